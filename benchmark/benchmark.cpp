@@ -0,0 +1,52 @@
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "TensorII/Instrumentation.h"
+
+using namespace TensorII::Core;
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+
+    // --tensorii_instrumentation_out=<prefix> writes <prefix>.json, <prefix>.trace.json and <prefix>.txt,
+    // --tensorii_hardware_counters adds perf_event counters to them,
+    // both only meaningful when built with TENSORII_INSTRUMENTATION
+    const std::string instrumentationFlag = "--tensorii_instrumentation_out=";
+    const std::string countersFlag = "--tensorii_hardware_counters";
+    std::string instrumentationOut;
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], instrumentationFlag.c_str(), instrumentationFlag.size()) == 0) {
+            instrumentationOut = argv[i] + instrumentationFlag.size();
+            argv[i--] = argv[--argc];
+        } else if (argv[i] == countersFlag) {
+            Instrumentation::setHardwareCounters(true);
+            argv[i--] = argv[--argc];
+        }
+    }
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+#ifdef TENSORII_INSTRUMENTATION
+    benchmark::AddCustomContext("tensorii_instrumentation", "enabled");
+#else
+    benchmark::AddCustomContext("tensorii_instrumentation", "disabled");
+#endif
+    benchmark::AddCustomContext("tensorii_hardware_counters",
+                                Instrumentation::PerfCounters::thisThread().available() ? "available" : "unavailable");
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    if (!instrumentationOut.empty()) {
+        std::ofstream statsFile {instrumentationOut + ".json"};
+        Instrumentation::writeJson(statsFile);
+        std::ofstream traceFile {instrumentationOut + ".trace.json"};
+        Instrumentation::writeChromeTrace(traceFile);
+        std::ofstream reportFile {instrumentationOut + ".txt"};
+        Instrumentation::writeReport(reportFile);
+    }
+    return 0;
+}
@@ -0,0 +1,115 @@
+# benchmark/compile/CompileTimeBenchmark.cmake
+#
+# Measures compiler frontend time for constexpr tensors built from nested braces, for increasing size and rank.
+# Run in script mode:
+#   cmake -DCXX_COMPILER=<c++> -DCXX_COMPILER_ID=<GNU|Clang|MSVC> -DINCLUDE_DIR=<src/core/include>
+#         -DOUTPUT_DIR=<dir> [-DREPEATS=3] -P CompileTimeBenchmark.cmake
+# Results are written to ${OUTPUT_DIR}/compile_benchmarks.json
+
+cmake_minimum_required(VERSION 3.25)
+
+foreach(var CXX_COMPILER CXX_COMPILER_ID INCLUDE_DIR OUTPUT_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} must be defined")
+    endif ()
+endforeach ()
+if(NOT DEFINED REPEATS)
+    set(REPEATS 3)
+endif ()
+
+# Shapes of increasing size, for each rank toTensor supports
+set(SHAPES
+        64 512 4096 32768
+        8x8 16x32 64x64 128x256
+        4x4x4 8x8x8 16x16x16 32x32x32
+        2x4x2x4 4x4x4x8 8x8x8x8 8x16x16x16
+        )
+
+if(CXX_COMPILER_ID STREQUAL MSVC)
+    set(FLAGS /std:c++20 /Zs /constexpr:steps100000000 /I${INCLUDE_DIR})
+else ()
+    set(FLAGS -std=c++20 -fsyntax-only -fconstexpr-ops-limit=1000000000 -I${INCLUDE_DIR})
+endif ()
+
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+# Builds the nested brace literal for the dimensions in 'dims', innermost rows counting up from 0
+function(nested_literal out dims)
+    list(POP_BACK dims last)
+    math(EXPR stop "${last} - 1")
+    set(values "")
+    foreach(i RANGE ${stop})
+        list(APPEND values ${i})
+    endforeach ()
+    list(JOIN values ", " row)
+    set(literal "{${row}}")
+    list(REVERSE dims)
+    foreach(dim IN LISTS dims)
+        string(REPEAT "${literal}, " ${dim} repeated)
+        string(REGEX REPLACE ", $" "" repeated "${repeated}")
+        set(literal "{${repeated}}")
+    endforeach ()
+    set(${out} "${literal}" PARENT_SCOPE)
+endfunction()
+
+# Best of REPEATS wall times, in microseconds, to compile 'source'
+function(time_compile out source)
+    set(best "")
+    foreach(repeat RANGE 1 ${REPEATS})
+        string(TIMESTAMP start "%s%f")
+        execute_process(COMMAND ${CXX_COMPILER} ${FLAGS} ${source}
+                RESULT_VARIABLE result
+                ERROR_VARIABLE errors)
+        string(TIMESTAMP stop "%s%f")
+        if(NOT result EQUAL 0)
+            message(FATAL_ERROR "Failed to compile ${source}:\n${errors}")
+        endif ()
+        math(EXPR elapsed "${stop} - ${start}")
+        if(best STREQUAL "" OR elapsed LESS best)
+            set(best ${elapsed})
+        endif ()
+    endforeach ()
+    set(${out} ${best} PARENT_SCOPE)
+endfunction()
+
+# Baseline: header parsing and instantiation cost of a single small tensor
+set(baseline_source ${OUTPUT_DIR}/baseline.cpp)
+file(WRITE ${baseline_source}
+        "#include \"TensorII/Tensor.h\"\n"
+        "using namespace TensorII::Core;\n"
+        "constexpr auto table = toTensor<int>({0, 1});\n")
+time_compile(baseline_us ${baseline_source})
+message(STATUS "baseline: ${baseline_us} us")
+
+set(results "")
+foreach(shape IN LISTS SHAPES)
+    string(REPLACE "x" ";" dims ${shape})
+    list(LENGTH dims rank)
+    set(elements 1)
+    foreach(dim IN LISTS dims)
+        math(EXPR elements "${elements} * ${dim}")
+    endforeach ()
+
+    nested_literal(literal "${dims}")
+    set(source ${OUTPUT_DIR}/table_${shape}.cpp)
+    file(WRITE ${source}
+            "#include \"TensorII/Tensor.h\"\n"
+            "using namespace TensorII::Core;\n"
+            "constexpr auto table = toTensor<int>(${literal});\n"
+            "static_assert(table.size() == ${elements});\n")
+
+    time_compile(total_us ${source})
+    math(EXPR frontend_us "${total_us} - ${baseline_us}")
+    math(EXPR ns_per_element "1000 * ${frontend_us} / ${elements}")
+    message(STATUS "${shape}: ${frontend_us} us above baseline, ${ns_per_element} ns/element")
+    list(APPEND results
+            "    {\"shape\": \"${shape}\", \"rank\": ${rank}, \"elements\": ${elements}, \"frontend_us\": ${frontend_us}, \"ns_per_element\": ${ns_per_element}}")
+endforeach ()
+
+list(JOIN results ",\n" results)
+file(WRITE ${OUTPUT_DIR}/compile_benchmarks.json
+        "{\n"
+        "  \"compiler\": \"${CXX_COMPILER_ID}\",\n"
+        "  \"baseline_us\": ${baseline_us},\n"
+        "  \"benchmarks\": [\n${results}\n  ]\n"
+        "}\n")
@@ -0,0 +1,74 @@
+#include <array>
+#include <memory>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/Async.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    inline constexpr Shape<1> Vector64K {65536};
+    inline constexpr std::size_t tensors = 16;
+
+    template <auto shape>
+    std::array<std::unique_ptr<Tensor<float, shape>>, tensors> makeTensors() {
+        std::array<std::unique_ptr<Tensor<float, shape>>, tensors> all;
+        for (auto& tensor : all) {
+            tensor = makeTensor<float, shape>();
+        }
+        return all;
+    }
+}
+
+// Sums of tensors too small to split across threads, one after the other
+template <auto shape>
+static void BM_SumsSequential(benchmark::State& state) {
+    auto all = makeTensors<shape>();
+    for (auto _ : state) {
+        float total = 0;
+        for (const auto& tensor : all) {
+            total += sum(*tensor);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * tensors * shape.n_elems() * sizeof(float)));
+    setRoofline(state, static_cast<double>(tensors * shape.n_elems()), static_cast<double>(tensors * shape.n_elems() * sizeof(float)));
+}
+
+// The same sums overlapped on the shared pool
+template <auto shape>
+static void BM_SumsAsync(benchmark::State& state) {
+    auto all = makeTensors<shape>();
+    for (auto _ : state) {
+        std::array<Future<float>, tensors> sums;
+        for (std::size_t i = 0; i < tensors; i++) {
+            sums[i] = sumAsync(*all[i]);
+        }
+        float total = 0;
+        for (const auto& partial : sums) {
+            total += partial.get();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * tensors * shape.n_elems() * sizeof(float)));
+    setRoofline(state, static_cast<double>(tensors * shape.n_elems()), static_cast<double>(tensors * shape.n_elems() * sizeof(float)));
+}
+
+// Cost of handing each link of a chain to the pool from the one before
+static void BM_AsyncChain(benchmark::State& state) {
+    for (auto _ : state) {
+        auto link = async([] { return 0; });
+        for (int i = 0; i < 64; i++) {
+            link = link.then([](int value) { return value + 1; });
+        }
+        benchmark::DoNotOptimize(link.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 65);
+    // Nothing but the additions, so the fraction is how little of the time the work itself takes
+    setRoofline(state, 64, 0);
+}
+
+BENCHMARK_TEMPLATE(BM_SumsSequential, Vector64K)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SumsAsync, Vector64K)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_AsyncChain)->Unit(benchmark::kMicrosecond)->UseRealTime();
@@ -0,0 +1,76 @@
+#ifndef TENSOR_BENCHMARKUTIL_H
+#define TENSOR_BENCHMARKUTIL_H
+
+#include <memory>
+#include <numeric>
+
+#include "benchmark/benchmark.h"
+#include "Roofline.h"
+#include "TensorII/Tensor.h"
+
+namespace TensorII::Benchmark {
+    using namespace TensorII::Core;
+
+    // Representative shapes, from a small matrix up to a full multispectral cube
+    namespace Shapes {
+        inline constexpr Shape<2> Mat3x3 {3, 3};
+        inline constexpr Shape<2> Mat64x64 {64, 64};
+        inline constexpr Shape<3> Cube256x256x16 {256, 256, 16};
+        inline constexpr Shape<3> Cube1kx1kx16 {1024, 1024, 16};
+        inline constexpr Shape<3> Cube4kx4kx16 {4096, 4096, 16};
+    }
+
+    // Registers a benchmark template for every representative shape. The 4096x4096x16 cube is 1 GiB of floats,
+    // and twice that for a move, so it's only registered when configured with TENSORII_BENCHMARK_LARGE_SHAPES.
+    #ifdef TENSORII_BENCHMARK_LARGE_SHAPES
+    #define BENCHMARK_LARGE_SHAPES(func, DType) \
+        BENCHMARK_TEMPLATE(func, DType, Shapes::Cube4kx4kx16)->Unit(benchmark::kMillisecond)
+    #else
+    #define BENCHMARK_LARGE_SHAPES(func, DType) static_assert(true)
+    #endif
+
+    #define BENCHMARK_ALL_SHAPES(func, DType) \
+        BENCHMARK_TEMPLATE(func, DType, Shapes::Mat3x3); \
+        BENCHMARK_TEMPLATE(func, DType, Shapes::Mat64x64); \
+        BENCHMARK_TEMPLATE(func, DType, Shapes::Cube256x256x16)->Unit(benchmark::kMicrosecond); \
+        BENCHMARK_TEMPLATE(func, DType, Shapes::Cube1kx1kx16)->Unit(benchmark::kMillisecond); \
+        BENCHMARK_LARGE_SHAPES(func, DType)
+
+    // Nested c-array type matching a shape, e.g. DType[2][3] for Shape{2, 3}
+    template <Scalar DType, auto shape, tensorRank axis = 0>
+    struct NestedArray {
+        using type = typename NestedArray<DType, shape, axis + 1>::type[shape[axis]];
+    };
+
+    template <Scalar DType, auto shape, tensorRank axis>
+    requires (axis == shape.rank())
+    struct NestedArray<DType, shape, axis> {
+        using type = DType;
+    };
+
+    // Tensors store their elements inline, so anything beyond a few KB has to live on the heap
+    template <Scalar DType, auto shape>
+    std::unique_ptr<Tensor<DType, shape>> makeTensor() {
+        auto tensor = std::make_unique<Tensor<DType, shape>>();
+        std::iota(tensor->data(), tensor->data() + tensor->size(), DType(0));
+        return tensor;
+    }
+
+    // Report throughput in elements and bytes, assuming each iteration touches every element once
+    template <Scalar DType, auto shape>
+    void setThroughput(benchmark::State& state, tensorSize bytesPerElement = sizeof(DType)) {
+        auto iterations = static_cast<int64_t>(state.iterations());
+        auto elements = static_cast<int64_t>(shape.n_elems());
+        state.SetItemsProcessed(iterations * elements);
+        state.SetBytesProcessed(iterations * elements * static_cast<int64_t>(bytesPerElement));
+    }
+
+    // Place a kernel on the host's roofline, from the flops it does and the bytes it reads and writes per element
+    template <Scalar DType, auto shape>
+    void setRoofline(benchmark::State& state, double flopsPerElement, double trafficBytesPerElement) {
+        auto elements = static_cast<double>(shape.n_elems());
+        setRoofline(state, flopsPerElement * elements, trafficBytesPerElement * elements);
+    }
+}
+
+#endif //TENSOR_BENCHMARKUTIL_H
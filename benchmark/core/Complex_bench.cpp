@@ -0,0 +1,157 @@
+#include <complex>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/Complex.h"
+#include "TensorII/Operations.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    inline constexpr Shape<1> Elements1M {1 << 20};
+
+    template <typename Real, auto shape>
+    std::unique_ptr<Tensor<std::complex<Real>, shape>> makeComplex() {
+        auto tensor = std::make_unique<Tensor<std::complex<Real>, shape>>();
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            tensor->data()[i] = {static_cast<Real>(i % 7) * Real(0.25), static_cast<Real>(i % 5) * Real(-0.5)};
+        }
+        return tensor;
+    }
+
+    template <typename Real, auto shape>
+    std::unique_ptr<SplitComplexTensor<Real, shape>> makeSplit() {
+        auto tensor = std::make_unique<SplitComplexTensor<Real, shape>>();
+        split(*makeComplex<Real, shape>(), *tensor);
+        return tensor;
+    }
+
+    // Complex products as std::complex writes them, checking each for infinities and NaNs
+    template <typename Real, auto shape>
+    void naiveMultiply(const Tensor<std::complex<Real>, shape>& lhs, const Tensor<std::complex<Real>, shape>& rhs,
+                       Tensor<std::complex<Real>, shape>& out) {
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            out.data()[i] = lhs.data()[i] * rhs.data()[i];
+        }
+    }
+}
+
+template <typename Real, auto shape>
+static void BM_ComplexMultiplyNaive(benchmark::State& state) {
+    auto a = makeComplex<Real, shape>(), b = makeComplex<Real, shape>(), out = makeComplex<Real, shape>();
+    for (auto _ : state) {
+        naiveMultiply(*a, *b, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<std::complex<Real>, shape>(state, 3 * sizeof(std::complex<Real>));
+    setRoofline<std::complex<Real>, shape>(state, 6, 3 * sizeof(std::complex<Real>));
+}
+
+template <typename Real, auto shape>
+static void BM_ComplexMultiplyInterleaved(benchmark::State& state) {
+    auto a = makeComplex<Real, shape>(), b = makeComplex<Real, shape>(), out = makeComplex<Real, shape>();
+    for (auto _ : state) {
+        multiply(*a, *b, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<std::complex<Real>, shape>(state, 3 * sizeof(std::complex<Real>));
+    setRoofline<std::complex<Real>, shape>(state, 6, 3 * sizeof(std::complex<Real>));
+}
+
+template <typename Real, auto shape>
+static void BM_ComplexMultiplySplit(benchmark::State& state) {
+    auto a = makeSplit<Real, shape>(), b = makeSplit<Real, shape>(), out = makeSplit<Real, shape>();
+    for (auto _ : state) {
+        multiply(*a, *b, *out);
+        benchmark::DoNotOptimize(out->real().data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<std::complex<Real>, shape>(state, 3 * sizeof(std::complex<Real>));
+    setRoofline<std::complex<Real>, shape>(state, 6, 3 * sizeof(std::complex<Real>));
+}
+
+template <typename Real, auto shape>
+static void BM_ComplexDotInterleaved(benchmark::State& state) {
+    auto a = makeComplex<Real, shape>(), b = makeComplex<Real, shape>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dot(*a, *b));
+    }
+    setThroughput<std::complex<Real>, shape>(state, 2 * sizeof(std::complex<Real>));
+    setRoofline<std::complex<Real>, shape>(state, 8, 2 * sizeof(std::complex<Real>));
+}
+
+template <typename Real, auto shape>
+static void BM_ComplexDotSplit(benchmark::State& state) {
+    auto a = makeSplit<Real, shape>(), b = makeSplit<Real, shape>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dot(*a, *b));
+    }
+    setThroughput<std::complex<Real>, shape>(state, 2 * sizeof(std::complex<Real>));
+    setRoofline<std::complex<Real>, shape>(state, 8, 2 * sizeof(std::complex<Real>));
+}
+
+template <typename Real, auto shape>
+static void BM_ComplexSumInterleaved(benchmark::State& state) {
+    auto a = makeComplex<Real, shape>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(*a));
+    }
+    setThroughput<std::complex<Real>, shape>(state);
+    setRoofline<std::complex<Real>, shape>(state, 2, sizeof(std::complex<Real>));
+}
+
+template <typename Real, auto shape>
+static void BM_ComplexSumSplit(benchmark::State& state) {
+    auto a = makeSplit<Real, shape>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(*a));
+    }
+    setThroughput<std::complex<Real>, shape>(state);
+    setRoofline<std::complex<Real>, shape>(state, 2, sizeof(std::complex<Real>));
+}
+
+// Square matrix product: row-major interleaved and split take the SIMD kernels, column-major the generic loop
+template <typename Real, typename Layout>
+static void BM_ComplexMatmulInterleaved(benchmark::State& state) {
+    auto lhs = std::make_unique<Tensor<std::complex<Real>, Shapes::Mat64x64, Layout>>();
+    auto rhs = std::make_unique<Tensor<std::complex<Real>, Shapes::Mat64x64, Layout>>();
+    auto out = std::make_unique<Tensor<std::complex<Real>, Shapes::Mat64x64, Layout>>();
+    for (auto _ : state) {
+        matmul(*lhs, *rhs, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    const auto n = static_cast<double>(Shapes::Mat64x64[0]);
+    setRoofline(state, 8 * n * n * n, 3 * n * n * sizeof(std::complex<Real>));
+}
+
+template <typename Real>
+static void BM_ComplexMatmulSplit(benchmark::State& state) {
+    auto lhs = std::make_unique<SplitComplexTensor<Real, Shapes::Mat64x64>>();
+    auto rhs = std::make_unique<SplitComplexTensor<Real, Shapes::Mat64x64>>();
+    auto out = std::make_unique<SplitComplexTensor<Real, Shapes::Mat64x64>>();
+    for (auto _ : state) {
+        matmul(*lhs, *rhs, *out);
+        benchmark::DoNotOptimize(out->real().data());
+        benchmark::ClobberMemory();
+    }
+    const auto n = static_cast<double>(Shapes::Mat64x64[0]);
+    setRoofline(state, 8 * n * n * n, 3 * n * n * sizeof(std::complex<Real>));
+}
+
+#define BENCHMARK_COMPLEX(Real) \
+    BENCHMARK_TEMPLATE(BM_ComplexMultiplyNaive, Real, Elements1M)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_ComplexMultiplyInterleaved, Real, Elements1M)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_ComplexMultiplySplit, Real, Elements1M)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_ComplexDotInterleaved, Real, Elements1M)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_ComplexDotSplit, Real, Elements1M)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_ComplexSumInterleaved, Real, Elements1M)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_ComplexSumSplit, Real, Elements1M)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_ComplexMatmulInterleaved, Real, ColumnMajor)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_ComplexMatmulInterleaved, Real, RowMajor)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_ComplexMatmulSplit, Real)->Unit(benchmark::kMicrosecond)
+
+BENCHMARK_COMPLEX(float);
+BENCHMARK_COMPLEX(double);
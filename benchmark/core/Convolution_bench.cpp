@@ -0,0 +1,112 @@
+#include "BenchmarkUtil.h"
+#include "TensorII/Convolution.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    // A convolution as it's usually written, an element and a band at a time, checking every tap against the
+    // edges of the image
+    template <auto shape, auto kernelShape>
+    void naiveConvolve(const Tensor<float, shape>& in, const Tensor<float, kernelShape>& kernel, Tensor<float, shape>& out) {
+        for (tensorIndex y = 0; y < shape[0]; y++) {
+            for (tensorIndex x = 0; x < shape[1]; x++) {
+                for (tensorIndex b = 0; b < shape[2]; b++) {
+                    float total = 0;
+                    for (tensorIndex i = 0; i < kernelShape[0]; i++) {
+                        for (tensorIndex j = 0; j < kernelShape[1]; j++) {
+                            const tensorIndex row = y + kernelShape[0] / 2 - i, column = x + kernelShape[1] / 2 - j;
+                            if (row >= 0 && row < shape[0] && column >= 0 && column < shape[1]) {
+                                total += kernel.at(i, j) * in.at(row, column, b);
+                            }
+                        }
+                    }
+                    out.at(y, x, b) = total;
+                }
+            }
+        }
+    }
+
+    template <tensorDimension size>
+    std::unique_ptr<Tensor<float, Shape<2>{size, size}>> boxKernel() {
+        auto kernel = std::make_unique<Tensor<float, Shape<2>{size, size}>>();
+        std::fill_n(kernel->data(), kernel->size(), 1.0f / static_cast<float>(size * size));
+        return kernel;
+    }
+
+    template <tensorDimension size>
+    std::unique_ptr<Tensor<float, Shape<1>{size}>> boxKernel1D() {
+        auto kernel = std::make_unique<Tensor<float, Shape<1>{size}>>();
+        std::fill_n(kernel->data(), kernel->size(), 1.0f / static_cast<float>(size));
+        return kernel;
+    }
+}
+
+template <tensorDimension size, auto shape>
+static void BM_ConvolveNaive(benchmark::State& state) {
+    auto in = makeTensor<float, shape>();
+    auto out = makeTensor<float, shape>();
+    auto kernel = boxKernel<size>();
+    for (auto _ : state) {
+        naiveConvolve(*in, *kernel, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<float, shape>(state, 2 * sizeof(float));
+    setRoofline<float, shape>(state, 2.0 * size * size, 2 * sizeof(float));
+}
+
+template <tensorDimension size, auto shape>
+static void BM_ConvolveDirect(benchmark::State& state) {
+    auto in = makeTensor<float, shape>();
+    auto out = makeTensor<float, shape>();
+    auto kernel = boxKernel<size>();
+    for (auto _ : state) {
+        convolve(*in, *kernel, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<float, shape>(state, 2 * sizeof(float));
+    setRoofline<float, shape>(state, 2.0 * size * size, 2 * sizeof(float));
+}
+
+template <tensorDimension size, auto shape>
+static void BM_ConvolveSeparable(benchmark::State& state) {
+    auto in = makeTensor<float, shape>();
+    auto out = makeTensor<float, shape>();
+    auto kernel = boxKernel1D<size>();
+    for (auto _ : state) {
+        convolveSeparable(*in, *kernel, *kernel, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<float, shape>(state, 2 * sizeof(float));
+    setRoofline<float, shape>(state, 4.0 * size, 2 * sizeof(float));
+}
+
+template <tensorDimension size, auto shape>
+static void BM_ConvolveFFT(benchmark::State& state) {
+    auto in = makeTensor<float, shape>();
+    auto out = makeTensor<float, shape>();
+    auto kernel = boxKernel<size>();
+    for (auto _ : state) {
+        convolveFFT(*in, *kernel, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<float, shape>(state, 2 * sizeof(float));
+}
+
+#define BENCHMARK_CONVOLUTIONS(size, shape) \
+    BENCHMARK_TEMPLATE(BM_ConvolveDirect, size, shape)->Unit(benchmark::kMillisecond)->UseRealTime(); \
+    BENCHMARK_TEMPLATE(BM_ConvolveSeparable, size, shape)->Unit(benchmark::kMillisecond)->UseRealTime(); \
+    BENCHMARK_TEMPLATE(BM_ConvolveFFT, size, shape)->Unit(benchmark::kMillisecond)->UseRealTime()
+
+BENCHMARK_TEMPLATE(BM_ConvolveNaive, 3, Shapes::Cube256x256x16)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConvolveNaive, 9, Shapes::Cube256x256x16)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CONVOLUTIONS(3, Shapes::Cube256x256x16);
+BENCHMARK_CONVOLUTIONS(9, Shapes::Cube256x256x16);
+BENCHMARK_CONVOLUTIONS(3, Shapes::Cube1kx1kx16);
+BENCHMARK_CONVOLUTIONS(9, Shapes::Cube1kx1kx16);
+BENCHMARK_CONVOLUTIONS(17, Shapes::Cube1kx1kx16);
+BENCHMARK_CONVOLUTIONS(33, Shapes::Cube1kx1kx16);
@@ -0,0 +1,56 @@
+#include "BenchmarkUtil.h"
+#include "TensorII/Einstein.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+using namespace TensorII::Core::Indices;
+
+// Cross product written out by hand, what index notation should compile to
+static void BM_CrossByHand(benchmark::State& state) {
+    Tensor<double, Shape{3}> a ({1, 2, 3});
+    Tensor<double, Shape{3}> b ({4, 5, 6});
+    Tensor<double, Shape{3}> c;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.data());
+        benchmark::DoNotOptimize(b.data());
+        c.data()[0] = a.data()[1] * b.data()[2] - a.data()[2] * b.data()[1];
+        c.data()[1] = a.data()[2] * b.data()[0] - a.data()[0] * b.data()[2];
+        c.data()[2] = a.data()[0] * b.data()[1] - a.data()[1] * b.data()[0];
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    // Six multiplies and three subtracts, two vectors in and one out
+    setRoofline(state, 9, 9 * sizeof(double));
+}
+
+static void BM_CrossByEpsilon(benchmark::State& state) {
+    Tensor<double, Shape{3}> a ({1, 2, 3});
+    Tensor<double, Shape{3}> b ({4, 5, 6});
+    Tensor<double, Shape{3}> c;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.data());
+        benchmark::DoNotOptimize(b.data());
+        c(i) = epsilon(i, j, k) * a(j) * b(k);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    setRoofline(state, 9, 9 * sizeof(double));
+}
+
+// 81 elements, of 729 combinations of indices only 36 are nonzero terms
+static void BM_EpsilonContraction(benchmark::State& state) {
+    Tensor<double, Shape{3, 3}> a ({{1, 2, 3}, {4, 5, 6}, {7, 8, 10}});
+    Tensor<double, Shape{3, 3, 3, 3}> out;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.data());
+        out(j, k, m, n) = epsilon(i, j, k) * epsilon(i, m, p) * a(p, n);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    // 36 of the products are nonzero, a multiply and an add each
+    setRoofline(state, 72, (9 + 81) * sizeof(double));
+}
+
+BENCHMARK(BM_CrossByHand);
+BENCHMARK(BM_CrossByEpsilon);
+BENCHMARK(BM_EpsilonContraction);
@@ -0,0 +1,69 @@
+#include <cmath>
+#include <complex>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/FFT.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    namespace Signals {
+        // A power of two, and the nearest length with factors of 3 and 5, along each axis
+        inline constexpr Shape<2> Rows1024 {256, 1024};
+        inline constexpr Shape<2> Rows960 {256, 960};
+        inline constexpr Shape<2> Columns1024 {1024, 256};
+        inline constexpr Shape<2> Columns960 {960, 256};
+    }
+
+    template <typename DType, auto shape>
+    std::unique_ptr<Tensor<DType, shape>> makeSignal() {
+        auto tensor = std::make_unique<Tensor<DType, shape>>();
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            tensor->data()[i] = static_cast<DType>(std::sin(0.01 * static_cast<double>(i)));
+        }
+        return tensor;
+    }
+
+    // The usual 5 n log2 n flops of a complex transform, as if it were radix 2
+    template <auto shape, tensorRank axis>
+    constexpr double flopsPerElement() {
+        return 5.0 * std::log2(static_cast<double>(shape[axis]));
+    }
+}
+
+template <tensorRank axis, auto shape>
+static void BM_FFT(benchmark::State& state) {
+    auto data = makeSignal<std::complex<float>, shape>();
+    for (auto _ : state) {
+        fft<axis>(*data);
+        benchmark::DoNotOptimize(data->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<std::complex<float>, shape>(state, 2 * sizeof(std::complex<float>));
+    setRoofline<std::complex<float>, shape>(state, flopsPerElement<shape, axis>(), 2 * sizeof(std::complex<float>));
+}
+
+template <tensorRank axis, auto shape>
+static void BM_RealFFT(benchmark::State& state) {
+    auto in = makeSignal<float, shape>();
+    auto out = std::make_unique<Tensor<std::complex<float>, halfSpectrum<shape, axis>>>();
+    for (auto _ : state) {
+        rfft<axis>(*in, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<float, shape>(state, sizeof(float) + sizeof(std::complex<float>) / 2);
+    setRoofline<float, shape>(state, flopsPerElement<shape, axis>() / 2, sizeof(float) + sizeof(std::complex<float>) / 2);
+}
+
+BENCHMARK_TEMPLATE(BM_FFT, 1, Signals::Rows1024)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_FFT, 1, Signals::Rows960)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_FFT, 0, Signals::Columns1024)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_FFT, 0, Signals::Columns960)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+// Real signals, against BM_FFT of the same signals stored as complex
+BENCHMARK_TEMPLATE(BM_RealFFT, 1, Signals::Rows1024)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RealFFT, 1, Signals::Rows960)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RealFFT, 0, Signals::Columns1024)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RealFFT, 0, Signals::Columns960)->Unit(benchmark::kMicrosecond)->UseRealTime();
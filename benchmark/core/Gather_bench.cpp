@@ -0,0 +1,128 @@
+#include <cstdint>
+#include <random>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/Gather.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    inline constexpr Shape<1> Field256K {1 << 18};
+    inline constexpr Shape<1> Values1M {1 << 20};
+    // Quadrilaterals of a 512 x 512 grid of nodes, four nodes each
+    inline constexpr Shape<2> Quads {511 * 511, 4};
+    inline constexpr Shape<1> Nodes {512 * 512};
+
+    template <typename Index, auto shape>
+    void randomIndices(Tensor<Index, shape>& indices, tensorSize fieldSize) {
+        std::mt19937 generator (1);
+        std::uniform_int_distribution<tensorSize> distribution (0, fieldSize - 1);
+        for (tensorSize i = 0; i < indices.size(); i++) {
+            indices.data()[i] = static_cast<Index>(distribution(generator));
+        }
+    }
+
+    template <auto shape>
+    void quadrilaterals(Tensor<std::int32_t, shape>& elements) {
+        for (tensorSize row = 0; row < 511; row++) {
+            for (tensorSize column = 0; column < 511; column++) {
+                const auto corner = static_cast<std::int32_t>(row * 512 + column);
+                const tensorSize element = row * 511 + column;
+                elements.at(element, 0) = corner;
+                elements.at(element, 1) = corner + 1;
+                elements.at(element, 2) = corner + 512;
+                elements.at(element, 3) = corner + 513;
+            }
+        }
+    }
+}
+
+// One load after another, as a plain indexed loop compiles to
+template <typename DType, typename Index, auto fieldShape, auto shape>
+static void BM_GatherScalar(benchmark::State& state) {
+    auto field = makeTensor<DType, fieldShape>();
+    auto indices = makeTensor<Index, shape>();
+    randomIndices(*indices, fieldShape.n_elems());
+    auto out = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            out->data()[i] = field->data()[indices->data()[i]];
+        }
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state, sizeof(Index) + 2 * sizeof(DType));
+    setRoofline<DType, shape>(state, 0, sizeof(Index) + 2 * sizeof(DType));
+}
+
+template <typename DType, typename Index, auto fieldShape, auto shape>
+static void BM_Gather(benchmark::State& state) {
+    auto field = makeTensor<DType, fieldShape>();
+    auto indices = makeTensor<Index, shape>();
+    randomIndices(*indices, fieldShape.n_elems());
+    auto out = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        gather(*field, *indices, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state, sizeof(Index) + 2 * sizeof(DType));
+    setRoofline<DType, shape>(state, 0, sizeof(Index) + 2 * sizeof(DType));
+}
+
+// Particle deposit: many values into random cells, by each strategy
+template <ScatterStrategy strategy>
+static void BM_ScatterAdd(benchmark::State& state) {
+    auto field = makeTensor<double, Field256K>();
+    auto indices = makeTensor<std::int32_t, Values1M>();
+    randomIndices(*indices, Field256K.n_elems());
+    auto values = makeTensor<double, Values1M>();
+    for (auto _ : state) {
+        scatterAdd(*field, *indices, *values, strategy);
+        benchmark::DoNotOptimize(field->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<double, Values1M>(state, sizeof(std::int32_t) + 3 * sizeof(double));
+    setRoofline<double, Values1M>(state, 1, sizeof(std::int32_t) + 3 * sizeof(double));
+}
+
+// Finite element assembly of one value per element node
+static void BM_ScatterAddAtomicAssembly(benchmark::State& state) {
+    auto nodes = makeTensor<double, Nodes>();
+    auto elements = makeTensor<std::int32_t, Quads>();
+    quadrilaterals(*elements);
+    auto values = makeTensor<double, Quads>();
+    for (auto _ : state) {
+        scatterAdd(*nodes, *elements, *values, ScatterStrategy::Atomic);
+        benchmark::DoNotOptimize(nodes->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<double, Quads>(state, sizeof(std::int32_t) + 3 * sizeof(double));
+    setRoofline<double, Quads>(state, 1, sizeof(std::int32_t) + 3 * sizeof(double));
+}
+
+static void BM_ScatterAddColouredAssembly(benchmark::State& state) {
+    auto nodes = makeTensor<double, Nodes>();
+    auto elements = makeTensor<std::int32_t, Quads>();
+    quadrilaterals(*elements);
+    auto values = makeTensor<double, Quads>();
+    const ScatterColouring colouring = colourScatter(*nodes, *elements);
+    for (auto _ : state) {
+        scatterAdd(*nodes, *elements, *values, colouring);
+        benchmark::DoNotOptimize(nodes->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<double, Quads>(state, sizeof(std::int32_t) + 3 * sizeof(double));
+    setRoofline<double, Quads>(state, 1, sizeof(std::int32_t) + 3 * sizeof(double));
+}
+
+BENCHMARK_TEMPLATE(BM_GatherScalar, float, std::int32_t, Field256K, Values1M)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Gather, float, std::int32_t, Field256K, Values1M)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_GatherScalar, double, std::int64_t, Field256K, Values1M)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Gather, double, std::int64_t, Field256K, Values1M)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ScatterAdd, ScatterStrategy::Serial)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ScatterAdd, ScatterStrategy::Privatised)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ScatterAdd, ScatterStrategy::Atomic)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_ScatterAddAtomicAssembly)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_ScatterAddColouredAssembly)->Unit(benchmark::kMicrosecond)->UseRealTime();
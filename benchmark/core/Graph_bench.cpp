@@ -0,0 +1,57 @@
+#include "BenchmarkUtil.h"
+#include "TensorII/Graph.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    inline constexpr Shape<3> Cube16M {64, 512, 512};
+
+    // Statement at a time, each rereading the cube or the intermediate before it
+    template <auto shape>
+    float eagerPipeline(const Tensor<float, shape>& in, Tensor<float, shape>& scaled, Tensor<float, shape>& mask) {
+        constexpr tensorSize n = shape.n_elems();
+        for (tensorSize i = 0; i < n; i++) {
+            scaled.data()[i] = in.data()[i] * 0.5f - 1.0f;
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            mask.data()[i] = scaled.data()[i] > 0.0f ? 1.0f : 0.0f;
+        }
+        float total = 0;
+        for (tensorSize i = 0; i < n; i++) {
+            total += scaled.data()[i] * mask.data()[i];
+        }
+        return total;
+    }
+}
+
+template <auto shape>
+static void BM_PipelineEager(benchmark::State& state) {
+    auto in = makeTensor<float, shape>();
+    auto scaled = makeTensor<float, shape>();
+    auto mask = makeTensor<float, shape>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(eagerPipeline(*in, *scaled, *mask));
+    }
+    setThroughput<float, shape>(state);
+    // Scale, compare, multiply and add; the intermediates are written once and read back three times
+    setRoofline<float, shape>(state, 5, 6 * sizeof(float));
+}
+
+// Normalise, mask and reduce fused into one read of the cube
+template <auto shape>
+static void BM_PipelineGraph(benchmark::State& state) {
+    auto in = makeTensor<float, shape>();
+    Graph<float, shape> graph;
+    auto scaled = graph.input(*in) * 0.5f - 1.0f;
+    auto total = graph.output(sum(scaled * greater(scaled, 0.0f)));
+    for (auto _ : state) {
+        graph.run();
+        benchmark::DoNotOptimize(graph.value(total));
+    }
+    setThroughput<float, shape>(state);
+    setRoofline<float, shape>(state, 5, sizeof(float));
+}
+
+BENCHMARK_TEMPLATE(BM_PipelineEager, Cube16M)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PipelineGraph, Cube16M)->Unit(benchmark::kMillisecond)->UseRealTime();
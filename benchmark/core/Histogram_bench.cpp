@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/Histogram.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    // A tile of 12-bit detector counts, bands last as read from a band-interleaved file
+    inline constexpr Shape<3> Tile {256, 256, 32};
+    inline constexpr tensorSize Bands = 32;
+    inline constexpr tensorSize Bins = 256;
+
+    template <auto shape>
+    void randomCounts(Tensor<std::uint16_t, shape>& tensor) {
+        std::mt19937 generator (1);
+        std::normal_distribution<double> distribution (2048, 400);
+        for (tensorSize i = 0; i < tensor.size(); i++) {
+            tensor.data()[i] = static_cast<std::uint16_t>(std::clamp(distribution(generator), 0.0, 4095.0));
+        }
+    }
+}
+
+// One shared histogram on one thread, band by the remainder of each offset, as a plain loop would
+static void BM_HistogramByHand(benchmark::State& state) {
+    auto tile = makeTensor<std::uint16_t, Tile>();
+    randomCounts(*tile);
+    std::vector<std::uint64_t> counts (Bands * Bins);
+    for (auto _ : state) {
+        for (tensorSize i = 0; i < Tile.n_elems(); i++) {
+            const double position = static_cast<double>(tile->data()[i]) * (Bins / 4096.0);
+            counts[i % Bands * Bins + static_cast<tensorSize>(position)]++;
+        }
+        benchmark::DoNotOptimize(counts.data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<std::uint16_t, Tile>(state);
+    // Scaled into a bin and counted, with the counts staying in cache
+    setRoofline<std::uint16_t, Tile>(state, 2, sizeof(std::uint16_t));
+}
+
+static void BM_HistogramFixed(benchmark::State& state) {
+    auto tile = makeTensor<std::uint16_t, Tile>();
+    randomCounts(*tile);
+    Histogram<std::uint16_t, 2, Bands> histogram (Bins, 0, 4096);
+    for (auto _ : state) {
+        histogram.add(*tile);
+        benchmark::DoNotOptimize(&histogram);
+    }
+    setThroughput<std::uint16_t, Tile>(state);
+    // Scaled into a bin and counted, with the counts staying in cache
+    setRoofline<std::uint16_t, Tile>(state, 2, sizeof(std::uint16_t));
+}
+
+static void BM_HistogramAdaptive(benchmark::State& state) {
+    auto tile = makeTensor<std::uint16_t, Tile>();
+    randomCounts(*tile);
+    Histogram<std::uint16_t, 2, Bands> histogram (Bins);
+    for (auto _ : state) {
+        histogram.add(*tile);
+        benchmark::DoNotOptimize(&histogram);
+    }
+    setThroughput<std::uint16_t, Tile>(state);
+    // Scaled into a bin and counted, with the counts staying in cache
+    setRoofline<std::uint16_t, Tile>(state, 2, sizeof(std::uint16_t));
+}
+
+// 2% and 98% of every band, as for a contrast stretch
+static void BM_HistogramQuantiles(benchmark::State& state) {
+    auto tile = makeTensor<std::uint16_t, Tile>();
+    randomCounts(*tile);
+    Histogram<std::uint16_t, 2, Bands> histogram (Bins, 0, 4096);
+    histogram.add(*tile);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(histogram.quantiles(0.02));
+        benchmark::DoNotOptimize(histogram.quantiles(0.98));
+    }
+    // Each quantile walks the running count of every bin of every band
+    setRoofline(state, 2.0 * Bands * Bins, 2.0 * Bands * Bins * sizeof(std::uint64_t));
+}
+
+BENCHMARK(BM_HistogramByHand)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_HistogramFixed)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_HistogramAdaptive)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_HistogramQuantiles)->Unit(benchmark::kMicrosecond);
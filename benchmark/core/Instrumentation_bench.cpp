@@ -0,0 +1,36 @@
+#include "BenchmarkUtil.h"
+#include "TensorII/Instrumentation.h"
+#include "TensorII/PerfCounters.h"
+
+using namespace TensorII::Core;
+
+// Baseline for BM_InstrumentedScope, with instrumentation disabled the two must match
+static void BM_EmptyScope(benchmark::State& state) {
+    tensorSize elements = 0;
+    for (auto _ : state) {
+        elements++;
+        benchmark::DoNotOptimize(elements);
+    }
+}
+
+static void BM_InstrumentedScope(benchmark::State& state) {
+    tensorSize elements = 0;
+    for (auto _ : state) {
+        TENSORII_INSTRUMENT_OP("BM_InstrumentedScope", Elementwise, elements, elements);
+        elements++;
+        benchmark::DoNotOptimize(elements);
+    }
+}
+
+// Cost of one counter read, paid twice per op when hardware counters are enabled
+static void BM_PerfCountersRead(benchmark::State& state) {
+    const Instrumentation::PerfCounters& counters = Instrumentation::PerfCounters::thisThread();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(counters.read());
+    }
+    state.SetLabel(counters.available() ? "available" : "unavailable");
+}
+
+BENCHMARK(BM_EmptyScope);
+BENCHMARK(BM_InstrumentedScope);
+BENCHMARK(BM_PerfCountersRead);
@@ -0,0 +1,85 @@
+#include "BenchmarkUtil.h"
+#include "TensorII/Operations.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    namespace Matrices {
+        inline constexpr Shape<2> Mat64x64 {64, 64};
+        inline constexpr Shape<2> Mat1kx1k {1024, 1024};
+        inline constexpr Shape<2> Mat4kx4k {4096, 4096};
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    std::unique_ptr<Tensor<DType, shape, Layout>> makeLaidOut() {
+        auto tensor = std::make_unique<Tensor<DType, shape, Layout>>();
+        std::iota(tensor->data(), tensor->data() + tensor->size(), DType(0));
+        return tensor;
+    }
+}
+
+#define BENCHMARK_MATRICES(func, ...) \
+    BENCHMARK_TEMPLATE(func, __VA_ARGS__, Matrices::Mat64x64); \
+    BENCHMARK_TEMPLATE(func, __VA_ARGS__, Matrices::Mat1kx1k)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(func, __VA_ARGS__, Matrices::Mat4kx4k)->Unit(benchmark::kMillisecond)
+
+template <TensorLayout From, TensorLayout To, auto shape>
+static void BM_Relayout(benchmark::State& state) {
+    auto in = makeLaidOut<float, shape, From>();
+    auto out = makeLaidOut<float, shape, To>();
+    for (auto _ : state) {
+        relayout(*in, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<float, shape>(state, 2 * sizeof(float));
+    setRoofline<float, shape>(state, 0, 2 * sizeof(float));
+}
+
+// Baseline for BM_Relayout, element by element in row-major order
+template <TensorLayout From, TensorLayout To, auto shape>
+static void BM_RelayoutNaive(benchmark::State& state) {
+    auto in = makeLaidOut<float, shape, From>();
+    auto out = makeLaidOut<float, shape, To>();
+    for (auto _ : state) {
+        for (tensorSize i = 0; i < static_cast<tensorSize>(shape[0]); i++) {
+            for (tensorSize j = 0; j < static_cast<tensorSize>(shape[1]); j++) {
+                out->at(i, j) = in->at(i, j);
+            }
+        }
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<float, shape>(state, 2 * sizeof(float));
+    setRoofline<float, shape>(state, 0, 2 * sizeof(float));
+}
+
+// Walks down columns, which only column-major (and to a degree tiled) storage keeps local
+template <TensorLayout Layout, auto shape>
+static void BM_ColumnSums(benchmark::State& state) {
+    auto tensor = makeLaidOut<float, shape, Layout>();
+    for (auto _ : state) {
+        float total = 0;
+        for (tensorSize j = 0; j < static_cast<tensorSize>(shape[1]); j++) {
+            float column = 0;
+            for (tensorSize i = 0; i < static_cast<tensorSize>(shape[0]); i++) {
+                column += tensor->at(i, j);
+            }
+            total += column;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    setThroughput<float, shape>(state);
+    setRoofline<float, shape>(state, 1, sizeof(float));
+}
+
+BENCHMARK_MATRICES(BM_Relayout, RowMajor, ColumnMajor);
+BENCHMARK_MATRICES(BM_RelayoutNaive, RowMajor, ColumnMajor);
+BENCHMARK_MATRICES(BM_Relayout, RowMajor, Tiled<16, 16>);
+BENCHMARK_MATRICES(BM_RelayoutNaive, RowMajor, Tiled<16, 16>);
+BENCHMARK_MATRICES(BM_Relayout, Tiled<16, 16>, ColumnMajor);
+
+BENCHMARK_MATRICES(BM_ColumnSums, RowMajor);
+BENCHMARK_MATRICES(BM_ColumnSums, ColumnMajor);
+BENCHMARK_MATRICES(BM_ColumnSums, Tiled<16, 16>);
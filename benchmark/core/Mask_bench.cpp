@@ -0,0 +1,108 @@
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/Mask.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    inline constexpr Shape<2> Scene1K {1024, 1024};
+
+    // A third of the pixels invalid at random, the worst case for a branch on each
+    template <auto shape>
+    std::vector<bool> randomValid() {
+        std::mt19937 generator (1);
+        std::bernoulli_distribution valid (2.0 / 3);
+        std::vector<bool> bits (shape.n_elems());
+        for (tensorSize i = 0; i < bits.size(); i++) {
+            bits[i] = valid(generator);
+        }
+        return bits;
+    }
+
+    template <auto shape>
+    std::unique_ptr<Mask<shape>> packed(const std::vector<bool>& bits) {
+        auto mask = std::make_unique<Mask<shape>>();
+        for (tensorSize i = 0; i < bits.size(); i++) {
+            mask->set(i, bits[i]);
+        }
+        return mask;
+    }
+}
+
+// A byte per pixel and a branch per pixel
+template <typename DType, auto shape>
+static void BM_MaskedSumBranching(benchmark::State& state) {
+    auto in = makeTensor<DType, shape>();
+    const std::vector<bool> bits = randomValid<shape>();
+    const std::vector<unsigned char> valid (bits.begin(), bits.end());
+    for (auto _ : state) {
+        DType total = 0;
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            if (valid[i]) {
+                total += in->data()[i];
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    setThroughput<DType, shape>(state, sizeof(DType) + 1);
+    setRoofline<DType, shape>(state, 1, sizeof(DType) + 1);
+}
+
+template <typename DType, auto shape>
+static void BM_MaskedSum(benchmark::State& state) {
+    auto in = makeTensor<DType, shape>();
+    const auto valid = packed<shape>(randomValid<shape>());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(*in, *valid));
+    }
+    setThroughput<DType, shape>(state, sizeof(DType));
+    // A bit of mask per element
+    setRoofline<DType, shape>(state, 1, sizeof(DType) + 0.125);
+}
+
+template <typename DType, auto shape>
+static void BM_WhereBranching(benchmark::State& state) {
+    auto in = makeTensor<DType, shape>();
+    auto fallback = makeTensor<DType, shape>();
+    auto out = makeTensor<DType, shape>();
+    const std::vector<bool> bits = randomValid<shape>();
+    const std::vector<unsigned char> valid (bits.begin(), bits.end());
+    for (auto _ : state) {
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            if (valid[i]) {
+                out->data()[i] = in->data()[i];
+            } else {
+                out->data()[i] = fallback->data()[i];
+            }
+        }
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state, 3 * sizeof(DType) + 1);
+    setRoofline<DType, shape>(state, 0, 3 * sizeof(DType) + 1);
+}
+
+template <typename DType, auto shape>
+static void BM_Where(benchmark::State& state) {
+    auto in = makeTensor<DType, shape>();
+    auto fallback = makeTensor<DType, shape>();
+    auto out = makeTensor<DType, shape>();
+    const auto valid = packed<shape>(randomValid<shape>());
+    for (auto _ : state) {
+        where(*valid, *in, *fallback, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state, 3 * sizeof(DType));
+    setRoofline<DType, shape>(state, 0, 3 * sizeof(DType) + 0.125);
+}
+
+BENCHMARK_TEMPLATE(BM_MaskedSumBranching, float, Scene1K)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MaskedSum, float, Scene1K)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_WhereBranching, float, Scene1K)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Where, float, Scene1K)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Where, double, Scene1K)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,191 @@
+#include <random>
+#include <vector>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/Operations.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    namespace Grids {
+        inline constexpr Shape<2> Grid1k {1024, 1024};
+        inline constexpr Shape<2> Grid4k {4096, 4096};
+        inline constexpr Shape<3> Grid128 {128, 128, 128};
+        inline constexpr Shape<3> Grid256 {256, 256, 256};
+    }
+
+    using SquareTiles = Tiled<16, 16>;
+    using CubeTiles = Tiled<8, 8, 8>;
+
+    constexpr tensorSize queries = 1 << 16;
+
+    template <auto shape, TensorLayout Layout>
+    std::unique_ptr<Tensor<float, shape, Layout>> makeGrid() {
+        auto tensor = std::make_unique<Tensor<float, shape, Layout>>();
+        std::iota(tensor->data(), tensor->data() + tensor->size(), 0.0f);
+        return tensor;
+    }
+
+    // Centres of the queries, either scattered uniformly or a random walk from one neighbour to the next
+    template <auto shape>
+    std::vector<std::array<tensorSize, shape.rank()>> makeCentres(bool walk) {
+        std::mt19937_64 generator (42);
+        std::vector<std::array<tensorSize, shape.rank()>> centres (queries);
+        std::array<tensorSize, shape.rank()> position {};
+        for (auto& centre : centres) {
+            for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+                const auto extent = static_cast<tensorSize>(shape[axis]);
+                position[axis] = walk ? (position[axis] + extent - 1 + generator() % 3) % extent : generator() % extent;
+            }
+            centre = position;
+        }
+        return centres;
+    }
+
+    // Sum of an element and its 2 * rank neighbours, wrapping at the edges
+    template <auto shape, TensorLayout Layout>
+    float neighbourhood(const Tensor<float, shape, Layout>& grid, std::array<tensorSize, shape.rank()> index) {
+        float total = grid.data()[Layout::template offset<shape>(index)];
+        for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+            const auto mask = static_cast<tensorSize>(shape[axis]) - 1;
+            const tensorSize centre = index[axis];
+            index[axis] = (centre + 1) & mask;
+            total += grid.data()[Layout::template offset<shape>(index)];
+            index[axis] = (centre - 1) & mask;
+            total += grid.data()[Layout::template offset<shape>(index)];
+            index[axis] = centre;
+        }
+        return total;
+    }
+}
+
+template <TensorLayout Layout, auto shape, bool walk>
+static void BM_Neighbourhoods(benchmark::State& state) {
+    auto grid = makeGrid<shape, Layout>();
+    const auto centres = makeCentres<shape>(walk);
+    for (auto _ : state) {
+        float total = 0;
+        for (const auto& centre : centres) {
+            total += neighbourhood(*grid, centre);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries));
+}
+
+// Morton neighbours found by stepping the centre's offset, without encoding each of them
+template <auto shape, bool walk>
+static void BM_NeighbourhoodsMortonStep(benchmark::State& state) {
+    auto grid = makeGrid<shape, Morton>();
+    const auto centres = makeCentres<shape>(walk);
+    for (auto _ : state) {
+        float total = 0;
+        for (const auto& centre : centres) {
+            const tensorSize offset = Morton::offset<shape>(centre);
+            total += grid->data()[offset];
+            for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+                total += grid->data()[Morton::neighbour<shape>(offset, axis, 1)];
+                total += grid->data()[Morton::neighbour<shape>(offset, axis, -1)];
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries));
+}
+
+template <auto shape>
+static void BM_EncodeMorton(benchmark::State& state) {
+    const auto centres = makeCentres<shape>(false);
+    for (auto _ : state) {
+        tensorSize total = 0;
+        for (const auto& centre : centres) {
+            total += Morton::offset<shape>(centre);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries));
+}
+
+template <auto shape>
+static void BM_DecodeMorton(benchmark::State& state) {
+    for (auto _ : state) {
+        tensorSize total = 0;
+        for (tensorSize offset = 0; offset < queries; offset++) {
+            total += Morton::indexOf<shape>(offset * 7919 % shape.n_elems())[0];
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries));
+}
+
+// Visits every element with its index, in storage order...
+template <auto shape>
+static void BM_MortonForEachStored(benchmark::State& state) {
+    auto grid = makeGrid<shape, Morton>();
+    for (auto _ : state) {
+        float total = 0;
+        grid->forEachStored([&](float element, const auto& index) {
+            total += element * static_cast<float>(index[0]);
+        });
+        benchmark::DoNotOptimize(total);
+    }
+    setThroughput<float, shape>(state);
+}
+
+// ...and decoding each offset
+template <auto shape>
+static void BM_MortonDecodeEach(benchmark::State& state) {
+    auto grid = makeGrid<shape, Morton>();
+    for (auto _ : state) {
+        float total = 0;
+        for (tensorSize offset = 0; offset < shape.n_elems(); offset++) {
+            total += grid->data()[offset] * static_cast<float>(Morton::indexOf<shape>(offset)[0]);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    setThroughput<float, shape>(state);
+}
+
+template <TensorLayout From, TensorLayout To, auto shape>
+static void BM_RelayoutMorton(benchmark::State& state) {
+    auto in = makeGrid<shape, From>();
+    auto out = makeGrid<shape, To>();
+    for (auto _ : state) {
+        relayout(*in, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<float, shape>(state, 2 * sizeof(float));
+    setRoofline<float, shape>(state, 0, 2 * sizeof(float));
+}
+
+#define BENCHMARK_NEIGHBOURHOODS(shape, tiles) \
+    BENCHMARK_TEMPLATE(BM_Neighbourhoods, RowMajor, shape, false)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_Neighbourhoods, tiles, shape, false)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_Neighbourhoods, Morton, shape, false)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_NeighbourhoodsMortonStep, shape, false)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_Neighbourhoods, RowMajor, shape, true)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_Neighbourhoods, tiles, shape, true)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_Neighbourhoods, Morton, shape, true)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(BM_NeighbourhoodsMortonStep, shape, true)->Unit(benchmark::kMicrosecond)
+
+BENCHMARK_NEIGHBOURHOODS(Grids::Grid1k, SquareTiles);
+BENCHMARK_NEIGHBOURHOODS(Grids::Grid4k, SquareTiles);
+BENCHMARK_NEIGHBOURHOODS(Grids::Grid128, CubeTiles);
+BENCHMARK_NEIGHBOURHOODS(Grids::Grid256, CubeTiles);
+
+BENCHMARK_TEMPLATE(BM_EncodeMorton, Grids::Grid4k)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_EncodeMorton, Grids::Grid256)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_DecodeMorton, Grids::Grid4k)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_DecodeMorton, Grids::Grid256)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MortonForEachStored, Grids::Grid1k)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MortonDecodeEach, Grids::Grid1k)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MortonForEachStored, Grids::Grid128)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_MortonDecodeEach, Grids::Grid128)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_RelayoutMorton, RowMajor, Morton, Grids::Grid1k)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_RelayoutMorton, Morton, RowMajor, Grids::Grid1k)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_RelayoutMorton, RowMajor, Morton, Grids::Grid4k)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_RelayoutMorton, RowMajor, Morton, Grids::Grid256)->Unit(benchmark::kMillisecond);
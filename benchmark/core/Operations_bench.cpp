@@ -0,0 +1,106 @@
+#include <memory>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/Operations.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+// DType -> float
+template <Scalar DType, auto shape>
+static void BM_Widen(benchmark::State& state) {
+    auto in = makeTensor<DType, shape>();
+    auto out = makeTensor<float, shape>();
+    for (auto _ : state) {
+        convert(*in, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state);
+    setRoofline<DType, shape>(state, 0, sizeof(DType) + sizeof(float));
+}
+
+// float -> DType
+template <Scalar DType, auto shape>
+static void BM_Narrow(benchmark::State& state) {
+    auto in = makeTensor<float, shape>();
+    auto out = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        convert(*in, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state);
+    setRoofline<DType, shape>(state, 0, sizeof(float) + sizeof(DType));
+}
+
+template <Scalar DType, auto shape>
+static void BM_Add(benchmark::State& state) {
+    auto lhs = makeTensor<DType, shape>();
+    auto rhs = makeTensor<DType, shape>();
+    auto out = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        add(*lhs, *rhs, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state, 3 * sizeof(DType));
+    setRoofline<DType, shape>(state, 1, 3 * sizeof(DType));
+}
+
+template <Scalar DType, auto shape>
+static void BM_Sum(benchmark::State& state) {
+    auto tensor = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(*tensor));
+    }
+    setThroughput<DType, shape>(state);
+    setRoofline<DType, shape>(state, 1, sizeof(DType));
+}
+
+template <Scalar DType, auto shape>
+static void BM_Dot(benchmark::State& state) {
+    auto lhs = makeTensor<DType, shape>();
+    auto rhs = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dot(*lhs, *rhs));
+    }
+    setThroughput<DType, shape>(state, 2 * sizeof(DType));
+    setRoofline<DType, shape>(state, 2, 2 * sizeof(DType));
+}
+
+// Square matrix product: row-major takes the SIMD kernel, column-major the loop constant evaluation uses
+template <TensorLayout Layout, auto shape>
+static void BM_Matmul(benchmark::State& state) {
+    auto lhs = std::make_unique<Tensor<float, shape, Layout>>();
+    auto rhs = std::make_unique<Tensor<float, shape, Layout>>();
+    auto out = std::make_unique<Tensor<float, shape, Layout>>();
+    for (auto _ : state) {
+        matmul(*lhs, *rhs, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    const auto n = static_cast<double>(shape[0]);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * shape.n_elems()));
+    setRoofline(state, 2 * n * n * n, 3 * n * n * sizeof(float));
+}
+
+BENCHMARK_ALL_SHAPES(BM_Widen, float16);
+BENCHMARK_ALL_SHAPES(BM_Widen, bfloat16);
+BENCHMARK_ALL_SHAPES(BM_Narrow, float16);
+BENCHMARK_ALL_SHAPES(BM_Narrow, bfloat16);
+
+// fp32 baselines for the 16-bit kernels, which should approach half the time on bandwidth bound shapes
+BENCHMARK_ALL_SHAPES(BM_Add, float);
+BENCHMARK_ALL_SHAPES(BM_Add, float16);
+BENCHMARK_ALL_SHAPES(BM_Add, bfloat16);
+BENCHMARK_ALL_SHAPES(BM_Sum, float);
+BENCHMARK_ALL_SHAPES(BM_Sum, float16);
+BENCHMARK_ALL_SHAPES(BM_Sum, bfloat16);
+BENCHMARK_ALL_SHAPES(BM_Dot, float);
+BENCHMARK_ALL_SHAPES(BM_Dot, float16);
+BENCHMARK_ALL_SHAPES(BM_Dot, bfloat16);
+BENCHMARK_TEMPLATE(BM_Matmul, RowMajor, Shapes::Mat3x3);
+BENCHMARK_TEMPLATE(BM_Matmul, ColumnMajor, Shapes::Mat3x3);
+BENCHMARK_TEMPLATE(BM_Matmul, RowMajor, Shapes::Mat64x64);
+BENCHMARK_TEMPLATE(BM_Matmul, ColumnMajor, Shapes::Mat64x64);
@@ -0,0 +1,76 @@
+#include <cstdint>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/Pipeline.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    inline constexpr Shape<3> Frame512x512x4 {512, 512, 4};
+    inline constexpr int frames = 32;
+
+    template <auto shape>
+    void scale(const Tensor<std::uint16_t, shape>& in, Tensor<float, shape>& out) {
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            out.data()[i] = 0.25f * in.data()[i];
+        }
+    }
+
+    template <auto shape>
+    StageTask produce(FramePool<Tensor<std::uint16_t, shape>>& pool, Channel<Frame<Tensor<std::uint16_t, shape>>>& out) {
+        for (int i = 0; i < frames; i++) {
+            auto frame = co_await pool.acquire();
+            frame->data()[0] = static_cast<std::uint16_t>(i);
+            if (!co_await out.push(std::move(frame))) {
+                break;
+            }
+        }
+        out.close();
+    }
+}
+
+// Read, scale and reduce each frame in turn on the calling thread
+template <auto shape>
+static void BM_FramesSequential(benchmark::State& state) {
+    auto raw = makeTensor<std::uint16_t, shape>();
+    auto scaled = makeTensor<float, shape>();
+    for (auto _ : state) {
+        float total = 0;
+        for (int i = 0; i < frames; i++) {
+            raw->data()[0] = static_cast<std::uint16_t>(i);
+            scale(*raw, *scaled);
+            total += scaled->data()[0];
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * frames);
+    setRoofline(state, static_cast<double>(frames * shape.n_elems()),
+                static_cast<double>(frames * shape.n_elems() * (sizeof(std::uint16_t) + sizeof(float))));
+}
+
+// The same three steps as pipeline stages on the shared pool, double-buffered between stages
+template <auto shape>
+static void BM_FramesPipeline(benchmark::State& state) {
+    using Raw = Tensor<std::uint16_t, shape>;
+    using Scaled = Tensor<float, shape>;
+    FramePool<Raw> rawFrames (2);
+    FramePool<Scaled> scaledFrames (2);
+    for (auto _ : state) {
+        Channel<Frame<Raw>> raw (2);
+        Channel<Frame<Scaled>> scaled (2);
+        float total = 0;
+        Pipeline pipeline;
+        pipeline.add(produce<shape>(rawFrames, raw));
+        pipeline.add(transform(raw, scaled, scaledFrames, scale<shape>));
+        pipeline.add(consume(scaled, [&total](const Frame<Scaled>& frame) { total += frame->data()[0]; }));
+        pipeline.wait();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * frames);
+    setRoofline(state, static_cast<double>(frames * shape.n_elems()),
+                static_cast<double>(frames * shape.n_elems() * (sizeof(std::uint16_t) + sizeof(float))));
+}
+
+BENCHMARK_TEMPLATE(BM_FramesSequential, Frame512x512x4)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_FramesPipeline, Frame512x512x4)->Unit(benchmark::kMillisecond)->UseRealTime();
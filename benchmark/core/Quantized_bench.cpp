@@ -0,0 +1,74 @@
+#include "BenchmarkUtil.h"
+#include "TensorII/Operations.h"
+#include "TensorII/Quantized.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    template <QuantizedStorage Stored, auto shape, tensorRank axis = perTensor>
+    std::unique_ptr<QuantizedTensor<Stored, shape, axis>> makeQuantized() {
+        auto tensor = std::make_unique<QuantizedTensor<Stored, shape, axis>>();
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            tensor->values().data()[i] = static_cast<Stored>(i);
+        }
+        return tensor;
+    }
+}
+
+// Compare against BM_Sum and BM_Dot on float, which read 2 or 4 times the bytes
+template <QuantizedStorage Stored, auto shape>
+static void BM_QuantizedSum(benchmark::State& state) {
+    auto tensor = makeQuantized<Stored, shape>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(*tensor));
+    }
+    setThroughput<Stored, shape>(state);
+    setRoofline<Stored, shape>(state, 1, sizeof(Stored));
+}
+
+template <QuantizedStorage Stored, auto shape>
+static void BM_QuantizedDot(benchmark::State& state) {
+    auto lhs = makeQuantized<Stored, shape>();
+    auto rhs = makeQuantized<Stored, shape>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dot(*lhs, *rhs));
+    }
+    setThroughput<Stored, shape>(state, 2 * sizeof(Stored));
+    setRoofline<Stored, shape>(state, 2, 2 * sizeof(Stored));
+}
+
+// Calibrated total of raw uint16 counts with a gain and offset per band, on the counts directly...
+template <auto shape>
+static void BM_BandSumQuantized(benchmark::State& state) {
+    auto counts = makeQuantized<uint16_t, shape, shape.rank() - 1>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum(*counts));
+    }
+    setThroughput<uint16_t, shape>(state);
+    setRoofline<uint16_t, shape>(state, 1, sizeof(uint16_t));
+}
+
+// ...and by calibrating to float first
+template <auto shape>
+static void BM_BandSumDequantized(benchmark::State& state) {
+    auto counts = makeQuantized<uint16_t, shape, shape.rank() - 1>();
+    auto calibrated = makeTensor<float, shape>();
+    for (auto _ : state) {
+        dequantize(*counts, *calibrated);
+        benchmark::DoNotOptimize(sum(*calibrated));
+    }
+    setThroughput<uint16_t, shape>(state, sizeof(uint16_t) + 2 * sizeof(float));
+    setRoofline<uint16_t, shape>(state, 3, sizeof(uint16_t) + 2 * sizeof(float));
+}
+
+BENCHMARK_ALL_SHAPES(BM_QuantizedSum, int8_t);
+BENCHMARK_ALL_SHAPES(BM_QuantizedSum, uint16_t);
+BENCHMARK_ALL_SHAPES(BM_QuantizedDot, int8_t);
+BENCHMARK_ALL_SHAPES(BM_QuantizedDot, uint8_t);
+BENCHMARK_ALL_SHAPES(BM_QuantizedDot, uint16_t);
+
+BENCHMARK_TEMPLATE(BM_BandSumQuantized, Shapes::Cube256x256x16)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_BandSumQuantized, Shapes::Cube1kx1kx16)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_BandSumDequantized, Shapes::Cube256x256x16)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_BandSumDequantized, Shapes::Cube1kx1kx16)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/Resample.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    // Coarse bands brought up to twice the resolution
+    inline constexpr tensorSize Size = 512;
+    inline constexpr tensorSize Bands = 8;
+    inline constexpr Shape<3> Coarse {static_cast<tensorDimension>(Size), static_cast<tensorDimension>(Size), static_cast<tensorDimension>(Bands)};
+    inline constexpr Shape<3> Fine {Coarse[0] * 2, Coarse[1] * 2, Coarse[2]};
+    inline constexpr Shape<3> Map {Fine[0], Fine[1], 2};
+
+    // Per output element: bilinear lerps twice along a row and once between rows, bicubic weights four taps along
+    // each of four rows and then the four rows
+    template <Interpolation interpolation>
+    constexpr double flopsPerElement() {
+        switch (interpolation) {
+            case Interpolation::Nearest: return 0;
+            case Interpolation::Bilinear: return 9;
+            case Interpolation::Bicubic: return 40;
+        }
+        return 0;
+    }
+
+    // Each coarse element is read for four fine ones, and the map's two coordinates are shared by every band
+    inline constexpr double resizeBytes = sizeof(float) * (1 + 0.25);
+    inline constexpr double warpBytes = resizeBytes + 2.0 * sizeof(float) / Bands;
+
+    // Turned a few degrees about the centre, as a co-registration would
+    std::unique_ptr<Tensor<float, Map>> rotation() {
+        auto map = std::make_unique<Tensor<float, Map>>();
+        const double angle = 0.05;
+        const double centre = Size / 2.0;
+        for (tensorSize row = 0; row < 2 * Size; row++) {
+            for (tensorSize column = 0; column < 2 * Size; column++) {
+                const double y = static_cast<double>(row) / 2 - centre;
+                const double x = static_cast<double>(column) / 2 - centre;
+                map->at(row, column, 0) = static_cast<float>(centre + y * std::cos(angle) - x * std::sin(angle));
+                map->at(row, column, 1) = static_cast<float>(centre + y * std::sin(angle) + x * std::cos(angle));
+            }
+        }
+        return map;
+    }
+}
+
+// Every output pixel and band on its own, four reads each, on one thread
+static void BM_ResizeBilinearByHand(benchmark::State& state) {
+    auto in = makeTensor<float, Coarse>();
+    auto out = makeTensor<float, Fine>();
+    const auto clampIndex = [](double i) { return static_cast<tensorSize>(std::clamp(i, 0.0, Size - 1.0)); };
+    for (auto _ : state) {
+        for (tensorSize row = 0; row < 2 * Size; row++) {
+            const double y = (static_cast<double>(row) + 0.5) / 2 - 0.5;
+            const double fy = y - std::floor(y);
+            const tensorSize top = clampIndex(std::floor(y));
+            const tensorSize bottom = clampIndex(std::floor(y) + 1);
+            for (tensorSize column = 0; column < 2 * Size; column++) {
+                const double x = (static_cast<double>(column) + 0.5) / 2 - 0.5;
+                const double fx = x - std::floor(x);
+                const tensorSize left = clampIndex(std::floor(x));
+                const tensorSize right = clampIndex(std::floor(x) + 1);
+                for (tensorSize band = 0; band < Bands; band++) {
+                    const double upper = (1 - fx) * in->at(top, left, band) + fx * in->at(top, right, band);
+                    const double lower = (1 - fx) * in->at(bottom, left, band) + fx * in->at(bottom, right, band);
+                    out->at(row, column, band) = static_cast<float>((1 - fy) * upper + fy * lower);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<float, Fine>(state);
+    setRoofline<float, Fine>(state, flopsPerElement<Interpolation::Bilinear>(), resizeBytes);
+}
+
+template <Interpolation interpolation>
+static void BM_Resize(benchmark::State& state) {
+    auto in = makeTensor<float, Coarse>();
+    auto out = makeTensor<float, Fine>();
+    for (auto _ : state) {
+        resize<interpolation>(*in, *out);
+        benchmark::DoNotOptimize(out->data());
+    }
+    setThroughput<float, Fine>(state);
+    setRoofline<float, Fine>(state, flopsPerElement<interpolation>(), resizeBytes);
+}
+
+template <Interpolation interpolation>
+static void BM_Warp(benchmark::State& state) {
+    auto in = makeTensor<float, Coarse>();
+    auto map = rotation();
+    auto out = makeTensor<float, Fine>();
+    for (auto _ : state) {
+        warp<interpolation>(*in, *map, *out);
+        benchmark::DoNotOptimize(out->data());
+    }
+    setThroughput<float, Fine>(state);
+    setRoofline<float, Fine>(state, flopsPerElement<interpolation>(), warpBytes);
+}
+
+BENCHMARK(BM_ResizeBilinearByHand)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Resize<Interpolation::Nearest>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Resize<Interpolation::Bilinear>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Resize<Interpolation::Bicubic>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Warp<Interpolation::Nearest>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Warp<Interpolation::Bilinear>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Warp<Interpolation::Bicubic>)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,220 @@
+#include "Roofline.h"
+
+#include <algorithm>
+#include <array>
+#include <barrier>
+#include <chrono>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "TensorII/private/Parallel.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define TENSORII_X86_PROBES
+#endif
+
+namespace TensorII::Benchmark {
+
+    namespace {
+        constexpr size_t nAccumulators = 12; // Enough independent FMAs to cover latency on two FMA ports
+
+        // Best wall time over 'repeats' runs of 'threads' threads started together, each running the function
+        // makeRun(thread) returns, so each sets up its own data on its own thread first
+        template <typename MakeRun>
+        double bestSeconds(size_t threads, int repeats, MakeRun&& makeRun) {
+            std::barrier sync(static_cast<std::ptrdiff_t>(threads));
+            double best = 0;
+            auto body = [&](size_t thread) {
+                auto run = makeRun(thread);
+                for (int repeat = 0; repeat < repeats; repeat++) {
+                    sync.arrive_and_wait();
+                    const auto start = std::chrono::steady_clock::now();
+                    run();
+                    sync.arrive_and_wait();
+                    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+                    if (thread == 0 && (repeat == 0 || elapsed.count() < best)) {
+                        best = elapsed.count();
+                    }
+                }
+            };
+            {
+                std::vector<std::jthread> others;
+                for (size_t thread = 1; thread < threads; thread++) {
+                    others.emplace_back(body, thread);
+                }
+                body(0);
+            }
+            return best;
+        }
+
+        float fmaLoopScalar(size_t nIterations) {
+            std::array<float, nAccumulators> accumulators {};
+            for (size_t k = 0; k < nAccumulators; k++) {
+                accumulators[k] = static_cast<float>(k) * 1e-3f;
+            }
+            for (size_t i = 0; i < nIterations; i++) {
+                for (float& accumulator : accumulators) {
+                    accumulator = accumulator * 0.999f + 1e-6f;
+                }
+            }
+            float sum = 0;
+            for (float accumulator : accumulators) { sum += accumulator; }
+            return sum;
+        }
+
+#ifdef TENSORII_X86_PROBES
+        __attribute__((target("avx2,fma")))
+        float fmaLoopAvx2(size_t nIterations) {
+            __m256 accumulators[nAccumulators];
+            for (size_t k = 0; k < nAccumulators; k++) {
+                accumulators[k] = _mm256_set1_ps(static_cast<float>(k) * 1e-3f);
+            }
+            const __m256 a = _mm256_set1_ps(0.999f);
+            const __m256 b = _mm256_set1_ps(1e-6f);
+            for (size_t i = 0; i < nIterations; i++) {
+                for (__m256& accumulator : accumulators) {
+                    accumulator = _mm256_fmadd_ps(accumulator, a, b);
+                }
+            }
+            __m256 sum = _mm256_setzero_ps();
+            for (__m256 accumulator : accumulators) { sum = _mm256_add_ps(sum, accumulator); }
+            return _mm_cvtss_f32(_mm256_castps256_ps128(sum));
+        }
+
+        __attribute__((target("avx512f")))
+        float fmaLoopAvx512(size_t nIterations) {
+            __m512 accumulators[nAccumulators];
+            for (size_t k = 0; k < nAccumulators; k++) {
+                accumulators[k] = _mm512_set1_ps(static_cast<float>(k) * 1e-3f);
+            }
+            const __m512 a = _mm512_set1_ps(0.999f);
+            const __m512 b = _mm512_set1_ps(1e-6f);
+            for (size_t i = 0; i < nIterations; i++) {
+                for (__m512& accumulator : accumulators) {
+                    accumulator = _mm512_fmadd_ps(accumulator, a, b);
+                }
+            }
+            __m512 sum = _mm512_setzero_ps();
+            for (__m512 accumulator : accumulators) { sum = _mm512_add_ps(sum, accumulator); }
+            return _mm512_reduce_add_ps(sum);
+        }
+#endif
+
+        // Floats processed by one FMA instruction of the selected probe
+        size_t fmaLanes() {
+#ifdef TENSORII_X86_PROBES
+            if (__builtin_cpu_supports("avx512f")) { return 16; }
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) { return 8; }
+#endif
+            return 1;
+        }
+
+        float fmaLoop(size_t nIterations) {
+#ifdef TENSORII_X86_PROBES
+            if (fmaLanes() == 16) { return fmaLoopAvx512(nIterations); }
+            if (fmaLanes() == 8) { return fmaLoopAvx2(nIterations); }
+#endif
+            return fmaLoopScalar(nIterations);
+        }
+    }
+
+    double streamTriadBytesPerSecond(size_t nElements, int repeats, size_t threads) {
+        // Several passes per run for arrays small enough to sit in cache, so the clock's resolution doesn't matter
+        const size_t passes = std::max<size_t>(1, (size_t(1) << 20) / nElements);
+        double seconds = bestSeconds(threads, repeats, [&](size_t) {
+            // Each thread's own arrays, first touched on that thread
+            return [nElements, passes, a = std::vector<double>(nElements, 0.0), b = std::vector<double>(nElements, 1.0),
+                    c = std::vector<double>(nElements, 2.0)]() mutable {
+                const double scalar = 3.0;
+                for (size_t pass = 0; pass < passes; pass++) {
+                    for (size_t i = 0; i < nElements; i++) {
+                        a[i] = b[i] + scalar * c[i];
+                    }
+                    benchmark::DoNotOptimize(a.data());
+                    benchmark::ClobberMemory();
+                }
+            };
+        });
+        // Counted as STREAM does, two reads and a write per element, ignoring write-allocate traffic
+        return 3.0 * sizeof(double) * static_cast<double>(nElements * passes * threads) / seconds;
+    }
+
+    double fmaFlopsPerSecond(size_t nIterations, int repeats, size_t threads) {
+        double seconds = bestSeconds(threads, repeats, [nIterations](size_t) {
+            return [nIterations] { benchmark::DoNotOptimize(fmaLoop(nIterations)); };
+        });
+        return 2.0 * static_cast<double>(nIterations * nAccumulators * fmaLanes() * threads) / seconds;
+    }
+
+    size_t peakThreads() {
+        return Core::Private::threadBudget();
+    }
+
+    const char* fmaProbeIsa() {
+        switch (fmaLanes()) {
+            case 16: return "avx512f";
+            case 8:  return "avx2+fma";
+            default: return "scalar";
+        }
+    }
+
+    const BandwidthRoof& MachinePeaks::roofFor(double workingSetBytes) const {
+        for (const BandwidthRoof& roof : bandwidths) {
+            if (workingSetBytes <= roof.capacityBytes) {
+                return roof;
+            }
+        }
+        return memory();
+    }
+
+    const MachinePeaks& machinePeaks() {
+        static const MachinePeaks peaks = [] {
+            MachinePeaks measured;
+            const size_t threads = peakThreads();
+            for (const auto& cache : benchmark::CPUInfo::Get().caches) {
+                if (cache.type == "Instruction" || cache.size <= 0) {
+                    continue;
+                }
+                // Every copy of the cache the threads spread over, e.g. one L2 per core but a single shared L3
+                const auto sharing = static_cast<size_t>(std::max(cache.num_sharing, 1));
+                const auto copies = static_cast<double>((threads + sharing - 1) / sharing);
+                const double capacity = copies * static_cast<double>(cache.size);
+                // Triad over half of it, leaving room for everything else that lives there
+                const auto nElements = static_cast<size_t>(capacity / 2 / static_cast<double>(threads) / (3 * sizeof(double)));
+                measured.bandwidths.push_back({"L" + std::to_string(cache.level), capacity,
+                                               streamTriadBytesPerSecond(nElements, 5, threads)});
+            }
+            std::ranges::sort(measured.bandwidths, {}, &BandwidthRoof::capacityBytes);
+            // Arrays well past the last level cache, 384MB unless that cache is even bigger
+            const double lastLevel = measured.bandwidths.empty() ? 0.0 : measured.bandwidths.back().capacityBytes;
+            const size_t nMemoryElements = std::max<size_t>(size_t(1) << 24, static_cast<size_t>(4 * lastLevel / (3 * sizeof(double))));
+            measured.bandwidths.push_back({"memory", std::numeric_limits<double>::infinity(),
+                                           streamTriadBytesPerSecond(std::max<size_t>(1, nMemoryElements / threads), 3, threads)});
+            // Enough FMAs to run for a few milliseconds
+            measured.flopsPerSecond = fmaFlopsPerSecond(size_t(1) << 22, 5, threads);
+            return measured;
+        }();
+        return peaks;
+    }
+
+    void setRoofline(benchmark::State& state, double flopsPerIteration, double bytesPerIteration,
+                     double workingSetBytes) {
+        const MachinePeaks& peaks = machinePeaks();
+        const BandwidthRoof& roof = peaks.roofFor(workingSetBytes);
+        const double memorySeconds = bytesPerIteration / roof.bytesPerSecond;
+        const double computeSeconds = flopsPerIteration / peaks.flopsPerSecond;
+        const double iterations = static_cast<double>(state.iterations());
+
+        state.counters["arithmetic_intensity"] = bytesPerIteration > 0 ? flopsPerIteration / bytesPerIteration : 0.0;
+        // As a rate, Google Benchmark divides by the measured time, leaving (lower bound time) / (measured time)
+        state.counters["roofline_fraction"] = benchmark::Counter(std::max(memorySeconds, computeSeconds) * iterations,
+                                                                 benchmark::Counter::kIsRate);
+        state.SetLabel(memorySeconds >= computeSeconds ? roof.name + " bound" : "compute bound");
+    }
+
+    void setRoofline(benchmark::State& state, double flopsPerIteration, double bytesPerIteration) {
+        setRoofline(state, flopsPerIteration, bytesPerIteration, bytesPerIteration);
+    }
+}
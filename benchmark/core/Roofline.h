@@ -0,0 +1,57 @@
+#ifndef TENSOR_ROOFLINE_H
+#define TENSOR_ROOFLINE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+namespace TensorII::Benchmark {
+
+    // Bandwidth available to working sets up to capacityBytes
+    struct BandwidthRoof {
+        std::string name;
+        double capacityBytes;
+        double bytesPerSecond;
+    };
+
+    // Limits of the whole host, measured on peakThreads() threads at once as the parallel kernels run. Serial
+    // kernels are placed against the same roofs, so their roofline_fraction also shows the cores they leave idle.
+    struct MachinePeaks {
+        // STREAM triad at each data cache level, by increasing capacity, ending with main memory
+        std::vector<BandwidthRoof> bandwidths;
+        // fp32 FMA loop, on the widest vectors the CPU supports
+        double flopsPerSecond;
+
+        // The innermost level a working set fits in
+        [[nodiscard]]
+        const BandwidthRoof& roofFor(double workingSetBytes) const;
+        [[nodiscard]]
+        const BandwidthRoof& memory() const { return bandwidths.back(); }
+    };
+
+    // Measured once, the first time it is called
+    const MachinePeaks& machinePeaks();
+
+    // Threads the peaks are measured on: the thread budget of the parallel kernels
+    size_t peakThreads();
+
+    // Probes, each returning the best combined rate over 'repeats' runs on 'threads' threads at once. Each thread
+    // runs the triad over arrays of nElements of its own.
+    double streamTriadBytesPerSecond(size_t nElements, int repeats, size_t threads);
+    double fmaFlopsPerSecond(size_t nIterations, int repeats, size_t threads);
+    // Name of the vector extension used by the FMA probe
+    const char* fmaProbeIsa();
+
+    // Adds roofline counters to a kernel's benchmark, given the work done per iteration:
+    //   arithmetic_intensity, flops per byte of memory traffic
+    //   roofline_fraction, the roofline's lower bound on time over the measured time, 1 is at the roofline
+    // and labels the kernel with what bounds it. The bandwidth roof is picked by the working set, which
+    // for kernels that touch each byte once is the traffic itself.
+    void setRoofline(benchmark::State& state, double flopsPerIteration, double bytesPerIteration,
+                     double workingSetBytes);
+    void setRoofline(benchmark::State& state, double flopsPerIteration, double bytesPerIteration);
+}
+
+#endif //TENSOR_ROOFLINE_H
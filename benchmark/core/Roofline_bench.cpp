@@ -0,0 +1,51 @@
+#include "Roofline.h"
+
+using namespace TensorII::Benchmark;
+
+// The roofs every kernel's roofline_fraction is measured against, reported so runs on different hosts can be compared
+
+static void BM_PeakBandwidth(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(machinePeaks());
+    }
+    for (const BandwidthRoof& roof : machinePeaks().bandwidths) {
+        state.counters[roof.name + "_bytes_per_second"] = roof.bytesPerSecond;
+    }
+    state.counters["threads"] = static_cast<double>(peakThreads());
+    state.SetLabel("stream triad");
+}
+
+static void BM_PeakFlops(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(machinePeaks());
+    }
+    state.counters["threads"] = static_cast<double>(peakThreads());
+    state.counters["peak_flops"] = machinePeaks().flopsPerSecond;
+    state.counters["ridge_point"] = machinePeaks().flopsPerSecond / machinePeaks().memory().bytesPerSecond;
+    state.SetLabel(fmaProbeIsa());
+}
+
+// The probes themselves, for checking how stable the peaks are on a host
+static void BM_StreamTriad(benchmark::State& state) {
+    const auto nElements = static_cast<size_t>(state.range(0));
+    double bytesPerSecond = 0;
+    for (auto _ : state) {
+        bytesPerSecond = streamTriadBytesPerSecond(nElements, 1, peakThreads());
+    }
+    state.counters["triad_bytes_per_second"] = bytesPerSecond;
+}
+
+static void BM_FmaLoop(benchmark::State& state) {
+    double flopsPerSecond = 0;
+    for (auto _ : state) {
+        flopsPerSecond = fmaFlopsPerSecond(static_cast<size_t>(state.range(0)), 1, peakThreads());
+    }
+    state.counters["flops"] = flopsPerSecond;
+    state.SetLabel(fmaProbeIsa());
+}
+
+BENCHMARK(BM_PeakBandwidth)->Iterations(1);
+BENCHMARK(BM_PeakFlops)->Iterations(1);
+// From in L2 out to DRAM
+BENCHMARK(BM_StreamTriad)->RangeMultiplier(16)->Range(1 << 12, 1 << 24)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_FmaLoop)->Arg(1 << 20)->Unit(benchmark::kMillisecond)->UseRealTime();
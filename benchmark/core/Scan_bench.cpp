@@ -0,0 +1,54 @@
+#include "BenchmarkUtil.h"
+#include "TensorII/Scan.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    inline constexpr Shape<1> Elements1M {1 << 20};
+    inline constexpr Shape<2> Image1K {1024, 1024};
+
+    // One running total, an add's latency per element
+    template <typename DType, auto shape>
+    void naiveCumsum(const Tensor<DType, shape>& in, Tensor<DType, shape>& out) {
+        DType running {};
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            running += in.data()[i];
+            out.data()[i] = running;
+        }
+    }
+}
+
+template <typename DType, auto shape>
+static void BM_CumsumNaive(benchmark::State& state) {
+    auto in = makeTensor<DType, shape>();
+    auto out = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        naiveCumsum(*in, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state, 2 * sizeof(DType));
+    setRoofline<DType, shape>(state, 1, 2 * sizeof(DType));
+}
+
+template <tensorRank axis, typename DType, auto shape>
+static void BM_Cumsum(benchmark::State& state) {
+    auto in = makeTensor<DType, shape>();
+    auto out = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        cumsum<axis>(*in, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state, 2 * sizeof(DType));
+    setRoofline<DType, shape>(state, 1, 2 * sizeof(DType));
+}
+
+BENCHMARK_TEMPLATE(BM_CumsumNaive, float, Elements1M)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Cumsum, 0, float, Elements1M)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CumsumNaive, double, Elements1M)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Cumsum, 0, double, Elements1M)->Unit(benchmark::kMicrosecond)->UseRealTime();
+// An integral image's two passes: down the columns, then along the rows
+BENCHMARK_TEMPLATE(BM_Cumsum, 0, float, Image1K)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Cumsum, 1, float, Image1K)->Unit(benchmark::kMicrosecond)->UseRealTime();
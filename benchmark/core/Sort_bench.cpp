@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/Sort.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    // Bands of each pixel, to sort per pixel, and one long sequence
+    inline constexpr Shape<3> Pixels {256, 256, 32};
+    inline constexpr Shape<1> Long1M {1 << 20};
+
+    // Comparisons stand in for flops, about log2 of the sequence length of them per element
+    inline constexpr double bandComparisons = 5;
+    inline constexpr double longComparisons = 20;
+
+    template <typename DType, auto shape>
+    void randomFill(Tensor<DType, shape>& tensor) {
+        std::mt19937 generator (1);
+        std::uniform_real_distribution<DType> distribution (0, 1);
+        for (tensorSize i = 0; i < tensor.size(); i++) {
+            tensor.data()[i] = distribution(generator);
+        }
+    }
+}
+
+// Each pixel's bands copied out, through std::sort and back, as a hand-written loop would
+template <typename DType>
+static void BM_SortBandsByHand(benchmark::State& state) {
+    constexpr auto bands = static_cast<tensorSize>(Pixels[2]);
+    auto in = makeTensor<DType, Pixels>();
+    randomFill(*in);
+    auto out = makeTensor<DType, Pixels>();
+    for (auto _ : state) {
+        for (tensorSize pixel = 0; pixel < Pixels.n_elems() / bands; pixel++) {
+            std::array<DType, bands> sequence;
+            std::copy_n(in->data() + pixel * bands, bands, sequence.begin());
+            std::sort(sequence.begin(), sequence.end());
+            std::copy_n(sequence.begin(), bands, out->data() + pixel * bands);
+        }
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, Pixels>(state, 2 * sizeof(DType));
+    setRoofline<DType, Pixels>(state, bandComparisons, 2 * sizeof(DType));
+}
+
+template <typename DType>
+static void BM_SortBands(benchmark::State& state) {
+    auto in = makeTensor<DType, Pixels>();
+    randomFill(*in);
+    auto out = makeTensor<DType, Pixels>();
+    for (auto _ : state) {
+        sort<2>(*in, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, Pixels>(state, 2 * sizeof(DType));
+    setRoofline<DType, Pixels>(state, bandComparisons, 2 * sizeof(DType));
+}
+
+template <typename DType>
+static void BM_ArgsortBands(benchmark::State& state) {
+    auto in = makeTensor<DType, Pixels>();
+    randomFill(*in);
+    auto indices = makeTensor<std::int32_t, Pixels>();
+    for (auto _ : state) {
+        argsort<2>(*in, *indices);
+        benchmark::DoNotOptimize(indices->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, Pixels>(state, sizeof(DType) + sizeof(std::int32_t));
+    setRoofline<DType, Pixels>(state, bandComparisons, sizeof(DType) + sizeof(std::int32_t));
+}
+
+// The 3 brightest bands of each pixel
+static void BM_TopkBands(benchmark::State& state) {
+    constexpr auto Top3 = Private::withExtent<Pixels, 2, 3>();
+    auto in = makeTensor<float, Pixels>();
+    randomFill(*in);
+    auto values = makeTensor<float, Top3>();
+    auto indices = makeTensor<std::int32_t, Top3>();
+    for (auto _ : state) {
+        topk<3, 2>(*in, *values, *indices);
+        benchmark::DoNotOptimize(values->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<float, Pixels>(state);
+    // One comparison against the third largest so far for most bands, and three values and indices out of 32
+    setRoofline<float, Pixels>(state, 1, sizeof(float) + 3.0 * (sizeof(float) + sizeof(std::int32_t)) / 32);
+}
+
+static void BM_SortLong(benchmark::State& state) {
+    auto in = makeTensor<float, Long1M>();
+    randomFill(*in);
+    auto out = makeTensor<float, Long1M>();
+    for (auto _ : state) {
+        sort<0>(*in, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<float, Long1M>(state, 2 * sizeof(float));
+    setRoofline<float, Long1M>(state, longComparisons, 2 * sizeof(float));
+}
+
+BENCHMARK_TEMPLATE(BM_SortBandsByHand, float)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SortBands, float)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SortBandsByHand, double)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SortBands, double)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ArgsortBands, float)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_TopkBands)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_SortLong)->Unit(benchmark::kMillisecond)->UseRealTime();
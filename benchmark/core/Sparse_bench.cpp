@@ -0,0 +1,84 @@
+#include <random>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/Sparse.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    inline constexpr Shape<2> Matrix4K {4096, 4096};
+    inline constexpr Shape<1> Vector4K {4096};
+    inline constexpr Shape<2> Panel4K {4096, 64};
+
+    // One element in a hundred nonzero, scattered uniformly
+    template <auto shape>
+    std::unique_ptr<Tensor<float, shape>> makeSparseDense() {
+        auto tensor = std::make_unique<Tensor<float, shape>>();
+        std::mt19937 generator (7);
+        std::uniform_int_distribution<int> distribution (0, 99);
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            tensor->data()[i] = distribution(generator) == 0 ? static_cast<float>(i % 13) + 1.0f : 0.0f;
+        }
+        return tensor;
+    }
+
+    template <auto matrixShape, auto denseShape, auto outShape>
+    void denseProduct(const Tensor<float, matrixShape>& matrix, const Tensor<float, denseShape>& dense,
+                      Tensor<float, outShape>& out) {
+        constexpr tensorSize rows = matrixShape[0], inner = matrixShape[1], n = denseShape.n_elems() / inner;
+        std::fill_n(out.data(), out.size(), 0.0f);
+        for (tensorSize row = 0; row < rows; row++) {
+            for (tensorSize k = 0; k < inner; k++) {
+                const float value = matrix.data()[row * inner + k];
+                for (tensorSize j = 0; j < n; j++) {
+                    out.data()[row * n + j] += value * dense.data()[k * n + j];
+                }
+            }
+        }
+    }
+}
+
+// The same product with every zero multiplied out, for scale
+template <auto denseShape, auto outShape>
+static void BM_DenseProduct(benchmark::State& state) {
+    auto matrix = makeSparseDense<Matrix4K>();
+    auto dense = makeTensor<float, denseShape>();
+    auto out = std::make_unique<Tensor<float, outShape>>();
+    for (auto _ : state) {
+        denseProduct(*matrix, *dense, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    constexpr tensorSize n = denseShape.n_elems() / Matrix4K[1];
+    state.counters["footprint_bytes"] = static_cast<double>(matrix->size_in_bytes());
+    setThroughput<float, Matrix4K>(state);
+    setRoofline(state, 2.0 * static_cast<double>(Matrix4K.n_elems() * n),
+                static_cast<double>(matrix->size_in_bytes() + dense->size_in_bytes() + out->size_in_bytes()));
+}
+
+template <auto denseShape, auto outShape>
+static void BM_CsrProduct(benchmark::State& state) {
+    CsrTensor<float, Matrix4K> sparse;
+    sparsify(*makeSparseDense<Matrix4K>(), sparse);
+    auto dense = makeTensor<float, denseShape>();
+    auto out = std::make_unique<Tensor<float, outShape>>();
+    for (auto _ : state) {
+        contract(sparse, *dense, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    constexpr tensorSize n = denseShape.n_elems() / Matrix4K[1];
+    const double bytes = static_cast<double>(sparse.size_in_bytes() + (dense->size_in_bytes() + out->size_in_bytes()));
+    state.counters["footprint_bytes"] = static_cast<double>(sparse.size_in_bytes());
+    state.counters["nonzeros"] = static_cast<double>(sparse.nonzeros());
+    state.SetBytesProcessed(static_cast<int64_t>(bytes) * state.iterations());
+    state.counters["GFLOP/s"] = benchmark::Counter(2.0 * static_cast<double>(sparse.nonzeros() * n) * static_cast<double>(state.iterations()),
+                                                   benchmark::Counter::kIsRate, benchmark::Counter::kIs1000);
+    setRoofline(state, 2.0 * static_cast<double>(sparse.nonzeros() * n), bytes);
+}
+
+BENCHMARK_TEMPLATE(BM_DenseProduct, Vector4K, Vector4K)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CsrProduct, Vector4K, Vector4K)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_DenseProduct, Panel4K, Panel4K)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CsrProduct, Panel4K, Panel4K)->Unit(benchmark::kMicrosecond)->UseRealTime();
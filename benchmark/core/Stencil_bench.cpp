@@ -0,0 +1,109 @@
+#include "BenchmarkUtil.h"
+#include "TensorII/Stencil.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+namespace {
+    namespace Grids {
+        inline constexpr Shape<2> Grid4k {4096, 4096};
+        inline constexpr Shape<3> Grid128 {128, 128, 128};
+        inline constexpr Shape<3> Grid256 {256, 256, 256};
+    }
+
+    constexpr auto laplacian2 = Stencils::laplacian<2>();
+    constexpr auto laplacian3 = Stencils::laplacian<3>();
+    constexpr auto box3 = Stencils::dense<3, 1>([] {
+        std::array<double, 27> weights {};
+        weights.fill(1.0 / 27.0);
+        return weights;
+    }());
+
+    // What a stencil looks like written out by hand: every point of every element checks every axis against
+    // the edges of the grid
+    template <auto stencil, auto shape>
+    void naiveStencil(const Tensor<double, shape>& in, Tensor<double, shape>& out) {
+        constexpr tensorRank rank = shape.rank();
+        std::array<tensorIndex, rank> index {};
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            double total = 0;
+            for (tensorSize point = 0; point < stencil.points(); point++) {
+                tensorSize flat = 0;
+                bool outside = false;
+                for (tensorRank axis = 0; axis < rank; axis++) {
+                    const tensorIndex j = index[axis] + stencil.offsets[point][axis];
+                    outside = outside || j < 0 || j >= shape[axis];
+                    flat = flat * static_cast<tensorSize>(shape[axis]) + static_cast<tensorSize>(j);
+                }
+                total += outside ? 0.0 : stencil.coefficients[point] * in.data()[flat];
+            }
+            out.data()[i] = total;
+            for (tensorRank axis = rank; axis-- > 0; ) {
+                if (++index[axis] < shape[axis]) {
+                    break;
+                }
+                index[axis] = 0;
+            }
+        }
+    }
+
+    // Stencils read every point from cache, so traffic is one read and one write per element
+    constexpr double stencilTraffic = 2 * sizeof(double);
+}
+
+template <auto stencil, auto shape>
+static void BM_StencilNaive(benchmark::State& state) {
+    auto in = makeTensor<double, shape>();
+    auto out = makeTensor<double, shape>();
+    for (auto _ : state) {
+        naiveStencil<stencil>(*in, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<double, shape>(state, 2 * sizeof(double));
+    setRoofline<double, shape>(state, 2.0 * stencil.points(), stencilTraffic);
+}
+
+template <auto stencil, auto shape>
+static void BM_ApplyStencil(benchmark::State& state) {
+    auto in = makeTensor<double, shape>();
+    auto out = makeTensor<double, shape>();
+    for (auto _ : state) {
+        applyStencil<stencil>(*in, *out);
+        benchmark::DoNotOptimize(out->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<double, shape>(state, 2 * sizeof(double));
+    setRoofline<double, shape>(state, 2.0 * stencil.points(), stencilTraffic);
+}
+
+// 'steps' sweeps per iteration, reported per element per sweep
+template <auto stencil, tensorSize timeBlock, auto shape>
+static void BM_IterateStencil(benchmark::State& state) {
+    constexpr tensorSize steps = 8;
+    auto field = makeTensor<double, shape>();
+    auto scratch = makeTensor<double, shape>();
+    for (auto _ : state) {
+        iterateStencil<stencil, Boundary::Dirichlet, timeBlock>(*field, *scratch, steps);
+        benchmark::DoNotOptimize(field->data());
+        benchmark::ClobberMemory();
+    }
+    const auto sweeps = static_cast<int64_t>(state.iterations() * steps);
+    state.SetItemsProcessed(sweeps * static_cast<int64_t>(shape.n_elems()));
+    setRoofline(state, 2.0 * stencil.points() * steps * shape.n_elems(),
+                stencilTraffic * steps / timeBlock * shape.n_elems());
+}
+
+BENCHMARK_TEMPLATE(BM_StencilNaive, laplacian2, Grids::Grid4k)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ApplyStencil, laplacian2, Grids::Grid4k)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StencilNaive, laplacian3, Grids::Grid128)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ApplyStencil, laplacian3, Grids::Grid128)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StencilNaive, laplacian3, Grids::Grid256)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ApplyStencil, laplacian3, Grids::Grid256)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StencilNaive, box3, Grids::Grid128)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ApplyStencil, box3, Grids::Grid128)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_IterateStencil, laplacian2, 1, Grids::Grid4k)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_IterateStencil, laplacian2, 4, Grids::Grid4k)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_IterateStencil, laplacian3, 1, Grids::Grid256)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_IterateStencil, laplacian3, 4, Grids::Grid256)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,17 @@
+#include "BenchmarkUtil.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/TensorView.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+template <Scalar DType, auto shape>
+static void BM_TensorViewConstruct(benchmark::State& state) {
+    auto tensor = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        TensorView<DType, shape> view {*tensor};
+        benchmark::DoNotOptimize(view.shape().rank());
+    }
+}
+
+BENCHMARK_ALL_SHAPES(BM_TensorViewConstruct, float);
@@ -0,0 +1,85 @@
+#include <vector>
+
+#include "BenchmarkUtil.h"
+#include "TensorII/Tensor.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Benchmark;
+
+template <Scalar DType, auto shape>
+static void BM_TensorDefaultConstruct(benchmark::State& state) {
+    auto tensor = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        std::construct_at(tensor.get());
+        benchmark::DoNotOptimize(tensor->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state);
+    setRoofline<DType, shape>(state, 0, sizeof(DType));
+}
+
+template <Scalar DType, auto shape>
+static void BM_TensorFromInitializer(benchmark::State& state) {
+    // Nested c-array, as would be written with braces
+    struct Values { typename NestedArray<DType, shape>::type array; };
+    auto values = std::make_unique<Values>();
+    auto* flat = reinterpret_cast<DType*>(&values->array);
+    std::iota(flat, flat + shape.n_elems(), DType(0));
+
+    auto tensor = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        std::construct_at(tensor.get(), Private::TensorInitializer<DType, shape>(values->array));
+        benchmark::DoNotOptimize(tensor->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state);
+    setRoofline<DType, shape>(state, 0, 2 * sizeof(DType));
+}
+
+template <Scalar DType, auto shape>
+static void BM_TensorFromRange(benchmark::State& state) {
+    std::vector<DType> values(shape.n_elems());
+    std::iota(values.begin(), values.end(), DType(0));
+
+    auto tensor = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        std::construct_at(tensor.get(), from_range, values);
+        benchmark::DoNotOptimize(tensor->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state);
+    setRoofline<DType, shape>(state, 0, 2 * sizeof(DType));
+}
+
+template <Scalar DType, auto shape>
+static void BM_TensorMoveConstruct(benchmark::State& state) {
+    auto source = makeTensor<DType, shape>();
+    auto destination = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        std::construct_at(destination.get(), std::move(*source));
+        benchmark::DoNotOptimize(destination->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state);
+    setRoofline<DType, shape>(state, 0, 2 * sizeof(DType));
+}
+
+template <Scalar DType, auto shape>
+static void BM_TensorMoveAssign(benchmark::State& state) {
+    auto source = makeTensor<DType, shape>();
+    auto destination = makeTensor<DType, shape>();
+    for (auto _ : state) {
+        *destination = std::move(*source);
+        benchmark::DoNotOptimize(destination->data());
+        benchmark::ClobberMemory();
+    }
+    setThroughput<DType, shape>(state);
+    setRoofline<DType, shape>(state, 0, 2 * sizeof(DType));
+}
+
+BENCHMARK_ALL_SHAPES(BM_TensorDefaultConstruct, float);
+BENCHMARK_ALL_SHAPES(BM_TensorFromInitializer, float);
+BENCHMARK_ALL_SHAPES(BM_TensorFromRange, float);
+BENCHMARK_ALL_SHAPES(BM_TensorMoveConstruct, float);
+BENCHMARK_ALL_SHAPES(BM_TensorMoveConstruct, uint16_t);
+BENCHMARK_ALL_SHAPES(BM_TensorMoveAssign, float);
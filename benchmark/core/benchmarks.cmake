@@ -0,0 +1,26 @@
+set(SOURCES
+        Tensor_bench.cpp
+        TensorView_bench.cpp
+        Instrumentation_bench.cpp
+        Roofline.cpp
+        Roofline_bench.cpp
+        Operations_bench.cpp
+        Quantized_bench.cpp
+        Layout_bench.cpp
+        Morton_bench.cpp
+        Stencil_bench.cpp
+        Convolution_bench.cpp
+        FFT_bench.cpp
+        Complex_bench.cpp
+        Sparse_bench.cpp
+        Scan_bench.cpp
+        Graph_bench.cpp
+        Async_bench.cpp
+        Pipeline_bench.cpp
+        Einstein_bench.cpp
+        Mask_bench.cpp
+        Gather_bench.cpp
+        Sort_bench.cpp
+        Histogram_bench.cpp
+        Resample_bench.cpp
+        )
@@ -0,0 +1,489 @@
+#include "TensorII/private/ComplexKernels.h"
+#include "TensorII/private/CpuFeatures.h"
+#include "TensorII/private/SimdTargets.h"
+
+#include <array>
+
+namespace TensorII::Core::Private {
+
+    namespace {
+        //region Scalar, also used for the tails of the vector loops
+        template <typename T>
+        void multiplyScalar(const std::complex<T>* lhs, const std::complex<T>* rhs, std::complex<T>* out,
+                            tensorSize begin, tensorSize n) {
+            for (tensorSize i = begin; i < n; i++) {
+                const std::complex<T> a = lhs[i], b = rhs[i];
+                out[i] = {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+            }
+        }
+
+        template <typename T>
+        std::complex<T> sumScalar(const std::complex<T>* in, tensorSize begin, tensorSize n) {
+            T real = 0, imag = 0;
+            for (tensorSize i = begin; i < n; i++) {
+                real += in[i].real();
+                imag += in[i].imag();
+            }
+            return {real, imag};
+        }
+
+        template <typename T>
+        std::complex<T> dotScalar(const std::complex<T>* lhs, const std::complex<T>* rhs, tensorSize begin, tensorSize n) {
+            T real = 0, imag = 0;
+            for (tensorSize i = begin; i < n; i++) {
+                real += lhs[i].real() * rhs[i].real() - lhs[i].imag() * rhs[i].imag();
+                imag += lhs[i].real() * rhs[i].imag() + lhs[i].imag() * rhs[i].real();
+            }
+            return {real, imag};
+        }
+
+        template <typename T>
+        void weightedSumScalar(const std::complex<T>* const* sources, const std::complex<T>* weights, tensorSize taps,
+                               std::complex<T>* out, tensorSize begin, tensorSize n) {
+            for (tensorSize i = begin; i < n; i++) {
+                T real = 0, imag = 0;
+                for (tensorSize t = 0; t < taps; t++) {
+                    const std::complex<T> w = weights[t], x = sources[t][i];
+                    real += w.real() * x.real() - w.imag() * x.imag();
+                    imag += w.real() * x.imag() + w.imag() * x.real();
+                }
+                out[i] = {real, imag};
+            }
+        }
+
+        template <typename T>
+        void multiplyScalar(SplitPlanes<const T> lhs, SplitPlanes<const T> rhs, SplitPlanes<T> out, tensorSize begin, tensorSize n) {
+            for (tensorSize i = begin; i < n; i++) {
+                const T real = lhs.real[i] * rhs.real[i] - lhs.imag[i] * rhs.imag[i];
+                const T imag = lhs.real[i] * rhs.imag[i] + lhs.imag[i] * rhs.real[i];
+                out.real[i] = real;
+                out.imag[i] = imag;
+            }
+        }
+
+        template <typename T>
+        std::complex<T> sumScalar(SplitPlanes<const T> in, tensorSize begin, tensorSize n) {
+            T real = 0, imag = 0;
+            for (tensorSize i = begin; i < n; i++) {
+                real += in.real[i];
+                imag += in.imag[i];
+            }
+            return {real, imag};
+        }
+
+        template <typename T>
+        std::complex<T> dotScalar(SplitPlanes<const T> lhs, SplitPlanes<const T> rhs, tensorSize begin, tensorSize n) {
+            T real = 0, imag = 0;
+            for (tensorSize i = begin; i < n; i++) {
+                real += lhs.real[i] * rhs.real[i] - lhs.imag[i] * rhs.imag[i];
+                imag += lhs.real[i] * rhs.imag[i] + lhs.imag[i] * rhs.real[i];
+            }
+            return {real, imag};
+        }
+        //endregion
+    }
+
+#ifdef TENSORII_SIMD_KERNELS
+TENSORII_SIMD_WARNINGS_PUSH
+    namespace {
+        //region Vector operations
+        // Interleaved complex products come from fmaddsub, subtracting in the even (real) lanes and adding in
+        // the odd (imaginary) ones: a * re(b) -+ swapPairs(a) * im(b)
+        template <typename T> struct Avx512Ops;
+        template <typename T> struct Avx2Ops;
+
+        template <>
+        struct Avx512Ops<float> {
+            using Vector = __m512;
+            static constexpr tensorSize width = 16;
+            TENSORII_TARGET_AVX512 static Vector zero() { return _mm512_setzero_ps(); }
+            TENSORII_TARGET_AVX512 static Vector broadcast(float value) { return _mm512_set1_ps(value); }
+            TENSORII_TARGET_AVX512 static Vector load(const float* in) { return _mm512_loadu_ps(in); }
+            TENSORII_TARGET_AVX512 static void store(float* out, Vector value) { _mm512_storeu_ps(out, value); }
+            TENSORII_TARGET_AVX512 static Vector add(Vector a, Vector b) { return _mm512_add_ps(a, b); }
+            TENSORII_TARGET_AVX512 static Vector mul(Vector a, Vector b) { return _mm512_mul_ps(a, b); }
+            TENSORII_TARGET_AVX512 static Vector fmadd(Vector a, Vector b, Vector c) { return _mm512_fmadd_ps(a, b, c); }
+            TENSORII_TARGET_AVX512 static Vector fmsub(Vector a, Vector b, Vector c) { return _mm512_fmsub_ps(a, b, c); }
+            TENSORII_TARGET_AVX512 static Vector fmaddsub(Vector a, Vector b, Vector c) { return _mm512_fmaddsub_ps(a, b, c); }
+            TENSORII_TARGET_AVX512 static Vector realParts(Vector a) { return _mm512_moveldup_ps(a); }
+            TENSORII_TARGET_AVX512 static Vector imagParts(Vector a) { return _mm512_movehdup_ps(a); }
+            TENSORII_TARGET_AVX512 static Vector swapPairs(Vector a) { return _mm512_permute_ps(a, 0xB1); }
+        };
+
+        template <>
+        struct Avx512Ops<double> {
+            using Vector = __m512d;
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX512 static Vector zero() { return _mm512_setzero_pd(); }
+            TENSORII_TARGET_AVX512 static Vector broadcast(double value) { return _mm512_set1_pd(value); }
+            TENSORII_TARGET_AVX512 static Vector load(const double* in) { return _mm512_loadu_pd(in); }
+            TENSORII_TARGET_AVX512 static void store(double* out, Vector value) { _mm512_storeu_pd(out, value); }
+            TENSORII_TARGET_AVX512 static Vector add(Vector a, Vector b) { return _mm512_add_pd(a, b); }
+            TENSORII_TARGET_AVX512 static Vector mul(Vector a, Vector b) { return _mm512_mul_pd(a, b); }
+            TENSORII_TARGET_AVX512 static Vector fmadd(Vector a, Vector b, Vector c) { return _mm512_fmadd_pd(a, b, c); }
+            TENSORII_TARGET_AVX512 static Vector fmsub(Vector a, Vector b, Vector c) { return _mm512_fmsub_pd(a, b, c); }
+            TENSORII_TARGET_AVX512 static Vector fmaddsub(Vector a, Vector b, Vector c) { return _mm512_fmaddsub_pd(a, b, c); }
+            TENSORII_TARGET_AVX512 static Vector realParts(Vector a) { return _mm512_movedup_pd(a); }
+            TENSORII_TARGET_AVX512 static Vector imagParts(Vector a) { return _mm512_permute_pd(a, 0xFF); }
+            TENSORII_TARGET_AVX512 static Vector swapPairs(Vector a) { return _mm512_permute_pd(a, 0x55); }
+        };
+
+        template <>
+        struct Avx2Ops<float> {
+            using Vector = __m256;
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX2_FMA static Vector zero() { return _mm256_setzero_ps(); }
+            TENSORII_TARGET_AVX2_FMA static Vector broadcast(float value) { return _mm256_set1_ps(value); }
+            TENSORII_TARGET_AVX2_FMA static Vector load(const float* in) { return _mm256_loadu_ps(in); }
+            TENSORII_TARGET_AVX2_FMA static void store(float* out, Vector value) { _mm256_storeu_ps(out, value); }
+            TENSORII_TARGET_AVX2_FMA static Vector add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Vector mul(Vector a, Vector b) { return _mm256_mul_ps(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Vector fmadd(Vector a, Vector b, Vector c) { return _mm256_fmadd_ps(a, b, c); }
+            TENSORII_TARGET_AVX2_FMA static Vector fmsub(Vector a, Vector b, Vector c) { return _mm256_fmsub_ps(a, b, c); }
+            TENSORII_TARGET_AVX2_FMA static Vector fmaddsub(Vector a, Vector b, Vector c) { return _mm256_fmaddsub_ps(a, b, c); }
+            TENSORII_TARGET_AVX2_FMA static Vector realParts(Vector a) { return _mm256_moveldup_ps(a); }
+            TENSORII_TARGET_AVX2_FMA static Vector imagParts(Vector a) { return _mm256_movehdup_ps(a); }
+            TENSORII_TARGET_AVX2_FMA static Vector swapPairs(Vector a) { return _mm256_permute_ps(a, 0xB1); }
+        };
+
+        template <>
+        struct Avx2Ops<double> {
+            using Vector = __m256d;
+            static constexpr tensorSize width = 4;
+            TENSORII_TARGET_AVX2_FMA static Vector zero() { return _mm256_setzero_pd(); }
+            TENSORII_TARGET_AVX2_FMA static Vector broadcast(double value) { return _mm256_set1_pd(value); }
+            TENSORII_TARGET_AVX2_FMA static Vector load(const double* in) { return _mm256_loadu_pd(in); }
+            TENSORII_TARGET_AVX2_FMA static void store(double* out, Vector value) { _mm256_storeu_pd(out, value); }
+            TENSORII_TARGET_AVX2_FMA static Vector add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Vector mul(Vector a, Vector b) { return _mm256_mul_pd(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Vector fmadd(Vector a, Vector b, Vector c) { return _mm256_fmadd_pd(a, b, c); }
+            TENSORII_TARGET_AVX2_FMA static Vector fmsub(Vector a, Vector b, Vector c) { return _mm256_fmsub_pd(a, b, c); }
+            TENSORII_TARGET_AVX2_FMA static Vector fmaddsub(Vector a, Vector b, Vector c) { return _mm256_fmaddsub_pd(a, b, c); }
+            TENSORII_TARGET_AVX2_FMA static Vector realParts(Vector a) { return _mm256_movedup_pd(a); }
+            TENSORII_TARGET_AVX2_FMA static Vector imagParts(Vector a) { return _mm256_permute_pd(a, 0xF); }
+            TENSORII_TARGET_AVX2_FMA static Vector swapPairs(Vector a) { return _mm256_permute_pd(a, 0x5); }
+        };
+        //endregion
+
+        //region Vector loops, inlined into each target
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline T horizontalSum(typename Ops::Vector value) {
+            std::array<T, Ops::width> lanes;
+            Ops::store(lanes.data(), value);
+            T total = 0;
+            for (T lane : lanes) {
+                total += lane;
+            }
+            return total;
+        }
+
+        // Even lanes summed into the real part, odd lanes into the imaginary
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline std::complex<T> pairwiseSum(typename Ops::Vector value) {
+            std::array<T, Ops::width> lanes;
+            Ops::store(lanes.data(), value);
+            T real = 0, imag = 0;
+            for (tensorSize lane = 0; lane < Ops::width; lane += 2) {
+                real += lanes[lane];
+                imag += lanes[lane + 1];
+            }
+            return {real, imag};
+        }
+
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline void multiplyVector(const std::complex<T>* lhs, const std::complex<T>* rhs,
+                                                          std::complex<T>* out, tensorSize n) {
+            constexpr tensorSize step = Ops::width / 2;
+            const auto* a = reinterpret_cast<const T*>(lhs);
+            const auto* b = reinterpret_cast<const T*>(rhs);
+            auto* c = reinterpret_cast<T*>(out);
+            tensorSize i = 0;
+            for (; i + step <= n; i += step) {
+                const auto x = Ops::load(a + 2 * i), y = Ops::load(b + 2 * i);
+                Ops::store(c + 2 * i, Ops::fmaddsub(x, Ops::realParts(y), Ops::mul(Ops::swapPairs(x), Ops::imagParts(y))));
+            }
+            multiplyScalar(lhs, rhs, out, i, n);
+        }
+
+        // Two accumulators, to keep the adds from waiting on each other
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline std::complex<T> sumVector(const std::complex<T>* in, tensorSize n) {
+            constexpr tensorSize step = Ops::width / 2;
+            const auto* a = reinterpret_cast<const T*>(in);
+            auto sum0 = Ops::zero(), sum1 = Ops::zero();
+            tensorSize i = 0;
+            for (; i + 2 * step <= n; i += 2 * step) {
+                sum0 = Ops::add(sum0, Ops::load(a + 2 * i));
+                sum1 = Ops::add(sum1, Ops::load(a + 2 * i + Ops::width));
+            }
+            return pairwiseSum<Ops, T>(Ops::add(sum0, sum1)) + sumScalar(in, i, n);
+        }
+
+        // Sums a * re(b) and swapPairs(a) * im(b) apart, and only combines them at the end:
+        // re = even(first) - even(second), im = odd(first) + odd(second)
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline std::complex<T> dotVector(const std::complex<T>* lhs, const std::complex<T>* rhs, tensorSize n) {
+            constexpr tensorSize step = Ops::width / 2;
+            const auto* a = reinterpret_cast<const T*>(lhs);
+            const auto* b = reinterpret_cast<const T*>(rhs);
+            auto direct = Ops::zero(), swapped = Ops::zero();
+            tensorSize i = 0;
+            for (; i + step <= n; i += step) {
+                const auto x = Ops::load(a + 2 * i), y = Ops::load(b + 2 * i);
+                direct = Ops::fmadd(x, Ops::realParts(y), direct);
+                swapped = Ops::fmadd(Ops::swapPairs(x), Ops::imagParts(y), swapped);
+            }
+            const std::complex<T> first = pairwiseSum<Ops, T>(direct), second = pairwiseSum<Ops, T>(swapped);
+            return std::complex<T>(first.real() - second.real(), first.imag() + second.imag()) + dotScalar(lhs, rhs, i, n);
+        }
+
+        // As the dot product, a * re(w) and swapPairs(a) * im(w) summed apart, then combined with one fmaddsub
+        // per output vector
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline void weightedSumVector(const std::complex<T>* const* sources, const std::complex<T>* weights,
+                                                             tensorSize taps, std::complex<T>* out, tensorSize n) {
+            constexpr tensorSize step = Ops::width / 2;
+            auto* c = reinterpret_cast<T*>(out);
+            const auto one = Ops::broadcast(1);
+            tensorSize i = 0;
+            for (; i + step <= n; i += step) {
+                auto direct = Ops::zero(), swapped = Ops::zero();
+                for (tensorSize t = 0; t < taps; t++) {
+                    const auto x = Ops::load(reinterpret_cast<const T*>(sources[t]) + 2 * i);
+                    direct = Ops::fmadd(x, Ops::broadcast(weights[t].real()), direct);
+                    swapped = Ops::fmadd(Ops::swapPairs(x), Ops::broadcast(weights[t].imag()), swapped);
+                }
+                Ops::store(c + 2 * i, Ops::fmaddsub(direct, one, swapped));
+            }
+            weightedSumScalar(sources, weights, taps, out, i, n);
+        }
+
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline void multiplyVector(SplitPlanes<const T> lhs, SplitPlanes<const T> rhs, SplitPlanes<T> out, tensorSize n) {
+            tensorSize i = 0;
+            for (; i + Ops::width <= n; i += Ops::width) {
+                const auto ar = Ops::load(lhs.real + i), ai = Ops::load(lhs.imag + i);
+                const auto br = Ops::load(rhs.real + i), bi = Ops::load(rhs.imag + i);
+                Ops::store(out.real + i, Ops::fmsub(ar, br, Ops::mul(ai, bi)));
+                Ops::store(out.imag + i, Ops::fmadd(ar, bi, Ops::mul(ai, br)));
+            }
+            multiplyScalar(lhs, rhs, out, i, n);
+        }
+
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline std::complex<T> sumVector(SplitPlanes<const T> in, tensorSize n) {
+            auto real = Ops::zero(), imag = Ops::zero();
+            tensorSize i = 0;
+            for (; i + Ops::width <= n; i += Ops::width) {
+                real = Ops::add(real, Ops::load(in.real + i));
+                imag = Ops::add(imag, Ops::load(in.imag + i));
+            }
+            return std::complex<T>(horizontalSum<Ops, T>(real), horizontalSum<Ops, T>(imag)) + sumScalar(in, i, n);
+        }
+
+        // Four independent products, re = rr - ii and im = ri + ir, with nothing to shuffle
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline std::complex<T> dotVector(SplitPlanes<const T> lhs, SplitPlanes<const T> rhs, tensorSize n) {
+            auto rr = Ops::zero(), ii = Ops::zero(), ri = Ops::zero(), ir = Ops::zero();
+            tensorSize i = 0;
+            for (; i + Ops::width <= n; i += Ops::width) {
+                const auto ar = Ops::load(lhs.real + i), ai = Ops::load(lhs.imag + i);
+                const auto br = Ops::load(rhs.real + i), bi = Ops::load(rhs.imag + i);
+                rr = Ops::fmadd(ar, br, rr);
+                ii = Ops::fmadd(ai, bi, ii);
+                ri = Ops::fmadd(ar, bi, ri);
+                ir = Ops::fmadd(ai, br, ir);
+            }
+            const std::complex<T> vectors (horizontalSum<Ops, T>(rr) - horizontalSum<Ops, T>(ii),
+                                           horizontalSum<Ops, T>(ri) + horizontalSum<Ops, T>(ir));
+            return vectors + dotScalar(lhs, rhs, i, n);
+        }
+        //endregion
+
+        //region Targets
+        template <typename T>
+        TENSORII_TARGET_AVX512 void multiplyAvx512(const std::complex<T>* lhs, const std::complex<T>* rhs, std::complex<T>* out, tensorSize n) {
+            multiplyVector<Avx512Ops<T>>(lhs, rhs, out, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512 std::complex<T> sumAvx512(const std::complex<T>* in, tensorSize n) {
+            return sumVector<Avx512Ops<T>>(in, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512 std::complex<T> dotAvx512(const std::complex<T>* lhs, const std::complex<T>* rhs, tensorSize n) {
+            return dotVector<Avx512Ops<T>>(lhs, rhs, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512 void weightedSumAvx512(const std::complex<T>* const* sources, const std::complex<T>* weights,
+                                                      tensorSize taps, std::complex<T>* out, tensorSize n) {
+            weightedSumVector<Avx512Ops<T>>(sources, weights, taps, out, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512 void multiplyAvx512(SplitPlanes<const T> lhs, SplitPlanes<const T> rhs, SplitPlanes<T> out, tensorSize n) {
+            multiplyVector<Avx512Ops<T>>(lhs, rhs, out, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512 std::complex<T> sumAvx512(SplitPlanes<const T> in, tensorSize n) {
+            return sumVector<Avx512Ops<T>>(in, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512 std::complex<T> dotAvx512(SplitPlanes<const T> lhs, SplitPlanes<const T> rhs, tensorSize n) {
+            return dotVector<Avx512Ops<T>>(lhs, rhs, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA void multiplyAvx2(const std::complex<T>* lhs, const std::complex<T>* rhs, std::complex<T>* out, tensorSize n) {
+            multiplyVector<Avx2Ops<T>>(lhs, rhs, out, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA std::complex<T> sumAvx2(const std::complex<T>* in, tensorSize n) {
+            return sumVector<Avx2Ops<T>>(in, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA std::complex<T> dotAvx2(const std::complex<T>* lhs, const std::complex<T>* rhs, tensorSize n) {
+            return dotVector<Avx2Ops<T>>(lhs, rhs, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA void weightedSumAvx2(const std::complex<T>* const* sources, const std::complex<T>* weights,
+                                                      tensorSize taps, std::complex<T>* out, tensorSize n) {
+            weightedSumVector<Avx2Ops<T>>(sources, weights, taps, out, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA void multiplyAvx2(SplitPlanes<const T> lhs, SplitPlanes<const T> rhs, SplitPlanes<T> out, tensorSize n) {
+            multiplyVector<Avx2Ops<T>>(lhs, rhs, out, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA std::complex<T> sumAvx2(SplitPlanes<const T> in, tensorSize n) {
+            return sumVector<Avx2Ops<T>>(in, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA std::complex<T> dotAvx2(SplitPlanes<const T> lhs, SplitPlanes<const T> rhs, tensorSize n) {
+            return dotVector<Avx2Ops<T>>(lhs, rhs, n);
+        }
+        //endregion
+    }
+TENSORII_SIMD_WARNINGS_POP
+#endif
+
+    namespace {
+        bool hasAvx2() {
+            const CpuFeatures& features = cpuFeatures();
+            return features.avx2 && features.fma;
+        }
+
+        template <typename T>
+        void multiplyDispatch(const std::complex<T>* lhs, const std::complex<T>* rhs, std::complex<T>* out, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return multiplyAvx512(lhs, rhs, out, n); }
+            if (hasAvx2()) { return multiplyAvx2(lhs, rhs, out, n); }
+#endif
+            multiplyScalar(lhs, rhs, out, 0, n);
+        }
+
+        template <typename T>
+        std::complex<T> sumDispatch(const std::complex<T>* in, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return sumAvx512(in, n); }
+            if (hasAvx2()) { return sumAvx2(in, n); }
+#endif
+            return sumScalar(in, 0, n);
+        }
+
+        template <typename T>
+        std::complex<T> dotDispatch(const std::complex<T>* lhs, const std::complex<T>* rhs, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return dotAvx512(lhs, rhs, n); }
+            if (hasAvx2()) { return dotAvx2(lhs, rhs, n); }
+#endif
+            return dotScalar(lhs, rhs, 0, n);
+        }
+
+        template <typename T>
+        void weightedSumDispatch(const std::complex<T>* const* sources, const std::complex<T>* weights, tensorSize taps,
+                                 std::complex<T>* out, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return weightedSumAvx512(sources, weights, taps, out, n); }
+            if (hasAvx2()) { return weightedSumAvx2(sources, weights, taps, out, n); }
+#endif
+            weightedSumScalar(sources, weights, taps, out, 0, n);
+        }
+
+        template <typename T>
+        void multiplyDispatch(SplitPlanes<const T> lhs, SplitPlanes<const T> rhs, SplitPlanes<T> out, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return multiplyAvx512(lhs, rhs, out, n); }
+            if (hasAvx2()) { return multiplyAvx2(lhs, rhs, out, n); }
+#endif
+            multiplyScalar(lhs, rhs, out, 0, n);
+        }
+
+        template <typename T>
+        std::complex<T> sumDispatch(SplitPlanes<const T> in, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return sumAvx512(in, n); }
+            if (hasAvx2()) { return sumAvx2(in, n); }
+#endif
+            return sumScalar(in, 0, n);
+        }
+
+        template <typename T>
+        std::complex<T> dotDispatch(SplitPlanes<const T> lhs, SplitPlanes<const T> rhs, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return dotAvx512(lhs, rhs, n); }
+            if (hasAvx2()) { return dotAvx2(lhs, rhs, n); }
+#endif
+            return dotScalar(lhs, rhs, 0, n);
+        }
+
+        template <typename T>
+        void splitOf(const std::complex<T>* in, SplitPlanes<T> out, tensorSize n) {
+            for (tensorSize i = 0; i < n; i++) {
+                out.real[i] = in[i].real();
+                out.imag[i] = in[i].imag();
+            }
+        }
+
+        template <typename T>
+        void interleaveOf(SplitPlanes<const T> in, std::complex<T>* out, tensorSize n) {
+            for (tensorSize i = 0; i < n; i++) {
+                out[i] = {in.real[i], in.imag[i]};
+            }
+        }
+    }
+
+    void multiply(const std::complex<float>* lhs, const std::complex<float>* rhs, std::complex<float>* out, tensorSize n) { multiplyDispatch(lhs, rhs, out, n); }
+    void multiply(const std::complex<double>* lhs, const std::complex<double>* rhs, std::complex<double>* out, tensorSize n) { multiplyDispatch(lhs, rhs, out, n); }
+    std::complex<float> sum(const std::complex<float>* in, tensorSize n) { return sumDispatch(in, n); }
+    std::complex<double> sum(const std::complex<double>* in, tensorSize n) { return sumDispatch(in, n); }
+    std::complex<float> dot(const std::complex<float>* lhs, const std::complex<float>* rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+    std::complex<double> dot(const std::complex<double>* lhs, const std::complex<double>* rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+
+    void weightedSum(const std::complex<float>* const* sources, const std::complex<float>* weights, tensorSize taps,
+                     std::complex<float>* out, tensorSize n) { weightedSumDispatch(sources, weights, taps, out, n); }
+    void weightedSum(const std::complex<double>* const* sources, const std::complex<double>* weights, tensorSize taps,
+                     std::complex<double>* out, tensorSize n) { weightedSumDispatch(sources, weights, taps, out, n); }
+
+    void multiply(SplitPlanes<const float> lhs, SplitPlanes<const float> rhs, SplitPlanes<float> out, tensorSize n) { multiplyDispatch(lhs, rhs, out, n); }
+    void multiply(SplitPlanes<const double> lhs, SplitPlanes<const double> rhs, SplitPlanes<double> out, tensorSize n) { multiplyDispatch(lhs, rhs, out, n); }
+    std::complex<float> sum(SplitPlanes<const float> in, tensorSize n) { return sumDispatch(in, n); }
+    std::complex<double> sum(SplitPlanes<const double> in, tensorSize n) { return sumDispatch(in, n); }
+    std::complex<float> dot(SplitPlanes<const float> lhs, SplitPlanes<const float> rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+    std::complex<double> dot(SplitPlanes<const double> lhs, SplitPlanes<const double> rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+
+    void split(const std::complex<float>* in, SplitPlanes<float> out, tensorSize n) { splitOf(in, out, n); }
+    void split(const std::complex<double>* in, SplitPlanes<double> out, tensorSize n) { splitOf(in, out, n); }
+    void interleave(SplitPlanes<const float> in, std::complex<float>* out, tensorSize n) { interleaveOf(in, out, n); }
+    void interleave(SplitPlanes<const double> in, std::complex<double>* out, tensorSize n) { interleaveOf(in, out, n); }
+}
@@ -0,0 +1,455 @@
+#include "TensorII/private/ConvolutionKernels.h"
+#include "TensorII/private/CpuFeatures.h"
+#include "TensorII/private/FFTKernels.h"
+#include "TensorII/private/Parallel.h"
+#include "TensorII/private/SimdTargets.h"
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+#include <vector>
+
+namespace TensorII::Core::Private {
+
+    namespace {
+        //region Weighted sums
+        template <typename T>
+        void weightedSumScalar(const T* const* sources, const T* weights, tensorSize taps, T* out, tensorSize begin, tensorSize n) {
+            // Element by element, so out may be one of the sources
+            for (tensorSize i = begin; i < n; i++) {
+                T total {};
+                for (tensorSize tap = 0; tap < taps; tap++) {
+                    total += weights[tap] * sources[tap][i];
+                }
+                out[i] = total;
+            }
+        }
+
+#ifdef TENSORII_SIMD_KERNELS
+TENSORII_SIMD_WARNINGS_PUSH
+        struct Avx512Float {
+            using Vector = __m512;
+            static constexpr tensorSize width = 16;
+            TENSORII_TARGET_AVX512 static Vector zero() { return _mm512_setzero_ps(); }
+            TENSORII_TARGET_AVX512 static Vector broadcast(float value) { return _mm512_set1_ps(value); }
+            TENSORII_TARGET_AVX512 static Vector load(const float* in) { return _mm512_loadu_ps(in); }
+            TENSORII_TARGET_AVX512 static void store(float* out, Vector value) { _mm512_storeu_ps(out, value); }
+            TENSORII_TARGET_AVX512 static Vector fma(Vector a, Vector b, Vector c) { return _mm512_fmadd_ps(a, b, c); }
+            TENSORII_TARGET_AVX512 static Vector loadFirst(const float* in, tensorSize count) {
+                return _mm512_maskz_loadu_ps(static_cast<__mmask16>((1u << count) - 1), in);
+            }
+            TENSORII_TARGET_AVX512 static void storeFirst(float* out, Vector value, tensorSize count) {
+                _mm512_mask_storeu_ps(out, static_cast<__mmask16>((1u << count) - 1), value);
+            }
+        };
+
+        struct Avx512Double {
+            using Vector = __m512d;
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX512 static Vector zero() { return _mm512_setzero_pd(); }
+            TENSORII_TARGET_AVX512 static Vector broadcast(double value) { return _mm512_set1_pd(value); }
+            TENSORII_TARGET_AVX512 static Vector load(const double* in) { return _mm512_loadu_pd(in); }
+            TENSORII_TARGET_AVX512 static void store(double* out, Vector value) { _mm512_storeu_pd(out, value); }
+            TENSORII_TARGET_AVX512 static Vector fma(Vector a, Vector b, Vector c) { return _mm512_fmadd_pd(a, b, c); }
+            TENSORII_TARGET_AVX512 static Vector loadFirst(const double* in, tensorSize count) {
+                return _mm512_maskz_loadu_pd(static_cast<__mmask8>((1u << count) - 1), in);
+            }
+            TENSORII_TARGET_AVX512 static void storeFirst(double* out, Vector value, tensorSize count) {
+                _mm512_mask_storeu_pd(out, static_cast<__mmask8>((1u << count) - 1), value);
+            }
+        };
+
+        // Four vectors of outputs at a time, each tap's weight broadcast once for all four
+        template <typename Ops, typename T>
+        TENSORII_TARGET_AVX512 void weightedSumAvx512(const T* const* sources, const T* weights, tensorSize taps,
+                                                      T* out, tensorSize n) {
+            constexpr tensorSize width = Ops::width;
+            tensorSize i = 0;
+            for (; i + 4 * width <= n; i += 4 * width) {
+                auto a0 = Ops::zero(), a1 = Ops::zero(), a2 = Ops::zero(), a3 = Ops::zero();
+                for (tensorSize tap = 0; tap < taps; tap++) {
+                    const auto weight = Ops::broadcast(weights[tap]);
+                    const T* source = sources[tap] + i;
+                    a0 = Ops::fma(weight, Ops::load(source), a0);
+                    a1 = Ops::fma(weight, Ops::load(source + width), a1);
+                    a2 = Ops::fma(weight, Ops::load(source + 2 * width), a2);
+                    a3 = Ops::fma(weight, Ops::load(source + 3 * width), a3);
+                }
+                Ops::store(out + i, a0);
+                Ops::store(out + i + width, a1);
+                Ops::store(out + i + 2 * width, a2);
+                Ops::store(out + i + 3 * width, a3);
+            }
+            for (; i < n; i += width) {
+                const tensorSize count = std::min(width, n - i);
+                auto total = Ops::zero();
+                for (tensorSize tap = 0; tap < taps; tap++) {
+                    total = Ops::fma(Ops::broadcast(weights[tap]), Ops::loadFirst(sources[tap] + i, count), total);
+                }
+                Ops::storeFirst(out + i, total, count);
+            }
+        }
+TENSORII_SIMD_WARNINGS_POP
+
+        struct Avx2Float {
+            using Vector = __m256;
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX2_FMA static Vector zero() { return _mm256_setzero_ps(); }
+            TENSORII_TARGET_AVX2_FMA static Vector broadcast(float value) { return _mm256_set1_ps(value); }
+            TENSORII_TARGET_AVX2_FMA static Vector load(const float* in) { return _mm256_loadu_ps(in); }
+            TENSORII_TARGET_AVX2_FMA static void store(float* out, Vector value) { _mm256_storeu_ps(out, value); }
+            TENSORII_TARGET_AVX2_FMA static Vector fma(Vector a, Vector b, Vector c) { return _mm256_fmadd_ps(a, b, c); }
+        };
+
+        struct Avx2Double {
+            using Vector = __m256d;
+            static constexpr tensorSize width = 4;
+            TENSORII_TARGET_AVX2_FMA static Vector zero() { return _mm256_setzero_pd(); }
+            TENSORII_TARGET_AVX2_FMA static Vector broadcast(double value) { return _mm256_set1_pd(value); }
+            TENSORII_TARGET_AVX2_FMA static Vector load(const double* in) { return _mm256_loadu_pd(in); }
+            TENSORII_TARGET_AVX2_FMA static void store(double* out, Vector value) { _mm256_storeu_pd(out, value); }
+            TENSORII_TARGET_AVX2_FMA static Vector fma(Vector a, Vector b, Vector c) { return _mm256_fmadd_pd(a, b, c); }
+        };
+
+        template <typename Ops, typename T>
+        TENSORII_TARGET_AVX2_FMA void weightedSumAvx2(const T* const* sources, const T* weights, tensorSize taps,
+                                                      T* out, tensorSize n) {
+            constexpr tensorSize width = Ops::width;
+            tensorSize i = 0;
+            for (; i + 4 * width <= n; i += 4 * width) {
+                auto a0 = Ops::zero(), a1 = Ops::zero(), a2 = Ops::zero(), a3 = Ops::zero();
+                for (tensorSize tap = 0; tap < taps; tap++) {
+                    const auto weight = Ops::broadcast(weights[tap]);
+                    const T* source = sources[tap] + i;
+                    a0 = Ops::fma(weight, Ops::load(source), a0);
+                    a1 = Ops::fma(weight, Ops::load(source + width), a1);
+                    a2 = Ops::fma(weight, Ops::load(source + 2 * width), a2);
+                    a3 = Ops::fma(weight, Ops::load(source + 3 * width), a3);
+                }
+                Ops::store(out + i, a0);
+                Ops::store(out + i + width, a1);
+                Ops::store(out + i + 2 * width, a2);
+                Ops::store(out + i + 3 * width, a3);
+            }
+            for (; i + width <= n; i += width) {
+                auto total = Ops::zero();
+                for (tensorSize tap = 0; tap < taps; tap++) {
+                    total = Ops::fma(Ops::broadcast(weights[tap]), Ops::load(sources[tap] + i), total);
+                }
+                Ops::store(out + i, total);
+            }
+            weightedSumScalar(sources, weights, taps, out, i, n);
+        }
+#endif
+
+        template <typename T>
+        void weightedSumDispatch(const T* const* sources, const T* weights, tensorSize taps, T* out, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            using Avx512 = std::conditional_t<std::is_same_v<T, float>, Avx512Float, Avx512Double>;
+            using Avx2 = std::conditional_t<std::is_same_v<T, float>, Avx2Float, Avx2Double>;
+            if (cpuFeatures().avx512f) { return weightedSumAvx512<Avx512>(sources, weights, taps, out, n); }
+            if (cpuFeatures().avx2 && cpuFeatures().fma) { return weightedSumAvx2<Avx2>(sources, weights, taps, out, n); }
+#endif
+            weightedSumScalar(sources, weights, taps, out, 0, n);
+        }
+        //endregion
+
+        //region Padding
+        tensorIndex resolve(tensorIndex i, tensorIndex extent, Boundary boundary) {
+            switch (boundary) {
+                case Boundary::Periodic: return resolveIndex<Boundary::Periodic>(i, extent);
+                case Boundary::Neumann: return resolveIndex<Boundary::Neumann>(i, extent);
+                case Boundary::Dirichlet:
+                default: return resolveIndex<Boundary::Dirichlet>(i, extent);
+            }
+        }
+
+        // Row 'row' of the image, which may lie beyond its edges, with 'left' and 'right' columns of padding
+        template <typename T>
+        void padRow(const T* in, ImageExtents extents, tensorIndex row, tensorSize left, tensorSize right,
+                    Boundary boundary, T boundaryValue, T* padded) {
+            const tensorSize rowLength = extents.columns * extents.bands;
+            const tensorIndex source = resolve(row, static_cast<tensorIndex>(extents.rows), boundary);
+            if (source < 0) {
+                std::fill_n(padded, rowLength + (left + right) * extents.bands, boundaryValue);
+                return;
+            }
+            const T* sourceRow = in + static_cast<tensorSize>(source) * rowLength;
+            std::memcpy(padded + left * extents.bands, sourceRow, rowLength * sizeof(T));
+            const auto padColumn = [&](tensorIndex column, T* to) {
+                const tensorIndex resolved = resolve(column, static_cast<tensorIndex>(extents.columns), boundary);
+                if (resolved < 0) {
+                    std::fill_n(to, extents.bands, boundaryValue);
+                } else {
+                    std::copy_n(sourceRow + static_cast<tensorSize>(resolved) * extents.bands, extents.bands, to);
+                }
+            };
+            for (tensorSize column = 0; column < left; column++) {
+                padColumn(static_cast<tensorIndex>(column) - static_cast<tensorIndex>(left), padded + column * extents.bands);
+            }
+            for (tensorSize column = 0; column < right; column++) {
+                padColumn(static_cast<tensorIndex>(extents.columns + column),
+                          padded + (left + extents.columns + column) * extents.bands);
+            }
+        }
+
+        // Padded copies of the last 'size' rows read, each in the slot of its row number modulo size
+        template <typename T>
+        class RowWindow {
+        public:
+            RowWindow(tensorSize size, tensorSize rowLength)
+            : size_(static_cast<tensorIndex>(size))
+            , rowLength_(rowLength)
+            , rows_(size * rowLength)
+            {}
+
+            T* operator[](tensorIndex row) noexcept {
+                return rows_.data() + static_cast<tensorSize>((row % size_ + size_) % size_) * rowLength_;
+            }
+
+        private:
+            tensorIndex size_;
+            tensorSize rowLength_;
+            std::vector<T> rows_;
+        };
+
+        // Rows per thread, enough that starting a thread and refilling a window are small next to the work
+        tensorSize rowGrain(ImageExtents extents, tensorSize kernelRows, tensorSize tapsPerElement) {
+            const tensorSize rowWork = extents.columns * extents.bands * tapsPerElement;
+            return std::max(2 * kernelRows, (tensorSize(1) << 20) / std::max<tensorSize>(rowWork, 1));
+        }
+        //endregion
+
+        // Output row y reads kernel row i from image row y + centreRow - i, and kernel column j from padded
+        // column x + kernelColumns - 1 - j
+        template <typename T>
+        void convolveDirectImpl(const T* in, T* out, ImageExtents extents, const T* kernel,
+                                tensorSize kernelRows, tensorSize kernelColumns, Boundary boundary, T boundaryValue) {
+            const tensorSize left = kernelColumns - 1 - kernelColumns / 2;
+            const tensorSize right = kernelColumns / 2;
+            const auto centreRow = static_cast<tensorIndex>(kernelRows / 2);
+            const tensorSize rowLength = extents.columns * extents.bands;
+            const tensorSize paddedLength = rowLength + (kernelColumns - 1) * extents.bands;
+            const tensorSize taps = kernelRows * kernelColumns;
+
+            parallelFor(extents.rows, rowGrain(extents, kernelRows, taps), [&](tensorSize begin, tensorSize end) {
+                RowWindow<T> window (kernelRows, paddedLength);
+                std::vector<const T*> sources (taps);
+                const auto first = static_cast<tensorIndex>(begin);
+                for (tensorIndex row = first + centreRow - static_cast<tensorIndex>(kernelRows) + 1; row < first + centreRow; row++) {
+                    padRow(in, extents, row, left, right, boundary, boundaryValue, window[row]);
+                }
+                for (auto y = first; y < static_cast<tensorIndex>(end); y++) {
+                    padRow(in, extents, y + centreRow, left, right, boundary, boundaryValue, window[y + centreRow]);
+                    for (tensorSize i = 0; i < kernelRows; i++) {
+                        const T* padded = window[y + centreRow - static_cast<tensorIndex>(i)];
+                        for (tensorSize j = 0; j < kernelColumns; j++) {
+                            sources[i * kernelColumns + j] = padded + (kernelColumns - 1 - j) * extents.bands;
+                        }
+                    }
+                    weightedSumDispatch(sources.data(), kernel, taps, out + static_cast<tensorSize>(y) * rowLength, rowLength);
+                }
+            });
+        }
+
+        // The row kernel is applied to each padded image row as it enters the window, and the column kernel
+        // to the window's rows
+        template <typename T>
+        void convolveSeparableImpl(const T* in, T* out, ImageExtents extents,
+                                   const T* columnKernel, tensorSize kernelRows,
+                                   const T* rowKernel, tensorSize kernelColumns, Boundary boundary, T boundaryValue) {
+            const tensorSize left = kernelColumns - 1 - kernelColumns / 2;
+            const tensorSize right = kernelColumns / 2;
+            const auto centreRow = static_cast<tensorIndex>(kernelRows / 2);
+            const tensorSize rowLength = extents.columns * extents.bands;
+            const tensorSize paddedLength = rowLength + (kernelColumns - 1) * extents.bands;
+
+            parallelFor(extents.rows, rowGrain(extents, kernelRows, kernelRows + kernelColumns), [&](tensorSize begin, tensorSize end) {
+                RowWindow<T> window (kernelRows, rowLength);
+                std::vector<T> padded (paddedLength);
+                std::vector<const T*> sources (std::max(kernelRows, kernelColumns));
+                for (tensorSize j = 0; j < kernelColumns; j++) {
+                    sources[j] = padded.data() + (kernelColumns - 1 - j) * extents.bands;
+                }
+                const auto filterRow = [&](tensorIndex row) {
+                    padRow(in, extents, row, left, right, boundary, boundaryValue, padded.data());
+                    weightedSumDispatch(sources.data(), rowKernel, kernelColumns, window[row], rowLength);
+                };
+
+                const auto first = static_cast<tensorIndex>(begin);
+                for (tensorIndex row = first + centreRow - static_cast<tensorIndex>(kernelRows) + 1; row < first + centreRow; row++) {
+                    filterRow(row);
+                }
+                std::vector<const T*> rows (kernelRows);
+                for (auto y = first; y < static_cast<tensorIndex>(end); y++) {
+                    filterRow(y + centreRow);
+                    for (tensorSize i = 0; i < kernelRows; i++) {
+                        rows[i] = window[y + centreRow - static_cast<tensorIndex>(i)];
+                    }
+                    weightedSumDispatch(rows.data(), columnKernel, kernelRows, out + static_cast<tensorSize>(y) * rowLength, rowLength);
+                }
+            });
+        }
+
+        // Columns transformed together in the second pass, so they stay in L2 over all log2(rows) rounds
+        constexpr tensorSize columnBlockBytes = 128 * 1024;
+
+        // Transform of an nRows x nColumns grid of 'lanes' interleaved sequences, row by row and then down the
+        // columns a block at a time
+        void transform2D(std::complex<double>* grid, tensorSize lanes, const FFTPlan& rowsPlan,
+                         const FFTPlan& columnsPlan, bool inverse) {
+            const tensorSize rowLength = columnsPlan.size() * lanes;
+            for (tensorSize row = 0; row < rowsPlan.size(); row++) {
+                columnsPlan.transform(grid + row * rowLength, lanes, inverse);
+            }
+            const tensorSize block = std::max<tensorSize>(8, columnBlockBytes / (rowsPlan.size() * sizeof(std::complex<double>)));
+            for (tensorSize first = 0; first < rowLength; first += block) {
+                rowsPlan.transform(grid + first, std::min(block, rowLength - first), rowLength, inverse);
+            }
+        }
+
+        // Each tile of output is the valid part of a circular convolution of the image around it, padded to
+        // the transform size: the first kernelRows - 1 rows and kernelColumns - 1 columns wrap round and are
+        // dropped. Band pairs are interleaved innermost like the bands themselves, so every butterfly works on
+        // all of them at once.
+        template <typename T>
+        void convolveFFTImpl(const T* in, T* out, ImageExtents extents, const T* kernel,
+                             tensorSize kernelRows, tensorSize kernelColumns, Boundary boundary, T boundaryValue) {
+            // Transforms of around four kernels across, so most of each tile is kept, but held to 128 for as long
+            // as that's still two kernels across so a tile's transform stays in L2, and no bigger than the image
+            const auto transformSize = [](tensorSize kernelExtent, tensorSize imageExtent) {
+                const tensorSize size = std::min(nextPowerOfTwo(std::max<tensorSize>(4 * kernelExtent, 32)),
+                                                 std::max<tensorSize>(128, nextPowerOfTwo(2 * kernelExtent)));
+                return std::max<tensorSize>(2, std::min(size, nextPowerOfTwo(imageExtent + kernelExtent - 1)));
+            };
+            const tensorSize nRows = transformSize(kernelRows, extents.rows);
+            const tensorSize nColumns = transformSize(kernelColumns, extents.columns);
+            const tensorSize tileRows = nRows - kernelRows + 1, tileColumns = nColumns - kernelColumns + 1;
+            const tensorSize tilesDown = (extents.rows + tileRows - 1) / tileRows;
+            const tensorSize tilesAcross = (extents.columns + tileColumns - 1) / tileColumns;
+            const tensorSize bands = extents.bands, pairs = (bands + 1) / 2;
+            const FFTPlan rowsPlan (nRows), columnsPlan (nColumns);
+
+            // Spectrum of the kernel, with the inverse transform's scaling folded in
+            std::vector<std::complex<double>> spectrum (nRows * nColumns);
+            const double scale = 1.0 / static_cast<double>(nRows * nColumns);
+            for (tensorSize i = 0; i < kernelRows; i++) {
+                for (tensorSize j = 0; j < kernelColumns; j++) {
+                    spectrum[i * nColumns + j] = static_cast<double>(kernel[i * kernelColumns + j]) * scale;
+                }
+            }
+            transform2D(spectrum.data(), 1, rowsPlan, columnsPlan, false);
+
+            const auto top = static_cast<tensorIndex>(kernelRows - 1 - kernelRows / 2);
+            const auto leftmost = static_cast<tensorIndex>(kernelColumns - 1 - kernelColumns / 2);
+            const auto rows = static_cast<tensorIndex>(extents.rows), columns = static_cast<tensorIndex>(extents.columns);
+            // Image indices this far out only feed outputs that are dropped
+            const auto beyondRows = rows + static_cast<tensorIndex>(kernelRows);
+            const auto beyondColumns = columns + static_cast<tensorIndex>(kernelColumns);
+            // Odd band counts leave the last pair's imaginary part empty
+            const auto pairOf = [&](const T* element, tensorSize pair) {
+                const tensorSize band = 2 * pair;
+                return std::complex<double>(static_cast<double>(element[band]),
+                                            band + 1 < bands ? static_cast<double>(element[band + 1]) : 0.0);
+            };
+            const std::complex<double> boundaryPair (static_cast<double>(boundaryValue),
+                                                     bands > 1 ? static_cast<double>(boundaryValue) : 0.0);
+
+            parallelFor(tilesDown * tilesAcross, 1, [&](tensorSize begin, tensorSize end) {
+                std::vector<std::complex<double>> grid (nRows * nColumns * pairs);
+                std::vector<tensorIndex> sourceColumns (nColumns);
+                for (tensorSize tile = begin; tile < end; tile++) {
+                    const auto firstRow = static_cast<tensorIndex>((tile / tilesAcross) * tileRows);
+                    const auto firstColumn = static_cast<tensorIndex>((tile % tilesAcross) * tileColumns);
+
+                    // Image column each grid column reads, -1 for the boundary value and -2 for nothing
+                    for (tensorSize c = 0; c < nColumns; c++) {
+                        const tensorIndex column = firstColumn + static_cast<tensorIndex>(c) - leftmost;
+                        sourceColumns[c] = column < beyondColumns ? resolve(column, columns, boundary) : -2;
+                    }
+                    for (tensorSize r = 0; r < nRows; r++) {
+                        const tensorIndex row = firstRow + static_cast<tensorIndex>(r) - top;
+                        const tensorIndex sourceRow = row < beyondRows ? resolve(row, rows, boundary) : -2;
+                        const T* imageRow = in + static_cast<tensorSize>(std::max<tensorIndex>(sourceRow, 0)) * extents.columns * bands;
+                        std::complex<double>* gridRow = grid.data() + r * nColumns * pairs;
+                        for (tensorSize c = 0; c < nColumns; c++) {
+                            const tensorIndex sourceColumn = sourceColumns[c];
+                            std::complex<double>* cell = gridRow + c * pairs;
+                            if (sourceRow == -2 || sourceColumn == -2) {
+                                std::fill_n(cell, pairs, std::complex<double>());
+                            } else if (sourceRow < 0 || sourceColumn < 0) {
+                                std::fill_n(cell, pairs, boundaryPair);
+                            } else {
+                                const T* element = imageRow + static_cast<tensorSize>(sourceColumn) * bands;
+                                for (tensorSize pair = 0; pair < pairs; pair++) {
+                                    cell[pair] = pairOf(element, pair);
+                                }
+                            }
+                        }
+                    }
+
+                    transform2D(grid.data(), pairs, rowsPlan, columnsPlan, false);
+                    for (tensorSize k = 0; k < nRows * nColumns; k++) {
+                        const std::complex<double> b = spectrum[k];
+                        std::complex<double>* cell = grid.data() + k * pairs;
+                        for (tensorSize pair = 0; pair < pairs; pair++) {
+                            const std::complex<double> a = cell[pair];
+                            cell[pair] = {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+                        }
+                    }
+                    transform2D(grid.data(), pairs, rowsPlan, columnsPlan, true);
+
+                    const tensorSize keptRows = std::min(tileRows, static_cast<tensorSize>(rows - firstRow));
+                    const tensorSize keptColumns = std::min(tileColumns, static_cast<tensorSize>(columns - firstColumn));
+                    for (tensorSize r = 0; r < keptRows; r++) {
+                        const std::complex<double>* gridRow = grid.data() + ((r + kernelRows - 1) * nColumns + kernelColumns - 1) * pairs;
+                        T* outRow = out + ((static_cast<tensorSize>(firstRow) + r) * extents.columns
+                                           + static_cast<tensorSize>(firstColumn)) * bands;
+                        for (tensorSize c = 0; c < keptColumns; c++) {
+                            for (tensorSize band = 0; band < bands; band++) {
+                                const std::complex<double> value = gridRow[c * pairs + band / 2];
+                                outRow[c * bands + band] = static_cast<T>(band % 2 == 0 ? value.real() : value.imag());
+                            }
+                        }
+                    }
+                }
+            });
+        }
+    }
+
+    void weightedSum(const float* const* sources, const float* weights, tensorSize taps, float* out, tensorSize n) {
+        weightedSumDispatch(sources, weights, taps, out, n);
+    }
+    void weightedSum(const double* const* sources, const double* weights, tensorSize taps, double* out, tensorSize n) {
+        weightedSumDispatch(sources, weights, taps, out, n);
+    }
+
+    void convolveDirect(const float* in, float* out, ImageExtents extents, const float* kernel,
+                        tensorSize kernelRows, tensorSize kernelColumns, Boundary boundary, float boundaryValue) {
+        convolveDirectImpl(in, out, extents, kernel, kernelRows, kernelColumns, boundary, boundaryValue);
+    }
+    void convolveDirect(const double* in, double* out, ImageExtents extents, const double* kernel,
+                        tensorSize kernelRows, tensorSize kernelColumns, Boundary boundary, double boundaryValue) {
+        convolveDirectImpl(in, out, extents, kernel, kernelRows, kernelColumns, boundary, boundaryValue);
+    }
+
+    void convolveSeparable(const float* in, float* out, ImageExtents extents,
+                           const float* columnKernel, tensorSize kernelRows,
+                           const float* rowKernel, tensorSize kernelColumns, Boundary boundary, float boundaryValue) {
+        convolveSeparableImpl(in, out, extents, columnKernel, kernelRows, rowKernel, kernelColumns, boundary, boundaryValue);
+    }
+    void convolveSeparable(const double* in, double* out, ImageExtents extents,
+                           const double* columnKernel, tensorSize kernelRows,
+                           const double* rowKernel, tensorSize kernelColumns, Boundary boundary, double boundaryValue) {
+        convolveSeparableImpl(in, out, extents, columnKernel, kernelRows, rowKernel, kernelColumns, boundary, boundaryValue);
+    }
+
+    void convolveFFT(const float* in, float* out, ImageExtents extents, const float* kernel,
+                     tensorSize kernelRows, tensorSize kernelColumns, Boundary boundary, float boundaryValue) {
+        convolveFFTImpl(in, out, extents, kernel, kernelRows, kernelColumns, boundary, boundaryValue);
+    }
+    void convolveFFT(const double* in, double* out, ImageExtents extents, const double* kernel,
+                     tensorSize kernelRows, tensorSize kernelColumns, Boundary boundary, double boundaryValue) {
+        convolveFFTImpl(in, out, extents, kernel, kernelRows, kernelColumns, boundary, boundaryValue);
+    }
+}
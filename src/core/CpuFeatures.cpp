@@ -0,0 +1,20 @@
+#include "TensorII/private/CpuFeatures.h"
+
+namespace TensorII::Core::Private {
+
+    const CpuFeatures& cpuFeatures() {
+#if defined(__GNUC__) && defined(__x86_64__)
+        static const CpuFeatures features {
+            __builtin_cpu_supports("avx2") != 0,
+            __builtin_cpu_supports("fma") != 0,
+            __builtin_cpu_supports("f16c") != 0,
+            __builtin_cpu_supports("avx512f") != 0,
+            __builtin_cpu_supports("avx512bw") != 0,
+            __builtin_cpu_supports("avx512vnni") != 0,
+        };
+#else
+        static const CpuFeatures features {};
+#endif
+        return features;
+    }
+}
@@ -0,0 +1,308 @@
+#include "TensorII/private/ElementwiseKernels.h"
+#include "TensorII/private/CpuFeatures.h"
+#include "TensorII/private/SimdTargets.h"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace TensorII::Core::Private {
+
+    namespace {
+        enum class Arithmetic { Add, Subtract, Multiply, Divide };
+
+        //region Scalar, also used for the tails of the AVX2 loops
+        template <Arithmetic op, typename T>
+        void elementwiseScalar(const T* lhs, const T* rhs, T* out, tensorSize begin, tensorSize n) {
+            for (tensorSize i = begin; i < n; i++) {
+                if constexpr (op == Arithmetic::Add) { out[i] = lhs[i] + rhs[i]; }
+                else if constexpr (op == Arithmetic::Subtract) { out[i] = lhs[i] - rhs[i]; }
+                else if constexpr (op == Arithmetic::Multiply) { out[i] = lhs[i] * rhs[i]; }
+                else { out[i] = lhs[i] / rhs[i]; }
+            }
+        }
+
+        template <typename T>
+        T sumScalar(const T* in, tensorSize begin, tensorSize n) {
+            T result {};
+            for (tensorSize i = begin; i < n; i++) {
+                result += in[i];
+            }
+            return result;
+        }
+
+        template <typename T>
+        T dotScalar(const T* lhs, const T* rhs, tensorSize begin, tensorSize n) {
+            T result {};
+            for (tensorSize i = begin; i < n; i++) {
+                result += lhs[i] * rhs[i];
+            }
+            return result;
+        }
+        //endregion
+
+#ifdef TENSORII_SIMD_KERNELS
+TENSORII_SIMD_WARNINGS_PUSH
+        //region Vector operations
+        struct Avx512Float {
+            using Vector = __m512;
+            static constexpr tensorSize width = 16;
+            TENSORII_TARGET_AVX512 static Vector load(const float* in) { return _mm512_loadu_ps(in); }
+            TENSORII_TARGET_AVX512 static void store(float* out, Vector value) { _mm512_storeu_ps(out, value); }
+            TENSORII_TARGET_AVX512 static Vector loadFirst(const float* in, tensorSize count) {
+                return _mm512_maskz_loadu_ps(static_cast<__mmask16>((1u << count) - 1), in);
+            }
+            TENSORII_TARGET_AVX512 static void storeFirst(float* out, Vector value, tensorSize count) {
+                _mm512_mask_storeu_ps(out, static_cast<__mmask16>((1u << count) - 1), value);
+            }
+            template <Arithmetic op>
+            TENSORII_TARGET_AVX512 static Vector apply(Vector lhs, Vector rhs) {
+                if constexpr (op == Arithmetic::Add) { return _mm512_add_ps(lhs, rhs); }
+                else if constexpr (op == Arithmetic::Subtract) { return _mm512_sub_ps(lhs, rhs); }
+                else if constexpr (op == Arithmetic::Multiply) { return _mm512_mul_ps(lhs, rhs); }
+                else { return _mm512_div_ps(lhs, rhs); }
+            }
+            TENSORII_TARGET_AVX512 static Vector zero() { return _mm512_setzero_ps(); }
+            TENSORII_TARGET_AVX512 static Vector add(Vector lhs, Vector rhs) { return _mm512_add_ps(lhs, rhs); }
+            TENSORII_TARGET_AVX512 static Vector multiplyAdd(Vector lhs, Vector rhs, Vector total) {
+                return _mm512_fmadd_ps(lhs, rhs, total);
+            }
+            TENSORII_TARGET_AVX512 static float reduce(Vector values) { return _mm512_reduce_add_ps(values); }
+        };
+
+        struct Avx512Double {
+            using Vector = __m512d;
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX512 static Vector load(const double* in) { return _mm512_loadu_pd(in); }
+            TENSORII_TARGET_AVX512 static void store(double* out, Vector value) { _mm512_storeu_pd(out, value); }
+            TENSORII_TARGET_AVX512 static Vector loadFirst(const double* in, tensorSize count) {
+                return _mm512_maskz_loadu_pd(static_cast<__mmask8>((1u << count) - 1), in);
+            }
+            TENSORII_TARGET_AVX512 static void storeFirst(double* out, Vector value, tensorSize count) {
+                _mm512_mask_storeu_pd(out, static_cast<__mmask8>((1u << count) - 1), value);
+            }
+            template <Arithmetic op>
+            TENSORII_TARGET_AVX512 static Vector apply(Vector lhs, Vector rhs) {
+                if constexpr (op == Arithmetic::Add) { return _mm512_add_pd(lhs, rhs); }
+                else if constexpr (op == Arithmetic::Subtract) { return _mm512_sub_pd(lhs, rhs); }
+                else if constexpr (op == Arithmetic::Multiply) { return _mm512_mul_pd(lhs, rhs); }
+                else { return _mm512_div_pd(lhs, rhs); }
+            }
+            TENSORII_TARGET_AVX512 static Vector zero() { return _mm512_setzero_pd(); }
+            TENSORII_TARGET_AVX512 static Vector add(Vector lhs, Vector rhs) { return _mm512_add_pd(lhs, rhs); }
+            TENSORII_TARGET_AVX512 static Vector multiplyAdd(Vector lhs, Vector rhs, Vector total) {
+                return _mm512_fmadd_pd(lhs, rhs, total);
+            }
+            TENSORII_TARGET_AVX512 static double reduce(Vector values) { return _mm512_reduce_add_pd(values); }
+        };
+
+        struct Avx2Float {
+            using Vector = __m256;
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX2 static Vector load(const float* in) { return _mm256_loadu_ps(in); }
+            TENSORII_TARGET_AVX2 static void store(float* out, Vector value) { _mm256_storeu_ps(out, value); }
+            template <Arithmetic op>
+            TENSORII_TARGET_AVX2 static Vector apply(Vector lhs, Vector rhs) {
+                if constexpr (op == Arithmetic::Add) { return _mm256_add_ps(lhs, rhs); }
+                else if constexpr (op == Arithmetic::Subtract) { return _mm256_sub_ps(lhs, rhs); }
+                else if constexpr (op == Arithmetic::Multiply) { return _mm256_mul_ps(lhs, rhs); }
+                else { return _mm256_div_ps(lhs, rhs); }
+            }
+            TENSORII_TARGET_AVX2 static Vector zero() { return _mm256_setzero_ps(); }
+            TENSORII_TARGET_AVX2 static Vector add(Vector lhs, Vector rhs) { return _mm256_add_ps(lhs, rhs); }
+            TENSORII_TARGET_AVX2_FMA static Vector multiplyAdd(Vector lhs, Vector rhs, Vector total) {
+                return _mm256_fmadd_ps(lhs, rhs, total);
+            }
+            TENSORII_TARGET_AVX2 static float reduce(Vector values) {
+                __m128 sum = _mm_add_ps(_mm256_castps256_ps128(values), _mm256_extractf128_ps(values, 1));
+                sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+                sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+                return _mm_cvtss_f32(sum);
+            }
+        };
+
+        struct Avx2Double {
+            using Vector = __m256d;
+            static constexpr tensorSize width = 4;
+            TENSORII_TARGET_AVX2 static Vector load(const double* in) { return _mm256_loadu_pd(in); }
+            TENSORII_TARGET_AVX2 static void store(double* out, Vector value) { _mm256_storeu_pd(out, value); }
+            template <Arithmetic op>
+            TENSORII_TARGET_AVX2 static Vector apply(Vector lhs, Vector rhs) {
+                if constexpr (op == Arithmetic::Add) { return _mm256_add_pd(lhs, rhs); }
+                else if constexpr (op == Arithmetic::Subtract) { return _mm256_sub_pd(lhs, rhs); }
+                else if constexpr (op == Arithmetic::Multiply) { return _mm256_mul_pd(lhs, rhs); }
+                else { return _mm256_div_pd(lhs, rhs); }
+            }
+            TENSORII_TARGET_AVX2 static Vector zero() { return _mm256_setzero_pd(); }
+            TENSORII_TARGET_AVX2 static Vector add(Vector lhs, Vector rhs) { return _mm256_add_pd(lhs, rhs); }
+            TENSORII_TARGET_AVX2_FMA static Vector multiplyAdd(Vector lhs, Vector rhs, Vector total) {
+                return _mm256_fmadd_pd(lhs, rhs, total);
+            }
+            TENSORII_TARGET_AVX2 static double reduce(Vector values) {
+                __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(values), _mm256_extractf128_pd(values, 1));
+                sum = _mm_add_sd(sum, _mm_unpackhi_pd(sum, sum));
+                return _mm_cvtsd_f64(sum);
+            }
+        };
+        //endregion
+
+        // Four vectors at a time, so the loads of one aren't waiting on the store of the last
+        template <Arithmetic op, typename Ops, typename T>
+        TENSORII_TARGET_AVX512 void elementwiseAvx512(const T* lhs, const T* rhs, T* out, tensorSize n) {
+            constexpr tensorSize width = Ops::width;
+            tensorSize i = 0;
+            for (; i + 4 * width <= n; i += 4 * width) {
+                const auto r0 = Ops::template apply<op>(Ops::load(lhs + i), Ops::load(rhs + i));
+                const auto r1 = Ops::template apply<op>(Ops::load(lhs + i + width), Ops::load(rhs + i + width));
+                const auto r2 = Ops::template apply<op>(Ops::load(lhs + i + 2 * width), Ops::load(rhs + i + 2 * width));
+                const auto r3 = Ops::template apply<op>(Ops::load(lhs + i + 3 * width), Ops::load(rhs + i + 3 * width));
+                Ops::store(out + i, r0);
+                Ops::store(out + i + width, r1);
+                Ops::store(out + i + 2 * width, r2);
+                Ops::store(out + i + 3 * width, r3);
+            }
+            for (; i < n; i += width) {
+                const tensorSize count = std::min(width, n - i);
+                Ops::storeFirst(out + i, Ops::template apply<op>(Ops::loadFirst(lhs + i, count), Ops::loadFirst(rhs + i, count)), count);
+            }
+        }
+
+        // Four accumulators, so each add waits on the one four back rather than the last
+        template <typename Ops, typename T>
+        TENSORII_TARGET_AVX512 T sumAvx512(const T* in, tensorSize n) {
+            constexpr tensorSize width = Ops::width;
+            auto sum0 = Ops::zero(), sum1 = Ops::zero(), sum2 = Ops::zero(), sum3 = Ops::zero();
+            tensorSize i = 0;
+            for (; i + 4 * width <= n; i += 4 * width) {
+                sum0 = Ops::add(sum0, Ops::load(in + i));
+                sum1 = Ops::add(sum1, Ops::load(in + i + width));
+                sum2 = Ops::add(sum2, Ops::load(in + i + 2 * width));
+                sum3 = Ops::add(sum3, Ops::load(in + i + 3 * width));
+            }
+            for (; i < n; i += width) {
+                sum0 = Ops::add(sum0, Ops::loadFirst(in + i, std::min(width, n - i)));
+            }
+            return Ops::reduce(Ops::add(Ops::add(sum0, sum1), Ops::add(sum2, sum3)));
+        }
+
+        template <typename Ops, typename T>
+        TENSORII_TARGET_AVX512 T dotAvx512(const T* lhs, const T* rhs, tensorSize n) {
+            constexpr tensorSize width = Ops::width;
+            auto sum0 = Ops::zero(), sum1 = Ops::zero(), sum2 = Ops::zero(), sum3 = Ops::zero();
+            tensorSize i = 0;
+            for (; i + 4 * width <= n; i += 4 * width) {
+                sum0 = Ops::multiplyAdd(Ops::load(lhs + i), Ops::load(rhs + i), sum0);
+                sum1 = Ops::multiplyAdd(Ops::load(lhs + i + width), Ops::load(rhs + i + width), sum1);
+                sum2 = Ops::multiplyAdd(Ops::load(lhs + i + 2 * width), Ops::load(rhs + i + 2 * width), sum2);
+                sum3 = Ops::multiplyAdd(Ops::load(lhs + i + 3 * width), Ops::load(rhs + i + 3 * width), sum3);
+            }
+            for (; i < n; i += width) {
+                const tensorSize count = std::min(width, n - i);
+                sum0 = Ops::multiplyAdd(Ops::loadFirst(lhs + i, count), Ops::loadFirst(rhs + i, count), sum0);
+            }
+            return Ops::reduce(Ops::add(Ops::add(sum0, sum1), Ops::add(sum2, sum3)));
+        }
+TENSORII_SIMD_WARNINGS_POP
+
+        template <Arithmetic op, typename Ops, typename T>
+        TENSORII_TARGET_AVX2 void elementwiseAvx2(const T* lhs, const T* rhs, T* out, tensorSize n) {
+            constexpr tensorSize width = Ops::width;
+            tensorSize i = 0;
+            for (; i + 4 * width <= n; i += 4 * width) {
+                const auto r0 = Ops::template apply<op>(Ops::load(lhs + i), Ops::load(rhs + i));
+                const auto r1 = Ops::template apply<op>(Ops::load(lhs + i + width), Ops::load(rhs + i + width));
+                const auto r2 = Ops::template apply<op>(Ops::load(lhs + i + 2 * width), Ops::load(rhs + i + 2 * width));
+                const auto r3 = Ops::template apply<op>(Ops::load(lhs + i + 3 * width), Ops::load(rhs + i + 3 * width));
+                Ops::store(out + i, r0);
+                Ops::store(out + i + width, r1);
+                Ops::store(out + i + 2 * width, r2);
+                Ops::store(out + i + 3 * width, r3);
+            }
+            for (; i + width <= n; i += width) {
+                Ops::store(out + i, Ops::template apply<op>(Ops::load(lhs + i), Ops::load(rhs + i)));
+            }
+            elementwiseScalar<op>(lhs, rhs, out, i, n);
+        }
+
+        template <typename Ops, typename T>
+        TENSORII_TARGET_AVX2 T sumAvx2(const T* in, tensorSize n) {
+            constexpr tensorSize width = Ops::width;
+            auto sum0 = Ops::zero(), sum1 = Ops::zero(), sum2 = Ops::zero(), sum3 = Ops::zero();
+            tensorSize i = 0;
+            for (; i + 4 * width <= n; i += 4 * width) {
+                sum0 = Ops::add(sum0, Ops::load(in + i));
+                sum1 = Ops::add(sum1, Ops::load(in + i + width));
+                sum2 = Ops::add(sum2, Ops::load(in + i + 2 * width));
+                sum3 = Ops::add(sum3, Ops::load(in + i + 3 * width));
+            }
+            for (; i + width <= n; i += width) {
+                sum0 = Ops::add(sum0, Ops::load(in + i));
+            }
+            return Ops::reduce(Ops::add(Ops::add(sum0, sum1), Ops::add(sum2, sum3))) + sumScalar(in, i, n);
+        }
+
+        template <typename Ops, typename T>
+        TENSORII_TARGET_AVX2_FMA T dotAvx2(const T* lhs, const T* rhs, tensorSize n) {
+            constexpr tensorSize width = Ops::width;
+            auto sum0 = Ops::zero(), sum1 = Ops::zero(), sum2 = Ops::zero(), sum3 = Ops::zero();
+            tensorSize i = 0;
+            for (; i + 4 * width <= n; i += 4 * width) {
+                sum0 = Ops::multiplyAdd(Ops::load(lhs + i), Ops::load(rhs + i), sum0);
+                sum1 = Ops::multiplyAdd(Ops::load(lhs + i + width), Ops::load(rhs + i + width), sum1);
+                sum2 = Ops::multiplyAdd(Ops::load(lhs + i + 2 * width), Ops::load(rhs + i + 2 * width), sum2);
+                sum3 = Ops::multiplyAdd(Ops::load(lhs + i + 3 * width), Ops::load(rhs + i + 3 * width), sum3);
+            }
+            for (; i + width <= n; i += width) {
+                sum0 = Ops::multiplyAdd(Ops::load(lhs + i), Ops::load(rhs + i), sum0);
+            }
+            return Ops::reduce(Ops::add(Ops::add(sum0, sum1), Ops::add(sum2, sum3))) + dotScalar(lhs, rhs, i, n);
+        }
+#endif
+
+        template <Arithmetic op, typename T>
+        void elementwiseDispatch(const T* lhs, const T* rhs, T* out, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            using Avx512 = std::conditional_t<std::is_same_v<T, float>, Avx512Float, Avx512Double>;
+            using Avx2 = std::conditional_t<std::is_same_v<T, float>, Avx2Float, Avx2Double>;
+            if (cpuFeatures().avx512f) { return elementwiseAvx512<op, Avx512>(lhs, rhs, out, n); }
+            if (cpuFeatures().avx2) { return elementwiseAvx2<op, Avx2>(lhs, rhs, out, n); }
+#endif
+            elementwiseScalar<op>(lhs, rhs, out, 0, n);
+        }
+
+        template <typename T>
+        T sumDispatch(const T* in, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            using Avx512 = std::conditional_t<std::is_same_v<T, float>, Avx512Float, Avx512Double>;
+            using Avx2 = std::conditional_t<std::is_same_v<T, float>, Avx2Float, Avx2Double>;
+            if (cpuFeatures().avx512f) { return sumAvx512<Avx512>(in, n); }
+            if (cpuFeatures().avx2) { return sumAvx2<Avx2>(in, n); }
+#endif
+            return sumScalar(in, 0, n);
+        }
+
+        template <typename T>
+        T dotDispatch(const T* lhs, const T* rhs, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            using Avx512 = std::conditional_t<std::is_same_v<T, float>, Avx512Float, Avx512Double>;
+            using Avx2 = std::conditional_t<std::is_same_v<T, float>, Avx2Float, Avx2Double>;
+            if (cpuFeatures().avx512f) { return dotAvx512<Avx512>(lhs, rhs, n); }
+            if (cpuFeatures().avx2 && cpuFeatures().fma) { return dotAvx2<Avx2>(lhs, rhs, n); }
+#endif
+            return dotScalar(lhs, rhs, 0, n);
+        }
+    }
+
+    void add(const float* lhs, const float* rhs, float* out, tensorSize n) { elementwiseDispatch<Arithmetic::Add>(lhs, rhs, out, n); }
+    void add(const double* lhs, const double* rhs, double* out, tensorSize n) { elementwiseDispatch<Arithmetic::Add>(lhs, rhs, out, n); }
+    void subtract(const float* lhs, const float* rhs, float* out, tensorSize n) { elementwiseDispatch<Arithmetic::Subtract>(lhs, rhs, out, n); }
+    void subtract(const double* lhs, const double* rhs, double* out, tensorSize n) { elementwiseDispatch<Arithmetic::Subtract>(lhs, rhs, out, n); }
+    void multiply(const float* lhs, const float* rhs, float* out, tensorSize n) { elementwiseDispatch<Arithmetic::Multiply>(lhs, rhs, out, n); }
+    void multiply(const double* lhs, const double* rhs, double* out, tensorSize n) { elementwiseDispatch<Arithmetic::Multiply>(lhs, rhs, out, n); }
+    void divide(const float* lhs, const float* rhs, float* out, tensorSize n) { elementwiseDispatch<Arithmetic::Divide>(lhs, rhs, out, n); }
+    void divide(const double* lhs, const double* rhs, double* out, tensorSize n) { elementwiseDispatch<Arithmetic::Divide>(lhs, rhs, out, n); }
+
+    float sum(const float* in, tensorSize n) { return sumDispatch(in, n); }
+    double sum(const double* in, tensorSize n) { return sumDispatch(in, n); }
+    float dot(const float* lhs, const float* rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+    double dot(const double* lhs, const double* rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+}
@@ -0,0 +1,464 @@
+#include "TensorII/private/FFTKernels.h"
+#include "TensorII/private/CpuFeatures.h"
+#include "TensorII/private/Parallel.h"
+#include "TensorII/private/SimdTargets.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+namespace TensorII::Core::Private {
+
+    namespace {
+        // Without -ffast-math std::complex multiplication checks every product for infinities and NaNs
+        inline std::complex<double> multiply(std::complex<double> a, std::complex<double> b) {
+            return {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+        }
+
+        // Radix 4 first, as it takes fewer multiplies per element than two radix 2 stages
+        std::vector<tensorSize> factorise(tensorSize n) {
+            constexpr tensorSize radices[] {4, 2, 3, 5};
+            std::vector<tensorSize> factors;
+            for (tensorSize factor : radices) {
+                while (n % factor == 0) {
+                    factors.push_back(factor);
+                    n /= factor;
+                }
+            }
+            return factors;
+        }
+    }
+
+    FFTPlan::FFTPlan(tensorSize n)
+    : n_(n)
+    {
+        if (!isFFTLength(n)) {
+            throw std::invalid_argument("FFT length must be positive with no prime factors other than 2, 3 and 5");
+        }
+        const std::vector<tensorSize> factors = factorise(n);
+        tensorSize span = 1;
+        for (tensorSize radix : factors) {
+            Stage stage {radix, span, std::vector<std::complex<double>>(span * (radix - 1))};
+            const auto length = static_cast<double>(span * radix);
+            for (tensorSize k = 0; k < span; k++) {
+                for (tensorSize j = 1; j < radix; j++) {
+                    stage.twiddles[k * (radix - 1) + j - 1] = std::polar(1.0, -2.0 * std::numbers::pi * static_cast<double>(j * k) / length);
+                }
+            }
+            stages_.push_back(std::move(stage));
+            span *= radix;
+        }
+
+        // Decimation in time: the first stage's transforms each take one residue mod the last radix, and so on
+        // down, so element i is read from the position its digits give most significant first
+        std::vector<tensorSize> source (n);
+        for (tensorSize i = 0; i < n; i++) {
+            tensorSize position = 0, remaining = i, size = n;
+            for (tensorSize stage = factors.size(); stage-- > 0; ) {
+                size /= factors[stage];
+                position += (remaining % factors[stage]) * size;
+                remaining /= factors[stage];
+            }
+            source[position] = i;
+        }
+        std::vector<bool> visited (n);
+        for (tensorSize start = 0; start < n; start++) {
+            if (visited[start] || source[start] == start) {
+                continue;
+            }
+            for (tensorSize position = start; !visited[position]; position = source[position]) {
+                visited[position] = true;
+                cycles_.push_back(position);
+            }
+            cycleEnds_.push_back(cycles_.size());
+        }
+    }
+
+TENSORII_SIMD_WARNINGS_PUSH
+    namespace {
+        //region Vector operations
+        struct ScalarOps {
+            using Vector = std::complex<double>;
+            static constexpr tensorSize width = 1;
+
+            static Vector load(const std::complex<double>* source) { return *source; }
+            static void store(std::complex<double>* destination, Vector value) { *destination = value; }
+            static Vector add(Vector a, Vector b) { return a + b; }
+            static Vector sub(Vector a, Vector b) { return a - b; }
+            static Vector scale(Vector a, double factor) { return a * factor; }
+            static Vector multiply(Vector a, std::complex<double> twiddle) { return Private::multiply(a, twiddle); }
+            static Vector timesI(Vector a) { return {-a.imag(), a.real()}; }
+            static Vector timesMinusI(Vector a) { return {a.imag(), -a.real()}; }
+        };
+
+#ifdef TENSORII_SIMD_KERNELS
+        // Complex products of interleaved pairs: real parts re * re - im * im from fmaddsub's subtracting even
+        // lanes, imaginary parts im * re + re * im from its adding odd lanes
+        struct Avx512Ops {
+            using Vector = __m512d;
+            static constexpr tensorSize width = 4;
+
+            TENSORII_TARGET_AVX512 static Vector load(const std::complex<double>* source) {
+                return _mm512_loadu_pd(reinterpret_cast<const double*>(source));
+            }
+            TENSORII_TARGET_AVX512 static void store(std::complex<double>* destination, Vector value) {
+                _mm512_storeu_pd(reinterpret_cast<double*>(destination), value);
+            }
+            TENSORII_TARGET_AVX512 static Vector add(Vector a, Vector b) { return _mm512_add_pd(a, b); }
+            TENSORII_TARGET_AVX512 static Vector sub(Vector a, Vector b) { return _mm512_sub_pd(a, b); }
+            TENSORII_TARGET_AVX512 static Vector scale(Vector a, double factor) { return _mm512_mul_pd(a, _mm512_set1_pd(factor)); }
+            TENSORII_TARGET_AVX512 static Vector multiply(Vector a, std::complex<double> twiddle) {
+                return _mm512_fmaddsub_pd(a, _mm512_set1_pd(twiddle.real()),
+                                          _mm512_mul_pd(_mm512_permute_pd(a, 0x55), _mm512_set1_pd(twiddle.imag())));
+            }
+            // Swap each pair, then negate the new real parts for i and the new imaginary parts for -i
+            TENSORII_TARGET_AVX512 static Vector timesI(Vector a) {
+                const __m512d swapped = _mm512_permute_pd(a, 0x55);
+                return _mm512_mask_sub_pd(swapped, 0x55, _mm512_setzero_pd(), swapped);
+            }
+            TENSORII_TARGET_AVX512 static Vector timesMinusI(Vector a) {
+                const __m512d swapped = _mm512_permute_pd(a, 0x55);
+                return _mm512_mask_sub_pd(swapped, 0xAA, _mm512_setzero_pd(), swapped);
+            }
+        };
+
+        struct Avx2Ops {
+            using Vector = __m256d;
+            static constexpr tensorSize width = 2;
+
+            TENSORII_TARGET_AVX2_FMA static Vector load(const std::complex<double>* source) {
+                return _mm256_loadu_pd(reinterpret_cast<const double*>(source));
+            }
+            TENSORII_TARGET_AVX2_FMA static void store(std::complex<double>* destination, Vector value) {
+                _mm256_storeu_pd(reinterpret_cast<double*>(destination), value);
+            }
+            TENSORII_TARGET_AVX2_FMA static Vector add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Vector sub(Vector a, Vector b) { return _mm256_sub_pd(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Vector scale(Vector a, double factor) { return _mm256_mul_pd(a, _mm256_set1_pd(factor)); }
+            TENSORII_TARGET_AVX2_FMA static Vector multiply(Vector a, std::complex<double> twiddle) {
+                return _mm256_fmaddsub_pd(a, _mm256_set1_pd(twiddle.real()),
+                                          _mm256_mul_pd(_mm256_permute_pd(a, 0x5), _mm256_set1_pd(twiddle.imag())));
+            }
+            TENSORII_TARGET_AVX2_FMA static Vector timesI(Vector a) {
+                return _mm256_addsub_pd(_mm256_setzero_pd(), _mm256_permute_pd(a, 0x5));
+            }
+            TENSORII_TARGET_AVX2_FMA static Vector timesMinusI(Vector a) {
+                return _mm256_xor_pd(_mm256_permute_pd(a, 0x5), _mm256_set_pd(-0.0, 0.0, -0.0, 0.0));
+            }
+        };
+#endif
+        //endregion
+
+        //region Butterflies
+        // One length 'radix' transform over Ops::width lanes, of elements rows[j][lane] after their twiddles.
+        // Rotations are by the forward transform's -i or the inverse's i.
+        template <typename Ops, tensorSize radix, bool inverse>
+        [[gnu::always_inline]] inline void butterfly(const std::array<std::complex<double>*, radix>& rows, tensorSize lane,
+                                                     const std::array<std::complex<double>, radix - 1>& twiddles, bool twiddled) {
+            using Vector = typename Ops::Vector;
+            Vector x[radix];
+            x[0] = Ops::load(rows[0] + lane);
+            for (tensorSize j = 1; j < radix; j++) {
+                x[j] = Ops::load(rows[j] + lane);
+                if (twiddled) {
+                    x[j] = Ops::multiply(x[j], twiddles[j - 1]);
+                }
+            }
+
+            if constexpr (radix == 2) {
+                Ops::store(rows[0] + lane, Ops::add(x[0], x[1]));
+                Ops::store(rows[1] + lane, Ops::sub(x[0], x[1]));
+            } else if constexpr (radix == 3) {
+                constexpr double sine = std::numbers::sqrt3 / 2;
+                const Vector sum = Ops::add(x[1], x[2]);
+                const Vector middle = Ops::sub(x[0], Ops::scale(sum, 0.5));
+                const Vector difference = Ops::scale(Ops::sub(x[1], x[2]), sine);
+                const Vector side = inverse ? Ops::timesI(difference) : Ops::timesMinusI(difference);
+                Ops::store(rows[0] + lane, Ops::add(x[0], sum));
+                Ops::store(rows[1] + lane, Ops::add(middle, side));
+                Ops::store(rows[2] + lane, Ops::sub(middle, side));
+            } else if constexpr (radix == 4) {
+                const Vector t0 = Ops::add(x[0], x[2]), t1 = Ops::sub(x[0], x[2]);
+                const Vector t2 = Ops::add(x[1], x[3]), difference = Ops::sub(x[1], x[3]);
+                const Vector t3 = inverse ? Ops::timesI(difference) : Ops::timesMinusI(difference);
+                Ops::store(rows[0] + lane, Ops::add(t0, t2));
+                Ops::store(rows[1] + lane, Ops::add(t1, t3));
+                Ops::store(rows[2] + lane, Ops::sub(t0, t2));
+                Ops::store(rows[3] + lane, Ops::sub(t1, t3));
+            } else {
+                static_assert(radix == 5);
+                const double c1 = std::cos(2 * std::numbers::pi / 5), c2 = std::cos(4 * std::numbers::pi / 5);
+                const double s1 = std::sin(2 * std::numbers::pi / 5), s2 = std::sin(4 * std::numbers::pi / 5);
+                const Vector p1 = Ops::add(x[1], x[4]), p2 = Ops::add(x[2], x[3]);
+                const Vector m1 = Ops::sub(x[1], x[4]), m2 = Ops::sub(x[2], x[3]);
+                const Vector a1 = Ops::add(x[0], Ops::add(Ops::scale(p1, c1), Ops::scale(p2, c2)));
+                const Vector a2 = Ops::add(x[0], Ops::add(Ops::scale(p1, c2), Ops::scale(p2, c1)));
+                const Vector e1 = Ops::add(Ops::scale(m1, s1), Ops::scale(m2, s2));
+                const Vector e2 = Ops::sub(Ops::scale(m1, s2), Ops::scale(m2, s1));
+                const Vector b1 = inverse ? Ops::timesI(e1) : Ops::timesMinusI(e1);
+                const Vector b2 = inverse ? Ops::timesI(e2) : Ops::timesMinusI(e2);
+                Ops::store(rows[0] + lane, Ops::add(x[0], Ops::add(p1, p2)));
+                Ops::store(rows[1] + lane, Ops::add(a1, b1));
+                Ops::store(rows[2] + lane, Ops::add(a2, b2));
+                Ops::store(rows[3] + lane, Ops::sub(a2, b2));
+                Ops::store(rows[4] + lane, Ops::sub(a1, b1));
+            }
+        }
+
+        // Combines every run of 'radix' transforms of length stage.span into one of length span * radix
+        template <typename Ops, tensorSize radix, bool inverse>
+        [[gnu::always_inline]] inline void pass(std::complex<double>* data, tensorSize n, tensorSize lanes, tensorSize stride,
+                                                const FFTPlan::Stage& stage) {
+            const tensorSize span = stage.span;
+            for (tensorSize start = 0; start < n; start += span * radix) {
+                for (tensorSize k = 0; k < span; k++) {
+                    std::array<std::complex<double>*, radix> rows;
+                    std::array<std::complex<double>, radix - 1> twiddles;
+                    for (tensorSize j = 0; j < radix; j++) {
+                        rows[j] = data + (start + k + j * span) * stride;
+                    }
+                    for (tensorSize j = 1; j < radix; j++) {
+                        const std::complex<double> twiddle = stage.twiddles[k * (radix - 1) + j - 1];
+                        twiddles[j - 1] = inverse ? std::conj(twiddle) : twiddle;
+                    }
+                    tensorSize lane = 0;
+                    for (; lane + Ops::width <= lanes; lane += Ops::width) {
+                        butterfly<Ops, radix, inverse>(rows, lane, twiddles, k != 0);
+                    }
+                    for (; lane < lanes; lane++) {
+                        butterfly<ScalarOps, radix, inverse>(rows, lane, twiddles, k != 0);
+                    }
+                }
+            }
+        }
+
+        template <typename Ops, bool inverse>
+        [[gnu::always_inline]] inline void passes(std::complex<double>* data, tensorSize n, tensorSize lanes, tensorSize stride,
+                                                  const std::vector<FFTPlan::Stage>& stages) {
+            for (const FFTPlan::Stage& stage : stages) {
+                switch (stage.radix) {
+                    case 2: pass<Ops, 2, inverse>(data, n, lanes, stride, stage); break;
+                    case 3: pass<Ops, 3, inverse>(data, n, lanes, stride, stage); break;
+                    case 4: pass<Ops, 4, inverse>(data, n, lanes, stride, stage); break;
+                    default: pass<Ops, 5, inverse>(data, n, lanes, stride, stage); break;
+                }
+            }
+        }
+
+        // Inlined into each target so the butterflies are too
+        template <typename Ops>
+        [[gnu::always_inline]] inline void transformWith(std::complex<double>* data, tensorSize n, tensorSize lanes, tensorSize stride,
+                                                         bool inverse, const std::vector<FFTPlan::Stage>& stages) {
+            if (inverse) {
+                passes<Ops, true>(data, n, lanes, stride, stages);
+            } else {
+                passes<Ops, false>(data, n, lanes, stride, stages);
+            }
+        }
+
+#ifdef TENSORII_SIMD_KERNELS
+        TENSORII_TARGET_AVX512 void transformAvx512(std::complex<double>* data, tensorSize n, tensorSize lanes, tensorSize stride,
+                                                    bool inverse, const std::vector<FFTPlan::Stage>& stages) {
+            transformWith<Avx512Ops>(data, n, lanes, stride, inverse, stages);
+        }
+
+        TENSORII_TARGET_AVX2_FMA void transformAvx2(std::complex<double>* data, tensorSize n, tensorSize lanes, tensorSize stride,
+                                                    bool inverse, const std::vector<FFTPlan::Stage>& stages) {
+            transformWith<Avx2Ops>(data, n, lanes, stride, inverse, stages);
+        }
+#endif
+        //endregion
+    }
+
+TENSORII_SIMD_WARNINGS_POP
+
+    void FFTPlan::transform(std::complex<double>* data, tensorSize lanes, tensorSize stride, bool inverse) const {
+        // Rotate each cycle of the digit reversal a block of lanes at a time
+        constexpr tensorSize block = 64;
+        std::array<std::complex<double>, block> carried;
+        tensorSize begin = 0;
+        for (tensorSize end : cycleEnds_) {
+            for (tensorSize first = 0; first < lanes; first += block) {
+                const tensorSize count = std::min(block, lanes - first);
+                std::copy_n(data + cycles_[begin] * stride + first, count, carried.data());
+                for (tensorSize i = begin; i + 1 < end; i++) {
+                    std::copy_n(data + cycles_[i + 1] * stride + first, count, data + cycles_[i] * stride + first);
+                }
+                std::copy_n(carried.data(), count, data + cycles_[end - 1] * stride + first);
+            }
+            begin = end;
+        }
+
+#ifdef TENSORII_SIMD_KERNELS
+        if (lanes > 1 && cpuFeatures().avx512f) {
+            return transformAvx512(data, n_, lanes, stride, inverse, stages_);
+        }
+        if (lanes > 1 && cpuFeatures().avx2 && cpuFeatures().fma) {
+            return transformAvx2(data, n_, lanes, stride, inverse, stages_);
+        }
+#endif
+        transformWith<ScalarOps>(data, n_, lanes, stride, inverse, stages_);
+    }
+
+    namespace {
+        //region Transforms along an axis
+        // Sequences are gathered a chunk at a time into interleaved lanes, enough to fill the vectors without
+        // the chunk outgrowing the L2 cache
+        tensorSize chunkLanes(tensorSize n) {
+            return std::clamp<tensorSize>(16384 / n, 4, 64);
+        }
+
+        // Offset of the first element of each of 'count' sequences from 'first', numbered row-major over the
+        // outer and inner axes
+        void sequenceOffsets(AxisExtents extents, tensorSize first, tensorSize count, std::vector<tensorSize>& offsets) {
+            for (tensorSize l = 0; l < count; l++) {
+                const tensorSize sequence = first + l;
+                offsets[l] = (sequence / extents.inner) * extents.n * extents.inner + sequence % extents.inner;
+            }
+        }
+
+        // Calls function(k, l) for element k of every lane l, in the order that reads or writes memory
+        // contiguously: along each sequence when the axis is innermost, else across the sequences
+        template <typename Function>
+        [[gnu::always_inline]] inline void forEachElement(AxisExtents extents, tensorSize lanes, Function&& function) {
+            if (extents.inner == 1) {
+                for (tensorSize l = 0; l < lanes; l++) {
+                    for (tensorSize k = 0; k < extents.n; k++) {
+                        function(k, l);
+                    }
+                }
+            } else {
+                for (tensorSize k = 0; k < extents.n; k++) {
+                    for (tensorSize l = 0; l < lanes; l++) {
+                        function(k, l);
+                    }
+                }
+            }
+        }
+
+        template <typename T>
+        void fftAxisOf(const std::complex<T>* in, std::complex<T>* out, AxisExtents extents, const FFTPlan& plan, bool inverse) {
+            const tensorSize n = extents.n, sequences = extents.outer * extents.inner;
+            const tensorSize lanes = chunkLanes(n);
+            const tensorSize chunks = (sequences + lanes - 1) / lanes;
+            const double scale = inverse ? 1.0 / static_cast<double>(n) : 1.0;
+            parallelFor(chunks, 1, [&](tensorSize begin, tensorSize end) {
+                std::vector<std::complex<double>> buffer (n * lanes);
+                std::vector<tensorSize> offsets (lanes);
+                for (tensorSize chunk = begin; chunk < end; chunk++) {
+                    const tensorSize count = std::min(lanes, sequences - chunk * lanes);
+                    sequenceOffsets(extents, chunk * lanes, count, offsets);
+                    forEachElement(extents, count, [&](tensorSize k, tensorSize l) {
+                        buffer[k * count + l] = in[offsets[l] + k * extents.inner];
+                    });
+                    plan.transform(buffer.data(), count, inverse);
+                    forEachElement(extents, count, [&](tensorSize k, tensorSize l) {
+                        out[offsets[l] + k * extents.inner] = std::complex<T>(buffer[k * count + l] * scale);
+                    });
+                }
+            });
+        }
+
+        // Two real sequences a and b per lane, transformed together as a + ib and separated by the symmetry
+        // of a real sequence's spectrum: A(k) = (Z(k) + conj Z(n - k)) / 2, B(k) = -i (Z(k) - conj Z(n - k)) / 2
+        template <typename T>
+        void realFFTAxisOf(const T* in, std::complex<T>* out, AxisExtents extents, const FFTPlan& plan) {
+            const tensorSize n = extents.n, half = n / 2 + 1, sequences = extents.outer * extents.inner;
+            const tensorSize lanes = chunkLanes(n);
+            const tensorSize chunks = (sequences + 2 * lanes - 1) / (2 * lanes);
+            const AxisExtents spectrum {extents.outer, half, extents.inner};
+            parallelFor(chunks, 1, [&](tensorSize begin, tensorSize end) {
+                std::vector<std::complex<double>> buffer (n * lanes);
+                std::vector<tensorSize> offsets (2 * lanes), spectrumOffsets (2 * lanes);
+                for (tensorSize chunk = begin; chunk < end; chunk++) {
+                    const tensorSize count = std::min(2 * lanes, sequences - chunk * 2 * lanes);
+                    const tensorSize pairs = (count + 1) / 2;
+                    sequenceOffsets(extents, chunk * 2 * lanes, count, offsets);
+                    sequenceOffsets(spectrum, chunk * 2 * lanes, count, spectrumOffsets);
+                    forEachElement(extents, pairs, [&](tensorSize k, tensorSize l) {
+                        const tensorSize offset = k * extents.inner;
+                        const double b = 2 * l + 1 < count ? static_cast<double>(in[offsets[2 * l + 1] + offset]) : 0.0;
+                        buffer[k * pairs + l] = {static_cast<double>(in[offsets[2 * l] + offset]), b};
+                    });
+                    plan.transform(buffer.data(), pairs, false);
+                    forEachElement(spectrum, pairs, [&](tensorSize k, tensorSize l) {
+                        const std::complex<double> z = buffer[k * pairs + l], conjugate = std::conj(buffer[(n - k) % n * pairs + l]);
+                        const tensorSize offset = k * extents.inner;
+                        out[spectrumOffsets[2 * l] + offset] = std::complex<T>((z + conjugate) * 0.5);
+                        if (2 * l + 1 < count) {
+                            const std::complex<double> difference = (z - conjugate) * 0.5;
+                            out[spectrumOffsets[2 * l + 1] + offset] = std::complex<T>(difference.imag(), -difference.real());
+                        }
+                    });
+                }
+            });
+        }
+
+        // The reverse: the spectra of a and b extended to all n frequencies by symmetry, combined as A + iB
+        // and transformed back to a + ib
+        template <typename T>
+        void inverseRealFFTAxisOf(const std::complex<T>* in, T* out, AxisExtents extents, const FFTPlan& plan) {
+            const tensorSize n = extents.n, half = n / 2 + 1, sequences = extents.outer * extents.inner;
+            const tensorSize lanes = chunkLanes(n);
+            const tensorSize chunks = (sequences + 2 * lanes - 1) / (2 * lanes);
+            const AxisExtents spectrum {extents.outer, half, extents.inner};
+            const double scale = 1.0 / static_cast<double>(n);
+            parallelFor(chunks, 1, [&](tensorSize begin, tensorSize end) {
+                std::vector<std::complex<double>> buffer (n * lanes);
+                std::vector<tensorSize> offsets (2 * lanes), spectrumOffsets (2 * lanes);
+                const auto frequency = [&](tensorSize sequence, tensorSize k) {
+                    std::complex<double> value (in[spectrumOffsets[sequence] + (k < half ? k : n - k) * extents.inner]);
+                    if (k == 0 || 2 * k == n) {
+                        value.imag(0.0);
+                    }
+                    return k < half ? value : std::conj(value);
+                };
+                for (tensorSize chunk = begin; chunk < end; chunk++) {
+                    const tensorSize count = std::min(2 * lanes, sequences - chunk * 2 * lanes);
+                    const tensorSize pairs = (count + 1) / 2;
+                    sequenceOffsets(extents, chunk * 2 * lanes, count, offsets);
+                    sequenceOffsets(spectrum, chunk * 2 * lanes, count, spectrumOffsets);
+                    forEachElement(extents, pairs, [&](tensorSize k, tensorSize l) {
+                        const std::complex<double> b = 2 * l + 1 < count ? frequency(2 * l + 1, k) : 0.0;
+                        buffer[k * pairs + l] = frequency(2 * l, k) + std::complex<double>(-b.imag(), b.real());
+                    });
+                    plan.transform(buffer.data(), pairs, true);
+                    forEachElement(extents, pairs, [&](tensorSize k, tensorSize l) {
+                        const tensorSize offset = k * extents.inner;
+                        out[offsets[2 * l] + offset] = static_cast<T>(buffer[k * pairs + l].real() * scale);
+                        if (2 * l + 1 < count) {
+                            out[offsets[2 * l + 1] + offset] = static_cast<T>(buffer[k * pairs + l].imag() * scale);
+                        }
+                    });
+                }
+            });
+        }
+        //endregion
+    }
+
+    void fftAxis(const std::complex<float>* in, std::complex<float>* out, AxisExtents extents, const FFTPlan& plan, bool inverse) {
+        fftAxisOf(in, out, extents, plan, inverse);
+    }
+
+    void fftAxis(const std::complex<double>* in, std::complex<double>* out, AxisExtents extents, const FFTPlan& plan, bool inverse) {
+        fftAxisOf(in, out, extents, plan, inverse);
+    }
+
+    void realFFTAxis(const float* in, std::complex<float>* out, AxisExtents extents, const FFTPlan& plan) {
+        realFFTAxisOf(in, out, extents, plan);
+    }
+
+    void realFFTAxis(const double* in, std::complex<double>* out, AxisExtents extents, const FFTPlan& plan) {
+        realFFTAxisOf(in, out, extents, plan);
+    }
+
+    void inverseRealFFTAxis(const std::complex<float>* in, float* out, AxisExtents extents, const FFTPlan& plan) {
+        inverseRealFFTAxisOf(in, out, extents, plan);
+    }
+
+    void inverseRealFFTAxis(const std::complex<double>* in, double* out, AxisExtents extents, const FFTPlan& plan) {
+        inverseRealFFTAxisOf(in, out, extents, plan);
+    }
+}
@@ -0,0 +1,144 @@
+#include "TensorII/private/GatherKernels.h"
+#include "TensorII/private/CpuFeatures.h"
+#include "TensorII/private/SimdTargets.h"
+
+namespace TensorII::Core::Private {
+
+    namespace {
+        // Also the tail of the vector loops, from 'begin'
+        template <typename T, typename Index>
+        void gatherScalar(const T* field, const Index* indices, T* out, tensorSize begin, tensorSize n) {
+            for (tensorSize i = begin; i < n; i++) {
+                out[i] = field[indices[i]];
+            }
+        }
+    }
+
+#ifdef TENSORII_SIMD_KERNELS
+TENSORII_SIMD_WARNINGS_PUSH
+    namespace {
+        //region Vector operations
+        // A vector's worth of indices at a time: as many as fill an index register, or fill a data register
+        // when the data is narrower, e.g. eight 64-bit indices to gather eight floats into 256 bits
+        template <typename T, typename Index> struct Avx512Ops;
+        template <typename T, typename Index> struct Avx2Ops;
+
+        template <>
+        struct Avx512Ops<float, std::int32_t> {
+            static constexpr tensorSize width = 16;
+            TENSORII_TARGET_AVX512 static void gather(const float* field, const std::int32_t* indices, float* out) {
+                _mm512_storeu_ps(out, _mm512_i32gather_ps(_mm512_loadu_si512(indices), field, 4));
+            }
+        };
+
+        template <>
+        struct Avx512Ops<float, std::int64_t> {
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX512 static void gather(const float* field, const std::int64_t* indices, float* out) {
+                _mm256_storeu_ps(out, _mm512_i64gather_ps(_mm512_loadu_si512(indices), field, 4));
+            }
+        };
+
+        template <>
+        struct Avx512Ops<double, std::int32_t> {
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX512 static void gather(const double* field, const std::int32_t* indices, double* out) {
+                const __m256i offsets = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices));
+                _mm512_storeu_pd(out, _mm512_i32gather_pd(offsets, field, 8));
+            }
+        };
+
+        template <>
+        struct Avx512Ops<double, std::int64_t> {
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX512 static void gather(const double* field, const std::int64_t* indices, double* out) {
+                _mm512_storeu_pd(out, _mm512_i64gather_pd(_mm512_loadu_si512(indices), field, 8));
+            }
+        };
+
+        template <>
+        struct Avx2Ops<float, std::int32_t> {
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX2_FMA static void gather(const float* field, const std::int32_t* indices, float* out) {
+                const __m256i offsets = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices));
+                _mm256_storeu_ps(out, _mm256_i32gather_ps(field, offsets, 4));
+            }
+        };
+
+        template <>
+        struct Avx2Ops<float, std::int64_t> {
+            static constexpr tensorSize width = 4;
+            TENSORII_TARGET_AVX2_FMA static void gather(const float* field, const std::int64_t* indices, float* out) {
+                const __m256i offsets = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices));
+                _mm_storeu_ps(out, _mm256_i64gather_ps(field, offsets, 4));
+            }
+        };
+
+        template <>
+        struct Avx2Ops<double, std::int32_t> {
+            static constexpr tensorSize width = 4;
+            TENSORII_TARGET_AVX2_FMA static void gather(const double* field, const std::int32_t* indices, double* out) {
+                const __m128i offsets = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices));
+                _mm256_storeu_pd(out, _mm256_i32gather_pd(field, offsets, 8));
+            }
+        };
+
+        template <>
+        struct Avx2Ops<double, std::int64_t> {
+            static constexpr tensorSize width = 4;
+            TENSORII_TARGET_AVX2_FMA static void gather(const double* field, const std::int64_t* indices, double* out) {
+                const __m256i offsets = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices));
+                _mm256_storeu_pd(out, _mm256_i64gather_pd(field, offsets, 8));
+            }
+        };
+        //endregion
+
+        template <typename Ops, typename T, typename Index>
+        [[gnu::always_inline]] inline void gatherVector(const T* field, const Index* indices, T* out, tensorSize n) {
+            tensorSize i = 0;
+            for (; i + Ops::width <= n; i += Ops::width) {
+                Ops::gather(field, indices + i, out + i);
+            }
+            gatherScalar(field, indices, out, i, n);
+        }
+
+        template <typename T, typename Index>
+        TENSORII_TARGET_AVX512 void gatherAvx512(const T* field, const Index* indices, T* out, tensorSize n) {
+            gatherVector<Avx512Ops<T, Index>>(field, indices, out, n);
+        }
+
+        template <typename T, typename Index>
+        TENSORII_TARGET_AVX2_FMA void gatherAvx2(const T* field, const Index* indices, T* out, tensorSize n) {
+            gatherVector<Avx2Ops<T, Index>>(field, indices, out, n);
+        }
+    }
+TENSORII_SIMD_WARNINGS_POP
+#endif
+
+    namespace {
+        template <typename T, typename Index>
+        void gatherDispatch(const T* field, const Index* indices, T* out, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return gatherAvx512(field, indices, out, n); }
+            if (cpuFeatures().avx2 && cpuFeatures().fma) { return gatherAvx2(field, indices, out, n); }
+#endif
+            gatherScalar(field, indices, out, 0, n);
+        }
+    }
+
+    void gather(const float* field, const std::int32_t* indices, float* out, tensorSize n) {
+        gatherDispatch(field, indices, out, n);
+    }
+
+    void gather(const float* field, const std::int64_t* indices, float* out, tensorSize n) {
+        gatherDispatch(field, indices, out, n);
+    }
+
+    void gather(const double* field, const std::int32_t* indices, double* out, tensorSize n) {
+        gatherDispatch(field, indices, out, n);
+    }
+
+    void gather(const double* field, const std::int64_t* indices, double* out, tensorSize n) {
+        gatherDispatch(field, indices, out, n);
+    }
+}
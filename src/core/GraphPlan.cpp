@@ -0,0 +1,179 @@
+#include "TensorII/GraphPlan.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace TensorII::Core {
+
+    const char* toString(GraphOp op) {
+        switch (op) {
+            case GraphOp::Input: return "input";
+            case GraphOp::Constant: return "constant";
+            case GraphOp::Negate: return "negate";
+            case GraphOp::Abs: return "abs";
+            case GraphOp::Sqrt: return "sqrt";
+            case GraphOp::Add: return "add";
+            case GraphOp::Subtract: return "subtract";
+            case GraphOp::Multiply: return "multiply";
+            case GraphOp::Divide: return "divide";
+            case GraphOp::Minimum: return "minimum";
+            case GraphOp::Maximum: return "maximum";
+            case GraphOp::Greater: return "greater";
+            case GraphOp::Less: return "less";
+            case GraphOp::Sum: return "sum";
+            case GraphOp::Min: return "min";
+            case GraphOp::Max: return "max";
+            default: return "unknown";
+        }
+    }
+
+    GraphPlan schedule(const std::vector<GraphNode>& nodes, const std::vector<std::size_t>& stores,
+                       const std::vector<std::size_t>& scalarOutputs) {
+        const std::size_t count = nodes.size();
+        for (std::size_t node : stores) {
+            if (node >= count || nodes[node].scalar) {
+                throw std::invalid_argument("Only elementwise nodes of the graph can be stored");
+            }
+        }
+        for (std::size_t node : scalarOutputs) {
+            if (node >= count || !nodes[node].scalar) {
+                throw std::invalid_argument("Only scalar nodes of the graph have a single value");
+            }
+        }
+
+        // Inputs always come before the nodes using them, so one backward sweep finds everything needed
+        std::vector<bool> live (count);
+        for (std::size_t node : stores) { live[node] = true; }
+        for (std::size_t node : scalarOutputs) { live[node] = true; }
+        for (std::size_t node = count; node-- > 0; ) {
+            if (live[node]) {
+                for (std::size_t input : nodes[node].inputs) {
+                    if (input != noInput) {
+                        live[input] = true;
+                    }
+                }
+            }
+        }
+
+        // A node's pass is the first in which all its inputs are known; a reduction's value is known from the
+        // pass after the one that folds it
+        std::vector<std::size_t> pass (count), ready (count);
+        std::size_t passCount = 0;
+        for (std::size_t node = 0; node < count; node++) {
+            for (std::size_t input : nodes[node].inputs) {
+                if (input != noInput) {
+                    pass[node] = std::max(pass[node], ready[input]);
+                }
+            }
+            const bool reduction = isReduction(nodes[node].op);
+            ready[node] = reduction ? pass[node] + 1 : pass[node];
+            if (live[node] && reduction) {
+                passCount = std::max(passCount, pass[node] + 1);
+            }
+        }
+        for (std::size_t node : stores) {
+            passCount = std::max(passCount, pass[node] + 1);
+        }
+
+        GraphPlan plan;
+        plan.passes.resize(passCount);
+        for (std::size_t node : stores) {
+            if (std::find(plan.passes[pass[node]].stores.begin(), plan.passes[pass[node]].stores.end(), node)
+                == plan.passes[pass[node]].stores.end()) {
+                plan.passes[pass[node]].stores.push_back(node);
+            }
+        }
+        std::vector<std::size_t> passesEvaluating (count);
+        for (std::size_t node = 0; node < count; node++) {
+            if (!live[node]) {
+                plan.eliminated.push_back(node);
+            } else if (isReduction(nodes[node].op)) {
+                plan.passes[pass[node]].reductions.push_back(node);
+            } else if (nodes[node].scalar && nodes[node].op != GraphOp::Constant) {
+                (ready[node] < passCount ? plan.passes[ready[node]].scalars : plan.finalScalars).push_back(node);
+            }
+        }
+
+        // Each pass evaluates the elementwise nodes its stores and reductions need, whichever pass they'd
+        // first be possible in
+        std::vector<std::size_t> visited (count, passCount);
+        for (std::size_t p = 0; p < passCount; p++) {
+            GraphPlan::Pass& current = plan.passes[p];
+            std::vector<std::size_t> pending = current.stores;
+            for (std::size_t reduction : current.reductions) {
+                pending.push_back(nodes[reduction].inputs[0]);
+            }
+            while (!pending.empty()) {
+                const std::size_t node = pending.back();
+                pending.pop_back();
+                if (nodes[node].scalar || visited[node] == p) {
+                    continue;
+                }
+                visited[node] = p;
+                for (std::size_t input : nodes[node].inputs) {
+                    if (input != noInput) {
+                        pending.push_back(input);
+                    }
+                }
+            }
+            for (std::size_t node = 0; node < count; node++) {
+                if (visited[node] == p) {
+                    current.elementwise.push_back(node);
+                    passesEvaluating[node]++;
+                }
+            }
+        }
+        for (std::size_t node = 0; node < count; node++) {
+            if (passesEvaluating[node] > 1 && nodes[node].op != GraphOp::Input) {
+                plan.recomputed.push_back(node);
+            }
+        }
+        return plan;
+    }
+
+    namespace {
+        void writeNodes(std::ostream& out, const std::vector<std::size_t>& list, const std::vector<GraphNode>& nodes) {
+            for (std::size_t i = 0; i < list.size(); i++) {
+                out << (i == 0 ? "" : ", ") << toString(nodes[list[i]].op) << '#' << list[i];
+            }
+        }
+    }
+
+    void writePlan(std::ostream& out, const GraphPlan& plan, const std::vector<GraphNode>& nodes) {
+        for (std::size_t p = 0; p < plan.passes.size(); p++) {
+            const GraphPlan::Pass& pass = plan.passes[p];
+            out << "pass " << p << ':';
+            if (!pass.scalars.empty()) {
+                out << " computes ";
+                writeNodes(out, pass.scalars, nodes);
+                out << ';';
+            }
+            out << " fuses ";
+            writeNodes(out, pass.elementwise, nodes);
+            if (!pass.reductions.empty()) {
+                out << " into ";
+                writeNodes(out, pass.reductions, nodes);
+            }
+            if (!pass.stores.empty()) {
+                out << "; stores ";
+                writeNodes(out, pass.stores, nodes);
+            }
+            out << '\n';
+        }
+        if (!plan.finalScalars.empty()) {
+            out << "then computes ";
+            writeNodes(out, plan.finalScalars, nodes);
+            out << '\n';
+        }
+        if (!plan.recomputed.empty()) {
+            out << "recomputed: ";
+            writeNodes(out, plan.recomputed, nodes);
+            out << '\n';
+        }
+        if (!plan.eliminated.empty()) {
+            out << "eliminated: ";
+            writeNodes(out, plan.eliminated, nodes);
+            out << '\n';
+        }
+    }
+}
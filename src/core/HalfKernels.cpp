@@ -0,0 +1,284 @@
+#include "TensorII/private/HalfKernels.h"
+#include "TensorII/private/CpuFeatures.h"
+#include "TensorII/private/SimdTargets.h"
+
+namespace TensorII::Core::Private {
+
+    namespace {
+        struct Add {
+            static float apply(float lhs, float rhs) { return lhs + rhs; }
+#ifdef TENSORII_SIMD_KERNELS
+            TENSORII_TARGET_AVX2_F16C static __m256 apply(__m256 lhs, __m256 rhs) { return _mm256_add_ps(lhs, rhs); }
+#endif
+        };
+
+        struct Subtract {
+            static float apply(float lhs, float rhs) { return lhs - rhs; }
+#ifdef TENSORII_SIMD_KERNELS
+            TENSORII_TARGET_AVX2_F16C static __m256 apply(__m256 lhs, __m256 rhs) { return _mm256_sub_ps(lhs, rhs); }
+#endif
+        };
+
+        struct Multiply {
+            static float apply(float lhs, float rhs) { return lhs * rhs; }
+#ifdef TENSORII_SIMD_KERNELS
+            TENSORII_TARGET_AVX2_F16C static __m256 apply(__m256 lhs, __m256 rhs) { return _mm256_mul_ps(lhs, rhs); }
+#endif
+        };
+
+        //region Scalar, also used for the tails of the vector loops
+        template <ReducedFloat T>
+        void widenScalar(const T* in, float* out, tensorSize begin, tensorSize n) {
+            for (tensorSize i = begin; i < n; i++) {
+                out[i] = in[i];
+            }
+        }
+
+        template <ReducedFloat T>
+        void narrowScalar(const float* in, T* out, tensorSize begin, tensorSize n) {
+            for (tensorSize i = begin; i < n; i++) {
+                out[i] = in[i];
+            }
+        }
+
+        template <typename Op, ReducedFloat T>
+        void elementwiseScalar(const T* lhs, const T* rhs, T* out, tensorSize begin, tensorSize n) {
+            for (tensorSize i = begin; i < n; i++) {
+                out[i] = Op::apply(lhs[i], rhs[i]);
+            }
+        }
+
+        template <ReducedFloat T>
+        float sumScalar(const T* in, tensorSize begin, tensorSize n) {
+            float result = 0;
+            for (tensorSize i = begin; i < n; i++) {
+                result += in[i];
+            }
+            return result;
+        }
+
+        template <ReducedFloat T>
+        float dotScalar(const T* lhs, const T* rhs, tensorSize begin, tensorSize n) {
+            float result = 0;
+            for (tensorSize i = begin; i < n; i++) {
+                result += static_cast<float>(lhs[i]) * static_cast<float>(rhs[i]);
+            }
+            return result;
+        }
+        //endregion
+
+#ifdef TENSORII_SIMD_KERNELS
+        //region AVX2, 8 lanes
+        TENSORII_TARGET_AVX2_F16C __m256 load8(const float16* in) {
+            return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+        }
+
+        TENSORII_TARGET_AVX2_F16C __m256 load8(const bfloat16* in) {
+            const __m256i widened = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+            return _mm256_castsi256_ps(_mm256_slli_epi32(widened, 16));
+        }
+
+        TENSORII_TARGET_AVX2_F16C void store8(float16* out, __m256 values) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+        }
+
+        TENSORII_TARGET_AVX2_F16C void store8(bfloat16* out, __m256 values) {
+            // Round to nearest even as floatToBFloatBits does, keeping NaNs quiet
+            const __m256i bits = _mm256_castps_si256(values);
+            const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+            __m256i rounded = _mm256_add_epi32(bits, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7FFF)));
+            const __m256i quiet = _mm256_or_si256(bits, _mm256_set1_epi32(0x00400000));
+            const __m256 isNaN = _mm256_cmp_ps(values, values, _CMP_UNORD_Q);
+            rounded = _mm256_blendv_epi8(rounded, quiet, _mm256_castps_si256(isNaN));
+            // packus works within 128-bit lanes, so gather the two packed quarters back together
+            const __m256i shifted = _mm256_srli_epi32(rounded, 16);
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(shifted, shifted), 0xD8);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(packed));
+        }
+
+        TENSORII_TARGET_AVX2_F16C float horizontalSum(__m256 values) {
+            __m128 sum = _mm_add_ps(_mm256_castps256_ps128(values), _mm256_extractf128_ps(values, 1));
+            sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+            sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+            return _mm_cvtss_f32(sum);
+        }
+
+        template <ReducedFloat T>
+        TENSORII_TARGET_AVX2_F16C void widenAvx2(const T* in, float* out, tensorSize n) {
+            tensorSize i = 0;
+            for (; i + 8 <= n; i += 8) {
+                _mm256_storeu_ps(out + i, load8(in + i));
+            }
+            widenScalar(in, out, i, n);
+        }
+
+        template <ReducedFloat T>
+        TENSORII_TARGET_AVX2_F16C void narrowAvx2(const float* in, T* out, tensorSize n) {
+            tensorSize i = 0;
+            for (; i + 8 <= n; i += 8) {
+                store8(out + i, _mm256_loadu_ps(in + i));
+            }
+            narrowScalar(in, out, i, n);
+        }
+
+        template <typename Op, ReducedFloat T>
+        TENSORII_TARGET_AVX2_F16C void elementwiseAvx2(const T* lhs, const T* rhs, T* out, tensorSize n) {
+            tensorSize i = 0;
+            for (; i + 8 <= n; i += 8) {
+                store8(out + i, Op::apply(load8(lhs + i), load8(rhs + i)));
+            }
+            elementwiseScalar<Op>(lhs, rhs, out, i, n);
+        }
+
+        // Four accumulators, to keep the adds from waiting on each other
+        template <ReducedFloat T>
+        TENSORII_TARGET_AVX2_F16C float sumAvx2(const T* in, tensorSize n) {
+            __m256 sum0 = _mm256_setzero_ps();
+            __m256 sum1 = _mm256_setzero_ps();
+            __m256 sum2 = _mm256_setzero_ps();
+            __m256 sum3 = _mm256_setzero_ps();
+            tensorSize i = 0;
+            for (; i + 32 <= n; i += 32) {
+                sum0 = _mm256_add_ps(sum0, load8(in + i));
+                sum1 = _mm256_add_ps(sum1, load8(in + i + 8));
+                sum2 = _mm256_add_ps(sum2, load8(in + i + 16));
+                sum3 = _mm256_add_ps(sum3, load8(in + i + 24));
+            }
+            for (; i + 8 <= n; i += 8) {
+                sum0 = _mm256_add_ps(sum0, load8(in + i));
+            }
+            const __m256 total = _mm256_add_ps(_mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3));
+            return horizontalSum(total) + sumScalar(in, i, n);
+        }
+
+        template <ReducedFloat T>
+        TENSORII_TARGET_AVX2_F16C float dotAvx2(const T* lhs, const T* rhs, tensorSize n) {
+            __m256 sum0 = _mm256_setzero_ps();
+            __m256 sum1 = _mm256_setzero_ps();
+            __m256 sum2 = _mm256_setzero_ps();
+            __m256 sum3 = _mm256_setzero_ps();
+            tensorSize i = 0;
+            for (; i + 32 <= n; i += 32) {
+                sum0 = _mm256_fmadd_ps(load8(lhs + i), load8(rhs + i), sum0);
+                sum1 = _mm256_fmadd_ps(load8(lhs + i + 8), load8(rhs + i + 8), sum1);
+                sum2 = _mm256_fmadd_ps(load8(lhs + i + 16), load8(rhs + i + 16), sum2);
+                sum3 = _mm256_fmadd_ps(load8(lhs + i + 24), load8(rhs + i + 24), sum3);
+            }
+            for (; i + 8 <= n; i += 8) {
+                sum0 = _mm256_fmadd_ps(load8(lhs + i), load8(rhs + i), sum0);
+            }
+            const __m256 total = _mm256_add_ps(_mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3));
+            return horizontalSum(total) + dotScalar(lhs, rhs, i, n);
+        }
+        //endregion
+
+TENSORII_SIMD_WARNINGS_PUSH
+        TENSORII_TARGET_AVX512 __m512 load16(const float16* in) {
+            return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in)));
+        }
+
+        TENSORII_TARGET_AVX512 __m512 load16(const bfloat16* in) {
+            const __m512i widened = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in)));
+            return _mm512_castsi512_ps(_mm512_slli_epi32(widened, 16));
+        }
+
+        TENSORII_TARGET_AVX512 void store16(float16* out, __m512 values) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                                _mm512_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        }
+
+        TENSORII_TARGET_AVX512 void store16(bfloat16* out, __m512 values) {
+            const __m512i bits = _mm512_castps_si512(values);
+            const __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+            __m512i rounded = _mm512_add_epi32(bits, _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7FFF)));
+            const __mmask16 isNaN = _mm512_cmp_ps_mask(values, values, _CMP_UNORD_Q);
+            rounded = _mm512_mask_or_epi32(rounded, isNaN, bits, _mm512_set1_epi32(0x00400000));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm512_cvtepi32_epi16(_mm512_srli_epi32(rounded, 16)));
+        }
+
+        template <ReducedFloat T>
+        TENSORII_TARGET_AVX512 void widenAvx512(const T* in, float* out, tensorSize n) {
+            tensorSize i = 0;
+            for (; i + 16 <= n; i += 16) {
+                _mm512_storeu_ps(out + i, load16(in + i));
+            }
+            widenScalar(in, out, i, n);
+        }
+
+        template <ReducedFloat T>
+        TENSORII_TARGET_AVX512 void narrowAvx512(const float* in, T* out, tensorSize n) {
+            tensorSize i = 0;
+            for (; i + 16 <= n; i += 16) {
+                store16(out + i, _mm512_loadu_ps(in + i));
+            }
+            narrowScalar(in, out, i, n);
+        }
+TENSORII_SIMD_WARNINGS_POP
+        //endregion
+#endif
+
+        bool hasAvx2() {
+            const CpuFeatures& features = cpuFeatures();
+            return features.avx2 && features.fma && features.f16c;
+        }
+
+        template <ReducedFloat T>
+        void widenDispatch(const T* in, float* out, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return widenAvx512(in, out, n); }
+            if (hasAvx2()) { return widenAvx2(in, out, n); }
+#endif
+            widenScalar(in, out, 0, n);
+        }
+
+        template <ReducedFloat T>
+        void narrowDispatch(const float* in, T* out, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return narrowAvx512(in, out, n); }
+            if (hasAvx2()) { return narrowAvx2(in, out, n); }
+#endif
+            narrowScalar(in, out, 0, n);
+        }
+
+        template <typename Op, ReducedFloat T>
+        void elementwiseDispatch(const T* lhs, const T* rhs, T* out, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (hasAvx2()) { return elementwiseAvx2<Op>(lhs, rhs, out, n); }
+#endif
+            elementwiseScalar<Op>(lhs, rhs, out, 0, n);
+        }
+
+        template <ReducedFloat T>
+        float sumDispatch(const T* in, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (hasAvx2()) { return sumAvx2(in, n); }
+#endif
+            return sumScalar(in, 0, n);
+        }
+
+        template <ReducedFloat T>
+        float dotDispatch(const T* lhs, const T* rhs, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (hasAvx2()) { return dotAvx2(lhs, rhs, n); }
+#endif
+            return dotScalar(lhs, rhs, 0, n);
+        }
+    }
+
+    void widen(const float16* in, float* out, tensorSize n) { widenDispatch(in, out, n); }
+    void widen(const bfloat16* in, float* out, tensorSize n) { widenDispatch(in, out, n); }
+    void narrow(const float* in, float16* out, tensorSize n) { narrowDispatch(in, out, n); }
+    void narrow(const float* in, bfloat16* out, tensorSize n) { narrowDispatch(in, out, n); }
+
+    void add(const float16* lhs, const float16* rhs, float16* out, tensorSize n) { elementwiseDispatch<Add>(lhs, rhs, out, n); }
+    void add(const bfloat16* lhs, const bfloat16* rhs, bfloat16* out, tensorSize n) { elementwiseDispatch<Add>(lhs, rhs, out, n); }
+    void subtract(const float16* lhs, const float16* rhs, float16* out, tensorSize n) { elementwiseDispatch<Subtract>(lhs, rhs, out, n); }
+    void subtract(const bfloat16* lhs, const bfloat16* rhs, bfloat16* out, tensorSize n) { elementwiseDispatch<Subtract>(lhs, rhs, out, n); }
+    void multiply(const float16* lhs, const float16* rhs, float16* out, tensorSize n) { elementwiseDispatch<Multiply>(lhs, rhs, out, n); }
+    void multiply(const bfloat16* lhs, const bfloat16* rhs, bfloat16* out, tensorSize n) { elementwiseDispatch<Multiply>(lhs, rhs, out, n); }
+
+    float sum(const float16* in, tensorSize n) { return sumDispatch(in, n); }
+    float sum(const bfloat16* in, tensorSize n) { return sumDispatch(in, n); }
+    float dot(const float16* lhs, const float16* rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+    float dot(const bfloat16* lhs, const bfloat16* rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+}
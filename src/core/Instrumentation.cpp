@@ -0,0 +1,197 @@
+#include "TensorII/Instrumentation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace TensorII::Core::Instrumentation {
+
+    namespace {
+        struct Registry {
+            std::mutex mutex;
+            std::map<std::string, OpStats, std::less<>> stats;
+            std::vector<OpEvent> events;
+            // Small sequential ids are easier to read in traces than hashed std::thread::ids
+            std::map<std::thread::id, uint64_t> threadIds;
+        };
+
+        std::atomic<bool> countersEnabled {false};
+
+        Registry& registry() {
+            static Registry instance;
+            return instance;
+        }
+
+        double ipc(const OpStats& opStats) {
+            const uint64_t cycles = opStats.counters[Counter::Cycles];
+            return cycles == 0 ? 0.0 : static_cast<double>(opStats.counters[Counter::Instructions]) / static_cast<double>(cycles);
+        }
+
+        void writeEscaped(std::ostream& out, const std::string& string) {
+            out << '"';
+            for (char c : string) {
+                if (c == '"' || c == '\\') { out << '\\'; }
+                out << c;
+            }
+            out << '"';
+        }
+    }
+
+    const char* toString(OpKind kind) {
+        switch (kind) {
+            case OpKind::Elementwise: return "Elementwise";
+            case OpKind::Reduction:   return "Reduction";
+            case OpKind::Contraction: return "Contraction";
+            case OpKind::Copy:        return "Copy";
+            case OpKind::IO:          return "IO";
+            default:                  return "Unknown";
+        }
+    }
+
+    int64_t now() {
+        auto sinceEpoch = std::chrono::steady_clock::now().time_since_epoch();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(sinceEpoch).count();
+    }
+
+    void record(const char* name, OpKind kind, int64_t startNanoseconds, int64_t stopNanoseconds,
+                tensorSize elements, tensorSize bytes, const CounterSample& counters) {
+        const int64_t duration = stopNanoseconds - startNanoseconds;
+
+        Registry& reg = registry();
+        std::lock_guard lock {reg.mutex};
+        const uint64_t threadId = reg.threadIds.try_emplace(std::this_thread::get_id(), reg.threadIds.size()).first->second;
+
+        auto found = reg.stats.find(name);
+        if (found == reg.stats.end()) {
+            found = reg.stats.emplace(name, OpStats{name, kind, 0, 0, 0, 0, {}}).first;
+        }
+        OpStats& opStats = found->second;
+        opStats.calls++;
+        opStats.nanoseconds += static_cast<uint64_t>(duration);
+        opStats.elements += elements;
+        opStats.bytes += bytes;
+        opStats.counters += counters;
+
+        if (reg.events.size() < maxEvents) {
+            reg.events.push_back({name, kind, threadId, startNanoseconds, duration, elements, bytes});
+        }
+    }
+
+    void setHardwareCounters(bool enabled) {
+        countersEnabled = enabled;
+    }
+
+    bool hardwareCountersEnabled() {
+        return countersEnabled;
+    }
+
+    CounterSample sampleCounters() {
+        if (!countersEnabled) {
+            return {};
+        }
+        return PerfCounters::thisThread().read();
+    }
+
+    std::vector<OpStats> stats() {
+        Registry& reg = registry();
+        std::lock_guard lock {reg.mutex};
+        std::vector<OpStats> result;
+        result.reserve(reg.stats.size());
+        for (const auto& [name, opStats] : reg.stats) {
+            result.push_back(opStats);
+        }
+        return result;
+    }
+
+    std::vector<OpEvent> events() {
+        Registry& reg = registry();
+        std::lock_guard lock {reg.mutex};
+        return reg.events;
+    }
+
+    void reset() {
+        Registry& reg = registry();
+        std::lock_guard lock {reg.mutex};
+        reg.stats.clear();
+        reg.events.clear();
+        reg.threadIds.clear();
+    }
+
+    void writeJson(std::ostream& out) {
+        out << "{\n  \"ops\": [";
+        bool first = true;
+        for (const OpStats& opStats : stats()) {
+            const double seconds = static_cast<double>(opStats.nanoseconds) * 1e-9;
+            out << (first ? "\n" : ",\n") << "    {\"name\": ";
+            writeEscaped(out, opStats.name);
+            out << ", \"kind\": \"" << toString(opStats.kind) << '"'
+                << ", \"calls\": " << opStats.calls
+                << ", \"nanoseconds\": " << opStats.nanoseconds
+                << ", \"elements\": " << opStats.elements
+                << ", \"bytes\": " << opStats.bytes
+                << ", \"bytes_per_second\": " << (seconds > 0 ? static_cast<double>(opStats.bytes) / seconds : 0.0);
+            if (countersEnabled) {
+                for (size_t i = 0; i < nCounters; i++) {
+                    out << ", \"" << toString(static_cast<Counter>(i)) << "\": " << opStats.counters.values[i];
+                }
+                out << ", \"ipc\": " << ipc(opStats);
+            }
+            out << "}";
+            first = false;
+        }
+        out << "\n  ]\n}\n";
+    }
+
+    void writeReport(std::ostream& out) {
+        const bool counted = countersEnabled && PerfCounters::thisThread().available();
+        out << std::left << std::setw(32) << "op" << std::setw(12) << "kind"
+            << std::right << std::setw(10) << "calls" << std::setw(14) << "mean ns" << std::setw(12) << "GB/s";
+        if (counted) {
+            out << std::setw(8) << "IPC" << std::setw(16) << "cache miss/KB" << std::setw(18) << "branch miss/call";
+        }
+        out << '\n';
+        for (const OpStats& opStats : stats()) {
+            const double calls = static_cast<double>(opStats.calls);
+            const double nanoseconds = static_cast<double>(opStats.nanoseconds);
+            const double kilobytes = static_cast<double>(opStats.bytes) / 1024;
+            out << std::left << std::setw(32) << opStats.name << std::setw(12) << toString(opStats.kind)
+                << std::right << std::setw(10) << opStats.calls
+                << std::setw(14) << std::fixed << std::setprecision(1) << nanoseconds / calls
+                << std::setw(12) << std::setprecision(2) << (nanoseconds > 0 ? static_cast<double>(opStats.bytes) / nanoseconds : 0.0);
+            if (counted) {
+                const double cacheMisses = static_cast<double>(opStats.counters[Counter::CacheMisses]);
+                const double branchMisses = static_cast<double>(opStats.counters[Counter::BranchMisses]);
+                out << std::setw(8) << ipc(opStats)
+                    << std::setw(16) << (kilobytes > 0 ? cacheMisses / kilobytes : 0.0)
+                    << std::setw(18) << branchMisses / calls;
+            }
+            out << '\n';
+        }
+        out << std::defaultfloat;
+    }
+
+    void writeChromeTrace(std::ostream& out) {
+        std::vector<OpEvent> recorded = events();
+        // Trace timestamps are microseconds, relative to the first event
+        const int64_t origin = recorded.empty() ? 0 : std::ranges::min(recorded, {}, &OpEvent::startNanoseconds).startNanoseconds;
+        out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+        bool first = true;
+        for (const OpEvent& event : recorded) {
+            out << (first ? "\n" : ",\n") << "  {\"name\": ";
+            writeEscaped(out, event.name);
+            out << ", \"cat\": \"" << toString(event.kind) << '"'
+                << ", \"ph\": \"X\", \"pid\": 0"
+                << ", \"tid\": " << event.threadId
+                << ", \"ts\": " << static_cast<double>(event.startNanoseconds - origin) * 1e-3
+                << ", \"dur\": " << static_cast<double>(event.durationNanoseconds) * 1e-3
+                << ", \"args\": {\"elements\": " << event.elements << ", \"bytes\": " << event.bytes << "}}";
+            first = false;
+        }
+        out << "\n]}\n";
+    }
+}
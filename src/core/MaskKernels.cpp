@@ -0,0 +1,426 @@
+#include "TensorII/private/MaskKernels.h"
+#include "TensorII/private/CpuFeatures.h"
+#include "TensorII/private/SimdTargets.h"
+
+#include <array>
+
+namespace TensorII::Core::Private {
+
+    namespace {
+        inline bool maskBit(const std::uint64_t* mask, tensorSize i) {
+            return ((mask[i / 64] >> (i % 64)) & 1) != 0;
+        }
+
+        // 'count' bits from i on, which never cross a word when count divides 64 and i is a multiple of it
+        template <tensorSize count>
+        inline std::uint64_t maskBits(const std::uint64_t* mask, tensorSize i) {
+            if constexpr (count == 64) {
+                return mask[i / 64];
+            } else {
+                return (mask[i / 64] >> (i % 64)) & ((std::uint64_t {1} << count) - 1);
+            }
+        }
+
+        // Also the tails of the vector loops, from 'begin'. Conditional moves rather than branches.
+        template <typename T>
+        void selectScalar(const std::uint64_t* mask, const T* whereSet, const T* whereClear, T* out, tensorSize begin, tensorSize n) {
+            for (tensorSize i = begin; i < n; i++) {
+                out[i] = maskBit(mask, i) ? whereSet[i] : whereClear[i];
+            }
+        }
+
+        template <typename T>
+        void fillScalar(const std::uint64_t* mask, T value, T* data, tensorSize begin, tensorSize n) {
+            for (tensorSize i = begin; i < n; i++) {
+                data[i] = maskBit(mask, i) ? value : data[i];
+            }
+        }
+
+        template <typename T>
+        T maskedSumScalar(const std::uint64_t* mask, const T* in, tensorSize begin, tensorSize n) {
+            T total {};
+            for (tensorSize i = begin; i < n; i++) {
+                total = static_cast<T>(total + (maskBit(mask, i) ? in[i] : T {}));
+            }
+            return total;
+        }
+    }
+
+#ifdef TENSORII_SIMD_KERNELS
+TENSORII_SIMD_WARNINGS_PUSH
+    namespace {
+        //region Vector operations
+        // Lanes is what a vector's worth of mask bits becomes: a mask register under AVX-512, a vector of all
+        // ones or zeros per lane under AVX2. Integers sum with wrapping adds in their own width, as sum() does.
+        template <typename T> struct Avx512Ops;
+        template <typename T> struct Avx2Ops;
+
+        template <>
+        struct Avx512Ops<float> {
+            using Vector = __m512;
+            using Lanes = __mmask16;
+            static constexpr tensorSize width = 16;
+            TENSORII_TARGET_AVX512 static Lanes lanes(std::uint64_t bits) { return static_cast<Lanes>(bits); }
+            TENSORII_TARGET_AVX512 static Vector zero() { return _mm512_setzero_ps(); }
+            TENSORII_TARGET_AVX512 static Vector broadcast(float value) { return _mm512_set1_ps(value); }
+            TENSORII_TARGET_AVX512 static Vector load(const float* in) { return _mm512_loadu_ps(in); }
+            TENSORII_TARGET_AVX512 static void store(float* out, Vector value) { _mm512_storeu_ps(out, value); }
+            TENSORII_TARGET_AVX512 static Vector add(Vector a, Vector b) { return _mm512_add_ps(a, b); }
+            TENSORII_TARGET_AVX512 static Vector blend(Lanes lanes, Vector whereClear, Vector whereSet) { return _mm512_mask_blend_ps(lanes, whereClear, whereSet); }
+            TENSORII_TARGET_AVX512 static Vector loadWhere(Lanes lanes, const float* in) { return _mm512_maskz_loadu_ps(lanes, in); }
+            TENSORII_TARGET_AVX512 static void storeWhere(Lanes lanes, float* out, Vector value) { _mm512_mask_storeu_ps(out, lanes, value); }
+        };
+
+        template <>
+        struct Avx512Ops<double> {
+            using Vector = __m512d;
+            using Lanes = __mmask8;
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX512 static Lanes lanes(std::uint64_t bits) { return static_cast<Lanes>(bits); }
+            TENSORII_TARGET_AVX512 static Vector zero() { return _mm512_setzero_pd(); }
+            TENSORII_TARGET_AVX512 static Vector broadcast(double value) { return _mm512_set1_pd(value); }
+            TENSORII_TARGET_AVX512 static Vector load(const double* in) { return _mm512_loadu_pd(in); }
+            TENSORII_TARGET_AVX512 static void store(double* out, Vector value) { _mm512_storeu_pd(out, value); }
+            TENSORII_TARGET_AVX512 static Vector add(Vector a, Vector b) { return _mm512_add_pd(a, b); }
+            TENSORII_TARGET_AVX512 static Vector blend(Lanes lanes, Vector whereClear, Vector whereSet) { return _mm512_mask_blend_pd(lanes, whereClear, whereSet); }
+            TENSORII_TARGET_AVX512 static Vector loadWhere(Lanes lanes, const double* in) { return _mm512_maskz_loadu_pd(lanes, in); }
+            TENSORII_TARGET_AVX512 static void storeWhere(Lanes lanes, double* out, Vector value) { _mm512_mask_storeu_pd(out, lanes, value); }
+        };
+
+        template <>
+        struct Avx2Ops<float> {
+            using Vector = __m256;
+            using Lanes = __m256;
+            static constexpr tensorSize width = 8;
+            // Each lane ands the bits with its own, and compares
+            TENSORII_TARGET_AVX2_FMA static Lanes lanes(std::uint64_t bits) {
+                const __m256i own = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+                const __m256i spread = _mm256_and_si256(_mm256_set1_epi32(static_cast<int>(bits)), own);
+                return _mm256_castsi256_ps(_mm256_cmpeq_epi32(spread, own));
+            }
+            TENSORII_TARGET_AVX2_FMA static Vector zero() { return _mm256_setzero_ps(); }
+            TENSORII_TARGET_AVX2_FMA static Vector broadcast(float value) { return _mm256_set1_ps(value); }
+            TENSORII_TARGET_AVX2_FMA static Vector load(const float* in) { return _mm256_loadu_ps(in); }
+            TENSORII_TARGET_AVX2_FMA static void store(float* out, Vector value) { _mm256_storeu_ps(out, value); }
+            TENSORII_TARGET_AVX2_FMA static Vector add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Vector blend(Lanes lanes, Vector whereClear, Vector whereSet) { return _mm256_blendv_ps(whereClear, whereSet, lanes); }
+            TENSORII_TARGET_AVX2_FMA static Vector loadWhere(Lanes lanes, const float* in) { return _mm256_and_ps(_mm256_loadu_ps(in), lanes); }
+            TENSORII_TARGET_AVX2_FMA static void storeWhere(Lanes lanes, float* out, Vector value) { _mm256_maskstore_ps(out, _mm256_castps_si256(lanes), value); }
+        };
+
+        template <>
+        struct Avx2Ops<double> {
+            using Vector = __m256d;
+            using Lanes = __m256d;
+            static constexpr tensorSize width = 4;
+            TENSORII_TARGET_AVX2_FMA static Lanes lanes(std::uint64_t bits) {
+                const __m256i own = _mm256_setr_epi64x(1, 2, 4, 8);
+                const __m256i spread = _mm256_and_si256(_mm256_set1_epi64x(static_cast<long long>(bits)), own);
+                return _mm256_castsi256_pd(_mm256_cmpeq_epi64(spread, own));
+            }
+            TENSORII_TARGET_AVX2_FMA static Vector zero() { return _mm256_setzero_pd(); }
+            TENSORII_TARGET_AVX2_FMA static Vector broadcast(double value) { return _mm256_set1_pd(value); }
+            TENSORII_TARGET_AVX2_FMA static Vector load(const double* in) { return _mm256_loadu_pd(in); }
+            TENSORII_TARGET_AVX2_FMA static void store(double* out, Vector value) { _mm256_storeu_pd(out, value); }
+            TENSORII_TARGET_AVX2_FMA static Vector add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Vector blend(Lanes lanes, Vector whereClear, Vector whereSet) { return _mm256_blendv_pd(whereClear, whereSet, lanes); }
+            TENSORII_TARGET_AVX2_FMA static Vector loadWhere(Lanes lanes, const double* in) { return _mm256_and_pd(_mm256_loadu_pd(in), lanes); }
+            TENSORII_TARGET_AVX2_FMA static void storeWhere(Lanes lanes, double* out, Vector value) { _mm256_maskstore_pd(out, _mm256_castpd_si256(lanes), value); }
+        };
+
+        template <>
+        struct Avx512Ops<std::uint8_t> {
+            using Vector = __m512i;
+            using Lanes = __mmask64;
+            static constexpr tensorSize width = 64;
+            TENSORII_TARGET_AVX512_BW static Lanes lanes(std::uint64_t bits) { return bits; }
+            TENSORII_TARGET_AVX512_BW static Vector zero() { return _mm512_setzero_si512(); }
+            TENSORII_TARGET_AVX512_BW static Vector broadcast(std::uint8_t value) { return _mm512_set1_epi8(static_cast<char>(value)); }
+            TENSORII_TARGET_AVX512_BW static Vector load(const std::uint8_t* in) { return _mm512_loadu_si512(in); }
+            TENSORII_TARGET_AVX512_BW static void store(std::uint8_t* out, Vector value) { _mm512_storeu_si512(out, value); }
+            TENSORII_TARGET_AVX512_BW static Vector add(Vector a, Vector b) { return _mm512_add_epi8(a, b); }
+            TENSORII_TARGET_AVX512_BW static Vector blend(Lanes lanes, Vector whereClear, Vector whereSet) { return _mm512_mask_blend_epi8(lanes, whereClear, whereSet); }
+            TENSORII_TARGET_AVX512_BW static Vector loadWhere(Lanes lanes, const std::uint8_t* in) { return _mm512_maskz_loadu_epi8(lanes, in); }
+            TENSORII_TARGET_AVX512_BW static void storeWhere(Lanes lanes, std::uint8_t* out, Vector value) { _mm512_mask_storeu_epi8(out, lanes, value); }
+        };
+
+        template <>
+        struct Avx512Ops<std::uint16_t> {
+            using Vector = __m512i;
+            using Lanes = __mmask32;
+            static constexpr tensorSize width = 32;
+            TENSORII_TARGET_AVX512_BW static Lanes lanes(std::uint64_t bits) { return static_cast<Lanes>(bits); }
+            TENSORII_TARGET_AVX512_BW static Vector zero() { return _mm512_setzero_si512(); }
+            TENSORII_TARGET_AVX512_BW static Vector broadcast(std::uint16_t value) { return _mm512_set1_epi16(static_cast<short>(value)); }
+            TENSORII_TARGET_AVX512_BW static Vector load(const std::uint16_t* in) { return _mm512_loadu_si512(in); }
+            TENSORII_TARGET_AVX512_BW static void store(std::uint16_t* out, Vector value) { _mm512_storeu_si512(out, value); }
+            TENSORII_TARGET_AVX512_BW static Vector add(Vector a, Vector b) { return _mm512_add_epi16(a, b); }
+            TENSORII_TARGET_AVX512_BW static Vector blend(Lanes lanes, Vector whereClear, Vector whereSet) { return _mm512_mask_blend_epi16(lanes, whereClear, whereSet); }
+            TENSORII_TARGET_AVX512_BW static Vector loadWhere(Lanes lanes, const std::uint16_t* in) { return _mm512_maskz_loadu_epi16(lanes, in); }
+            TENSORII_TARGET_AVX512_BW static void storeWhere(Lanes lanes, std::uint16_t* out, Vector value) { _mm512_mask_storeu_epi16(out, lanes, value); }
+        };
+
+        // AVX2 has no byte or word masked store, so storeWhere blends into what is there and writes the vector back
+        template <>
+        struct Avx2Ops<std::uint8_t> {
+            using Vector = __m256i;
+            using Lanes = __m256i;
+            static constexpr tensorSize width = 32;
+            // Each byte takes the byte of the bits holding its own, ands that with its bit, and compares
+            TENSORII_TARGET_AVX2_FMA static Lanes lanes(std::uint64_t bits) {
+                const __m256i bytes = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(bits)),
+                                                          _mm256_setr_epi64x(0x0000000000000000, 0x0101010101010101,
+                                                                             0x0202020202020202, 0x0303030303030303));
+                const __m256i own = _mm256_set1_epi64x(static_cast<long long>(0x8040201008040201));
+                return _mm256_cmpeq_epi8(_mm256_and_si256(bytes, own), own);
+            }
+            TENSORII_TARGET_AVX2_FMA static Vector zero() { return _mm256_setzero_si256(); }
+            TENSORII_TARGET_AVX2_FMA static Vector broadcast(std::uint8_t value) { return _mm256_set1_epi8(static_cast<char>(value)); }
+            TENSORII_TARGET_AVX2_FMA static Vector load(const std::uint8_t* in) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in)); }
+            TENSORII_TARGET_AVX2_FMA static void store(std::uint8_t* out, Vector value) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), value); }
+            TENSORII_TARGET_AVX2_FMA static Vector add(Vector a, Vector b) { return _mm256_add_epi8(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Vector blend(Lanes lanes, Vector whereClear, Vector whereSet) { return _mm256_blendv_epi8(whereClear, whereSet, lanes); }
+            TENSORII_TARGET_AVX2_FMA static Vector loadWhere(Lanes lanes, const std::uint8_t* in) { return _mm256_and_si256(load(in), lanes); }
+            TENSORII_TARGET_AVX2_FMA static void storeWhere(Lanes lanes, std::uint8_t* out, Vector value) { store(out, blend(lanes, load(out), value)); }
+        };
+
+        template <>
+        struct Avx2Ops<std::uint16_t> {
+            using Vector = __m256i;
+            using Lanes = __m256i;
+            static constexpr tensorSize width = 16;
+            TENSORII_TARGET_AVX2_FMA static Lanes lanes(std::uint64_t bits) {
+                const __m256i own = _mm256_setr_epi16(0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+                                                      0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, -0x8000);
+                const __m256i spread = _mm256_and_si256(_mm256_set1_epi16(static_cast<short>(bits)), own);
+                return _mm256_cmpeq_epi16(spread, own);
+            }
+            TENSORII_TARGET_AVX2_FMA static Vector zero() { return _mm256_setzero_si256(); }
+            TENSORII_TARGET_AVX2_FMA static Vector broadcast(std::uint16_t value) { return _mm256_set1_epi16(static_cast<short>(value)); }
+            TENSORII_TARGET_AVX2_FMA static Vector load(const std::uint16_t* in) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in)); }
+            TENSORII_TARGET_AVX2_FMA static void store(std::uint16_t* out, Vector value) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), value); }
+            TENSORII_TARGET_AVX2_FMA static Vector add(Vector a, Vector b) { return _mm256_add_epi16(a, b); }
+            // Lanes are all ones or zeros across each word, so a byte blend does
+            TENSORII_TARGET_AVX2_FMA static Vector blend(Lanes lanes, Vector whereClear, Vector whereSet) { return _mm256_blendv_epi8(whereClear, whereSet, lanes); }
+            TENSORII_TARGET_AVX2_FMA static Vector loadWhere(Lanes lanes, const std::uint16_t* in) { return _mm256_and_si256(load(in), lanes); }
+            TENSORII_TARGET_AVX2_FMA static void storeWhere(Lanes lanes, std::uint16_t* out, Vector value) { store(out, blend(lanes, load(out), value)); }
+        };
+        //endregion
+
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline T horizontalSum(typename Ops::Vector value) {
+            std::array<T, Ops::width> lanes;
+            Ops::store(lanes.data(), value);
+            T total = 0;
+            for (T lane : lanes) {
+                total = static_cast<T>(total + lane);
+            }
+            return total;
+        }
+
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline void selectVector(const std::uint64_t* mask, const T* whereSet, const T* whereClear, T* out, tensorSize n) {
+            tensorSize i = 0;
+            for (; i + Ops::width <= n; i += Ops::width) {
+                const typename Ops::Lanes lanes = Ops::lanes(maskBits<Ops::width>(mask, i));
+                Ops::store(out + i, Ops::blend(lanes, Ops::load(whereClear + i), Ops::load(whereSet + i)));
+            }
+            selectScalar(mask, whereSet, whereClear, out, i, n);
+        }
+
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline void fillVector(const std::uint64_t* mask, T value, T* data, tensorSize n) {
+            const typename Ops::Vector values = Ops::broadcast(value);
+            tensorSize i = 0;
+            for (; i + Ops::width <= n; i += Ops::width) {
+                Ops::storeWhere(Ops::lanes(maskBits<Ops::width>(mask, i)), data + i, values);
+            }
+            fillScalar(mask, value, data, i, n);
+        }
+
+        // Four totals per lane, so the adds of neighbouring vectors overlap
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline T maskedSumVector(const std::uint64_t* mask, const T* in, tensorSize n) {
+            constexpr tensorSize width = Ops::width;
+            typename Ops::Vector totals[4] {Ops::zero(), Ops::zero(), Ops::zero(), Ops::zero()};
+            tensorSize i = 0;
+            for (; i + 4 * width <= n; i += 4 * width) {
+                for (tensorSize k = 0; k < 4; k++) {
+                    const tensorSize at = i + k * width;
+                    totals[k] = Ops::add(totals[k], Ops::loadWhere(Ops::lanes(maskBits<width>(mask, at)), in + at));
+                }
+            }
+            for (; i + width <= n; i += width) {
+                totals[0] = Ops::add(totals[0], Ops::loadWhere(Ops::lanes(maskBits<width>(mask, i)), in + i));
+            }
+            const typename Ops::Vector all = Ops::add(Ops::add(totals[0], totals[1]), Ops::add(totals[2], totals[3]));
+            return horizontalSum<Ops, T>(all) + maskedSumScalar(mask, in, i, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512 void selectAvx512(const std::uint64_t* mask, const T* whereSet, const T* whereClear, T* out, tensorSize n) {
+            selectVector<Avx512Ops<T>>(mask, whereSet, whereClear, out, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA void selectAvx2(const std::uint64_t* mask, const T* whereSet, const T* whereClear, T* out, tensorSize n) {
+            selectVector<Avx2Ops<T>>(mask, whereSet, whereClear, out, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512 void fillAvx512(const std::uint64_t* mask, T value, T* data, tensorSize n) {
+            fillVector<Avx512Ops<T>>(mask, value, data, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA void fillAvx2(const std::uint64_t* mask, T value, T* data, tensorSize n) {
+            fillVector<Avx2Ops<T>>(mask, value, data, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512 T maskedSumAvx512(const std::uint64_t* mask, const T* in, tensorSize n) {
+            return maskedSumVector<Avx512Ops<T>>(mask, in, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA T maskedSumAvx2(const std::uint64_t* mask, const T* in, tensorSize n) {
+            return maskedSumVector<Avx2Ops<T>>(mask, in, n);
+        }
+
+        // 8 and 16-bit elements need AVX-512BW's byte and word masks
+        template <typename T>
+        TENSORII_TARGET_AVX512_BW void selectAvx512Bw(const std::uint64_t* mask, const T* whereSet, const T* whereClear, T* out, tensorSize n) {
+            selectVector<Avx512Ops<T>>(mask, whereSet, whereClear, out, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512_BW void fillAvx512Bw(const std::uint64_t* mask, T value, T* data, tensorSize n) {
+            fillVector<Avx512Ops<T>>(mask, value, data, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512_BW T maskedSumAvx512Bw(const std::uint64_t* mask, const T* in, tensorSize n) {
+            return maskedSumVector<Avx512Ops<T>>(mask, in, n);
+        }
+    }
+TENSORII_SIMD_WARNINGS_POP
+#endif
+
+    namespace {
+        template <typename T>
+        void selectDispatch(const std::uint64_t* mask, const T* whereSet, const T* whereClear, T* out, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if constexpr (sizeof(T) < 4) {
+                if (cpuFeatures().avx512f && cpuFeatures().avx512bw) { return selectAvx512Bw(mask, whereSet, whereClear, out, n); }
+            }
+            else {
+                if (cpuFeatures().avx512f) { return selectAvx512(mask, whereSet, whereClear, out, n); }
+            }
+            if (cpuFeatures().avx2 && cpuFeatures().fma) { return selectAvx2(mask, whereSet, whereClear, out, n); }
+#endif
+            selectScalar(mask, whereSet, whereClear, out, 0, n);
+        }
+
+        template <typename T>
+        void fillDispatch(const std::uint64_t* mask, T value, T* data, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if constexpr (sizeof(T) < 4) {
+                if (cpuFeatures().avx512f && cpuFeatures().avx512bw) { return fillAvx512Bw(mask, value, data, n); }
+            }
+            else {
+                if (cpuFeatures().avx512f) { return fillAvx512(mask, value, data, n); }
+            }
+            if (cpuFeatures().avx2 && cpuFeatures().fma) { return fillAvx2(mask, value, data, n); }
+#endif
+            fillScalar(mask, value, data, 0, n);
+        }
+
+        template <typename T>
+        T maskedSumDispatch(const std::uint64_t* mask, const T* in, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if constexpr (sizeof(T) < 4) {
+                if (cpuFeatures().avx512f && cpuFeatures().avx512bw) { return maskedSumAvx512Bw(mask, in, n); }
+            }
+            else {
+                if (cpuFeatures().avx512f) { return maskedSumAvx512(mask, in, n); }
+            }
+            if (cpuFeatures().avx2 && cpuFeatures().fma) { return maskedSumAvx2(mask, in, n); }
+#endif
+            return maskedSumScalar(mask, in, 0, n);
+        }
+    }
+
+    void select(const std::uint64_t* mask, const float* whereSet, const float* whereClear, float* out, tensorSize n) {
+        selectDispatch(mask, whereSet, whereClear, out, n);
+    }
+
+    void select(const std::uint64_t* mask, const double* whereSet, const double* whereClear, double* out, tensorSize n) {
+        selectDispatch(mask, whereSet, whereClear, out, n);
+    }
+
+    void fill(const std::uint64_t* mask, float value, float* data, tensorSize n) {
+        fillDispatch(mask, value, data, n);
+    }
+
+    void fill(const std::uint64_t* mask, double value, double* data, tensorSize n) {
+        fillDispatch(mask, value, data, n);
+    }
+
+    float maskedSum(const std::uint64_t* mask, const float* in, tensorSize n) {
+        return maskedSumDispatch(mask, in, n);
+    }
+
+    double maskedSum(const std::uint64_t* mask, const double* in, tensorSize n) {
+        return maskedSumDispatch(mask, in, n);
+    }
+
+    void select(const std::uint64_t* mask, const std::uint8_t* whereSet, const std::uint8_t* whereClear, std::uint8_t* out, tensorSize n) {
+        selectDispatch(mask, whereSet, whereClear, out, n);
+    }
+
+    void select(const std::uint64_t* mask, const std::uint16_t* whereSet, const std::uint16_t* whereClear, std::uint16_t* out, tensorSize n) {
+        selectDispatch(mask, whereSet, whereClear, out, n);
+    }
+
+    void select(const std::uint64_t* mask, const std::int8_t* whereSet, const std::int8_t* whereClear, std::int8_t* out, tensorSize n) {
+        selectDispatch(mask, reinterpret_cast<const std::uint8_t*>(whereSet), reinterpret_cast<const std::uint8_t*>(whereClear),
+                       reinterpret_cast<std::uint8_t*>(out), n);
+    }
+
+    void select(const std::uint64_t* mask, const std::int16_t* whereSet, const std::int16_t* whereClear, std::int16_t* out, tensorSize n) {
+        selectDispatch(mask, reinterpret_cast<const std::uint16_t*>(whereSet), reinterpret_cast<const std::uint16_t*>(whereClear),
+                       reinterpret_cast<std::uint16_t*>(out), n);
+    }
+
+    void fill(const std::uint64_t* mask, std::uint8_t value, std::uint8_t* data, tensorSize n) {
+        fillDispatch(mask, value, data, n);
+    }
+
+    void fill(const std::uint64_t* mask, std::uint16_t value, std::uint16_t* data, tensorSize n) {
+        fillDispatch(mask, value, data, n);
+    }
+
+    void fill(const std::uint64_t* mask, std::int8_t value, std::int8_t* data, tensorSize n) {
+        fillDispatch(mask, static_cast<std::uint8_t>(value), reinterpret_cast<std::uint8_t*>(data), n);
+    }
+
+    void fill(const std::uint64_t* mask, std::int16_t value, std::int16_t* data, tensorSize n) {
+        fillDispatch(mask, static_cast<std::uint16_t>(value), reinterpret_cast<std::uint16_t*>(data), n);
+    }
+
+    std::uint8_t maskedSum(const std::uint64_t* mask, const std::uint8_t* in, tensorSize n) {
+        return maskedSumDispatch(mask, in, n);
+    }
+
+    std::uint16_t maskedSum(const std::uint64_t* mask, const std::uint16_t* in, tensorSize n) {
+        return maskedSumDispatch(mask, in, n);
+    }
+
+    std::int8_t maskedSum(const std::uint64_t* mask, const std::int8_t* in, tensorSize n) {
+        return static_cast<std::int8_t>(maskedSumDispatch(mask, reinterpret_cast<const std::uint8_t*>(in), n));
+    }
+
+    std::int16_t maskedSum(const std::uint64_t* mask, const std::int16_t* in, tensorSize n) {
+        return static_cast<std::int16_t>(maskedSumDispatch(mask, reinterpret_cast<const std::uint16_t*>(in), n));
+    }
+}
@@ -0,0 +1,137 @@
+#include "TensorII/PerfCounters.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace TensorII::Core::Instrumentation {
+
+    const char* toString(Counter counter) {
+        switch (counter) {
+            case Counter::Cycles:       return "cycles";
+            case Counter::Instructions: return "instructions";
+            case Counter::CacheMisses:  return "cache_misses";
+            case Counter::BranchMisses: return "branch_misses";
+            case Counter::PageFaults:   return "page_faults";
+            default:                    return "unknown";
+        }
+    }
+
+#if defined(__linux__)
+    namespace {
+        struct EventConfig {
+            uint32_t type;
+            uint64_t config;
+        };
+
+        // Indexed by Counter
+        constexpr std::array<EventConfig, nCounters> eventConfigs {{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+        }};
+
+        int openEvent(const EventConfig& event, int groupFd) {
+            perf_event_attr attributes {};
+            attributes.size = sizeof(attributes);
+            attributes.type = event.type;
+            attributes.config = event.config;
+            // User space only, which is all perf_event_paranoid=2 allows
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, groupFd, 0));
+        }
+    }
+
+    PerfCounters::PerfCounters()
+    : leader_(-1)
+    , nOpen_(0)
+    {
+        slots_.fill(-1);
+        fds_.fill(-1);
+        // The first counter that opens leads the group, so the rest are scheduled together with it
+        for (size_t i = 0; i < nCounters; i++) {
+            int fd = openEvent(eventConfigs[i], leader_);
+            if (fd < 0) {
+                continue;
+            }
+            if (leader_ < 0) {
+                leader_ = fd;
+            }
+            fds_[i] = fd;
+            slots_[i] = nOpen_++;
+        }
+        if (leader_ >= 0) {
+            ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+
+    PerfCounters::~PerfCounters() {
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    CounterSample PerfCounters::read() const {
+        CounterSample sample;
+        if (leader_ < 0) {
+            return sample;
+        }
+        // { nr, time_enabled, time_running, values[nr] }
+        std::array<uint64_t, 3 + nCounters> buffer {};
+        if (::read(leader_, buffer.data(), sizeof(buffer)) < 0) {
+            return sample;
+        }
+        const uint64_t enabled = buffer[1];
+        const uint64_t running = buffer[2];
+        for (size_t i = 0; i < nCounters; i++) {
+            if (slots_[i] < 0) {
+                continue;
+            }
+            uint64_t value = buffer[3 + static_cast<size_t>(slots_[i])];
+            if (running != 0 && running < enabled) {
+                value = static_cast<uint64_t>(static_cast<double>(value) * static_cast<double>(enabled)
+                                              / static_cast<double>(running));
+            }
+            sample.values[i] = value;
+        }
+        return sample;
+    }
+#else
+    PerfCounters::PerfCounters()
+    : leader_(-1)
+    , nOpen_(0)
+    {
+        slots_.fill(-1);
+        fds_.fill(-1);
+    }
+
+    PerfCounters::~PerfCounters() = default;
+
+    CounterSample PerfCounters::read() const {
+        return {};
+    }
+#endif
+
+    bool PerfCounters::available() const {
+        return nOpen_ > 0;
+    }
+
+    bool PerfCounters::available(Counter counter) const {
+        return slots_[static_cast<size_t>(counter)] >= 0;
+    }
+
+    PerfCounters& PerfCounters::thisThread() {
+        thread_local PerfCounters counters;
+        return counters;
+    }
+}
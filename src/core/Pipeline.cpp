@@ -0,0 +1,47 @@
+#include "TensorII/Pipeline.h"
+
+#include <utility>
+
+namespace TensorII::Core {
+
+    void StageTask::Finish::await_suspend(std::coroutine_handle<promise_type> handle) const noexcept {
+        Promise<void> completion = std::move(handle.promise().completion);
+        const std::exception_ptr error = handle.promise().error;
+        // Whatever the frame held, e.g. frames from a FramePool, goes back before anyone waiting hears it's done
+        handle.destroy();
+        if (error) {
+            completion.fail(error);
+        }
+        else {
+            completion.set();
+        }
+    }
+
+    StageTask::StageTask(StageTask&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+    StageTask::~StageTask() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    Future<void> StageTask::start(ThreadPool& pool) && {
+        Future<void> done = handle_.promise().completion.future();
+        pool.submit([handle = std::exchange(handle_, {})] { handle.resume(); });
+        return done;
+    }
+
+    void Pipeline::add(StageTask stage) {
+        stages_.push_back(std::move(stage).start(pool_));
+    }
+
+    void Pipeline::wait() {
+        const std::vector<Future<void>> stages = std::exchange(stages_, {});
+        for (const auto& stage : stages) {
+            stage.wait();
+        }
+        for (const auto& stage : stages) {
+            stage.get();
+        }
+    }
+}
@@ -0,0 +1,230 @@
+#include "TensorII/private/QuantizedKernels.h"
+#include "TensorII/private/CpuFeatures.h"
+#include "TensorII/private/SimdTargets.h"
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+namespace TensorII::Core::Private {
+
+    namespace {
+        //region Scalar, also used for the tails of the vector loops
+        template <typename T>
+        int64_t sumScalar(const T* in, tensorSize begin, tensorSize n) {
+            int64_t result = 0;
+            for (tensorSize i = begin; i < n; i++) {
+                result += in[i];
+            }
+            return result;
+        }
+
+        template <typename T>
+        int64_t dotScalar(const T* lhs, const T* rhs, tensorSize begin, tensorSize n) {
+            int64_t result = 0;
+            for (tensorSize i = begin; i < n; i++) {
+                result += static_cast<int64_t>(lhs[i]) * static_cast<int64_t>(rhs[i]);
+            }
+            return result;
+        }
+        //endregion
+
+#ifdef TENSORII_SIMD_KERNELS
+        //region AVX2
+        // Vector steps 32-bit lanes can accumulate before they could overflow, and are flushed to 64 bits
+        constexpr tensorSize blockSteps = 8192;
+
+        TENSORII_TARGET_AVX2 int64_t horizontalSum64(__m256i values) {
+            alignas(32) std::array<int64_t, 4> lanes {};
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes.data()), values);
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        }
+
+        TENSORII_TARGET_AVX2 int64_t horizontalSum32(__m256i values) {
+            alignas(32) std::array<int32_t, 8> lanes {};
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes.data()), values);
+            int64_t result = 0;
+            for (int32_t lane : lanes) { result += lane; }
+            return result;
+        }
+
+        // Unsigned by flipping the top bit, which adds 2^(bits-1) to every value
+        template <typename T>
+        constexpr int64_t bias() {
+            return std::is_signed_v<T> ? int64_t(1) << (8 * sizeof(T) - 1) : 0;
+        }
+
+        // Sums of absolute differences against 0, exact in 64-bit lanes
+        template <typename T>
+        requires (sizeof(T) == 1)
+        TENSORII_TARGET_AVX2 int64_t sumAvx2(const T* in, tensorSize n) {
+            const __m256i flip = _mm256_set1_epi8(static_cast<char>(bias<T>()));
+            __m256i total = _mm256_setzero_si256();
+            tensorSize i = 0;
+            for (; i + 32 <= n; i += 32) {
+                const __m256i values = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)), flip);
+                total = _mm256_add_epi64(total, _mm256_sad_epu8(values, _mm256_setzero_si256()));
+            }
+            return horizontalSum64(total) - bias<T>() * static_cast<int64_t>(i) + sumScalar(in, i, n);
+        }
+
+        // Pairwise sums against ones, signed by flipping the top bit of unsigned values
+        template <typename T>
+        requires (sizeof(T) == 2)
+        TENSORII_TARGET_AVX2 int64_t sumAvx2(const T* in, tensorSize n) {
+            constexpr int64_t unsignedBias = std::is_signed_v<T> ? 0 : 0x8000;
+            const __m256i flip = _mm256_set1_epi16(static_cast<short>(unsignedBias));
+            const __m256i ones = _mm256_set1_epi16(1);
+            int64_t result = 0;
+            tensorSize i = 0;
+            while (i + 16 <= n) {
+                __m256i block = _mm256_setzero_si256();
+                const tensorSize blockEnd = std::min(n - n % 16, i + 16 * blockSteps);
+                for (; i < blockEnd; i += 16) {
+                    const __m256i values = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)), flip);
+                    block = _mm256_add_epi32(block, _mm256_madd_epi16(values, ones));
+                }
+                result += horizontalSum32(block);
+            }
+            return result + unsignedBias * static_cast<int64_t>(i) + sumScalar(in, i, n);
+        }
+
+        TENSORII_TARGET_AVX2 __m256i widen16(const int8_t* in) {
+            return _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+        }
+
+        TENSORII_TARGET_AVX2 __m256i widen16(const uint8_t* in) {
+            return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+        }
+
+        TENSORII_TARGET_AVX2 __m256i widen32(const int16_t* in) {
+            return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+        }
+
+        TENSORII_TARGET_AVX2 __m256i widen32(const uint16_t* in) {
+            return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+        }
+
+        // Widened to 16 bits so pairwise multiply-adds are exact, |pair| <= 2 * 255^2
+        template <typename T>
+        requires (sizeof(T) == 1)
+        TENSORII_TARGET_AVX2 int64_t dotAvx2(const T* lhs, const T* rhs, tensorSize n) {
+            int64_t result = 0;
+            tensorSize i = 0;
+            while (i + 16 <= n) {
+                __m256i block = _mm256_setzero_si256();
+                const tensorSize blockEnd = std::min(n - n % 16, i + 16 * blockSteps);
+                for (; i < blockEnd; i += 16) {
+                    block = _mm256_add_epi32(block, _mm256_madd_epi16(widen16(lhs + i), widen16(rhs + i)));
+                }
+                result += horizontalSum32(block);
+            }
+            return result + dotScalar(lhs, rhs, i, n);
+        }
+
+        // Products of 16-bit values fill 32 bits, so they're widened to 64 before they're added
+        template <typename T>
+        requires (sizeof(T) == 2)
+        TENSORII_TARGET_AVX2 int64_t dotAvx2(const T* lhs, const T* rhs, tensorSize n) {
+            __m256i total = _mm256_setzero_si256();
+            tensorSize i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const __m256i products = _mm256_mullo_epi32(widen32(lhs + i), widen32(rhs + i));
+                const __m128i low = _mm256_castsi256_si128(products);
+                const __m128i high = _mm256_extracti128_si256(products, 1);
+                if constexpr (std::is_signed_v<T>) {
+                    total = _mm256_add_epi64(total, _mm256_add_epi64(_mm256_cvtepi32_epi64(low), _mm256_cvtepi32_epi64(high)));
+                } else {
+                    total = _mm256_add_epi64(total, _mm256_add_epi64(_mm256_cvtepu32_epi64(low), _mm256_cvtepu32_epi64(high)));
+                }
+            }
+            return horizontalSum64(total) + dotScalar(lhs, rhs, i, n);
+        }
+        //endregion
+
+        //region AVX-512 VNNI
+TENSORII_SIMD_WARNINGS_PUSH
+        TENSORII_TARGET_AVX512_VNNI int64_t horizontalSum32(__m512i values) {
+            const __m512i low = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(values));
+            const __m512i high = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(values, 1));
+            return _mm512_reduce_add_epi64(_mm512_add_epi64(low, high));
+        }
+
+        // vpdpbusd multiplies unsigned by signed bytes, so one side has its top bit flipped and the
+        // resulting bias, 128 times the sum of the other side, is taken back off
+        template <typename T>
+        requires (sizeof(T) == 1)
+        TENSORII_TARGET_AVX512_VNNI int64_t dotVnni(const T* lhs, const T* rhs, tensorSize n) {
+            const __m512i flip = _mm512_set1_epi8(static_cast<char>(0x80));
+            const __m512i ones = _mm512_set1_epi8(1);
+            int64_t products = 0;
+            int64_t biasSum = 0;
+            tensorSize i = 0;
+            while (i + 64 <= n) {
+                __m512i block = _mm512_setzero_si512();
+                __m512i biasBlock = _mm512_setzero_si512();
+                const tensorSize blockEnd = std::min(n - n % 64, i + 64 * blockSteps / 2);
+                for (; i < blockEnd; i += 64) {
+                    const __m512i a = _mm512_loadu_si512(lhs + i);
+                    const __m512i b = _mm512_loadu_si512(rhs + i);
+                    if constexpr (std::is_signed_v<T>) {
+                        // (a + 128) . b = a . b + 128 * sum(b)
+                        block = _mm512_dpbusd_epi32(block, _mm512_xor_si512(a, flip), b);
+                        biasBlock = _mm512_dpbusd_epi32(biasBlock, ones, b);
+                    } else {
+                        // a . (b - 128) = a . b - 128 * sum(a)
+                        block = _mm512_dpbusd_epi32(block, a, _mm512_xor_si512(b, flip));
+                        biasBlock = _mm512_dpbusd_epi32(biasBlock, a, ones);
+                    }
+                }
+                products += horizontalSum32(block);
+                biasSum += horizontalSum32(biasBlock);
+            }
+            const int64_t correction = std::is_signed_v<T> ? -128 * biasSum : 128 * biasSum;
+            return products + correction + dotScalar(lhs, rhs, i, n);
+        }
+TENSORII_SIMD_WARNINGS_POP
+        //endregion
+#endif
+
+        bool hasVnni() {
+            const CpuFeatures& features = cpuFeatures();
+            return features.avx512f && features.avx512bw && features.avx512vnni;
+        }
+
+        template <typename T>
+        int64_t sumDispatch(const T* in, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if constexpr (sizeof(T) <= 2) {
+                if (cpuFeatures().avx2) { return sumAvx2(in, n); }
+            }
+#endif
+            return sumScalar(in, 0, n);
+        }
+
+        template <typename T>
+        int64_t dotDispatch(const T* lhs, const T* rhs, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if constexpr (sizeof(T) == 1) {
+                if (hasVnni()) { return dotVnni(lhs, rhs, n); }
+            }
+            if constexpr (sizeof(T) <= 2) {
+                if (cpuFeatures().avx2) { return dotAvx2(lhs, rhs, n); }
+            }
+#endif
+            return dotScalar(lhs, rhs, 0, n);
+        }
+    }
+
+    int64_t sum(const int8_t* in, tensorSize n) { return sumDispatch(in, n); }
+    int64_t sum(const uint8_t* in, tensorSize n) { return sumDispatch(in, n); }
+    int64_t sum(const int16_t* in, tensorSize n) { return sumDispatch(in, n); }
+    int64_t sum(const uint16_t* in, tensorSize n) { return sumDispatch(in, n); }
+    int64_t sum(const int32_t* in, tensorSize n) { return sumDispatch(in, n); }
+
+    int64_t dot(const int8_t* lhs, const int8_t* rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+    int64_t dot(const uint8_t* lhs, const uint8_t* rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+    int64_t dot(const int16_t* lhs, const int16_t* rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+    int64_t dot(const uint16_t* lhs, const uint16_t* rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+    int64_t dot(const int32_t* lhs, const int32_t* rhs, tensorSize n) { return dotDispatch(lhs, rhs, n); }
+}
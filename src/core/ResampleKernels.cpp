@@ -0,0 +1,187 @@
+#include "TensorII/private/ResampleKernels.h"
+#include "TensorII/private/Parallel.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace TensorII::Core::Private {
+
+    namespace {
+        // Bands at which blending a pixel's bands is worth a SIMD weighted sum
+        constexpr tensorSize vectorBands = 16;
+
+        // Keys' cubic convolution kernel with a = -0.5, at distance t from a tap
+        double cubicWeight(double t) {
+            constexpr double a = -0.5;
+            t = std::abs(t);
+            if (t <= 1) {
+                return ((a + 2) * t - (a + 3)) * t * t + 1;
+            }
+            return ((a * t - 5 * a) * t + 8 * a) * t - 4 * a;
+        }
+
+        // Source indices along one axis a sample at 'position' reads, -1 beyond a Dirichlet edge, and their weights
+        struct Taps {
+            std::array<tensorIndex, 4> index;
+            std::array<double, 4> weight;
+            tensorSize count;
+        };
+
+        Taps tapsAt(Interpolation interpolation, double position, tensorIndex extent, Boundary boundary) {
+            const double whole = std::floor(position);
+            const double fraction = position - whole;
+            // Offset before converting, so there's no signed arithmetic left for the bounds checks to fold
+            const double first = interpolation == Interpolation::Bicubic ? whole - 1 : whole;
+            Taps taps {};
+            if (interpolation == Interpolation::Bicubic) {
+                taps.count = 4;
+                taps.weight = {cubicWeight(1 + fraction), cubicWeight(fraction), cubicWeight(1 - fraction), cubicWeight(2 - fraction)};
+            } else {
+                taps.count = 2;
+                taps.weight = {1 - fraction, fraction};
+            }
+            for (tensorSize t = 0; t < taps.count; t++) {
+                taps.index[t] = wrapIndex(boundary, static_cast<tensorIndex>(first + static_cast<double>(t)), extent);
+            }
+            return taps;
+        }
+
+        template <tensorSize taps, typename T>
+        void blendFew(const T* const* sources, const T* weights, T* out, tensorSize bands) {
+            for (tensorSize band = 0; band < bands; band++) {
+                T total {};
+                for (tensorSize tap = 0; tap < taps; tap++) {
+                    total += weights[tap] * sources[tap][band];
+                }
+                out[band] = total;
+            }
+        }
+
+        // out = sum over t of weights[t] * sources[t], each 'bands' long. Few bands are blended with the tap
+        // count fixed, so the taps unroll and the bands vectorise.
+        template <typename T>
+        void blendBands(const T* const* sources, const T* weights, tensorSize taps, T* out, tensorSize bands) {
+            if (bands >= vectorBands) {
+                weightedSum(sources, weights, taps, out, bands);
+            } else if (taps == 2) {
+                blendFew<2>(sources, weights, out, bands);
+            } else if (taps == 4) {
+                blendFew<4>(sources, weights, out, bands);
+            } else {
+                blendFew<16>(sources, weights, out, bands);
+            }
+        }
+
+        template <typename T>
+        void resizeImpl(const T* in, ImageExtents inExtents, T* out, ImageExtents outExtents,
+                        Interpolation interpolation, Boundary boundary, T boundaryValue) {
+            const tensorSize bands = inExtents.bands;
+            const tensorSize rowLength = inExtents.columns * bands;
+            // What Dirichlet taps read, a whole row for the rows and a pixel's worth for the columns
+            const std::vector<T> outside (rowLength, boundaryValue);
+            const auto position = [](tensorSize i, tensorSize from, tensorSize to) {
+                return (static_cast<double>(i) + 0.5) * static_cast<double>(from) / static_cast<double>(to) - 0.5;
+            };
+            // The same for every row
+            std::vector<Taps> columnTaps (outExtents.columns);
+            for (tensorSize column = 0; column < outExtents.columns; column++) {
+                columnTaps[column] = tapsAt(interpolation, position(column, inExtents.columns, outExtents.columns),
+                                            static_cast<tensorIndex>(inExtents.columns), boundary);
+            }
+
+            parallelFor(outExtents.rows, resampleRowGrain(outExtents), [&](tensorSize begin, tensorSize end) {
+                std::vector<T> blended (rowLength);
+                std::array<const T*, 4> sources;
+                std::array<T, 4> weights;
+                for (tensorSize row = begin; row < end; row++) {
+                    const Taps rowTaps = tapsAt(interpolation, position(row, inExtents.rows, outExtents.rows),
+                                                static_cast<tensorIndex>(inExtents.rows), boundary);
+                    for (tensorSize t = 0; t < rowTaps.count; t++) {
+                        sources[t] = rowTaps.index[t] < 0 ? outside.data() : in + static_cast<tensorSize>(rowTaps.index[t]) * rowLength;
+                        weights[t] = static_cast<T>(rowTaps.weight[t]);
+                    }
+                    weightedSum(sources.data(), weights.data(), rowTaps.count, blended.data(), rowLength);
+
+                    T* outRow = out + row * outExtents.columns * bands;
+                    for (tensorSize column = 0; column < outExtents.columns; column++) {
+                        const Taps& taps = columnTaps[column];
+                        for (tensorSize t = 0; t < taps.count; t++) {
+                            sources[t] = taps.index[t] < 0 ? outside.data() : blended.data() + static_cast<tensorSize>(taps.index[t]) * bands;
+                            weights[t] = static_cast<T>(taps.weight[t]);
+                        }
+                        blendBands(sources.data(), weights.data(), taps.count, outRow + column * bands, bands);
+                    }
+                }
+            });
+        }
+
+        template <typename T, typename Coordinate>
+        void warpImpl(const T* in, ImageExtents inExtents, const Coordinate* coordinates, T* out, ImageExtents outExtents,
+                      Interpolation interpolation, Boundary boundary, T boundaryValue) {
+            const tensorSize bands = inExtents.bands;
+            const std::vector<T> outside (bands, boundaryValue);
+
+            parallelFor(outExtents.rows, resampleRowGrain(outExtents), [&](tensorSize begin, tensorSize end) {
+                std::array<const T*, 16> sources;
+                std::array<T, 16> weights;
+                for (tensorSize pixel = begin * outExtents.columns; pixel < end * outExtents.columns; pixel++) {
+                    const auto row = static_cast<double>(coordinates[2 * pixel]);
+                    const auto column = static_cast<double>(coordinates[2 * pixel + 1]);
+                    T* target = out + pixel * bands;
+                    if (std::isnan(row) || std::isnan(column)) {
+                        std::fill_n(target, bands, boundaryValue);
+                        continue;
+                    }
+                    const Taps rowTaps = tapsAt(interpolation, std::clamp(row, -farthestCoordinate, farthestCoordinate),
+                                                static_cast<tensorIndex>(inExtents.rows), boundary);
+                    const Taps columnTaps = tapsAt(interpolation, std::clamp(column, -farthestCoordinate, farthestCoordinate),
+                                                   static_cast<tensorIndex>(inExtents.columns), boundary);
+                    tensorSize taps = 0;
+                    for (tensorSize i = 0; i < rowTaps.count; i++) {
+                        for (tensorSize j = 0; j < columnTaps.count; j++, taps++) {
+                            const tensorIndex sourceRow = rowTaps.index[i];
+                            const tensorIndex sourceColumn = columnTaps.index[j];
+                            sources[taps] = sourceRow < 0 || sourceColumn < 0
+                                            ? outside.data()
+                                            : in + (static_cast<tensorSize>(sourceRow) * inExtents.columns + static_cast<tensorSize>(sourceColumn)) * bands;
+                            weights[taps] = static_cast<T>(rowTaps.weight[i] * columnTaps.weight[j]);
+                        }
+                    }
+                    blendBands(sources.data(), weights.data(), taps, target, bands);
+                }
+            });
+        }
+    }
+
+    void resize(const float* in, ImageExtents inExtents, float* out, ImageExtents outExtents,
+                Interpolation interpolation, Boundary boundary, float boundaryValue) {
+        resizeImpl(in, inExtents, out, outExtents, interpolation, boundary, boundaryValue);
+    }
+
+    void resize(const double* in, ImageExtents inExtents, double* out, ImageExtents outExtents,
+                Interpolation interpolation, Boundary boundary, double boundaryValue) {
+        resizeImpl(in, inExtents, out, outExtents, interpolation, boundary, boundaryValue);
+    }
+
+    void warp(const float* in, ImageExtents inExtents, const float* coordinates, float* out, ImageExtents outExtents,
+              Interpolation interpolation, Boundary boundary, float boundaryValue) {
+        warpImpl(in, inExtents, coordinates, out, outExtents, interpolation, boundary, boundaryValue);
+    }
+
+    void warp(const float* in, ImageExtents inExtents, const double* coordinates, float* out, ImageExtents outExtents,
+              Interpolation interpolation, Boundary boundary, float boundaryValue) {
+        warpImpl(in, inExtents, coordinates, out, outExtents, interpolation, boundary, boundaryValue);
+    }
+
+    void warp(const double* in, ImageExtents inExtents, const float* coordinates, double* out, ImageExtents outExtents,
+              Interpolation interpolation, Boundary boundary, double boundaryValue) {
+        warpImpl(in, inExtents, coordinates, out, outExtents, interpolation, boundary, boundaryValue);
+    }
+
+    void warp(const double* in, ImageExtents inExtents, const double* coordinates, double* out, ImageExtents outExtents,
+              Interpolation interpolation, Boundary boundary, double boundaryValue) {
+        warpImpl(in, inExtents, coordinates, out, outExtents, interpolation, boundary, boundaryValue);
+    }
+}
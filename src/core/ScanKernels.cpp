@@ -0,0 +1,158 @@
+#include "TensorII/private/ScanKernels.h"
+#include "TensorII/private/CpuFeatures.h"
+#include "TensorII/private/SimdTargets.h"
+
+namespace TensorII::Core::Private {
+
+    namespace {
+        // Also the tail of the vector loop, carrying on from 'running'
+        template <typename T>
+        void inclusiveSumScalar(const T* in, T* out, tensorSize begin, tensorSize n, T running) {
+            for (tensorSize i = begin; i < n; i++) {
+                running += in[i];
+                out[i] = running;
+            }
+        }
+    }
+
+#ifdef TENSORII_SIMD_KERNELS
+TENSORII_SIMD_WARNINGS_PUSH
+    namespace {
+        //region Vector operations
+        // prefix() is the running sum across the lanes of one vector, and last() its final lane in every lane.
+        // AVX-512 shifts whole vectors lanewise with valign against zero; AVX2 shifts within 128-bit halves,
+        // then adds the low half's total into the high half.
+        template <typename T> struct Avx512Ops;
+        template <typename T> struct Avx2Ops;
+
+        template <>
+        struct Avx512Ops<float> {
+            using Vector = __m512;
+            static constexpr tensorSize width = 16;
+            TENSORII_TARGET_AVX512 static Vector zero() { return _mm512_setzero_ps(); }
+            TENSORII_TARGET_AVX512 static Vector load(const float* in) { return _mm512_loadu_ps(in); }
+            TENSORII_TARGET_AVX512 static void store(float* out, Vector value) { _mm512_storeu_ps(out, value); }
+            TENSORII_TARGET_AVX512 static Vector add(Vector a, Vector b) { return _mm512_add_ps(a, b); }
+            TENSORII_TARGET_AVX512 static float first(Vector a) { return _mm512_cvtss_f32(a); }
+            TENSORII_TARGET_AVX512 static Vector last(Vector a) { return _mm512_permutexvar_ps(_mm512_set1_epi32(15), a); }
+            // Lanes moved up by 'count', zeros shifted in
+            template <int count>
+            TENSORII_TARGET_AVX512 static Vector shift(Vector a) {
+                return _mm512_castsi512_ps(_mm512_alignr_epi32(_mm512_castps_si512(a), _mm512_setzero_si512(), 16 - count));
+            }
+            TENSORII_TARGET_AVX512 static Vector prefix(Vector a) {
+                a = _mm512_add_ps(a, shift<1>(a));
+                a = _mm512_add_ps(a, shift<2>(a));
+                a = _mm512_add_ps(a, shift<4>(a));
+                return _mm512_add_ps(a, shift<8>(a));
+            }
+        };
+
+        template <>
+        struct Avx512Ops<double> {
+            using Vector = __m512d;
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX512 static Vector zero() { return _mm512_setzero_pd(); }
+            TENSORII_TARGET_AVX512 static Vector load(const double* in) { return _mm512_loadu_pd(in); }
+            TENSORII_TARGET_AVX512 static void store(double* out, Vector value) { _mm512_storeu_pd(out, value); }
+            TENSORII_TARGET_AVX512 static Vector add(Vector a, Vector b) { return _mm512_add_pd(a, b); }
+            TENSORII_TARGET_AVX512 static double first(Vector a) { return _mm512_cvtsd_f64(a); }
+            TENSORII_TARGET_AVX512 static Vector last(Vector a) { return _mm512_permutexvar_pd(_mm512_set1_epi64(7), a); }
+            template <int count>
+            TENSORII_TARGET_AVX512 static Vector shift(Vector a) {
+                return _mm512_castsi512_pd(_mm512_alignr_epi64(_mm512_castpd_si512(a), _mm512_setzero_si512(), 8 - count));
+            }
+            TENSORII_TARGET_AVX512 static Vector prefix(Vector a) {
+                a = _mm512_add_pd(a, shift<1>(a));
+                a = _mm512_add_pd(a, shift<2>(a));
+                return _mm512_add_pd(a, shift<4>(a));
+            }
+        };
+
+        template <>
+        struct Avx2Ops<float> {
+            using Vector = __m256;
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX2_FMA static Vector zero() { return _mm256_setzero_ps(); }
+            TENSORII_TARGET_AVX2_FMA static Vector load(const float* in) { return _mm256_loadu_ps(in); }
+            TENSORII_TARGET_AVX2_FMA static void store(float* out, Vector value) { _mm256_storeu_ps(out, value); }
+            TENSORII_TARGET_AVX2_FMA static Vector add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+            TENSORII_TARGET_AVX2_FMA static float first(Vector a) { return _mm256_cvtss_f32(a); }
+            TENSORII_TARGET_AVX2_FMA static Vector last(Vector a) {
+                const Vector high = _mm256_permute_ps(a, 0xFF);
+                return _mm256_permute2f128_ps(high, high, 0x11);
+            }
+            TENSORII_TARGET_AVX2_FMA static Vector prefix(Vector a) {
+                a = _mm256_add_ps(a, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(a), 4)));
+                a = _mm256_add_ps(a, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(a), 8)));
+                const Vector lowTotal = _mm256_permute_ps(a, 0xFF);
+                return _mm256_add_ps(a, _mm256_permute2f128_ps(lowTotal, lowTotal, 0x08));
+            }
+        };
+
+        template <>
+        struct Avx2Ops<double> {
+            using Vector = __m256d;
+            static constexpr tensorSize width = 4;
+            TENSORII_TARGET_AVX2_FMA static Vector zero() { return _mm256_setzero_pd(); }
+            TENSORII_TARGET_AVX2_FMA static Vector load(const double* in) { return _mm256_loadu_pd(in); }
+            TENSORII_TARGET_AVX2_FMA static void store(double* out, Vector value) { _mm256_storeu_pd(out, value); }
+            TENSORII_TARGET_AVX2_FMA static Vector add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+            TENSORII_TARGET_AVX2_FMA static double first(Vector a) { return _mm256_cvtsd_f64(a); }
+            TENSORII_TARGET_AVX2_FMA static Vector last(Vector a) {
+                const Vector high = _mm256_permute_pd(a, 0xF);
+                return _mm256_permute2f128_pd(high, high, 0x11);
+            }
+            TENSORII_TARGET_AVX2_FMA static Vector prefix(Vector a) {
+                a = _mm256_add_pd(a, _mm256_castsi256_pd(_mm256_slli_si256(_mm256_castpd_si256(a), 8)));
+                const Vector lowTotal = _mm256_permute_pd(a, 0xF);
+                return _mm256_add_pd(a, _mm256_permute2f128_pd(lowTotal, lowTotal, 0x08));
+            }
+        };
+        //endregion
+
+        // The carry is the only dependency between vectors, one add long; each vector's own scan overlaps it
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline void inclusiveSumVector(const T* in, T* out, tensorSize n) {
+            typename Ops::Vector carry = Ops::zero();
+            tensorSize i = 0;
+            for (; i + Ops::width <= n; i += Ops::width) {
+                const typename Ops::Vector sums = Ops::prefix(Ops::load(in + i));
+                Ops::store(out + i, Ops::add(sums, carry));
+                carry = Ops::add(carry, Ops::last(sums));
+            }
+            inclusiveSumScalar(in, out, i, n, Ops::first(carry));
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512 void inclusiveSumAvx512(const T* in, T* out, tensorSize n) {
+            inclusiveSumVector<Avx512Ops<T>>(in, out, n);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA void inclusiveSumAvx2(const T* in, T* out, tensorSize n) {
+            inclusiveSumVector<Avx2Ops<T>>(in, out, n);
+        }
+    }
+TENSORII_SIMD_WARNINGS_POP
+#endif
+
+    namespace {
+        template <typename T>
+        void inclusiveSumDispatch(const T* in, T* out, tensorSize n) {
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return inclusiveSumAvx512(in, out, n); }
+            if (cpuFeatures().avx2 && cpuFeatures().fma) { return inclusiveSumAvx2(in, out, n); }
+#endif
+            inclusiveSumScalar(in, out, 0, n, T {});
+        }
+    }
+
+    void inclusiveSum(const float* in, float* out, tensorSize n) {
+        inclusiveSumDispatch(in, out, n);
+    }
+
+    void inclusiveSum(const double* in, double* out, tensorSize n) {
+        inclusiveSumDispatch(in, out, n);
+    }
+}
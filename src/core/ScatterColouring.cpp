@@ -0,0 +1,68 @@
+#include "TensorII/ScatterColouring.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace TensorII::Core {
+
+    ScatterColouring::ScatterColouring(const std::int32_t* indices, tensorSize rows, tensorSize rowLength, tensorSize fieldSize)
+    : rows_(rows), rowLength_(rowLength)
+    {
+        colour(indices, fieldSize);
+    }
+
+    ScatterColouring::ScatterColouring(const std::int64_t* indices, tensorSize rows, tensorSize rowLength, tensorSize fieldSize)
+    : rows_(rows), rowLength_(rowLength)
+    {
+        colour(indices, fieldSize);
+    }
+
+    std::span<const tensorSize> ScatterColouring::rowsOf(tensorSize colour) const noexcept {
+        return {order_.data() + starts_[colour], order_.data() + starts_[colour + 1]};
+    }
+
+    std::span<const tensorSize> ScatterColouring::uncoloured() const noexcept {
+        return {order_.data() + starts_[colours()], order_.data() + starts_[colours() + 1]};
+    }
+
+    template <typename Index>
+    void ScatterColouring::colour(const Index* indices, tensorSize fieldSize) {
+        // Colours already taken by a row touching each element, a bit each
+        std::vector<std::uint64_t> taken (fieldSize);
+        std::vector<tensorSize> colourOf (rows_);
+        std::vector<tensorSize> counts (maxColours + 1);
+        tensorSize used = 0;
+        for (tensorSize row = 0; row < rows_; row++) {
+            const Index* targets = indices + row * rowLength_;
+            std::uint64_t forbidden = 0;
+            for (tensorSize k = 0; k < rowLength_; k++) {
+                if (targets[k] < 0 || static_cast<tensorSize>(targets[k]) >= fieldSize) {
+                    throw std::out_of_range("Scatter index outside the field");
+                }
+                forbidden |= taken[static_cast<tensorSize>(targets[k])];
+            }
+            const auto colour = static_cast<tensorSize>(std::countr_one(forbidden));
+            if (colour < maxColours) {
+                for (tensorSize k = 0; k < rowLength_; k++) {
+                    taken[static_cast<tensorSize>(targets[k])] |= std::uint64_t {1} << colour;
+                }
+                used = std::max(used, colour + 1);
+            }
+            colourOf[row] = colour;
+            counts[colour]++;
+        }
+
+        // Counting sort by colour, keeping rows in order within each; uncoloured rows go after the last colour
+        counts[used] = counts[maxColours];
+        starts_.assign(used + 2, 0);
+        for (tensorSize colour = 0; colour <= used; colour++) {
+            starts_[colour + 1] = starts_[colour] + counts[colour];
+        }
+        std::vector<tensorSize> next (starts_.begin(), starts_.end() - 1);
+        order_.resize(rows_);
+        for (tensorSize row = 0; row < rows_; row++) {
+            order_[next[std::min(colourOf[row], used)]++] = row;
+        }
+    }
+}
@@ -0,0 +1,250 @@
+#include "TensorII/private/SortKernels.h"
+#include "TensorII/private/CpuFeatures.h"
+#include "TensorII/private/SimdTargets.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace TensorII::Core::Private {
+
+    namespace {
+        struct CompareExchange {
+            std::uint8_t low;
+            std::uint8_t high;
+        };
+
+        using Network = std::vector<CompareExchange>;
+
+        // Batcher's odd-even merge sort for the next power of two, less every compare-exchange reaching past n:
+        // those elements would be +infinity, which never move down
+        Network oddEvenMergeSort(tensorSize n) {
+            tensorSize padded = 1;
+            while (padded < n) {
+                padded *= 2;
+            }
+            Network network;
+            for (tensorSize p = 1; p < padded; p *= 2) {
+                for (tensorSize k = p; k >= 1; k /= 2) {
+                    for (tensorSize j = k % p; j + k < padded; j += 2 * k) {
+                        for (tensorSize i = 0; i < k && i + j + k < padded; i++) {
+                            if ((i + j) / (2 * p) == (i + j + k) / (2 * p) && i + j + k < n) {
+                                network.push_back({static_cast<std::uint8_t>(i + j), static_cast<std::uint8_t>(i + j + k)});
+                            }
+                        }
+                    }
+                }
+            }
+            return network;
+        }
+
+        const Network& networkFor(tensorSize n) {
+            static const std::array<Network, sortNetworkMost + 1> networks = [] {
+                std::array<Network, sortNetworkMost + 1> all;
+                for (tensorSize length = 0; length <= sortNetworkMost; length++) {
+                    all[length] = oddEvenMergeSort(length);
+                }
+                return all;
+            }();
+            return networks[n];
+        }
+
+        template <typename T>
+        void sortBlockScalar(T* keys, const Network& network) {
+            for (CompareExchange step : network) {
+                T* low = keys + step.low * sortLanes;
+                T* high = keys + step.high * sortLanes;
+                for (tensorSize lane = 0; lane < sortLanes; lane++) {
+                    const T a = low[lane];
+                    const T b = high[lane];
+                    low[lane] = b < a ? b : a;
+                    high[lane] = b < a ? a : b;
+                }
+            }
+        }
+
+        template <typename T>
+        void sortBlockScalar(T* keys, T* payload, const Network& network) {
+            for (CompareExchange step : network) {
+                const tensorSize low = step.low * sortLanes;
+                const tensorSize high = step.high * sortLanes;
+                for (tensorSize lane = 0; lane < sortLanes; lane++) {
+                    const T a = keys[low + lane], b = keys[high + lane];
+                    const T p = payload[low + lane], q = payload[high + lane];
+                    const bool swap = b < a || (b == a && q < p);
+                    keys[low + lane] = swap ? b : a;
+                    keys[high + lane] = swap ? a : b;
+                    payload[low + lane] = swap ? q : p;
+                    payload[high + lane] = swap ? p : q;
+                }
+            }
+        }
+    }
+
+#ifdef TENSORII_SIMD_KERNELS
+TENSORII_SIMD_WARNINGS_PUSH
+    namespace {
+        //region Vector operations
+        // before(a, b, p, q) is where (b, q) sorts before (a, p), in whatever selects lanes for blend()
+        template <typename T> struct Avx512Ops;
+        template <typename T> struct Avx2Ops;
+
+        template <>
+        struct Avx512Ops<float> {
+            using Vector = __m512;
+            using Lanes = __mmask16;
+            static constexpr tensorSize width = 16;
+            TENSORII_TARGET_AVX512 static Vector load(const float* in) { return _mm512_loadu_ps(in); }
+            TENSORII_TARGET_AVX512 static void store(float* out, Vector value) { _mm512_storeu_ps(out, value); }
+            TENSORII_TARGET_AVX512 static Vector min(Vector a, Vector b) { return _mm512_min_ps(a, b); }
+            TENSORII_TARGET_AVX512 static Vector max(Vector a, Vector b) { return _mm512_max_ps(a, b); }
+            TENSORII_TARGET_AVX512 static Lanes before(Vector a, Vector b, Vector p, Vector q) {
+                const Lanes equal = _mm512_cmp_ps_mask(b, a, _CMP_EQ_OQ);
+                return _mm512_cmp_ps_mask(b, a, _CMP_LT_OQ) | (equal & _mm512_cmp_ps_mask(q, p, _CMP_LT_OQ));
+            }
+            // Lanes where 'lanes' is set from b, others from a
+            TENSORII_TARGET_AVX512 static Vector blend(Lanes lanes, Vector a, Vector b) { return _mm512_mask_blend_ps(lanes, a, b); }
+        };
+
+        template <>
+        struct Avx512Ops<double> {
+            using Vector = __m512d;
+            using Lanes = __mmask8;
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX512 static Vector load(const double* in) { return _mm512_loadu_pd(in); }
+            TENSORII_TARGET_AVX512 static void store(double* out, Vector value) { _mm512_storeu_pd(out, value); }
+            TENSORII_TARGET_AVX512 static Vector min(Vector a, Vector b) { return _mm512_min_pd(a, b); }
+            TENSORII_TARGET_AVX512 static Vector max(Vector a, Vector b) { return _mm512_max_pd(a, b); }
+            TENSORII_TARGET_AVX512 static Lanes before(Vector a, Vector b, Vector p, Vector q) {
+                const Lanes equal = _mm512_cmp_pd_mask(b, a, _CMP_EQ_OQ);
+                return _mm512_cmp_pd_mask(b, a, _CMP_LT_OQ) | (equal & _mm512_cmp_pd_mask(q, p, _CMP_LT_OQ));
+            }
+            TENSORII_TARGET_AVX512 static Vector blend(Lanes lanes, Vector a, Vector b) { return _mm512_mask_blend_pd(lanes, a, b); }
+        };
+
+        template <>
+        struct Avx2Ops<float> {
+            using Vector = __m256;
+            using Lanes = __m256;
+            static constexpr tensorSize width = 8;
+            TENSORII_TARGET_AVX2_FMA static Vector load(const float* in) { return _mm256_loadu_ps(in); }
+            TENSORII_TARGET_AVX2_FMA static void store(float* out, Vector value) { _mm256_storeu_ps(out, value); }
+            TENSORII_TARGET_AVX2_FMA static Vector min(Vector a, Vector b) { return _mm256_min_ps(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Vector max(Vector a, Vector b) { return _mm256_max_ps(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Lanes before(Vector a, Vector b, Vector p, Vector q) {
+                const Lanes equal = _mm256_cmp_ps(b, a, _CMP_EQ_OQ);
+                return _mm256_or_ps(_mm256_cmp_ps(b, a, _CMP_LT_OQ), _mm256_and_ps(equal, _mm256_cmp_ps(q, p, _CMP_LT_OQ)));
+            }
+            TENSORII_TARGET_AVX2_FMA static Vector blend(Lanes lanes, Vector a, Vector b) { return _mm256_blendv_ps(a, b, lanes); }
+        };
+
+        template <>
+        struct Avx2Ops<double> {
+            using Vector = __m256d;
+            using Lanes = __m256d;
+            static constexpr tensorSize width = 4;
+            TENSORII_TARGET_AVX2_FMA static Vector load(const double* in) { return _mm256_loadu_pd(in); }
+            TENSORII_TARGET_AVX2_FMA static void store(double* out, Vector value) { _mm256_storeu_pd(out, value); }
+            TENSORII_TARGET_AVX2_FMA static Vector min(Vector a, Vector b) { return _mm256_min_pd(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Vector max(Vector a, Vector b) { return _mm256_max_pd(a, b); }
+            TENSORII_TARGET_AVX2_FMA static Lanes before(Vector a, Vector b, Vector p, Vector q) {
+                const Lanes equal = _mm256_cmp_pd(b, a, _CMP_EQ_OQ);
+                return _mm256_or_pd(_mm256_cmp_pd(b, a, _CMP_LT_OQ), _mm256_and_pd(equal, _mm256_cmp_pd(q, p, _CMP_LT_OQ)));
+            }
+            TENSORII_TARGET_AVX2_FMA static Vector blend(Lanes lanes, Vector a, Vector b) { return _mm256_blendv_pd(a, b, lanes); }
+        };
+        //endregion
+
+        // Each compare-exchange is sortLanes / width vectors wide
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline void sortBlockVector(T* keys, const Network& network) {
+            for (CompareExchange step : network) {
+                T* low = keys + step.low * sortLanes;
+                T* high = keys + step.high * sortLanes;
+                for (tensorSize v = 0; v < sortLanes; v += Ops::width) {
+                    const typename Ops::Vector a = Ops::load(low + v);
+                    const typename Ops::Vector b = Ops::load(high + v);
+                    Ops::store(low + v, Ops::min(a, b));
+                    Ops::store(high + v, Ops::max(a, b));
+                }
+            }
+        }
+
+        template <typename Ops, typename T>
+        [[gnu::always_inline]] inline void sortBlockVector(T* keys, T* payload, const Network& network) {
+            for (CompareExchange step : network) {
+                const tensorSize low = step.low * sortLanes;
+                const tensorSize high = step.high * sortLanes;
+                for (tensorSize v = 0; v < sortLanes; v += Ops::width) {
+                    const typename Ops::Vector a = Ops::load(keys + low + v), b = Ops::load(keys + high + v);
+                    const typename Ops::Vector p = Ops::load(payload + low + v), q = Ops::load(payload + high + v);
+                    const typename Ops::Lanes swap = Ops::before(a, b, p, q);
+                    Ops::store(keys + low + v, Ops::blend(swap, a, b));
+                    Ops::store(keys + high + v, Ops::blend(swap, b, a));
+                    Ops::store(payload + low + v, Ops::blend(swap, p, q));
+                    Ops::store(payload + high + v, Ops::blend(swap, q, p));
+                }
+            }
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512 void sortBlockAvx512(T* keys, const Network& network) {
+            sortBlockVector<Avx512Ops<T>>(keys, network);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA void sortBlockAvx2(T* keys, const Network& network) {
+            sortBlockVector<Avx2Ops<T>>(keys, network);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX512 void sortBlockAvx512(T* keys, T* payload, const Network& network) {
+            sortBlockVector<Avx512Ops<T>>(keys, payload, network);
+        }
+
+        template <typename T>
+        TENSORII_TARGET_AVX2_FMA void sortBlockAvx2(T* keys, T* payload, const Network& network) {
+            sortBlockVector<Avx2Ops<T>>(keys, payload, network);
+        }
+    }
+TENSORII_SIMD_WARNINGS_POP
+#endif
+
+    namespace {
+        template <typename T>
+        void sortBlockDispatch(T* keys, tensorSize n) {
+            const Network& network = networkFor(n);
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return sortBlockAvx512(keys, network); }
+            if (cpuFeatures().avx2 && cpuFeatures().fma) { return sortBlockAvx2(keys, network); }
+#endif
+            sortBlockScalar(keys, network);
+        }
+
+        template <typename T>
+        void sortBlockDispatch(T* keys, T* payload, tensorSize n) {
+            const Network& network = networkFor(n);
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) { return sortBlockAvx512(keys, payload, network); }
+            if (cpuFeatures().avx2 && cpuFeatures().fma) { return sortBlockAvx2(keys, payload, network); }
+#endif
+            sortBlockScalar(keys, payload, network);
+        }
+    }
+
+    void sortBlock(float* keys, tensorSize n) {
+        sortBlockDispatch(keys, n);
+    }
+
+    void sortBlock(double* keys, tensorSize n) {
+        sortBlockDispatch(keys, n);
+    }
+
+    void sortBlock(float* keys, float* payload, tensorSize n) {
+        sortBlockDispatch(keys, payload, n);
+    }
+
+    void sortBlock(double* keys, double* payload, tensorSize n) {
+        sortBlockDispatch(keys, payload, n);
+    }
+}
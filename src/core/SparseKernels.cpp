@@ -0,0 +1,115 @@
+#include "TensorII/private/SparseKernels.h"
+#include "TensorII/private/CpuFeatures.h"
+#include "TensorII/private/Parallel.h"
+#include "TensorII/private/SimdTargets.h"
+
+#include <algorithm>
+
+namespace TensorII::Core::Private {
+
+    namespace {
+        // The row loops carry no intrinsics: inlined into the target wrappers below, the compiler vectorises
+        // the axpy over each output row for that instruction set. The gathers of a sparse-vector product
+        // don't vectorise profitably, so it keeps four independent sums to hide the add latency instead.
+        template <typename T, typename Column>
+        [[gnu::always_inline]] inline void csrRows(CsrArrays<T, Column> sparse, const T* dense, tensorSize n,
+                                                   T* __restrict out, tensorSize first, tensorSize last) {
+            if (n == 1) {
+                for (tensorSize row = first; row < last; row++) {
+                    const tensorSize end = sparse.rowOffsets[row + 1];
+                    tensorSize i = sparse.rowOffsets[row];
+                    T sums[4] {};
+                    for (; i + 4 <= end; i += 4) {
+                        for (tensorSize lane = 0; lane < 4; lane++) {
+                            sums[lane] += sparse.values[i + lane] * dense[sparse.columns[i + lane]];
+                        }
+                    }
+                    for (; i < end; i++) {
+                        sums[0] += sparse.values[i] * dense[sparse.columns[i]];
+                    }
+                    out[row] = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+                }
+                return;
+            }
+            for (tensorSize row = first; row < last; row++) {
+                T* __restrict target = out + row * n;
+                std::fill_n(target, n, T {});
+                for (tensorSize i = sparse.rowOffsets[row]; i < sparse.rowOffsets[row + 1]; i++) {
+                    const T value = sparse.values[i];
+                    const T* __restrict source = dense + static_cast<tensorSize>(sparse.columns[i]) * n;
+                    for (tensorSize j = 0; j < n; j++) {
+                        target[j] += value * source[j];
+                    }
+                }
+            }
+        }
+
+        template <typename T, typename Column>
+        void csrRowsScalar(CsrArrays<T, Column> sparse, const T* dense, tensorSize n, T* out, tensorSize first, tensorSize last) {
+            csrRows(sparse, dense, n, out, first, last);
+        }
+
+#ifdef TENSORII_SIMD_KERNELS
+        template <typename T, typename Column>
+        TENSORII_TARGET_AVX512 void csrRowsAvx512(CsrArrays<T, Column> sparse, const T* dense, tensorSize n, T* out,
+                                                  tensorSize first, tensorSize last) {
+            csrRows(sparse, dense, n, out, first, last);
+        }
+
+        template <typename T, typename Column>
+        TENSORII_TARGET_AVX2_FMA void csrRowsAvx2(CsrArrays<T, Column> sparse, const T* dense, tensorSize n, T* out,
+                                                  tensorSize first, tensorSize last) {
+            csrRows(sparse, dense, n, out, first, last);
+        }
+#endif
+
+        // First row starting at or after 'work', where row r starts at rowOffsets[r] + r: each row costs its
+        // nonzeros plus one for writing it, so long runs of empty rows still get shared out.
+        template <typename T, typename Column>
+        tensorSize rowAt(CsrArrays<T, Column> sparse, tensorSize work) {
+            tensorSize low = 0, high = sparse.rows;
+            while (low < high) {
+                const tensorSize middle = low + (high - low) / 2;
+                if (sparse.rowOffsets[middle] + middle < work) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            return low;
+        }
+
+        template <typename T, typename Column>
+        void multiply(CsrArrays<T, Column> sparse, const T* dense, tensorSize n, T* out) {
+            auto rows = csrRowsScalar<T, Column>;
+#ifdef TENSORII_SIMD_KERNELS
+            if (cpuFeatures().avx512f) {
+                rows = csrRowsAvx512<T, Column>;
+            } else if (cpuFeatures().avx2 && cpuFeatures().fma) {
+                rows = csrRowsAvx2<T, Column>;
+            }
+#endif
+            const tensorSize work = sparse.rowOffsets[sparse.rows] + sparse.rows;
+            const tensorSize grain = std::max<tensorSize>(1, 32768 / std::max<tensorSize>(n, 1));
+            parallelFor(work, grain, [&](tensorSize begin, tensorSize end) {
+                rows(sparse, dense, n, out, rowAt(sparse, begin), rowAt(sparse, end));
+            });
+        }
+    }
+
+    void multiplyCsr(CsrArrays<float, uint32_t> sparse, const float* dense, tensorSize n, float* out) {
+        multiply(sparse, dense, n, out);
+    }
+
+    void multiplyCsr(CsrArrays<float, uint64_t> sparse, const float* dense, tensorSize n, float* out) {
+        multiply(sparse, dense, n, out);
+    }
+
+    void multiplyCsr(CsrArrays<double, uint32_t> sparse, const double* dense, tensorSize n, double* out) {
+        multiply(sparse, dense, n, out);
+    }
+
+    void multiplyCsr(CsrArrays<double, uint64_t> sparse, const double* dense, tensorSize n, double* out) {
+        multiply(sparse, dense, n, out);
+    }
+}
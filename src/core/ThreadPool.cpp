@@ -0,0 +1,69 @@
+#include "TensorII/ThreadPool.h"
+
+#include <algorithm>
+
+#include "TensorII/private/Parallel.h"
+
+namespace TensorII::Core {
+
+    namespace {
+        // Pool the calling thread is a worker of, if any
+        thread_local const ThreadPool* currentPool = nullptr;
+    }
+
+    namespace Private {
+        tensorSize threadBudget() {
+            static const auto hardware = static_cast<tensorSize>(std::max(1u, std::thread::hardware_concurrency()));
+            if (currentPool == nullptr) {
+                return hardware;
+            }
+            return std::max<tensorSize>(1, hardware / static_cast<tensorSize>(currentPool->size()));
+        }
+    }
+
+    ThreadPool::ThreadPool(std::size_t threads) {
+        threads_.reserve(std::max<std::size_t>(threads, 1));
+        for (std::size_t i = 0; i < std::max<std::size_t>(threads, 1); i++) {
+            threads_.emplace_back([this] { work(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            const std::scoped_lock lock (mutex_);
+            stopping_ = true;
+        }
+        available_.notify_all();
+        threads_.clear();
+    }
+
+    void ThreadPool::submit(std::function<void()> task) {
+        {
+            const std::scoped_lock lock (mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        available_.notify_one();
+    }
+
+    ThreadPool& ThreadPool::shared() {
+        static ThreadPool pool (std::max(1u, std::thread::hardware_concurrency()));
+        return pool;
+    }
+
+    void ThreadPool::work() {
+        currentPool = this;
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock (mutex_);
+                available_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+}
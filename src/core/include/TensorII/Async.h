@@ -0,0 +1,87 @@
+#ifndef TENSOR_ASYNC_H
+#define TENSOR_ASYNC_H
+
+#include <istream>
+#include <ostream>
+
+#include "TensorII/Future.h"
+#include "TensorII/Operations.h"
+#include "TensorII/Sparse.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/ThreadPool.h"
+
+namespace TensorII::Core {
+
+    // Async forms of the heavy operations, on the shared pool unless given one. Tensors are used in place, not
+    // copied, so they must outlive the op, and nothing else may write them until it's done: chain ops on the
+    // same tensors through 'after'.
+
+    template <Scalar DType, auto shape, TensorLayout Layout, typename ... Dependencies>
+    Future<Accumulator<DType>> sumAsync(ThreadPool& pool, const Tensor<DType, shape, Layout>& tensor,
+                                        const Future<Dependencies>& ... after);
+
+    template <Scalar DType, auto shape, TensorLayout Layout, typename ... Dependencies>
+    Future<Accumulator<DType>> dotAsync(ThreadPool& pool, const Tensor<DType, shape, Layout>& lhs,
+                                        const Tensor<DType, shape, Layout>& rhs, const Future<Dependencies>& ... after);
+
+    template <Scalar DType, auto sparseShape, auto denseShape, auto outShape, typename ... Dependencies>
+    requires (Private::sparseContractable<sparseShape, denseShape, outShape>())
+    Future<void> contractAsync(ThreadPool& pool, const CsrTensor<DType, sparseShape>& sparse,
+                               const Tensor<DType, denseShape>& dense, Tensor<DType, outShape>& out,
+                               const Future<Dependencies>& ... after);
+
+    // Copies 'in' to 'out', converting layout if they differ
+    template <Scalar DType, auto shape, TensorLayout From, TensorLayout To, typename ... Dependencies>
+    Future<void> copyAsync(ThreadPool& pool, const Tensor<DType, shape, From>& in, Tensor<DType, shape, To>& out,
+                           const Future<Dependencies>& ... after);
+
+    // The tensor's storage as raw bytes, in the byte order of this machine. Fails with std::ios_base::failure if
+    // the stream does.
+    template <Scalar DType, auto shape, TensorLayout Layout, typename ... Dependencies>
+    Future<void> writeAsync(ThreadPool& pool, std::ostream& stream, const Tensor<DType, shape, Layout>& tensor,
+                            const Future<Dependencies>& ... after);
+
+    template <Scalar DType, auto shape, TensorLayout Layout, typename ... Dependencies>
+    Future<void> readAsync(ThreadPool& pool, std::istream& stream, Tensor<DType, shape, Layout>& tensor,
+                           const Future<Dependencies>& ... after);
+
+    //region On the shared pool
+    template <Scalar DType, auto shape, TensorLayout Layout, typename ... Dependencies>
+    Future<Accumulator<DType>> sumAsync(const Tensor<DType, shape, Layout>& tensor, const Future<Dependencies>& ... after) {
+        return sumAsync(ThreadPool::shared(), tensor, after...);
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout, typename ... Dependencies>
+    Future<Accumulator<DType>> dotAsync(const Tensor<DType, shape, Layout>& lhs, const Tensor<DType, shape, Layout>& rhs,
+                                        const Future<Dependencies>& ... after) {
+        return dotAsync(ThreadPool::shared(), lhs, rhs, after...);
+    }
+
+    template <Scalar DType, auto sparseShape, auto denseShape, auto outShape, typename ... Dependencies>
+    requires (Private::sparseContractable<sparseShape, denseShape, outShape>())
+    Future<void> contractAsync(const CsrTensor<DType, sparseShape>& sparse, const Tensor<DType, denseShape>& dense,
+                               Tensor<DType, outShape>& out, const Future<Dependencies>& ... after) {
+        return contractAsync(ThreadPool::shared(), sparse, dense, out, after...);
+    }
+
+    template <Scalar DType, auto shape, TensorLayout From, TensorLayout To, typename ... Dependencies>
+    Future<void> copyAsync(const Tensor<DType, shape, From>& in, Tensor<DType, shape, To>& out,
+                           const Future<Dependencies>& ... after) {
+        return copyAsync(ThreadPool::shared(), in, out, after...);
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout, typename ... Dependencies>
+    Future<void> writeAsync(std::ostream& stream, const Tensor<DType, shape, Layout>& tensor, const Future<Dependencies>& ... after) {
+        return writeAsync(ThreadPool::shared(), stream, tensor, after...);
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout, typename ... Dependencies>
+    Future<void> readAsync(std::istream& stream, Tensor<DType, shape, Layout>& tensor, const Future<Dependencies>& ... after) {
+        return readAsync(ThreadPool::shared(), stream, tensor, after...);
+    }
+    //endregion
+}
+
+#endif //TENSOR_ASYNC_H
+
+#include "TensorII/private/templates/Async.tpp"
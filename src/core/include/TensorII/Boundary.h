@@ -0,0 +1,52 @@
+#ifndef TENSOR_BOUNDARY_H
+#define TENSOR_BOUNDARY_H
+
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    // What lies beyond the edges of the grid
+    enum class Boundary {
+        Dirichlet, // A fixed value
+        Periodic,  // The opposite edge
+        Neumann    // A mirror image of the grid, so the derivative across the edge is 0
+    };
+
+    namespace Private {
+        // Index along an axis of 'extent' elements which a point at 'i' reads, or -1 beyond a Dirichlet edge.
+        // Assumes nothing reaches further than one extent beyond the edge.
+        template <Boundary boundary>
+        constexpr tensorIndex resolveIndex(tensorIndex i, tensorIndex extent) noexcept {
+            if (i >= 0 && i < extent) {
+                return i;
+            }
+            if constexpr (boundary == Boundary::Periodic) {
+                return i < 0 ? i + extent : i - extent;
+            } else if constexpr (boundary == Boundary::Neumann) {
+                return i < 0 ? -1 - i : 2 * extent - 1 - i;
+            } else {
+                return -1;
+            }
+        }
+
+        // As resolveIndex, for a boundary known only at run time and a point any distance beyond the edge
+        constexpr tensorIndex wrapIndex(Boundary boundary, tensorIndex i, tensorIndex extent) noexcept {
+            if (i >= 0 && i < extent) {
+                return i;
+            }
+            if (boundary == Boundary::Periodic) {
+                const tensorIndex wrapped = i % extent;
+                return wrapped < 0 ? wrapped + extent : wrapped;
+            }
+            if (boundary == Boundary::Neumann) {
+                // Mirrored, the grid repeats every two extents
+                tensorIndex wrapped = i % (2 * extent);
+                wrapped = wrapped < 0 ? wrapped + 2 * extent : wrapped;
+                return wrapped < extent ? wrapped : 2 * extent - 1 - wrapped;
+            }
+            return -1;
+        }
+    }
+}
+
+#endif //TENSOR_BOUNDARY_H
@@ -0,0 +1,97 @@
+#ifndef TENSOR_COMPLEX_H
+#define TENSOR_COMPLEX_H
+
+#include <complex>
+#include <concepts>
+#include <type_traits>
+
+#include "TensorII/Operations.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    // Complex values stored as two planes, every real part and then every imaginary part, rather than
+    // interleaved as a Tensor of std::complex keeps them. Products of split operands need no shuffling, so they
+    // vectorise as fully as real ones; interleaved storage is what FFTs and most other libraries take.
+    template <std::floating_point Real, auto shape_, TensorLayout Layout_ = RowMajor>
+    class SplitComplexTensor {
+    public:
+        using Plane = Tensor<Real, shape_, Layout_>;
+        using Layout = Layout_;
+
+        constexpr SplitComplexTensor();
+
+        static constexpr Shape<shape_.rank()> shape() { return shape_; }
+        static constexpr tensorSize size() noexcept { return shape_.n_elems(); }
+
+        constexpr Plane& real() noexcept { return real_; }
+        constexpr const Plane& real() const noexcept { return real_; }
+        constexpr Plane& imag() noexcept { return imag_; }
+        constexpr const Plane& imag() const noexcept { return imag_; }
+
+        template<std::convertible_to<tensorSize> ... Indices>
+        requires (sizeof...(Indices) == shape_.rank())
+        constexpr std::complex<Real> at(const Indices& ... indices) const noexcept;
+
+        template<std::convertible_to<tensorSize> ... Indices>
+        requires (sizeof...(Indices) == shape_.rank())
+        constexpr void set(std::complex<Real> value, const Indices& ... indices) noexcept;
+
+    private:
+        Plane real_;
+        Plane imag_;
+    };
+
+    enum class ComplexStorage {
+        Interleaved,
+        Split,
+    };
+
+    // A complex tensor in whichever storage suits the work it's for
+    template <std::floating_point Real, auto shape, ComplexStorage storage = ComplexStorage::Interleaved,
+              TensorLayout Layout = RowMajor>
+    using ComplexTensor = std::conditional_t<storage == ComplexStorage::Interleaved,
+                                             Tensor<std::complex<Real>, shape, Layout>,
+                                             SplitComplexTensor<Real, shape, Layout>>;
+
+    // Between the storages
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr void split(const Tensor<std::complex<Real>, shape, Layout>& in, SplitComplexTensor<Real, shape, Layout>& out);
+
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr void interleave(const SplitComplexTensor<Real, shape, Layout>& in, Tensor<std::complex<Real>, shape, Layout>& out);
+
+    // As for interleaved tensors in Operations.h: elementwise, out may alias either input...
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr void add(const SplitComplexTensor<Real, shape, Layout>& lhs, const SplitComplexTensor<Real, shape, Layout>& rhs,
+                       SplitComplexTensor<Real, shape, Layout>& out);
+
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr void subtract(const SplitComplexTensor<Real, shape, Layout>& lhs, const SplitComplexTensor<Real, shape, Layout>& rhs,
+                            SplitComplexTensor<Real, shape, Layout>& out);
+
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr void multiply(const SplitComplexTensor<Real, shape, Layout>& lhs, const SplitComplexTensor<Real, shape, Layout>& rhs,
+                            SplitComplexTensor<Real, shape, Layout>& out);
+
+    // ...and reductions over every element. dot is the sum of products, without conjugating either side.
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr std::complex<Real> sum(const SplitComplexTensor<Real, shape, Layout>& tensor);
+
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr std::complex<Real> dot(const SplitComplexTensor<Real, shape, Layout>& lhs, const SplitComplexTensor<Real, shape, Layout>& rhs);
+
+    // Matrix product, as matmul in Operations.h. With every operand row-major, each plane of a row of out is a
+    // weighted sum of both planes of the rows of rhs, so it runs on the real SIMD kernel with no complex
+    // arithmetic at all. out may not alias either input.
+    template <std::floating_point Real, auto lhsShape, auto rhsShape, auto outShape,
+              TensorLayout LhsLayout, TensorLayout RhsLayout, TensorLayout OutLayout>
+    requires (Private::multipliable<lhsShape, rhsShape, outShape>())
+    constexpr void matmul(const SplitComplexTensor<Real, lhsShape, LhsLayout>& lhs, const SplitComplexTensor<Real, rhsShape, RhsLayout>& rhs,
+                          SplitComplexTensor<Real, outShape, OutLayout>& out);
+}
+
+#endif //TENSOR_COMPLEX_H
+
+#include "TensorII/private/templates/Complex.tpp"
@@ -0,0 +1,45 @@
+#ifndef TENSOR_CONVOLUTION_H
+#define TENSOR_CONVOLUTION_H
+
+#include <concepts>
+
+#include "TensorII/Boundary.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    template <typename T>
+    concept ConvolutionScalar = std::same_as<T, float> || std::same_as<T, double>;
+
+    // 2D convolution over the first two axes of a rows x columns x bands image, every band in the same pass.
+    // The kernel is centred on its element (rows / 2, columns / 2) and the boundary decides what lies beyond
+    // the image: boundaryValue for Dirichlet, the image reflected for Neumann or wrapped round for Periodic.
+    // 'out' must not alias 'in'. Rows, or tiles for the FFT, are shared out between hardware threads.
+
+    // Every tap of every element, vectorised along the rows. Best for kernels up to around 15 x 15, beyond which
+    // convolveFFT is faster unless the kernel is separable.
+    template <Boundary boundary = Boundary::Dirichlet, ConvolutionScalar DType, auto shape, auto kernelShape>
+    requires (shape.rank() == 3 && kernelShape.rank() == 2)
+    void convolve(const Tensor<DType, shape>& in, const Tensor<DType, kernelShape>& kernel, Tensor<DType, shape>& out,
+                  DType boundaryValue = DType {});
+
+    // Kernel the outer product of columnKernel, applied down the columns, and rowKernel, applied along the rows,
+    // such as a Gaussian or Sobel: rows + columns taps per element rather than rows * columns
+    template <Boundary boundary = Boundary::Dirichlet, ConvolutionScalar DType, auto shape, auto columnShape, auto rowShape>
+    requires (shape.rank() == 3 && columnShape.rank() == 1 && rowShape.rank() == 1)
+    void convolveSeparable(const Tensor<DType, shape>& in, const Tensor<DType, columnShape>& columnKernel,
+                           const Tensor<DType, rowShape>& rowKernel, Tensor<DType, shape>& out,
+                           DType boundaryValue = DType {});
+
+    // Through the frequency domain, over tiles a few kernels across, so the cost per element grows with the log
+    // of the kernel size rather than its area. Computed in double precision.
+    template <Boundary boundary = Boundary::Dirichlet, ConvolutionScalar DType, auto shape, auto kernelShape>
+    requires (shape.rank() == 3 && kernelShape.rank() == 2)
+    void convolveFFT(const Tensor<DType, shape>& in, const Tensor<DType, kernelShape>& kernel, Tensor<DType, shape>& out,
+                     DType boundaryValue = DType {});
+}
+
+#endif //TENSOR_CONVOLUTION_H
+
+#include "TensorII/private/templates/Convolution.tpp"
@@ -0,0 +1,104 @@
+#ifndef TENSOR_EINSTEIN_H
+#define TENSOR_EINSTEIN_H
+
+#include <tuple>
+#include <type_traits>
+
+#include "TensorII/Operations.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/private/Indexed.h"
+
+namespace TensorII::Core {
+
+    // Index notation with Einstein summation. An index appearing twice in a product is summed over; those
+    // appearing once must be the indices of the tensor assigned to, e.g.
+    //
+    //     using namespace Indices;
+    //     c(i) = epsilon(i, j, k) * a(j) * b(k);    // cross product
+    //     B(i, k) = delta(i, j) * A(j, k);           // copy
+    //     double trace = scalar(A(i, i));
+    //
+    // The summation is resolved at compile time into the nonzero terms of every element: delta and epsilon
+    // factors never multiply anything, they only decide which terms exist and with what sign. Up to
+    // unrolledIndexTerms terms are unrolled into straight-line code, e.g. anything of rank 4 or less in three
+    // dimensions. Operands may be in any layout, and the tensor assigned to may also appear on the right.
+    // Expressions ranging over more than maxIndexValues combinations of indices, e.g. a product of 32x32
+    // matrices, are rejected; those are for matmul in Operations.h.
+
+    namespace Indices {
+        inline constexpr Index<'i'> i;
+        inline constexpr Index<'j'> j;
+        inline constexpr Index<'k'> k;
+        inline constexpr Index<'l'> l;
+        inline constexpr Index<'m'> m;
+        inline constexpr Index<'n'> n;
+        inline constexpr Index<'p'> p;
+        inline constexpr Index<'q'> q;
+        inline constexpr Index<'r'> r;
+        inline constexpr Index<'s'> s;
+    }
+
+    namespace Private {
+        template <char ... names>
+        struct Delta {};
+
+        template <char ... names>
+        struct Epsilon {};
+
+        template <typename ... Factors>
+        struct Product {
+            std::tuple<Factors...> factors;
+        };
+
+        template <typename T>
+        struct IsIndexFactor : std::false_type {};
+
+        template <typename TensorType, char ... names>
+        struct IsIndexFactor<Indexed<TensorType, names...>> : std::true_type {};
+
+        template <char ... names>
+        struct IsIndexFactor<Delta<names...>> : std::true_type {};
+
+        template <char ... names>
+        struct IsIndexFactor<Epsilon<names...>> : std::true_type {};
+
+        template <typename T>
+        struct IsIndexProduct : std::false_type {};
+
+        template <typename ... Factors>
+        struct IsIndexProduct<Product<Factors...>> : std::true_type {};
+
+        template <typename T>
+        concept IndexExpression = IsIndexFactor<T>::value || IsIndexProduct<T>::value;
+
+        template <IndexExpression Lhs, IndexExpression Rhs>
+        constexpr auto operator*(const Lhs& lhs, const Rhs& rhs);
+
+        // Most terms unrolled into straight-line code; beyond it they're looped over
+        inline constexpr std::size_t unrolledIndexTerms = 729;
+
+        // Most combinations of index values an expression may range over. Its terms are found among them at
+        // compile time and the result is built on the stack, so index notation is for small shapes only.
+        inline constexpr std::size_t maxIndexValues = 4096;
+    }
+
+    // Kronecker delta, 1 where a and b are equal and 0 elsewhere. Its dimension is that of whatever else a
+    // and b index.
+    template <char a, char b>
+    constexpr Private::Delta<a, b> delta(Index<a>, Index<b>) noexcept { return {}; }
+
+    // Levi-Civita symbol of as many dimensions as it has indices: the sign of the permutation they form, or 0
+    // if any are equal
+    template <char ... names>
+    requires (sizeof...(names) >= 2)
+    constexpr Private::Epsilon<names...> epsilon(Index<names> ...) noexcept { return {}; }
+
+    // The value of an expression with no free indices, e.g. scalar(a(i) * b(i)), in the type the first tensor
+    // in it accumulates in
+    template <Private::IndexExpression Expression>
+    constexpr auto scalar(const Expression& expression);
+}
+
+#endif //TENSOR_EINSTEIN_H
+
+#include "TensorII/private/templates/Einstein.tpp"
@@ -0,0 +1,63 @@
+#ifndef TENSOR_FFT_H
+#define TENSOR_FFT_H
+
+#include <complex>
+#include <concepts>
+
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    template <typename T>
+    concept RealFFTScalar = std::same_as<T, float> || std::same_as<T, double>;
+
+    template <typename T>
+    concept ComplexFFTScalar = std::same_as<T, std::complex<float>> || std::same_as<T, std::complex<double>>;
+
+    namespace Private {
+        template <auto shape, tensorRank axis>
+        constexpr auto halfSpectrumOf() noexcept;
+    }
+
+    // Shape of a real transform's output: 'axis' holds only the n / 2 + 1 non-negative frequencies, the rest
+    // being their conjugates
+    template <auto shape, tensorRank axis>
+    inline constexpr auto halfSpectrum = Private::halfSpectrumOf<shape, axis>();
+
+    // Discrete Fourier transforms along one axis of a tensor, of every sequence along it at once. The length
+    // along the axis may be any with no prime factors but 2, 3 and 5; each length's plan is made on first use
+    // and kept. Sequences are interleaved into vectors a chunk at a time and the chunks shared out between
+    // hardware threads. Computed in double precision. Inverses are scaled by 1 / n, so ifft(fft(x)) == x.
+
+    template <tensorRank axis, ComplexFFTScalar DType, auto shape>
+    requires (axis < shape.rank())
+    void fft(Tensor<DType, shape>& data);
+
+    template <tensorRank axis, ComplexFFTScalar DType, auto shape>
+    requires (axis < shape.rank())
+    void fft(const Tensor<DType, shape>& in, Tensor<DType, shape>& out);
+
+    template <tensorRank axis, ComplexFFTScalar DType, auto shape>
+    requires (axis < shape.rank())
+    void ifft(Tensor<DType, shape>& data);
+
+    template <tensorRank axis, ComplexFFTScalar DType, auto shape>
+    requires (axis < shape.rank())
+    void ifft(const Tensor<DType, shape>& in, Tensor<DType, shape>& out);
+
+    // Real input, two sequences packed into each complex transform, so about half the work of fft
+    template <tensorRank axis, RealFFTScalar DType, auto shape>
+    requires (axis < shape.rank())
+    void rfft(const Tensor<DType, shape>& in, Tensor<std::complex<DType>, halfSpectrum<shape, axis>>& out);
+
+    // Back to the real sequences of length shape[axis]. The imaginary parts of the zero and, for even
+    // lengths, the n / 2 frequencies are ignored.
+    template <tensorRank axis, RealFFTScalar DType, auto shape>
+    requires (axis < shape.rank())
+    void irfft(const Tensor<std::complex<DType>, halfSpectrum<shape, axis>>& in, Tensor<DType, shape>& out);
+}
+
+#endif //TENSOR_FFT_H
+
+#include "TensorII/private/templates/FFT.tpp"
@@ -0,0 +1,115 @@
+#ifndef TENSOR_FUTURE_H
+#define TENSOR_FUTURE_H
+
+#include <concepts>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "TensorII/ThreadPool.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        template <typename T>
+        using AsyncValue = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+        // Result of one async op, shared by its futures and whatever waits on it
+        template <typename T>
+        class AsyncState {
+        public:
+            // Either completes the state, once; throws std::logic_error if it's already complete
+            void setValue(AsyncValue<T> value);
+            void setException(std::exception_ptr error);
+
+            // Runs 'continuation' once complete: on the completing thread, or straight away if already complete
+            void onReady(std::function<void()> continuation);
+
+            [[nodiscard]] bool ready() const;
+            void wait() const;
+            // Only once complete
+            [[nodiscard]] std::exception_ptr exception() const noexcept { return error_; }
+            const AsyncValue<T>& value() const noexcept { return *value_; }
+
+        private:
+            template <typename Store>
+            void complete(Store store);
+
+            mutable std::mutex mutex_;
+            mutable std::condition_variable completed_;
+            bool ready_ = false;
+            std::optional<AsyncValue<T>> value_;
+            std::exception_ptr error_;
+            std::vector<std::function<void()>> continuations_;
+        };
+    }
+
+    // Result of an async op. Copies share it, so any number of later ops can depend on one op; get() hands each
+    // the same value, or rethrows what the op threw.
+    template <typename T>
+    class Future {
+    public:
+        Future() = default;
+        explicit Future(std::shared_ptr<Private::AsyncState<T>> state) : state_(std::move(state)) {}
+
+        [[nodiscard]] bool valid() const noexcept { return state_ != nullptr; }
+        [[nodiscard]] bool ready() const { return state_->ready(); }
+        void wait() const { state_->wait(); }
+        decltype(auto) get() const;
+
+        // function(value), or function() for Future<void>, once this is ready; skipped if this failed, passing
+        // the failure on
+        template <typename Function>
+        auto then(ThreadPool& pool, Function function) const;
+
+        template <typename Function>
+        auto then(Function function) const { return then(ThreadPool::shared(), std::move(function)); }
+
+        const std::shared_ptr<Private::AsyncState<T>>& state() const noexcept { return state_; }
+
+    private:
+        std::shared_ptr<Private::AsyncState<T>> state_;
+    };
+
+    // Completes a Future from outside the pool, e.g. when a network read lands. Destroying a promise that was
+    // never completed fails its futures with std::future_errc::broken_promise.
+    template <typename T>
+    class Promise {
+    public:
+        Promise() : state_(std::make_shared<Private::AsyncState<T>>()) {}
+        ~Promise();
+        Promise(Promise&&) noexcept = default;
+        Promise& operator=(Promise&&) noexcept = default;
+
+        Future<T> future() const { return Future<T>(state_); }
+
+        void set(Private::AsyncValue<T> value) requires (!std::is_void_v<T>) { state_->setValue(std::move(value)); }
+        void set() requires std::is_void_v<T> { state_->setValue({}); }
+        void fail(std::exception_ptr error) { state_->setException(std::move(error)); }
+
+    private:
+        std::shared_ptr<Private::AsyncState<T>> state_;
+    };
+
+    // Runs function() on 'pool' once every future in 'after' is ready, without anyone waiting for them: the last
+    // to complete submits it. If any of them failed it isn't run, and the result fails the same way.
+    template <typename Function, typename ... Dependencies>
+    requires std::invocable<Function&> && std::copy_constructible<Function>
+    Future<std::invoke_result_t<Function&>> async(ThreadPool& pool, Function function, const Future<Dependencies>& ... after);
+
+    template <typename Function, typename ... Dependencies>
+    requires std::invocable<Function&> && std::copy_constructible<Function>
+    Future<std::invoke_result_t<Function&>> async(Function function, const Future<Dependencies>& ... after) {
+        return async(ThreadPool::shared(), std::move(function), after...);
+    }
+}
+
+#endif //TENSOR_FUTURE_H
+
+#include "TensorII/private/templates/Future.tpp"
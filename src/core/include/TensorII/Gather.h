@@ -0,0 +1,52 @@
+#ifndef TENSOR_GATHER_H
+#define TENSOR_GATHER_H
+
+#include <concepts>
+#include <cstdint>
+
+#include "TensorII/ScatterColouring.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    // Indirect reads and writes through an index tensor, e.g. the nodes of each element of a mesh or the cell of
+    // each particle. Indices are storage offsets into the field, which may be in any layout, and must be within
+    // it. The index tensor and the values read or written share one shape and layout.
+
+    // out[i] = field[indices[i]]. float and double with 32 or 64-bit indices load a vector at a time with the
+    // AVX2 or AVX-512 gather instructions.
+    template <Scalar DType, auto fieldShape, TensorLayout FieldLayout, std::integral Index, auto indexShape, TensorLayout Layout>
+    constexpr void gather(const Tensor<DType, fieldShape, FieldLayout>& field, const Tensor<Index, indexShape, Layout>& indices,
+                          Tensor<DType, indexShape, Layout>& out);
+
+    // How scatterAdd keeps threads from adding to the same element at once
+    enum class ScatterStrategy {
+        Automatic,  // Privatised when the field is small beside the values, otherwise atomic
+        Serial,     // One thread
+        Privatised, // Each thread adds into a zeroed copy of the field, and the copies are then summed into it
+        Atomic      // Each thread adds its share straight into the field with atomic adds
+    };
+
+    // field[indices[i]] += values[i], every value added whichever indices repeat. Sums of floats may round
+    // differently between strategies and runs, as they're added in a different order.
+    template <Scalar DType, auto fieldShape, TensorLayout FieldLayout, std::integral Index, auto indexShape, TensorLayout Layout>
+    constexpr void scatterAdd(Tensor<DType, fieldShape, FieldLayout>& field, const Tensor<Index, indexShape, Layout>& indices,
+                              const Tensor<DType, indexShape, Layout>& values, ScatterStrategy strategy = ScatterStrategy::Automatic);
+
+    // Colours the rows of row-major indices along their last axis for scatterAdd, e.g. the elements of a mesh
+    template <Scalar DType, auto fieldShape, TensorLayout FieldLayout, std::integral Index, auto indexShape>
+    requires ((std::same_as<Index, std::int32_t> || std::same_as<Index, std::int64_t>) && indexShape.rank() > 0)
+    ScatterColouring colourScatter(const Tensor<DType, fieldShape, FieldLayout>& field, const Tensor<Index, indexShape>& indices);
+
+    // With rows coloured by colourScatter from the same indices: one colour at a time, its rows split between
+    // threads with plain adds, then any uncoloured rows on the calling thread. No atomics and no copies.
+    template <Scalar DType, auto fieldShape, TensorLayout FieldLayout, std::integral Index, auto indexShape>
+    requires (indexShape.rank() > 0)
+    void scatterAdd(Tensor<DType, fieldShape, FieldLayout>& field, const Tensor<Index, indexShape>& indices,
+                    const Tensor<DType, indexShape>& values, const ScatterColouring& colouring);
+}
+
+#endif //TENSOR_GATHER_H
+
+#include "TensorII/private/templates/Gather.tpp"
@@ -0,0 +1,216 @@
+#ifndef TENSOR_GRAPH_H
+#define TENSOR_GRAPH_H
+
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include "TensorII/GraphPlan.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    template <typename DType>
+    concept GraphScalar = Scalar<DType> && std::totally_ordered<DType>;
+
+    template <GraphScalar DType, auto shape> class Graph;
+
+    // Handle to a node of a Graph with a value per element
+    template <GraphScalar DType, auto shape>
+    class Lazy {
+    public:
+        Graph<DType, shape>& graph() const noexcept { return *graph_; }
+        [[nodiscard]] std::size_t node() const noexcept { return node_; }
+
+    private:
+        friend class Graph<DType, shape>;
+        Lazy(Graph<DType, shape>& graph, std::size_t node) : graph_(&graph), node_(node) {}
+
+        Graph<DType, shape>* graph_;
+        std::size_t node_;
+    };
+
+    // Handle to a node of a Graph with a single value: a constant, a reduction, or arithmetic on those
+    template <GraphScalar DType, auto shape>
+    class LazyScalar {
+    public:
+        Graph<DType, shape>& graph() const noexcept { return *graph_; }
+        [[nodiscard]] std::size_t node() const noexcept { return node_; }
+
+    private:
+        friend class Graph<DType, shape>;
+        LazyScalar(Graph<DType, shape>& graph, std::size_t node) : graph_(&graph), node_(node) {}
+
+        Graph<DType, shape>* graph_;
+        std::size_t node_;
+    };
+
+    // Opt-in deferred evaluation over tensors of one shape. Arithmetic on Lazy handles records nodes instead of
+    // computing anything; outputs are named with output(), and run() schedules everything needed for them
+    // into as few passes over the elements as the reductions allow (see GraphPlan), fusing each pass's
+    // elementwise chain into its reductions and stores and dropping nodes no output needs.
+    //
+    //     constexpr Shape<3> cube {16, 256, 256};
+    //     constexpr auto n = static_cast<float>(cube.n_elems());
+    //     auto data = std::make_unique<Tensor<float, cube>>();
+    //     auto anomalies = std::make_unique<Tensor<float, cube>>();
+    //
+    //     Graph<float, cube> graph;
+    //     auto x = graph.input(*data);
+    //     auto centred = x - sum(x) / graph.constant(n);
+    //     graph.output(centred, *anomalies);
+    //     auto spread = graph.output(sum(centred * centred));
+    //     graph.run();    // two passes: sum(x), then centred stored and squared into the second sum
+    //     float variance = graph.value(spread) / n;
+    //
+    // Input tensors are read, and outputs written, only by run(), so they must live until then. Handles refer to
+    // the graph, which therefore can't be copied or moved.
+    template <GraphScalar DType, auto shape>
+    class Graph {
+    public:
+        Graph() = default;
+        Graph(const Graph&) = delete;
+        Graph& operator=(const Graph&) = delete;
+
+        Lazy<DType, shape> input(const Tensor<DType, shape>& tensor);
+        LazyScalar<DType, shape> constant(DType value);
+
+        // Writes the node's elements to 'out' when the graph is run
+        void output(const Lazy<DType, shape>& value, Tensor<DType, shape>& out);
+        // Keeps the node's value for value() once the graph is run
+        LazyScalar<DType, shape> output(const LazyScalar<DType, shape>& value);
+
+        // Scheduled on first use and kept until more is recorded
+        const GraphPlan& plan();
+        void writePlan(std::ostream& out);
+
+        // Evaluates every output. Safe to repeat, rereading the inputs.
+        void run();
+        // Throws std::logic_error unless 'scalar' is an output and the graph has run since it was made one
+        DType value(const LazyScalar<DType, shape>& scalar) const;
+
+        [[nodiscard]] const std::vector<GraphNode>& nodes() const noexcept { return nodes_; }
+
+        // Records a node; used by the operators on handles
+        std::size_t record(GraphOp op, std::size_t lhs, std::size_t rhs, bool scalar);
+        Lazy<DType, shape> lazy(std::size_t node) { return {*this, node}; }
+        LazyScalar<DType, shape> lazyScalar(std::size_t node) { return {*this, node}; }
+
+    private:
+        void runPass(const GraphPlan::Pass& pass);
+        void computeScalars(const std::vector<std::size_t>& scalars);
+
+        std::vector<GraphNode> nodes_;
+        // Indexed by node, only set for inputs and constants
+        std::vector<const DType*> inputs_;
+        std::vector<DType> values_;
+        std::vector<std::pair<std::size_t, DType*>> stores_;
+        std::vector<std::size_t> scalarOutputs_;
+        std::optional<GraphPlan> plan_;
+        bool hasRun_ = false;
+    };
+
+    namespace Private {
+        template <typename T>
+        struct LazyTraits {
+            static constexpr bool isLazy = false;
+        };
+
+        template <GraphScalar DType, auto shape>
+        struct LazyTraits<Lazy<DType, shape>> {
+            static constexpr bool isLazy = true;
+            static constexpr bool scalar = false;
+            using Type = DType;
+            using GraphType = Graph<DType, shape>;
+        };
+
+        template <GraphScalar DType, auto shape>
+        struct LazyTraits<LazyScalar<DType, shape>> {
+            static constexpr bool isLazy = true;
+            static constexpr bool scalar = true;
+            using Type = DType;
+            using GraphType = Graph<DType, shape>;
+        };
+
+        // One side a handle, the other a handle of the same graph type or a plain value
+        template <typename Lhs, typename Rhs>
+        concept LazyOperands = (LazyTraits<Lhs>::isLazy && LazyTraits<Rhs>::isLazy
+                                && std::same_as<typename LazyTraits<Lhs>::GraphType, typename LazyTraits<Rhs>::GraphType>)
+                            || (LazyTraits<Lhs>::isLazy && !LazyTraits<Rhs>::isLazy && std::convertible_to<Rhs, typename LazyTraits<Lhs>::Type>)
+                            || (!LazyTraits<Lhs>::isLazy && LazyTraits<Rhs>::isLazy && std::convertible_to<Lhs, typename LazyTraits<Rhs>::Type>);
+
+        template <typename Lhs, typename Rhs>
+        requires LazyOperands<Lhs, Rhs>
+        auto lazyBinary(GraphOp op, const Lhs& lhs, const Rhs& rhs);
+
+        template <typename Operand>
+        requires (LazyTraits<Operand>::isLazy)
+        auto lazyUnary(GraphOp op, const Operand& operand);
+    }
+
+    // Elementwise where either side has a value per element, otherwise scalar. Plain values become constants.
+
+    template <typename Lhs, typename Rhs>
+    requires Private::LazyOperands<Lhs, Rhs>
+    auto operator+(const Lhs& lhs, const Rhs& rhs) { return Private::lazyBinary(GraphOp::Add, lhs, rhs); }
+
+    template <typename Lhs, typename Rhs>
+    requires Private::LazyOperands<Lhs, Rhs>
+    auto operator-(const Lhs& lhs, const Rhs& rhs) { return Private::lazyBinary(GraphOp::Subtract, lhs, rhs); }
+
+    template <typename Lhs, typename Rhs>
+    requires Private::LazyOperands<Lhs, Rhs>
+    auto operator*(const Lhs& lhs, const Rhs& rhs) { return Private::lazyBinary(GraphOp::Multiply, lhs, rhs); }
+
+    template <typename Lhs, typename Rhs>
+    requires Private::LazyOperands<Lhs, Rhs>
+    auto operator/(const Lhs& lhs, const Rhs& rhs) { return Private::lazyBinary(GraphOp::Divide, lhs, rhs); }
+
+    template <typename Lhs, typename Rhs>
+    requires Private::LazyOperands<Lhs, Rhs>
+    auto minimum(const Lhs& lhs, const Rhs& rhs) { return Private::lazyBinary(GraphOp::Minimum, lhs, rhs); }
+
+    template <typename Lhs, typename Rhs>
+    requires Private::LazyOperands<Lhs, Rhs>
+    auto maximum(const Lhs& lhs, const Rhs& rhs) { return Private::lazyBinary(GraphOp::Maximum, lhs, rhs); }
+
+    // Masks: 1 where the comparison holds, 0 elsewhere, to multiply by
+    template <typename Lhs, typename Rhs>
+    requires Private::LazyOperands<Lhs, Rhs>
+    auto greater(const Lhs& lhs, const Rhs& rhs) { return Private::lazyBinary(GraphOp::Greater, lhs, rhs); }
+
+    template <typename Lhs, typename Rhs>
+    requires Private::LazyOperands<Lhs, Rhs>
+    auto less(const Lhs& lhs, const Rhs& rhs) { return Private::lazyBinary(GraphOp::Less, lhs, rhs); }
+
+    template <typename Operand>
+    requires (Private::LazyTraits<Operand>::isLazy)
+    auto operator-(const Operand& operand) { return Private::lazyUnary(GraphOp::Negate, operand); }
+
+    template <typename Operand>
+    requires (Private::LazyTraits<Operand>::isLazy)
+    auto abs(const Operand& operand) { return Private::lazyUnary(GraphOp::Abs, operand); }
+
+    template <typename Operand>
+    requires (Private::LazyTraits<Operand>::isLazy)
+    auto sqrt(const Operand& operand) { return Private::lazyUnary(GraphOp::Sqrt, operand); }
+
+    // Reductions over every element, summed in the Accumulator type
+
+    template <GraphScalar DType, auto shape>
+    LazyScalar<DType, shape> sum(const Lazy<DType, shape>& operand);
+
+    template <GraphScalar DType, auto shape>
+    LazyScalar<DType, shape> min(const Lazy<DType, shape>& operand);
+
+    template <GraphScalar DType, auto shape>
+    LazyScalar<DType, shape> max(const Lazy<DType, shape>& operand);
+}
+
+#endif //TENSOR_GRAPH_H
+
+#include "TensorII/private/templates/Graph.tpp"
@@ -0,0 +1,67 @@
+#ifndef TENSOR_GRAPHPLAN_H
+#define TENSOR_GRAPHPLAN_H
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <vector>
+
+namespace TensorII::Core {
+
+    enum class GraphOp {
+        Input, Constant,
+        Negate, Abs, Sqrt,
+        Add, Subtract, Multiply, Divide, Minimum, Maximum, Greater, Less,
+        Sum, Min, Max
+    };
+
+    const char* toString(GraphOp op);
+
+    constexpr bool isReduction(GraphOp op) noexcept {
+        return op == GraphOp::Sum || op == GraphOp::Min || op == GraphOp::Max;
+    }
+
+    inline constexpr std::size_t noInput = std::numeric_limits<std::size_t>::max();
+
+    // One recorded operation. Nodes only ever refer to nodes recorded before them. Scalar nodes are constants,
+    // reductions, and operations on scalars alone; the rest have a value per element of the graph's shape.
+    struct GraphNode {
+        GraphOp op;
+        std::array<std::size_t, 2> inputs;
+        bool scalar;
+    };
+
+    // How a graph runs: a pass over the elements per level of reductions feeding one another. Each pass works
+    // through the elements a block at a time, evaluating every elementwise node it needs into a block-sized
+    // buffer, so none of them is ever written out whole unless it's stored, and folding the blocks into its
+    // reductions. A node needed in more than one pass is recomputed rather than kept.
+    struct GraphPlan {
+        struct Pass {
+            // Computed before the pass from constants and earlier reductions, in order. Constants are always known.
+            std::vector<std::size_t> scalars;
+            // Evaluated for each block, in order
+            std::vector<std::size_t> elementwise;
+            std::vector<std::size_t> stores;
+            std::vector<std::size_t> reductions;
+        };
+
+        std::vector<Pass> passes;
+        // Scalars computed after the last pass, from its reductions
+        std::vector<std::size_t> finalScalars;
+        // Elementwise nodes evaluated in more than one pass
+        std::vector<std::size_t> recomputed;
+        // Recorded but needed by no output
+        std::vector<std::size_t> eliminated;
+    };
+
+    // 'stores' are elementwise nodes written out to tensors, 'scalarOutputs' the scalar nodes whose values are
+    // wanted. Everything else is kept only as far as they need it.
+    GraphPlan schedule(const std::vector<GraphNode>& nodes, const std::vector<std::size_t>& stores,
+                       const std::vector<std::size_t>& scalarOutputs);
+
+    // A line per pass listing the nodes it fuses and what they feed, then anything recomputed or eliminated
+    void writePlan(std::ostream& out, const GraphPlan& plan, const std::vector<GraphNode>& nodes);
+}
+
+#endif //TENSOR_GRAPHPLAN_H
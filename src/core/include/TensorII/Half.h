@@ -0,0 +1,212 @@
+#ifndef TENSOR_HALF_H
+#define TENSOR_HALF_H
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace TensorII::Core {
+
+    namespace Private {
+        // IEEE 754 binary16, round to nearest even
+        constexpr uint16_t floatToHalfBits(float value) {
+            const uint32_t bits = std::bit_cast<uint32_t>(value);
+            const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+            const uint32_t magnitude = bits & 0x7FFFFFFF;
+
+            if (magnitude >= 0x7F800000) {
+                // Inf, or NaN kept quiet with as much of its payload as fits
+                const uint32_t payload = magnitude > 0x7F800000 ? 0x0200 | ((magnitude >> 13) & 0x03FF) : 0;
+                return static_cast<uint16_t>(sign | 0x7C00 | payload);
+            }
+            if (magnitude >= 0x477FF000) {
+                // 65520 and above round to Inf
+                return static_cast<uint16_t>(sign | 0x7C00);
+            }
+            if (magnitude >= 0x38800000) {
+                // Normal: rebias the exponent, then round off the 13 extra mantissa bits
+                const uint32_t rounded = magnitude + 0x0FFF + ((magnitude >> 13) & 1);
+                return static_cast<uint16_t>(sign | ((rounded - 0x38000000) >> 13));
+            }
+            if (magnitude < 0x33000000) {
+                // Below half the smallest subnormal
+                return sign;
+            }
+            // Subnormal, m * 2^-24
+            const uint32_t exponent = magnitude >> 23;
+            const uint32_t mantissa = (magnitude & 0x007FFFFF) | 0x00800000;
+            const uint32_t shift = 126 - exponent;
+            uint32_t half = mantissa >> shift;
+            const uint32_t remainder = mantissa & ((1U << shift) - 1);
+            const uint32_t halfway = 1U << (shift - 1);
+            if (remainder > halfway || (remainder == halfway && (half & 1))) {
+                half++;
+            }
+            return static_cast<uint16_t>(sign | half);
+        }
+
+        constexpr float halfBitsToFloat(uint16_t half) {
+            const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+            const uint32_t exponent = (half >> 10) & 0x1F;
+            uint32_t mantissa = half & 0x03FF;
+
+            if (exponent == 0x1F) {
+                return std::bit_cast<float>(sign | 0x7F800000 | (mantissa << 13));
+            }
+            if (exponent != 0) {
+                return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+            }
+            if (mantissa == 0) {
+                return std::bit_cast<float>(sign);
+            }
+            // Subnormal, normalised for fp32
+            uint32_t floatExponent = 113;
+            while ((mantissa & 0x0400) == 0) {
+                mantissa <<= 1;
+                floatExponent--;
+            }
+            return std::bit_cast<float>(sign | (floatExponent << 23) | ((mantissa & 0x03FF) << 13));
+        }
+
+        // The top half of an fp32, round to nearest even
+        constexpr uint16_t floatToBFloatBits(float value) {
+            const uint32_t bits = std::bit_cast<uint32_t>(value);
+            if ((bits & 0x7FFFFFFF) > 0x7F800000) {
+                return static_cast<uint16_t>((bits >> 16) | 0x0040);
+            }
+            return static_cast<uint16_t>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+        }
+
+        constexpr float bfloatBitsToFloat(uint16_t bfloat) {
+            return std::bit_cast<float>(static_cast<uint32_t>(bfloat) << 16);
+        }
+
+        struct Binary16 {
+            static constexpr uint16_t toBits(float value) { return floatToHalfBits(value); }
+            static constexpr float fromBits(uint16_t bits) { return halfBitsToFloat(bits); }
+        };
+
+        struct BFloat16 {
+            static constexpr uint16_t toBits(float value) { return floatToBFloatBits(value); }
+            static constexpr float fromBits(uint16_t bits) { return bfloatBitsToFloat(bits); }
+        };
+
+        // Arithmetic on 16-bit floats promotes to float, as it does for the built in types narrower than int.
+        // Only the compound operators narrow back.
+        template <typename Format>
+        class PackedFloat {
+        public:
+            constexpr PackedFloat() = default;
+            constexpr PackedFloat(float value) : bits_(Format::toBits(value)) {} // NOLINT(google-explicit-constructor)
+            template <typename OtherFormat>
+            explicit constexpr PackedFloat(PackedFloat<OtherFormat> other) : PackedFloat(static_cast<float>(other)) {}
+
+            constexpr operator float() const { return Format::fromBits(bits_); } // NOLINT(google-explicit-constructor)
+
+            static constexpr PackedFloat fromBits(uint16_t bits) {
+                PackedFloat value;
+                value.bits_ = bits;
+                return value;
+            }
+            [[nodiscard]]
+            constexpr uint16_t bits() const { return bits_; }
+
+            constexpr PackedFloat& operator+=(float other) { return *this = static_cast<float>(*this) + other; }
+            constexpr PackedFloat& operator-=(float other) { return *this = static_cast<float>(*this) - other; }
+            constexpr PackedFloat& operator*=(float other) { return *this = static_cast<float>(*this) * other; }
+            constexpr PackedFloat& operator/=(float other) { return *this = static_cast<float>(*this) / other; }
+            constexpr PackedFloat& operator++() { return *this += 1.0f; }
+            constexpr PackedFloat& operator--() { return *this -= 1.0f; }
+            constexpr PackedFloat operator++(int) { PackedFloat old = *this; ++*this; return old; }
+            constexpr PackedFloat operator--(int) { PackedFloat old = *this; --*this; return old; }
+            constexpr PackedFloat operator-() const { return fromBits(static_cast<uint16_t>(bits_ ^ 0x8000)); }
+
+        private:
+            uint16_t bits_ {};
+        };
+
+        template <typename T>
+        struct IsReducedFloat : std::false_type {};
+
+        template <typename Format>
+        struct IsReducedFloat<PackedFloat<Format>> : std::true_type {};
+    }
+
+    // 16-bit floats, stored packed and computed on in fp32
+    using float16 = Private::PackedFloat<Private::Binary16>;
+    using bfloat16 = Private::PackedFloat<Private::BFloat16>;
+
+    template <typename T>
+    concept ReducedFloat = Private::IsReducedFloat<T>::value;
+
+    static_assert(sizeof(float16) == 2 && std::is_trivially_copyable_v<float16>);
+    static_assert(sizeof(bfloat16) == 2 && std::is_trivially_copyable_v<bfloat16>);
+}
+
+template <>
+class std::numeric_limits<TensorII::Core::float16> {
+    using T = TensorII::Core::float16;
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr bool is_iec559 = true;
+    static constexpr bool is_bounded = true;
+    static constexpr float_round_style round_style = round_to_nearest;
+    static constexpr int digits = 11;
+    static constexpr int digits10 = 3;
+    static constexpr int max_digits10 = 5;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = -13;
+    static constexpr int max_exponent = 16;
+
+    static constexpr T min() noexcept { return T::fromBits(0x0400); }
+    static constexpr T max() noexcept { return T::fromBits(0x7BFF); }
+    static constexpr T lowest() noexcept { return T::fromBits(0xFBFF); }
+    static constexpr T epsilon() noexcept { return T::fromBits(0x1400); }
+    static constexpr T round_error() noexcept { return T::fromBits(0x3800); }
+    static constexpr T infinity() noexcept { return T::fromBits(0x7C00); }
+    static constexpr T quiet_NaN() noexcept { return T::fromBits(0x7E00); }
+    static constexpr T signaling_NaN() noexcept { return T::fromBits(0x7D00); }
+    static constexpr T denorm_min() noexcept { return T::fromBits(0x0001); }
+};
+
+template <>
+class std::numeric_limits<TensorII::Core::bfloat16> {
+    using T = TensorII::Core::bfloat16;
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr bool has_signaling_NaN = true;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr float_round_style round_style = round_to_nearest;
+    static constexpr int digits = 8;
+    static constexpr int digits10 = 2;
+    static constexpr int max_digits10 = 4;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = -125;
+    static constexpr int max_exponent = 128;
+
+    static constexpr T min() noexcept { return T::fromBits(0x0080); }
+    static constexpr T max() noexcept { return T::fromBits(0x7F7F); }
+    static constexpr T lowest() noexcept { return T::fromBits(0xFF7F); }
+    static constexpr T epsilon() noexcept { return T::fromBits(0x3C00); }
+    static constexpr T round_error() noexcept { return T::fromBits(0x3F00); }
+    static constexpr T infinity() noexcept { return T::fromBits(0x7F80); }
+    static constexpr T quiet_NaN() noexcept { return T::fromBits(0x7FC0); }
+    static constexpr T signaling_NaN() noexcept { return T::fromBits(0x7FA0); }
+    static constexpr T denorm_min() noexcept { return T::fromBits(0x0001); }
+};
+
+#endif //TENSOR_HALF_H
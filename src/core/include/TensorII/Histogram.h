@@ -0,0 +1,89 @@
+#ifndef TENSOR_HISTOGRAM_H
+#define TENSOR_HISTOGRAM_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    // One histogram per index of an axis, e.g. per band of a cube, built up a tile at a time so the whole cube
+    // is never in memory at once: add each tile as it's read, then ask for counts or quantiles. Tiles may have
+    // any shape with bands_ along axis_.
+    //
+    // Each tile's elements are shared out between hardware threads, each counting into a histogram of its
+    // own, and those are summed into this one once the tile is done, so threads never write the same count.
+    // Values are binned in double, and NaNs are counted apart from everything else.
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    class Histogram {
+    public:
+        using Count = std::uint64_t;
+        static constexpr tensorRank axis = axis_;
+        static constexpr tensorSize bands = bands_;
+
+        // Fixed: 'bins' equal bins over [low, high), for every band or a range for each. Values outside the
+        // range are counted below or above it.
+        Histogram(tensorSize bins, double low, double high);
+        Histogram(tensorSize bins, const std::array<double, bands_>& low, const std::array<double, bands_>& high);
+        // Adaptive: each band's range starts as that of the first finite values seen, and doubles, bins merging
+        // in pairs, whenever later ones fall outside it, so only infinities are ever below or above it. 'bins'
+        // must be even.
+        explicit Histogram(tensorSize bins);
+
+        template <auto shape>
+        requires (axis_ < shape.rank() && static_cast<tensorSize>(shape[axis_]) == bands_)
+        void add(const Tensor<DType, shape>& tile);
+
+        // Adds the counts of a histogram with the same bins, e.g. of tiles read on another thread. Adaptive
+        // histograms have the same bins if they started from the same range and doubled as often.
+        void merge(const Histogram& other);
+
+        [[nodiscard]] tensorSize bins() const noexcept { return bins_; }
+        [[nodiscard]] bool adaptive() const noexcept { return adaptive_; }
+
+        [[nodiscard]] Count count(tensorSize band, tensorSize bin) const noexcept;
+        [[nodiscard]] Count below(tensorSize band) const noexcept;
+        [[nodiscard]] Count above(tensorSize band) const noexcept;
+        [[nodiscard]] Count nans(tensorSize band) const noexcept;
+        // Every value counted but NaNs
+        [[nodiscard]] Count total(tensorSize band) const noexcept;
+
+        // Lower edge of a bin; binLow(band, bins()) is the top of the range. NaN for an adaptive band with no
+        // values yet.
+        [[nodiscard]] double binLow(tensorSize band, tensorSize bin) const noexcept;
+        // Of the values counted, NaN if there are none
+        [[nodiscard]] double min(tensorSize band) const noexcept;
+        [[nodiscard]] double max(tensorSize band) const noexcept;
+
+        // The value a fraction q of a band's values are below, e.g. 0.02 and 0.98 for a contrast stretch.
+        // Interpolated linearly within the bin it falls in, so within a bin width of the exact quantile;
+        // values below or above the range count as a bin from the minimum up to it and from it up to the
+        // maximum. 0 and 1 are the exact minimum and maximum. NaN if the band has no values.
+        [[nodiscard]] double quantile(tensorSize band, double q) const;
+        [[nodiscard]] std::array<double, bands_> quantiles(double q) const;
+
+    private:
+        // Counts of each band: below, the bins, above, then NaNs
+        [[nodiscard]] tensorSize slots() const noexcept { return bins_ + 3; }
+        // Doubles a band's range until it takes in [lowest, highest]
+        void widen(tensorSize band, double lowest, double highest);
+
+        tensorSize bins_;
+        bool adaptive_;
+        // Whether each band has a range yet, always for fixed bins
+        std::array<bool, bands_> ranged_;
+        std::array<double, bands_> low_;
+        std::array<double, bands_> width_;
+        std::array<double, bands_> min_;
+        std::array<double, bands_> max_;
+        std::vector<Count> counts_;
+    };
+}
+
+#endif //TENSOR_HISTOGRAM_H
+
+#include "TensorII/private/templates/Histogram.tpp"
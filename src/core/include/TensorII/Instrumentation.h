@@ -0,0 +1,117 @@
+#ifndef TENSOR_INSTRUMENTATION_H
+#define TENSOR_INSTRUMENTATION_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "TensorII/PerfCounters.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Instrumentation {
+
+    enum class OpKind { Elementwise, Reduction, Contraction, Copy, IO };
+
+    const char* toString(OpKind kind);
+
+    // Aggregate over every call of one op
+    struct OpStats {
+        std::string name;
+        OpKind kind;
+        uint64_t calls;
+        uint64_t nanoseconds;
+        uint64_t elements;
+        uint64_t bytes;
+        // Totals over every call, all 0 unless hardware counters are enabled and available
+        CounterSample counters;
+    };
+
+    // A single call, kept for traces
+    struct OpEvent {
+        const char* name;
+        OpKind kind;
+        uint64_t threadId;
+        int64_t startNanoseconds;
+        int64_t durationNanoseconds;
+        uint64_t elements;
+        uint64_t bytes;
+    };
+
+    // Only the first maxEvents calls are kept as events, aggregates are always updated
+    constexpr size_t maxEvents = size_t(1) << 20;
+
+    int64_t now();
+    void record(const char* name, OpKind kind, int64_t startNanoseconds, int64_t stopNanoseconds,
+                tensorSize elements, tensorSize bytes, const CounterSample& counters = {});
+
+    // Also read hardware counters around every op. Off by default since it costs a syscall per read.
+    void setHardwareCounters(bool enabled);
+    bool hardwareCountersEnabled();
+    // Counters of the calling thread if enabled, otherwise all 0
+    CounterSample sampleCounters();
+
+    std::vector<OpStats> stats();
+    std::vector<OpEvent> events();
+    void reset();
+
+    // Per-op aggregates as JSON
+    void writeJson(std::ostream& out);
+    // Every recorded call as Chrome's trace event format, viewable in chrome://tracing or Perfetto
+    void writeChromeTrace(std::ostream& out);
+    // Human readable table of per-op bandwidth and, if counted, IPC and cache misses
+    void writeReport(std::ostream& out);
+
+    // Times its own lifetime and records it against 'name'. Does nothing during constant evaluation,
+    // so it can be used inside constexpr kernels.
+    class ScopedOp {
+    public:
+        constexpr ScopedOp(const char* name, OpKind kind, tensorSize elements, tensorSize bytes)
+        : name_(name)
+        , kind_(kind)
+        , elements_(elements)
+        , bytes_(bytes)
+        , start_(0)
+        , startCounters_{}
+        {
+            if (!std::is_constant_evaluated()) {
+                startCounters_ = sampleCounters();
+                start_ = now();
+            }
+        }
+
+        ScopedOp(const ScopedOp&) = delete;
+        ScopedOp& operator=(const ScopedOp&) = delete;
+
+        constexpr ~ScopedOp() {
+            if (!std::is_constant_evaluated()) {
+                const int64_t stop = now();
+                record(name_, kind_, start_, stop, elements_, bytes_, sampleCounters() - startCounters_);
+            }
+        }
+
+    private:
+        const char* name_;
+        OpKind kind_;
+        tensorSize elements_;
+        tensorSize bytes_;
+        int64_t start_;
+        CounterSample startCounters_;
+    };
+}
+
+#define TENSORII_CONCAT_IMPL(a, b) a##b
+#define TENSORII_CONCAT(a, b) TENSORII_CONCAT_IMPL(a, b)
+
+// Records the enclosing scope as one call of an op. 'bytes' counts bytes both read and written.
+// Compiles to nothing unless TENSORII_INSTRUMENTATION is defined.
+#ifdef TENSORII_INSTRUMENTATION
+#define TENSORII_INSTRUMENT_OP(name, kind, elements, bytes)                                   \
+    ::TensorII::Core::Instrumentation::ScopedOp TENSORII_CONCAT(tensoriiScopedOp, __LINE__) { \
+        name, ::TensorII::Core::Instrumentation::OpKind::kind, elements, bytes }
+#else
+#define TENSORII_INSTRUMENT_OP(name, kind, elements, bytes) static_cast<void>(0)
+#endif
+
+#endif //TENSOR_INSTRUMENTATION_H
@@ -0,0 +1,14 @@
+#ifndef TENSOR_INTERPOLATION_H
+#define TENSOR_INTERPOLATION_H
+
+namespace TensorII::Core {
+
+    // How a value between grid points is made from those around it
+    enum class Interpolation {
+        Nearest,  // The closest point's, so any type, and class labels stay labels
+        Bilinear, // Weighted by distance from the 2 x 2 points around it
+        Bicubic   // A cubic convolution of the 4 x 4 points around it (Keys, a = -0.5), sharper than bilinear
+    };
+}
+
+#endif //TENSOR_INTERPOLATION_H
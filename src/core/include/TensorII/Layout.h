@@ -0,0 +1,148 @@
+#ifndef TENSOR_LAYOUT_H
+#define TENSOR_LAYOUT_H
+
+#include <array>
+#include <type_traits>
+
+#include "TensorII/Shape.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    // Layouts map a multi-index to an offset into a tensor's storage. Everything but the index is known at
+    // compile time, so the mapping inlines to a handful of multiplies by constants (and shifts and masks,
+    // for power of two tiles). Each offset is a sum of one term per axis, which kernels can tabulate.
+
+    // Last axis contiguous, the C and NumPy default
+    struct RowMajor {
+        template <auto shape>
+        static constexpr bool fits() noexcept;
+
+        template <auto shape>
+        static constexpr tensorSize offset(const std::array<tensorSize, shape.rank()>& index) noexcept;
+
+        template <auto shape>
+        static constexpr tensorSize axisOffset(tensorRank axis, tensorSize i) noexcept;
+
+        // Consecutive elements along the last axis which are also consecutive in storage
+        template <auto shape>
+        static constexpr tensorSize contiguousRun() noexcept;
+
+        // Inverse of offset
+        template <auto shape>
+        static constexpr std::array<tensorSize, shape.rank()> indexOf(tensorSize offset) noexcept;
+
+        // Calls function(offset, index) for every element, in storage order
+        template <auto shape, typename Function>
+        static constexpr void forEachIndex(Function&& function);
+    };
+
+    // First axis contiguous, as Fortran and LAPACK expect
+    struct ColumnMajor {
+        template <auto shape>
+        static constexpr bool fits() noexcept;
+
+        template <auto shape>
+        static constexpr tensorSize offset(const std::array<tensorSize, shape.rank()>& index) noexcept;
+
+        template <auto shape>
+        static constexpr tensorSize axisOffset(tensorRank axis, tensorSize i) noexcept;
+
+        template <auto shape>
+        static constexpr tensorSize contiguousRun() noexcept;
+
+        // Inverse of offset
+        template <auto shape>
+        static constexpr std::array<tensorSize, shape.rank()> indexOf(tensorSize offset) noexcept;
+
+        // Calls function(offset, index) for every element, in storage order
+        template <auto shape, typename Function>
+        static constexpr void forEachIndex(Function&& function);
+    };
+
+    // Blocks of tile[0] x tile[1] x ... elements, each stored contiguously and row-major, with the blocks
+    // themselves in row-major order. Neighbours along every axis then tend to share a cache line or page.
+    // The tiles have to divide the shape evenly.
+    template <tensorDimension... tile>
+    requires (sizeof...(tile) > 0 && ((tile > 0) && ...))
+    struct Tiled {
+        static constexpr std::array<tensorSize, sizeof...(tile)> tileShape {static_cast<tensorSize>(tile)...};
+        static constexpr tensorSize tileSize = (static_cast<tensorSize>(tile) * ...);
+
+        template <auto shape>
+        static constexpr bool fits() noexcept;
+
+        template <auto shape>
+        static constexpr tensorSize offset(const std::array<tensorSize, shape.rank()>& index) noexcept;
+
+        template <auto shape>
+        static constexpr tensorSize axisOffset(tensorRank axis, tensorSize i) noexcept;
+
+        template <auto shape>
+        static constexpr tensorSize contiguousRun() noexcept;
+
+        // Inverse of offset
+        template <auto shape>
+        static constexpr std::array<tensorSize, shape.rank()> indexOf(tensorSize offset) noexcept;
+
+        // Calls function(offset, index) for every element, in storage order
+        template <auto shape, typename Function>
+        static constexpr void forEachIndex(Function&& function);
+    };
+
+    // Z-order: the bits of the indices interleaved, last axis lowest, so that every aligned 2x2 (2x2x2) block,
+    // 4x4 (4x4x4) block and so on is contiguous. Neighbours along any axis are then usually close in memory.
+    // For rank 2 and 3 tensors with power of two extents, which needn't be equal: once the shorter axes run
+    // out of bits the longer ones carry on interleaving among themselves.
+    // Indices are scattered into (and gathered from) offsets with pdep and pext when compiled for BMI2, see
+    // the TENSORII_BMI2 CMake option, and otherwise a byte at a time through lookup tables built at compile time
+    // for each shape and axis.
+    struct Morton {
+        template <auto shape>
+        static constexpr bool fits() noexcept;
+
+        template <auto shape>
+        static constexpr tensorSize offset(const std::array<tensorSize, shape.rank()>& index) noexcept;
+
+        template <auto shape>
+        static constexpr tensorSize axisOffset(tensorRank axis, tensorSize i) noexcept;
+
+        template <auto shape>
+        static constexpr tensorSize contiguousRun() noexcept;
+
+        template <auto shape>
+        static constexpr std::array<tensorSize, shape.rank()> indexOf(tensorSize offset) noexcept;
+
+        template <auto shape, typename Function>
+        static constexpr void forEachIndex(Function&& function);
+
+        // Offset of the element 'delta' steps along 'axis' from the one at 'offset', wrapping around at the
+        // edges, by adding within the axis' bits rather than decoding and encoding again
+        template <auto shape>
+        static constexpr tensorSize neighbour(tensorSize offset, tensorRank axis, tensorIndex delta) noexcept;
+    };
+
+    namespace Private {
+        template <typename T>
+        struct IsLayout : std::false_type {};
+
+        template <>
+        struct IsLayout<RowMajor> : std::true_type {};
+
+        template <>
+        struct IsLayout<ColumnMajor> : std::true_type {};
+
+        template <tensorDimension... tile>
+        struct IsLayout<Tiled<tile...>> : std::true_type {};
+
+        template <>
+        struct IsLayout<Morton> : std::true_type {};
+    }
+
+    template <typename T>
+    concept TensorLayout = Private::IsLayout<T>::value;
+}
+
+#endif //TENSOR_LAYOUT_H
+
+#include "TensorII/private/templates/Layout.tpp"
@@ -0,0 +1,110 @@
+#ifndef TENSOR_MASK_H
+#define TENSOR_MASK_H
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+
+#include "TensorII/Layout.h"
+#include "TensorII/Operations.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    // One bit per element of a tensor of the same shape and layout, e.g. the valid pixels of a scene, packed
+    // 64 to a word: an eighth of the memory of bools. Bits are in the storage order of Layout, the first
+    // element in the lowest bit of the first word, so bit i stands for data()[i] of a Tensor<DType, shape,
+    // Layout>. Bits past the last element are always clear.
+    template <auto shape_, TensorLayout Layout_ = RowMajor>
+    class Mask {
+    public:
+        using Layout = Layout_;
+        using Word = std::uint64_t;
+        static constexpr tensorSize wordBits = 64;
+
+        static constexpr tensorSize size() noexcept;
+        static constexpr tensorSize nWords() noexcept;
+        static constexpr tensorSize size_in_bytes() noexcept;
+
+        // Every element clear, or every element set to value
+        constexpr Mask();
+        constexpr explicit Mask(bool value);
+
+        // Copy not allowed, as for tensors
+        constexpr Mask(const Mask&) = delete;
+        constexpr Mask& operator=(const Mask&) = delete;
+
+        constexpr Mask(Mask&&) noexcept = default;
+        constexpr Mask& operator=(Mask&&) noexcept = default;
+
+        // By storage offset
+        constexpr bool test(tensorSize offset) const noexcept;
+        constexpr void set(tensorSize offset, bool value = true) noexcept;
+        // wordBits elements at once from word * wordBits on; bits past the last element are dropped
+        constexpr void setWord(tensorSize word, Word bits) noexcept;
+
+        template <std::convertible_to<tensorSize> ... Indices>
+        requires (sizeof...(Indices) == shape_.rank())
+        constexpr bool at(const Indices& ... indices) const noexcept;
+
+        constexpr const Word* words() const noexcept;
+
+        // Elements set
+        constexpr tensorSize count() const noexcept;
+        constexpr bool any() const noexcept;
+        constexpr bool all() const noexcept;
+
+        constexpr Mask& operator&=(const Mask& other) noexcept;
+        constexpr Mask& operator|=(const Mask& other) noexcept;
+        constexpr Mask& operator^=(const Mask& other) noexcept;
+        constexpr Mask operator~() const noexcept;
+
+        constexpr bool operator==(const Mask& other) const noexcept = default;
+
+    private:
+        std::array<Word, (shape_.n_elems() + wordBits - 1) / wordBits> words_;
+
+        // The bits of the last word that stand for elements
+        static constexpr Word lastWordBits() noexcept;
+    };
+
+    template <auto shape, TensorLayout Layout>
+    constexpr Mask<shape, Layout> operator&(const Mask<shape, Layout>& lhs, const Mask<shape, Layout>& rhs) noexcept;
+
+    template <auto shape, TensorLayout Layout>
+    constexpr Mask<shape, Layout> operator|(const Mask<shape, Layout>& lhs, const Mask<shape, Layout>& rhs) noexcept;
+
+    template <auto shape, TensorLayout Layout>
+    constexpr Mask<shape, Layout> operator^(const Mask<shape, Layout>& lhs, const Mask<shape, Layout>& rhs) noexcept;
+
+    // Set where predicate(element) holds, e.g. makeMask(scene, [](float x) { return !std::isnan(x); })
+    template <Scalar DType, auto shape, TensorLayout Layout, std::predicate<DType> Predicate>
+    constexpr Mask<shape, Layout> makeMask(const Tensor<DType, shape, Layout>& tensor, Predicate predicate);
+
+    // Elements selected without branching on the mask: float, double and 8 and 16-bit integers blend a SIMD
+    // vector at a time, under AVX-512 straight from the packed bits as mask registers, other types by a
+    // conditional move per element. Elements not selected are never computed with, so they may be NaN.
+
+    // out = mask ? whereSet : whereClear, elementwise. out may alias either input.
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void where(const Mask<shape, Layout>& mask, const Tensor<DType, shape, Layout>& whereSet,
+                         const Tensor<DType, shape, Layout>& whereClear, Tensor<DType, shape, Layout>& out);
+
+    // Elements where the mask is set become value, e.g. invalid pixels a fill value
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void maskedFill(Tensor<DType, shape, Layout>& tensor, const Mask<shape, Layout>& mask, DType value);
+
+    // Reductions over the elements where the mask is set. The SIMD sums keep a total per lane, so float sums
+    // may differ from sum()'s in the last bits; integer sums wrap in the element type, as sum()'s do.
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr Accumulator<DType> sum(const Tensor<DType, shape, Layout>& tensor, const Mask<shape, Layout>& mask);
+
+    // NaN if no element is set
+    template <std::floating_point DType, auto shape, TensorLayout Layout>
+    constexpr DType mean(const Tensor<DType, shape, Layout>& tensor, const Mask<shape, Layout>& mask);
+}
+
+#endif //TENSOR_MASK_H
+
+#include "TensorII/private/templates/Mask.tpp"
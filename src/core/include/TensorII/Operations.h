@@ -0,0 +1,111 @@
+#ifndef TENSOR_OPERATIONS_H
+#define TENSOR_OPERATIONS_H
+
+#include <concepts>
+
+#include "TensorII/Tensor.h"
+#include "TensorII/TensorDType.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        template <Scalar DType>
+        struct AccumulatorOf {
+            using type = DType;
+        };
+
+        template <ReducedFloat DType>
+        struct AccumulatorOf<DType> {
+            using type = float;
+        };
+    }
+
+    // Type reductions of a DType are carried out and returned in
+    template <Scalar DType>
+    using Accumulator = typename Private::AccumulatorOf<DType>::type;
+
+    // Elementwise operations and reductions work on storage directly, so all their operands share one layout.
+    // 16-bit floats and complex floats have SIMD kernels, as do the arithmetic, scale, sum and dot over float and
+    // double; for split complex storage see Complex.h.
+    //
+    // Everything here is constexpr, so tables such as quadrature weights or rotation sets can be computed
+    // into a constexpr Tensor by a lambda returning it. Constant evaluation takes plain loops; at run time the
+    // same calls take the SIMD kernels.
+
+    // Elementwise static_cast, widening or narrowing 16-bit floats with SIMD kernels
+    template <Scalar To, Scalar From, auto shape, TensorLayout Layout>
+    constexpr void convert(const Tensor<From, shape, Layout>& in, Tensor<To, shape, Layout>& out);
+
+    // The same elements stored in another layout, e.g. column-major to hand to a Fortran solver
+    template <Scalar DType, auto shape, TensorLayout From, TensorLayout To>
+    constexpr void relayout(const Tensor<DType, shape, From>& in, Tensor<DType, shape, To>& out);
+
+    // Elementwise, out may alias either input
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void add(const Tensor<DType, shape, Layout>& lhs, const Tensor<DType, shape, Layout>& rhs,
+                       Tensor<DType, shape, Layout>& out);
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void subtract(const Tensor<DType, shape, Layout>& lhs, const Tensor<DType, shape, Layout>& rhs,
+                            Tensor<DType, shape, Layout>& out);
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void multiply(const Tensor<DType, shape, Layout>& lhs, const Tensor<DType, shape, Layout>& rhs,
+                            Tensor<DType, shape, Layout>& out);
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void divide(const Tensor<DType, shape, Layout>& lhs, const Tensor<DType, shape, Layout>& rhs,
+                          Tensor<DType, shape, Layout>& out);
+
+    // out = factor * in, out may alias in
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void scale(const Tensor<DType, shape, Layout>& in, DType factor, Tensor<DType, shape, Layout>& out);
+
+    // out = function(in) or function(lhs, rhs) elementwise, usable in constant evaluation if function is.
+    // out may alias the inputs.
+    template <Scalar In, Scalar Out, auto shape, TensorLayout Layout, std::invocable<In> Function>
+    constexpr void map(const Tensor<In, shape, Layout>& in, Tensor<Out, shape, Layout>& out, Function function);
+
+    template <Scalar Lhs, Scalar Rhs, Scalar Out, auto shape, TensorLayout Layout, std::invocable<Lhs, Rhs> Function>
+    constexpr void map(const Tensor<Lhs, shape, Layout>& lhs, const Tensor<Rhs, shape, Layout>& rhs,
+                       Tensor<Out, shape, Layout>& out, Function function);
+
+    // Reductions over every element. dot of complex tensors doesn't conjugate either side.
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr Accumulator<DType> sum(const Tensor<DType, shape, Layout>& tensor);
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr Accumulator<DType> dot(const Tensor<DType, shape, Layout>& lhs, const Tensor<DType, shape, Layout>& rhs);
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr Accumulator<DType> product(const Tensor<DType, shape, Layout>& tensor);
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    requires std::totally_ordered<DType>
+    constexpr DType min(const Tensor<DType, shape, Layout>& tensor);
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    requires std::totally_ordered<DType>
+    constexpr DType max(const Tensor<DType, shape, Layout>& tensor);
+
+    namespace Private {
+        template <auto lhsShape, auto rhsShape, auto outShape>
+        constexpr bool multipliable() noexcept {
+            return lhsShape.rank() == 2 && rhsShape.rank() == 2 && outShape.rank() == 2
+                   && lhsShape[1] == rhsShape[0] && outShape[0] == lhsShape[0] && outShape[1] == rhsShape[1];
+        }
+    }
+
+    // Matrix product of small matrices, e.g. shape functions at quadrature points. Operands may be in any
+    // layouts; with all three row-major float or double, or complex of either, and rows long enough, it runs on
+    // the SIMD weighted sum of rows the convolutions use. out may not alias either input.
+    template <Scalar DType, auto lhsShape, auto rhsShape, auto outShape,
+              TensorLayout LhsLayout, TensorLayout RhsLayout, TensorLayout OutLayout>
+    requires (Private::multipliable<lhsShape, rhsShape, outShape>())
+    constexpr void matmul(const Tensor<DType, lhsShape, LhsLayout>& lhs, const Tensor<DType, rhsShape, RhsLayout>& rhs,
+                          Tensor<DType, outShape, OutLayout>& out);
+}
+
+#endif //TENSOR_OPERATIONS_H
+
+#include "TensorII/private/templates/Operations.tpp"
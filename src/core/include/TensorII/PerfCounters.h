@@ -0,0 +1,69 @@
+#ifndef TENSOR_PERFCOUNTERS_H
+#define TENSOR_PERFCOUNTERS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace TensorII::Core::Instrumentation {
+
+    enum class Counter { Cycles, Instructions, CacheMisses, BranchMisses, PageFaults };
+    constexpr size_t nCounters = 5;
+
+    const char* toString(Counter counter);
+
+    struct CounterSample {
+        std::array<uint64_t, nCounters> values {};
+
+        constexpr uint64_t operator[](Counter counter) const { return values[static_cast<size_t>(counter)]; }
+        constexpr uint64_t& operator[](Counter counter) { return values[static_cast<size_t>(counter)]; }
+
+        constexpr CounterSample operator-(const CounterSample& other) const {
+            CounterSample difference;
+            for (size_t i = 0; i < nCounters; i++) {
+                difference.values[i] = values[i] - other.values[i];
+            }
+            return difference;
+        }
+
+        constexpr CounterSample& operator+=(const CounterSample& other) {
+            for (size_t i = 0; i < nCounters; i++) {
+                values[i] += other.values[i];
+            }
+            return *this;
+        }
+    };
+
+    // Hardware and software counters for the calling thread, read with perf_event_open on Linux.
+    // Counters which can't be opened (no PMU in a VM, perf_event_paranoid, seccomp, other OSes) read as 0,
+    // so callers never need to special case an unprivileged container.
+    class PerfCounters {
+    public:
+        PerfCounters();
+        ~PerfCounters();
+
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        [[nodiscard]]
+        bool available() const;
+        [[nodiscard]]
+        bool available(Counter counter) const;
+
+        // Running totals since construction, scaled up if the kernel had to multiplex the counters
+        [[nodiscard]]
+        CounterSample read() const;
+
+        // Counters of the calling thread, opened on first use
+        static PerfCounters& thisThread();
+
+    private:
+        int leader_;
+        // Position of each counter in the group's read buffer, -1 if it couldn't be opened
+        std::array<int, nCounters> slots_;
+        std::array<int, nCounters> fds_;
+        int nOpen_;
+    };
+}
+
+#endif //TENSOR_PERFCOUNTERS_H
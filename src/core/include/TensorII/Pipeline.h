@@ -0,0 +1,175 @@
+#ifndef TENSOR_PIPELINE_H
+#define TENSOR_PIPELINE_H
+
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "TensorII/Future.h"
+#include "TensorII/ThreadPool.h"
+
+namespace TensorII::Core {
+
+    // Coroutine running one stage of a pipeline: a loop popping from one channel and pushing to the next. It
+    // doesn't start until started, and every suspension resumes on the pool, so stages share its threads
+    // rather than holding one each.
+    class StageTask {
+    public:
+        struct promise_type;
+
+        // Completes the stage's future after destroying its frame
+        struct Finish {
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<promise_type> handle) const noexcept;
+            void await_resume() const noexcept {}
+        };
+
+        struct promise_type {
+            StageTask get_return_object() noexcept { return StageTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            Finish final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { error = std::current_exception(); }
+
+            Promise<void> completion;
+            std::exception_ptr error;
+        };
+
+        StageTask(StageTask&& other) noexcept;
+        StageTask& operator=(StageTask&&) = delete;
+        ~StageTask();
+
+        // The future completes once the stage has returned and its frame, with everything it held, is gone
+        Future<void> start(ThreadPool& pool) &&;
+
+    private:
+        friend struct promise_type;
+        explicit StageTask(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    // Bounded queue between stages. A push to a full channel suspends the producer until a consumer makes
+    // room, so a slow stage holds back the ones before it instead of letting the queue grow. Any number of
+    // producers and consumers; each item goes to exactly one consumer, in no particular order between them.
+    template <typename T>
+    class Channel {
+    public:
+        // The channel closes once 'producers' have each called close()
+        explicit Channel(std::size_t capacity, std::size_t producers = 1, ThreadPool& pool = ThreadPool::shared());
+
+        Channel(const Channel&) = delete;
+        Channel& operator=(const Channel&) = delete;
+
+        // co_await push(item) is false, dropping the item, if the channel is closed or cancelled
+        auto push(T item);
+        // co_await pop() is empty once the channel is closed and drained, or cancelled
+        auto pop();
+
+        void close();
+        // Drops whatever is queued and wakes everyone waiting; for a stage that fails, so the rest of the
+        // pipeline doesn't wait on it forever
+        void cancel();
+
+        [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    private:
+        struct PushAwaiter;
+        struct PopAwaiter;
+
+        void schedule(std::coroutine_handle<> handle) { pool_.submit([handle] { handle.resume(); }); }
+
+        std::mutex mutex_;
+        std::deque<T> items_;
+        std::deque<PushAwaiter*> pushers_;
+        std::deque<PopAwaiter*> poppers_;
+        const std::size_t capacity_;
+        std::size_t producers_;
+        bool cancelled_ = false;
+        ThreadPool& pool_;
+    };
+
+    template <typename TensorType>
+    class FramePool;
+
+    // A tensor borrowed from a FramePool, going back to it when destroyed. Move it through channels rather than
+    // the tensor itself.
+    template <typename TensorType>
+    class Frame {
+    public:
+        Frame(Frame&& other) noexcept = default;
+        Frame& operator=(Frame&& other) noexcept;
+        ~Frame();
+
+        TensorType& operator*() const noexcept { return *tensor_; }
+        TensorType* operator->() const noexcept { return tensor_.get(); }
+
+    private:
+        friend class FramePool<TensorType>;
+        Frame(FramePool<TensorType>& pool, std::unique_ptr<TensorType> tensor) noexcept : pool_(&pool), tensor_(std::move(tensor)) {}
+
+        FramePool<TensorType>* pool_;
+        std::unique_ptr<TensorType> tensor_;
+    };
+
+    // Fixed set of tensors allocated up front and recycled, so a pipeline allocates nothing per frame and the
+    // frames in flight are bounded. Frames come back as they were left, not zeroed. It must outlive them.
+    template <typename TensorType>
+    class FramePool {
+    public:
+        explicit FramePool(std::size_t frames, ThreadPool& pool = ThreadPool::shared());
+
+        FramePool(const FramePool&) = delete;
+        FramePool& operator=(const FramePool&) = delete;
+
+        // co_await acquire() suspends until a frame is free
+        auto acquire();
+        [[nodiscard]] std::size_t available();
+
+    private:
+        friend class Frame<TensorType>;
+        struct AcquireAwaiter;
+
+        void release(std::unique_ptr<TensorType> tensor);
+
+        std::mutex mutex_;
+        std::vector<std::unique_ptr<TensorType>> free_;
+        std::deque<AcquireAwaiter*> waiting_;
+        ThreadPool& pool_;
+    };
+
+    // Runs stages on a pool until they've all returned
+    class Pipeline {
+    public:
+        explicit Pipeline(ThreadPool& pool = ThreadPool::shared()) : pool_(pool) {}
+
+        // Add a stage several times, sharing its input and output channels, to run that many copies of it at once
+        void add(StageTask stage);
+        // Rethrows the first stage to fail, once every stage has returned
+        void wait();
+
+        [[nodiscard]] ThreadPool& pool() const noexcept { return pool_; }
+
+    private:
+        ThreadPool& pool_;
+        std::vector<Future<void>> stages_;
+    };
+
+    // Stage running function(const In&, Out&) on each frame from 'in' into a frame from 'frames', pushed to 'out'.
+    // Closes 'out' when 'in' is done; cancels both if function throws.
+    template <typename In, typename Out, typename Function>
+    StageTask transform(Channel<Frame<In>>& in, Channel<Frame<Out>>& out, FramePool<Out>& frames, Function function);
+
+    // Stage passing each item from 'in' to function, e.g. to write it out
+    template <typename T, typename Function>
+    StageTask consume(Channel<T>& in, Function function);
+}
+
+#endif //TENSOR_PIPELINE_H
+
+#include "TensorII/private/templates/Pipeline.tpp"
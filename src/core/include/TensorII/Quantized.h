@@ -0,0 +1,102 @@
+#ifndef TENSOR_QUANTIZED_H
+#define TENSOR_QUANTIZED_H
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    template <typename T>
+    concept QuantizedStorage
+            = std::same_as<T, int8_t>
+            || std::same_as<T, uint8_t>
+            || std::same_as<T, int16_t>
+            || std::same_as<T, uint16_t>
+            || std::same_as<T, int32_t>
+            || std::same_as<T, int64_t>;
+
+    // Axis value for a single scale and zero point over the whole tensor
+    inline constexpr tensorRank perTensor = std::numeric_limits<tensorRank>::max();
+
+    // Integers standing for real values, real = scale * (stored - zeroPoint), with either one scale and zero
+    // point for the whole tensor or one per index of 'axis_', e.g. per band gain and offset of raw detector counts.
+    // Arithmetic stays on the stored integers and only the results are scaled back to reals.
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_ = perTensor>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    class QuantizedTensor {
+    public:
+        static constexpr tensorSize nChannels = axis_ == perTensor ? 1 : static_cast<tensorSize>(shape_[axis_]);
+        // Elements of one channel that are contiguous in memory, and the number of such runs per channel
+        static constexpr tensorSize innerSize();
+        static constexpr tensorSize outerSize();
+
+        using Scales = std::array<float, nChannels>;
+        using ZeroPoints = std::array<int32_t, nChannels>;
+
+        // Scale of 1 and zero point of 0, stored values are the reals
+        constexpr QuantizedTensor();
+        constexpr QuantizedTensor(float scale, int32_t zeroPoint) requires (axis_ == perTensor);
+        constexpr QuantizedTensor(const Scales& scales, const ZeroPoints& zeroPoints);
+        // Wraps integers which are already quantized, such as raw counts
+        constexpr QuantizedTensor(Tensor<Stored, shape_>&& values, const Scales& scales, const ZeroPoints& zeroPoints);
+
+        constexpr Tensor<Stored, shape_>& values() noexcept;
+        constexpr const Tensor<Stored, shape_>& values() const noexcept;
+
+        constexpr const Scales& scales() const noexcept;
+        constexpr const ZeroPoints& zeroPoints() const noexcept;
+        // Reinterprets the stored values, which are left as they are
+        constexpr void setParameters(const Scales& scales, const ZeroPoints& zeroPoints);
+
+        static constexpr tensorSize channelOf(tensorSize flatIndex) noexcept;
+        // Real value of one element
+        constexpr float at(tensorSize flatIndex) const;
+
+    private:
+        Tensor<Stored, shape_> values_;
+        Scales scales_;
+        ZeroPoints zeroPoints_;
+    };
+
+    // Round to nearest, saturating at the limits of Stored
+    template <QuantizedStorage Stored, auto shape, tensorRank axis>
+    constexpr void quantize(const Tensor<float, shape>& in, QuantizedTensor<Stored, shape, axis>& out);
+
+    template <QuantizedStorage Stored, auto shape, tensorRank axis>
+    constexpr void dequantize(const QuantizedTensor<Stored, shape, axis>& in, Tensor<float, shape>& out);
+
+    // Elementwise on the stored integers, into a signed type wide enough that nothing overflows, as differences
+    // and centred products go negative even for unsigned inputs. The parameters of 'out' are set from those of
+    // the inputs; adding and subtracting needs the inputs' scales to match.
+    template <QuantizedStorage Out, QuantizedStorage Stored, auto shape, tensorRank axis>
+    requires (std::is_signed_v<Out> && sizeof(Out) > sizeof(Stored))
+    constexpr void add(const QuantizedTensor<Stored, shape, axis>& lhs, const QuantizedTensor<Stored, shape, axis>& rhs,
+                       QuantizedTensor<Out, shape, axis>& out);
+
+    template <QuantizedStorage Out, QuantizedStorage Stored, auto shape, tensorRank axis>
+    requires (std::is_signed_v<Out> && sizeof(Out) > sizeof(Stored))
+    constexpr void subtract(const QuantizedTensor<Stored, shape, axis>& lhs, const QuantizedTensor<Stored, shape, axis>& rhs,
+                            QuantizedTensor<Out, shape, axis>& out);
+
+    template <QuantizedStorage Out, QuantizedStorage Stored, auto shape, tensorRank axis>
+    requires (std::is_signed_v<Out> && sizeof(Out) > 2 * sizeof(Stored))
+    constexpr void multiply(const QuantizedTensor<Stored, shape, axis>& lhs, const QuantizedTensor<Stored, shape, axis>& rhs,
+                            QuantizedTensor<Out, shape, axis>& out);
+
+    // Reductions accumulate exactly in 64-bit integers, and are scaled to a real only at the end
+    template <QuantizedStorage Stored, auto shape, tensorRank axis>
+    constexpr double sum(const QuantizedTensor<Stored, shape, axis>& tensor);
+
+    template <QuantizedStorage Stored, auto shape, tensorRank axis>
+    constexpr double dot(const QuantizedTensor<Stored, shape, axis>& lhs, const QuantizedTensor<Stored, shape, axis>& rhs);
+}
+
+#endif //TENSOR_QUANTIZED_H
+
+#include "TensorII/private/templates/Quantized.tpp"
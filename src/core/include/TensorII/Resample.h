@@ -0,0 +1,55 @@
+#ifndef TENSOR_RESAMPLE_H
+#define TENSOR_RESAMPLE_H
+
+#include <concepts>
+
+#include "TensorII/Boundary.h"
+#include "TensorII/Interpolation.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    // Resampling over the first two axes of a rows x columns image, or rows x columns x bands with every band
+    // in the same pass, onto the grid of 'out', whose shape sets the output rows and columns; bands must match.
+    // Positions are in source pixels with the centres on whole numbers, and the boundary decides what taps
+    // beyond the image read: boundaryValue for Dirichlet, the image reflected for Neumann or wrapped round for
+    // Periodic. 'out' must not alias 'in'. Output rows are shared out between hardware threads.
+    //
+    // Nearest works on any type; bilinear and bicubic on float and double, blending whole rows of columns and
+    // bands a SIMD vector at a time. Bicubic may overshoot the range of its input near edges in the image.
+
+    namespace Private {
+        template <auto inShape, auto outShape>
+        constexpr bool resamplable() noexcept {
+            return inShape.rank() == outShape.rank() && (inShape.rank() == 2 || (inShape.rank() == 3 && inShape[2] == outShape[2]));
+        }
+
+        template <Interpolation interpolation, typename DType>
+        inline constexpr bool interpolates = interpolation == Interpolation::Nearest || std::same_as<DType, float> || std::same_as<DType, double>;
+
+        template <typename Coordinate>
+        inline constexpr bool mapsCoordinates = std::same_as<Coordinate, float> || std::same_as<Coordinate, double>;
+    }
+
+    // Onto a grid over the same area, the corners of the corner pixels aligned, e.g. bands of a coarser
+    // resolution up to a finer one. There's no smoothing first, so shrinking by much more than 2 aliases;
+    // convolve with a low pass filter before.
+    template <Interpolation interpolation, Boundary boundary = Boundary::Neumann, Scalar DType, auto inShape, auto outShape>
+    requires (Private::resamplable<inShape, outShape>() && Private::interpolates<interpolation, DType>)
+    void resize(const Tensor<DType, inShape>& in, Tensor<DType, outShape>& out, DType boundaryValue = DType {});
+
+    // Output pixel (r, c) sampled at the source (row, column) in coordinates(r, c, 0) and coordinates(r, c, 1),
+    // e.g. through a co-registration's transform, in float or double. A NaN coordinate gives boundaryValue.
+    template <Interpolation interpolation, Boundary boundary = Boundary::Dirichlet, Scalar DType, auto inShape,
+              typename Coordinate, auto mapShape, auto outShape>
+    requires (Private::resamplable<inShape, outShape>() && Private::interpolates<interpolation, DType>
+              && Private::mapsCoordinates<Coordinate>
+              && mapShape.rank() == 3 && mapShape[0] == outShape[0] && mapShape[1] == outShape[1] && mapShape[2] == 2)
+    void warp(const Tensor<DType, inShape>& in, const Tensor<Coordinate, mapShape>& coordinates, Tensor<DType, outShape>& out,
+              DType boundaryValue = DType {});
+}
+
+#endif //TENSOR_RESAMPLE_H
+
+#include "TensorII/private/templates/Resample.tpp"
@@ -0,0 +1,57 @@
+#ifndef TENSOR_SCAN_H
+#define TENSOR_SCAN_H
+
+#include <concepts>
+#include <functional>
+
+#include "TensorII/Operations.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    // Inclusive scans along one axis of a tensor, of every sequence along it at once:
+    // out[..., i, ...] = in[..., 0, ...] op in[..., 1, ...] op ... op in[..., i, ...]. Output has the input's
+    // shape, and each operation has an in-place form.
+    //
+    // Sequences along the last axis are contiguous; float and double sums of those scan a SIMD vector at a time
+    // in registers. Along any other axis neighbouring sequences sit side by side, and are scanned a block of
+    // them at a time. Many sequences are shared out between hardware threads; when there are too few to go
+    // round, each long one is split into a chunk per thread, the chunks scanned, and each offset by the totals
+    // of the chunks before it. That regroups the operations, so op must be associative, and float sums may
+    // differ from a sequential scan's in the last bits.
+
+    // 'op' combines a running total of DType with the next element
+    template <typename Op, typename DType>
+    concept ScanOperation = std::regular_invocable<Op, DType, DType> && std::convertible_to<std::invoke_result_t<Op, DType, DType>, DType>;
+
+    template <tensorRank axis, Scalar DType, auto shape, ScanOperation<DType> Op>
+    requires (axis < shape.rank())
+    constexpr void scan(const Tensor<DType, shape>& in, Tensor<DType, shape>& out, Op op);
+
+    template <tensorRank axis, Scalar DType, auto shape, ScanOperation<DType> Op>
+    requires (axis < shape.rank())
+    constexpr void scan(Tensor<DType, shape>& data, Op op);
+
+    // Running sums and products, carried in the Accumulator type so 16-bit floats round only once per element
+
+    template <tensorRank axis, Scalar DType, auto shape>
+    requires (axis < shape.rank())
+    constexpr void cumsum(const Tensor<DType, shape>& in, Tensor<DType, shape>& out);
+
+    template <tensorRank axis, Scalar DType, auto shape>
+    requires (axis < shape.rank())
+    constexpr void cumsum(Tensor<DType, shape>& data);
+
+    template <tensorRank axis, Scalar DType, auto shape>
+    requires (axis < shape.rank())
+    constexpr void cumprod(const Tensor<DType, shape>& in, Tensor<DType, shape>& out);
+
+    template <tensorRank axis, Scalar DType, auto shape>
+    requires (axis < shape.rank())
+    constexpr void cumprod(Tensor<DType, shape>& data);
+}
+
+#endif //TENSOR_SCAN_H
+
+#include "TensorII/private/templates/Scan.tpp"
@@ -0,0 +1,45 @@
+#ifndef TENSOR_SCATTERCOLOURING_H
+#define TENSOR_SCATTERCOLOURING_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    // The rows of an index tensor, runs of rowLength consecutive indices such as the nodes of each element of a
+    // mesh, split into colours: no two rows of a colour share an index, so a colour's rows can scatter-add in
+    // parallel without atomics. Colours are handed out first fit, at most maxColours of them; any row that
+    // would need another is left uncoloured. Colouring is a pass over every index, so build one per mesh and
+    // reuse it for every assembly.
+    class ScatterColouring {
+    public:
+        static constexpr tensorSize maxColours = 64;
+
+        // indices are rows * rowLength offsets into a field of fieldSize elements
+        ScatterColouring(const std::int32_t* indices, tensorSize rows, tensorSize rowLength, tensorSize fieldSize);
+        ScatterColouring(const std::int64_t* indices, tensorSize rows, tensorSize rowLength, tensorSize fieldSize);
+
+        [[nodiscard]] tensorSize rows() const noexcept { return rows_; }
+        [[nodiscard]] tensorSize rowLength() const noexcept { return rowLength_; }
+        [[nodiscard]] tensorSize colours() const noexcept { return starts_.size() - 2; }
+
+        // In increasing order
+        [[nodiscard]] std::span<const tensorSize> rowsOf(tensorSize colour) const noexcept;
+        [[nodiscard]] std::span<const tensorSize> uncoloured() const noexcept;
+
+    private:
+        template <typename Index>
+        void colour(const Index* indices, tensorSize fieldSize);
+
+        tensorSize rows_;
+        tensorSize rowLength_;
+        // Rows by colour, the uncoloured last, and where each colour starts with one past the end to close it
+        std::vector<tensorSize> order_;
+        std::vector<tensorSize> starts_;
+    };
+}
+
+#endif //TENSOR_SCATTERCOLOURING_H
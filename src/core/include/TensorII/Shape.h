@@ -40,7 +40,7 @@ namespace TensorII::Core {
 
     template <tensorRank rank_>
     struct Shape {
-        std::array<tensorDimension, std::max(rank_, 1U)> dimensions;
+        std::array<tensorDimension, std::max<tensorRank>(rank_, 1)> dimensions;
 
         constexpr Shape();
         constexpr ~Shape() = default;
@@ -0,0 +1,55 @@
+#ifndef TENSOR_SORT_H
+#define TENSOR_SORT_H
+
+#include <concepts>
+
+#include "TensorII/Shape.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    // Sorting along one axis of a tensor, every sequence along it on its own, e.g. the bands of each pixel.
+    // NaNs order after everything else; elements that compare equal keep the order of their positions, so
+    // argsort and topk are stable.
+    //
+    // float and double sequences of up to 64 elements, such as band counts, are sorted sortLanes at a time by
+    // a SIMD sorting network, laid side by side so each compare-exchange is a vector min and max. Longer
+    // sequences are comparison sorted, shared out between hardware threads; a single long sequence is split
+    // into a sorted chunk per thread, and the chunks merged.
+
+    // Ascending
+    template <tensorRank axis, Scalar DType, auto shape>
+    requires (axis < shape.rank())
+    constexpr void sort(const Tensor<DType, shape>& in, Tensor<DType, shape>& out);
+
+    template <tensorRank axis, Scalar DType, auto shape>
+    requires (axis < shape.rank())
+    constexpr void sort(Tensor<DType, shape>& data);
+
+    // The positions along the axis that sort each sequence: in[..., indices[..., i, ...], ...] ascends with i
+    template <tensorRank axis, Scalar DType, auto shape, std::integral Index>
+    requires (axis < shape.rank())
+    constexpr void argsort(const Tensor<DType, shape>& in, Tensor<Index, shape>& indices);
+
+    namespace Private {
+        // 'shape' with k along 'axis'
+        template <auto shape, tensorRank axis, tensorSize k>
+        constexpr auto withExtent() noexcept {
+            auto result = shape;
+            result.dimensions[axis] = static_cast<tensorDimension>(k);
+            return result;
+        }
+    }
+
+    // The k largest along the axis, largest first, and their positions along it. NaNs are taken only when
+    // there's nothing else left.
+    template <tensorSize k, tensorRank axis, Scalar DType, auto shape, std::integral Index>
+    requires (axis < shape.rank() && k <= static_cast<tensorSize>(shape[axis]))
+    constexpr void topk(const Tensor<DType, shape>& in, Tensor<DType, Private::withExtent<shape, axis, k>()>& values,
+                        Tensor<Index, Private::withExtent<shape, axis, k>()>& indices);
+}
+
+#endif //TENSOR_SORT_H
+
+#include "TensorII/private/templates/Sort.tpp"
@@ -0,0 +1,111 @@
+#ifndef TENSOR_SPARSE_H
+#define TENSOR_SPARSE_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    // Coordinate list, one index and value per nonzero in the order they were inserted. Indices may repeat,
+    // repeats summing. Cheap to build an element at a time; compress into a CsrTensor to compute with.
+    template <Scalar DType, auto shape_>
+    class CooTensor {
+    public:
+        using Index = std::array<tensorSize, shape_.rank()>;
+
+        static constexpr Shape<shape_.rank()> shape() { return shape_; }
+        [[nodiscard]] tensorSize nonzeros() const noexcept { return values_.size(); }
+
+        void reserve(tensorSize count);
+        void clear() noexcept;
+
+        // Throws std::out_of_range if an index lies outside the shape
+        template<std::convertible_to<tensorSize> ... Indices>
+        requires (sizeof...(Indices) == shape_.rank())
+        void insert(DType value, const Indices& ... indices);
+
+        const std::vector<Index>& indices() const noexcept { return indices_; }
+        const std::vector<DType>& values() const noexcept { return values_; }
+
+    private:
+        std::vector<Index> indices_;
+        std::vector<DType> values_;
+    };
+
+    // Compressed sparse rows: the tensor as a matrix of shape[0] rows by the product of the other axes, in
+    // row-major order, with each row's nonzeros stored together in column order. Columns are 32-bit where
+    // they fit, so a nonzero float costs 8 bytes and the offsets 8 bytes a row.
+    template <Scalar DType, auto shape_>
+    requires (shape_.rank() >= 2)
+    class CsrTensor {
+    public:
+        static constexpr tensorSize rows = static_cast<tensorSize>(shape_[0]);
+        static constexpr tensorSize columns = shape_.n_elems() / rows;
+        using Column = std::conditional_t<columns <= static_cast<tensorSize>(std::numeric_limits<int32_t>::max()), uint32_t, uint64_t>;
+
+        // All zeros
+        CsrTensor();
+        // Takes arrays already in CSR form: rows + 1 ascending offsets from 0 to the number of nonzeros, and
+        // within each row ascending columns. Throws std::invalid_argument if they aren't.
+        CsrTensor(std::vector<tensorSize> rowOffsets, std::vector<Column> columnIndices, std::vector<DType> values);
+
+        static constexpr Shape<shape_.rank()> shape() { return shape_; }
+        [[nodiscard]] tensorSize nonzeros() const noexcept { return values_.size(); }
+        // Heap memory held, to compare against sizeof the dense Tensor
+        [[nodiscard]] tensorSize size_in_bytes() const noexcept;
+
+        const std::vector<tensorSize>& rowOffsets() const noexcept { return rowOffsets_; }
+        const std::vector<Column>& columnIndices() const noexcept { return columns_; }
+        const std::vector<DType>& values() const noexcept { return values_; }
+
+        // Value of one element, zero if it isn't stored. A binary search of its row.
+        template<std::convertible_to<tensorSize> ... Indices>
+        requires (sizeof...(Indices) == shape_.rank())
+        DType at(const Indices& ... indices) const;
+
+    private:
+        std::vector<tensorSize> rowOffsets_;
+        std::vector<Column> columns_;
+        std::vector<DType> values_;
+    };
+
+    // Every element of 'dense' that isn't zero
+    template <Scalar DType, auto shape>
+    void sparsify(const Tensor<DType, shape>& dense, CooTensor<DType, shape>& out);
+
+    template <Scalar DType, auto shape>
+    void sparsify(const Tensor<DType, shape>& dense, CsrTensor<DType, shape>& out);
+
+    // Sorts the entries into rows and columns, summing repeats
+    template <Scalar DType, auto shape>
+    void compress(const CooTensor<DType, shape>& in, CsrTensor<DType, shape>& out);
+
+    template <Scalar DType, auto shape>
+    void densify(const CooTensor<DType, shape>& in, Tensor<DType, shape>& out);
+
+    template <Scalar DType, auto shape>
+    void densify(const CsrTensor<DType, shape>& in, Tensor<DType, shape>& out);
+
+    namespace Private {
+        template <auto sparseShape, auto denseShape, auto outShape>
+        constexpr bool sparseContractable() noexcept;
+    }
+
+    // Contracts every axis of 'sparse' but the first with the leading axes of 'dense':
+    // out(i, rest...) = sum over j... of sparse(i, j...) * dense(j..., rest...). A dense vector or matrix gives
+    // the usual sparse matrix-vector and matrix-matrix products. Rows are shared out between hardware threads
+    // so each gets about the same number of nonzeros, however unevenly they're spread over the rows.
+    template <Scalar DType, auto sparseShape, auto denseShape, auto outShape>
+    requires (Private::sparseContractable<sparseShape, denseShape, outShape>())
+    void contract(const CsrTensor<DType, sparseShape>& sparse, const Tensor<DType, denseShape>& dense, Tensor<DType, outShape>& out);
+}
+
+#endif //TENSOR_SPARSE_H
+
+#include "TensorII/private/templates/Sparse.tpp"
@@ -0,0 +1,58 @@
+#ifndef TENSOR_STENCIL_H
+#define TENSOR_STENCIL_H
+
+#include <array>
+
+#include "TensorII/Boundary.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core {
+
+    // Points of a finite difference stencil, offsets from the element being updated and their weights.
+    // Passed as a template argument, so every offset and coefficient is a constant in the generated loops.
+    template <tensorRank rank_, tensorSize points_>
+    struct Stencil {
+        std::array<std::array<tensorIndex, rank_>, points_> offsets;
+        std::array<double, points_> coefficients;
+
+        static constexpr tensorRank rank() noexcept { return rank_; }
+        static constexpr tensorSize points() noexcept { return points_; }
+
+        // Largest offset along any axis
+        constexpr tensorIndex radius() const noexcept;
+    };
+
+    namespace Private {
+        constexpr tensorSize densePoints(tensorRank rank, tensorIndex radius) noexcept;
+    }
+
+    namespace Stencils {
+        // Second order Laplacian, 5 points in 2D and 7 in 3D
+        template <tensorRank rank>
+        constexpr Stencil<rank, 2 * rank + 1> laplacian(double spacing = 1.0);
+
+        // Every point of the (2 * radius + 1)^rank cube, weights given in row-major order
+        template <tensorRank rank, tensorIndex radius, tensorSize points = Private::densePoints(rank, radius)>
+        constexpr Stencil<rank, points> dense(const std::array<double, points>& weights);
+    }
+
+    // out = stencil applied to in, which must not alias. Interior elements, those whose every point lies inside
+    // the grid, take no branches and vectorise along the innermost axis; boundaryValue is the Dirichlet value.
+    template <auto stencil, Boundary boundary = Boundary::Dirichlet, Scalar DType, auto shape>
+    requires (stencil.rank() == shape.rank())
+    constexpr void applyStencil(const Tensor<DType, shape>& in, Tensor<DType, shape>& out, DType boundaryValue = DType {});
+
+    // Applies the stencil 'steps' times, leaving the result in 'field'. 'scratch' is overwritten.
+    // Steps are fused timeBlock at a time into a wavefront along the first axis, so each plane is read from
+    // cache by every step in the block rather than from memory. Periodic boundaries join the first plane to
+    // the last, so they step one at a time.
+    template <auto stencil, Boundary boundary = Boundary::Dirichlet, tensorSize timeBlock = 4, Scalar DType, auto shape>
+    requires (stencil.rank() == shape.rank() && timeBlock > 0)
+    constexpr void iterateStencil(Tensor<DType, shape>& field, Tensor<DType, shape>& scratch, tensorSize steps,
+                                  DType boundaryValue = DType {});
+}
+
+#endif //TENSOR_STENCIL_H
+
+#include "TensorII/private/templates/Stencil.tpp"
@@ -10,16 +10,22 @@
 
 #include "TensorII/Types.h"
 #include "TensorII/private/Tensor_predecl.h"
+#include "TensorII/Layout.h"
 #include "TensorII/Shape.h"
 #include "TensorII/TensorDType.h"
+#include "TensorII/private/Indexed.h"
 #include "TensorII/private/TensorInitializer.h"
 #include "TensorII/private/TensorIndex.h"
 
 namespace TensorII::Core {
 
-    template <Scalar DType, auto shape_>
+    template <Scalar DType, auto shape_, TensorLayout Layout_>
     class Tensor{
+        static_assert(Layout_::template fits<shape_>(), "Layout does not fit the shape, e.g. tiles which don't divide it");
     public:
+        using Layout = Layout_;
+
+        // Initializers and ranges are always in row-major order, whatever the layout they are stored in
         constexpr Tensor();
         explicit constexpr Tensor(typename Private::TensorInitializer<DType, shape_>::Array&);
         explicit constexpr Tensor(Private::TensorInitializer<DType, shape_>&&);
@@ -39,12 +45,47 @@ namespace TensorII::Core {
         static constexpr tensorSize size() noexcept;
         static constexpr tensorSize size_in_bytes() noexcept;
 
+        // Storage, in the order given by Layout
         constexpr DType* data() noexcept;
         constexpr const DType* data() const noexcept;
 
+        // Where an element lives in data(), resolved at compile time apart from the indices themselves
+        template <std::convertible_to<tensorSize> ... Indices>
+        requires (sizeof...(Indices) == shape_.rank())
+        static constexpr tensorSize offset(const Indices& ... indices) noexcept;
+
+        template <std::convertible_to<tensorSize> ... Indices>
+        requires (sizeof...(Indices) == shape_.rank())
+        constexpr DType& at(const Indices& ... indices) noexcept;
+
+        template <std::convertible_to<tensorSize> ... Indices>
+        requires (sizeof...(Indices) == shape_.rank())
+        constexpr const DType& at(const Indices& ... indices) const noexcept;
+
+        // Index notation, e.g. c(i) = epsilon(i, j, k) * a(j) * b(k); see Einstein.h
+        template <char ... names>
+        requires (sizeof...(names) == shape_.rank())
+        constexpr Private::Indexed<Tensor, names...> operator()(Index<names> ...) noexcept;
+
+        template <char ... names>
+        requires (sizeof...(names) == shape_.rank())
+        constexpr Private::Indexed<const Tensor, names...> operator()(Index<names> ...) const noexcept;
+
+        // Calls function(element, index) for every element in storage order, the quickest way through them all
+        // whatever the layout. The index is a std::array.
+        template <typename Function>
+        constexpr void forEachStored(Function&& function);
+
+        template <typename Function>
+        constexpr void forEachStored(Function&& function) const;
+
     private:
         using Array = std::array<DType, size()>;
         Array data_;
+
+        // Writes row-major ordered values to where Layout keeps them
+        template <typename Iterator>
+        constexpr void scatter(Iterator values);
     };
 
     template <Scalar DType, Shape oldShape, Shape newShape>
@@ -5,14 +5,31 @@
 #ifndef TENSOR_TENSORDTYPE_H
 #define TENSOR_TENSORDTYPE_H
 
+#include <complex>
 #include <type_traits>
 #include <concepts>
 
+#include "TensorII/Half.h"
+
 namespace TensorII::Core {
+    namespace Private {
+        template<typename T>
+        struct IsComplex : std::false_type {};
+
+        template<std::floating_point T>
+        struct IsComplex<std::complex<T>> : std::true_type {};
+    }
+
+    // std::complex of float, double or long double
+    template<typename T>
+    concept Complex = Private::IsComplex<T>::value;
+
     template<typename T>
     concept Scalar
             = std::integral<T>
-            || std::floating_point<T>;
+            || std::floating_point<T>
+            || ReducedFloat<T>
+            || Complex<T>;
 
     template<typename Arr>
     concept ScalarArray
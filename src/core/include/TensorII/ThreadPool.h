@@ -0,0 +1,43 @@
+#ifndef TENSOR_THREADPOOL_H
+#define TENSOR_THREADPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace TensorII::Core {
+
+    // Fixed set of threads running submitted tasks in the order they were submitted. A task that throws
+    // terminates the program, as it would on a thread of its own; async ops catch into their futures instead.
+    class ThreadPool {
+    public:
+        // At least one thread
+        explicit ThreadPool(std::size_t threads);
+        // Runs every task already submitted, then joins
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        void submit(std::function<void()> task);
+        [[nodiscard]] std::size_t size() const noexcept { return threads_.size(); }
+
+        // Where async ops run unless given a pool: a thread per hardware thread, started on first use
+        static ThreadPool& shared();
+
+    private:
+        void work();
+
+        std::mutex mutex_;
+        std::condition_variable available_;
+        std::deque<std::function<void()>> tasks_;
+        bool stopping_ = false;
+        std::vector<std::jthread> threads_;
+    };
+}
+
+#endif //TENSOR_THREADPOOL_H
@@ -5,6 +5,8 @@
 #ifndef TENSOR_TYPES_H
 #define TENSOR_TYPES_H
 
+#include <cstddef>
+
 namespace TensorII::Core{
 
     using tensorDimension = long;  // 2^32 = 4G, probably don't need larger
@@ -0,0 +1,29 @@
+#ifndef TENSOR_AXISEXTENTS_H
+#define TENSOR_AXISEXTENTS_H
+
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Private {
+    // Elements before, along and after one axis of a row-major shape. There are outer * inner sequences along
+    // the axis, each n long with its elements inner apart; sequences with the same outer index sit side by side.
+    struct AxisExtents {
+        tensorSize outer;
+        tensorSize n;
+        tensorSize inner;
+    };
+
+    template <auto shape, tensorRank axis>
+    constexpr AxisExtents axisExtentsOf() noexcept {
+        AxisExtents extents {1, static_cast<tensorSize>(shape[axis]), 1};
+        for (tensorRank i = 0; i < shape.rank(); i++) {
+            if (i < axis) {
+                extents.outer *= static_cast<tensorSize>(shape[i]);
+            } else if (i > axis) {
+                extents.inner *= static_cast<tensorSize>(shape[i]);
+            }
+        }
+        return extents;
+    }
+}
+
+#endif //TENSOR_AXISEXTENTS_H
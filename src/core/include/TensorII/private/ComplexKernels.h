@@ -0,0 +1,52 @@
+#ifndef TENSOR_COMPLEXKERNELS_H
+#define TENSOR_COMPLEXKERNELS_H
+
+#include <complex>
+#include <concepts>
+
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Private {
+    // Kernels over complex floats, either interleaved as std::complex stores them or split into planes of real
+    // and imaginary parts. Products are written out rather than left to std::complex, which checks every one
+    // for infinities and NaNs, and use AVX-512 or AVX2 / FMA where the CPU has them.
+
+    template <typename T>
+    concept ComplexKernelScalar = std::same_as<T, std::complex<float>> || std::same_as<T, std::complex<double>>;
+
+    // The two planes of a split complex array
+    template <typename T>
+    struct SplitPlanes {
+        T* real;
+        T* imag;
+    };
+
+    void multiply(const std::complex<float>* lhs, const std::complex<float>* rhs, std::complex<float>* out, tensorSize n);
+    void multiply(const std::complex<double>* lhs, const std::complex<double>* rhs, std::complex<double>* out, tensorSize n);
+    std::complex<float> sum(const std::complex<float>* in, tensorSize n);
+    std::complex<double> sum(const std::complex<double>* in, tensorSize n);
+    std::complex<float> dot(const std::complex<float>* lhs, const std::complex<float>* rhs, tensorSize n);
+    std::complex<double> dot(const std::complex<double>* lhs, const std::complex<double>* rhs, tensorSize n);
+
+    // out[i] = sum over t of weights[t] * sources[t][i], the complex counterpart of the weighted sum of rows in
+    // ConvolutionKernels.h that matrix products run on. out may be one of the sources, but not overlap one at an offset.
+    void weightedSum(const std::complex<float>* const* sources, const std::complex<float>* weights, tensorSize taps,
+                     std::complex<float>* out, tensorSize n);
+    void weightedSum(const std::complex<double>* const* sources, const std::complex<double>* weights, tensorSize taps,
+                     std::complex<double>* out, tensorSize n);
+
+    void multiply(SplitPlanes<const float> lhs, SplitPlanes<const float> rhs, SplitPlanes<float> out, tensorSize n);
+    void multiply(SplitPlanes<const double> lhs, SplitPlanes<const double> rhs, SplitPlanes<double> out, tensorSize n);
+    std::complex<float> sum(SplitPlanes<const float> in, tensorSize n);
+    std::complex<double> sum(SplitPlanes<const double> in, tensorSize n);
+    std::complex<float> dot(SplitPlanes<const float> lhs, SplitPlanes<const float> rhs, tensorSize n);
+    std::complex<double> dot(SplitPlanes<const double> lhs, SplitPlanes<const double> rhs, tensorSize n);
+
+    // Between the two storages
+    void split(const std::complex<float>* in, SplitPlanes<float> out, tensorSize n);
+    void split(const std::complex<double>* in, SplitPlanes<double> out, tensorSize n);
+    void interleave(SplitPlanes<const float> in, std::complex<float>* out, tensorSize n);
+    void interleave(SplitPlanes<const double> in, std::complex<double>* out, tensorSize n);
+}
+
+#endif //TENSOR_COMPLEXKERNELS_H
@@ -0,0 +1,47 @@
+#ifndef TENSOR_CONVOLUTIONKERNELS_H
+#define TENSOR_CONVOLUTIONKERNELS_H
+
+#include "TensorII/Boundary.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Private {
+
+    // Row-major rows x columns x bands, bands innermost
+    struct ImageExtents {
+        tensorSize rows;
+        tensorSize columns;
+        tensorSize bands;
+    };
+
+    // out[i] = sum over t of weights[t] * sources[t][i], for i in [0, n). AVX-512 or AVX2 with FMA where the
+    // CPU has them, with a scalar fallback. out may be one of the sources, but not overlap one at an offset.
+    void weightedSum(const float* const* sources, const float* weights, tensorSize taps, float* out, tensorSize n);
+    void weightedSum(const double* const* sources, const double* weights, tensorSize taps, double* out, tensorSize n);
+
+    // 2D convolution over the rows and columns of every band, with a row-major kernelRows x kernelColumns
+    // kernel centred on its element (kernelRows / 2, kernelColumns / 2). Neither kernel extent may exceed the
+    // image's. Rows are shared out between threads.
+
+    // Every tap of every output element
+    void convolveDirect(const float* in, float* out, ImageExtents extents, const float* kernel,
+                        tensorSize kernelRows, tensorSize kernelColumns, Boundary boundary, float boundaryValue);
+    void convolveDirect(const double* in, double* out, ImageExtents extents, const double* kernel,
+                        tensorSize kernelRows, tensorSize kernelColumns, Boundary boundary, double boundaryValue);
+
+    // Kernel the outer product of columnKernel, along the rows axis, and rowKernel, along the columns axis
+    void convolveSeparable(const float* in, float* out, ImageExtents extents,
+                           const float* columnKernel, tensorSize kernelRows,
+                           const float* rowKernel, tensorSize kernelColumns, Boundary boundary, float boundaryValue);
+    void convolveSeparable(const double* in, double* out, ImageExtents extents,
+                           const double* columnKernel, tensorSize kernelRows,
+                           const double* rowKernel, tensorSize kernelColumns, Boundary boundary, double boundaryValue);
+
+    // Overlap-save over tiles, transformed two bands at a time as the real and imaginary parts of one complex
+    // image. Computed in double precision.
+    void convolveFFT(const float* in, float* out, ImageExtents extents, const float* kernel,
+                     tensorSize kernelRows, tensorSize kernelColumns, Boundary boundary, float boundaryValue);
+    void convolveFFT(const double* in, double* out, ImageExtents extents, const double* kernel,
+                     tensorSize kernelRows, tensorSize kernelColumns, Boundary boundary, double boundaryValue);
+}
+
+#endif //TENSOR_CONVOLUTIONKERNELS_H
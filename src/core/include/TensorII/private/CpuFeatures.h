@@ -0,0 +1,19 @@
+#ifndef TENSOR_CPUFEATURES_H
+#define TENSOR_CPUFEATURES_H
+
+namespace TensorII::Core::Private {
+
+    // Instruction set extensions the SIMD kernels dispatch on, checked once at startup
+    struct CpuFeatures {
+        bool avx2;
+        bool fma;
+        bool f16c;
+        bool avx512f;
+        bool avx512bw;
+        bool avx512vnni;
+    };
+
+    const CpuFeatures& cpuFeatures();
+}
+
+#endif //TENSOR_CPUFEATURES_H
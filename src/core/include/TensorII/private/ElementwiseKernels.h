@@ -0,0 +1,27 @@
+#ifndef TENSOR_ELEMENTWISEKERNELS_H
+#define TENSOR_ELEMENTWISEKERNELS_H
+
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Private {
+    // out[i] = lhs[i] op rhs[i] over float and double, AVX-512 or AVX2 where the CPU has them, with a scalar
+    // fallback. out may be either input, but not overlap one at an offset.
+
+    void add(const float* lhs, const float* rhs, float* out, tensorSize n);
+    void add(const double* lhs, const double* rhs, double* out, tensorSize n);
+    void subtract(const float* lhs, const float* rhs, float* out, tensorSize n);
+    void subtract(const double* lhs, const double* rhs, double* out, tensorSize n);
+    void multiply(const float* lhs, const float* rhs, float* out, tensorSize n);
+    void multiply(const double* lhs, const double* rhs, double* out, tensorSize n);
+    void divide(const float* lhs, const float* rhs, float* out, tensorSize n);
+    void divide(const double* lhs, const double* rhs, double* out, tensorSize n);
+
+    // Sum of in, and of lhs[i] * rhs[i], over float and double, each in several accumulators so the adds overlap.
+    // The order of the adds therefore differs from a serial loop.
+    float sum(const float* in, tensorSize n);
+    double sum(const double* in, tensorSize n);
+    float dot(const float* lhs, const float* rhs, tensorSize n);
+    double dot(const double* lhs, const double* rhs, tensorSize n);
+}
+
+#endif //TENSOR_ELEMENTWISEKERNELS_H
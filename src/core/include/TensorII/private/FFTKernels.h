@@ -0,0 +1,82 @@
+#ifndef TENSOR_FFTKERNELS_H
+#define TENSOR_FFTKERNELS_H
+
+#include <complex>
+#include <vector>
+
+#include "TensorII/Types.h"
+#include "TensorII/private/AxisExtents.h"
+
+namespace TensorII::Core::Private {
+
+    constexpr bool isPowerOfTwo(tensorSize n) noexcept { return n != 0 && (n & (n - 1)) == 0; }
+
+    constexpr tensorSize nextPowerOfTwo(tensorSize n) noexcept {
+        tensorSize power = 1;
+        while (power < n) {
+            power *= 2;
+        }
+        return power;
+    }
+
+    // Lengths FFTPlan can transform, those with no prime factors but 2, 3 and 5
+    constexpr bool isFFTLength(tensorSize n) noexcept {
+        if (n == 0) {
+            return false;
+        }
+        constexpr tensorSize factors[] {2, 3, 5};
+        for (tensorSize factor : factors) {
+            while (n % factor == 0) {
+                n /= factor;
+            }
+        }
+        return n == 1;
+    }
+
+    // Mixed radix 2, 3, 4 and 5 transform of one length, with its twiddle factors and input permutation
+    // worked out once so it can be applied to many sequences
+    class FFTPlan {
+    public:
+        explicit FFTPlan(tensorSize n);
+
+        [[nodiscard]] tensorSize size() const noexcept { return n_; }
+
+        // In place over 'lanes' interleaved sequences, element k of sequence l at data[k * stride + l], so a
+        // whole row of columns is transformed at once. Neither direction is normalised: a forward then an
+        // inverse transform multiplies by n.
+        void transform(std::complex<double>* data, tensorSize lanes, tensorSize stride, bool inverse) const;
+        void transform(std::complex<double>* data, tensorSize lanes, bool inverse) const {
+            transform(data, lanes, lanes, inverse);
+        }
+
+        struct Stage {
+            tensorSize radix;
+            // Length of the transforms this stage combines radix of
+            tensorSize span;
+            // span * (radix - 1) factors, e^(-2 pi i j k / (span * radix)) for k < span and 0 < j < radix
+            std::vector<std::complex<double>> twiddles;
+        };
+
+    private:
+        tensorSize n_;
+        std::vector<Stage> stages_;
+        // The mixed radix digit reversal the stages expect their input in, as cycles laid end to end
+        std::vector<tensorSize> cycles_;
+        std::vector<tensorSize> cycleEnds_;
+    };
+
+    // Complex to complex along the n axis of outer x n x inner elements, 'out' may be 'in'. Inverses are scaled by 1 / n.
+    void fftAxis(const std::complex<float>* in, std::complex<float>* out, AxisExtents extents, const FFTPlan& plan, bool inverse);
+    void fftAxis(const std::complex<double>* in, std::complex<double>* out, AxisExtents extents, const FFTPlan& plan, bool inverse);
+
+    // Real to complex, the n / 2 + 1 non-negative frequencies written along the axis of 'out'
+    void realFFTAxis(const float* in, std::complex<float>* out, AxisExtents extents, const FFTPlan& plan);
+    void realFFTAxis(const double* in, std::complex<double>* out, AxisExtents extents, const FFTPlan& plan);
+
+    // Back from the non-negative frequencies, scaled by 1 / n. The imaginary parts of the 0 and, for even n,
+    // n / 2 frequencies are taken to be 0.
+    void inverseRealFFTAxis(const std::complex<float>* in, float* out, AxisExtents extents, const FFTPlan& plan);
+    void inverseRealFFTAxis(const std::complex<double>* in, double* out, AxisExtents extents, const FFTPlan& plan);
+}
+
+#endif //TENSOR_FFTKERNELS_H
@@ -0,0 +1,17 @@
+#ifndef TENSOR_GATHERKERNELS_H
+#define TENSOR_GATHERKERNELS_H
+
+#include <cstdint>
+
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Private {
+    // out[i] = field[indices[i]], a vector of loads per gather instruction under AVX2 or AVX-512. Indices must
+    // be within field.
+    void gather(const float* field, const std::int32_t* indices, float* out, tensorSize n);
+    void gather(const float* field, const std::int64_t* indices, float* out, tensorSize n);
+    void gather(const double* field, const std::int32_t* indices, double* out, tensorSize n);
+    void gather(const double* field, const std::int64_t* indices, double* out, tensorSize n);
+}
+
+#endif //TENSOR_GATHERKERNELS_H
@@ -0,0 +1,30 @@
+#ifndef TENSOR_HALFKERNELS_H
+#define TENSOR_HALFKERNELS_H
+
+#include "TensorII/Half.h"
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Private {
+    // Kernels over packed 16-bit floats. Each widens to fp32 in registers, computes, and narrows on store,
+    // using F16C / AVX2 or AVX-512 where the CPU has them.
+
+    void widen(const float16* in, float* out, tensorSize n);
+    void widen(const bfloat16* in, float* out, tensorSize n);
+    void narrow(const float* in, float16* out, tensorSize n);
+    void narrow(const float* in, bfloat16* out, tensorSize n);
+
+    void add(const float16* lhs, const float16* rhs, float16* out, tensorSize n);
+    void add(const bfloat16* lhs, const bfloat16* rhs, bfloat16* out, tensorSize n);
+    void subtract(const float16* lhs, const float16* rhs, float16* out, tensorSize n);
+    void subtract(const bfloat16* lhs, const bfloat16* rhs, bfloat16* out, tensorSize n);
+    void multiply(const float16* lhs, const float16* rhs, float16* out, tensorSize n);
+    void multiply(const bfloat16* lhs, const bfloat16* rhs, bfloat16* out, tensorSize n);
+
+    // Accumulated in fp32
+    float sum(const float16* in, tensorSize n);
+    float sum(const bfloat16* in, tensorSize n);
+    float dot(const float16* lhs, const float16* rhs, tensorSize n);
+    float dot(const bfloat16* lhs, const bfloat16* rhs, tensorSize n);
+}
+
+#endif //TENSOR_HALFKERNELS_H
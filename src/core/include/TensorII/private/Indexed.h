@@ -0,0 +1,29 @@
+#ifndef TENSOR_INDEXED_H
+#define TENSOR_INDEXED_H
+
+namespace TensorII::Core {
+
+    // An index of index notation, e.g. the i of a(i) * b(i); the usual ones are in Einstein.h
+    template <char name>
+    struct Index {};
+
+    namespace Private {
+        // A tensor with an index on each axis, one factor of an index notation expression. Assigning an
+        // expression to it evaluates the expression, which needs Einstein.h.
+        template <typename TensorType, char ... names>
+        struct Indexed {
+            constexpr explicit Indexed(TensorType& indexed) noexcept : tensor(indexed) {}
+            constexpr Indexed(const Indexed&) noexcept = default;
+
+            constexpr Indexed& operator=(const Indexed& expression);
+            template <typename Expression>
+            constexpr Indexed& operator=(const Expression& expression);
+            template <typename Expression>
+            constexpr Indexed& operator+=(const Expression& expression);
+
+            TensorType& tensor;
+        };
+    }
+}
+
+#endif //TENSOR_INDEXED_H
@@ -0,0 +1,41 @@
+#ifndef TENSOR_MASKKERNELS_H
+#define TENSOR_MASKKERNELS_H
+
+#include <cstdint>
+
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Private {
+    // Kernels under a packed mask, element i selected by bit i % 64 of mask[i / 64]. AVX-512 takes each vector's
+    // worth of bits, 8 to 64 of them, as a mask register, which for 8 and 16-bit integers needs AVX-512BW; AVX2
+    // spreads them into lanes of all ones or zeros and blends or ands with those. Signed integers share the
+    // kernels of unsigned ones of their width.
+
+    // out[i] = bit ? whereSet[i] : whereClear[i], out may alias either input
+    void select(const std::uint64_t* mask, const float* whereSet, const float* whereClear, float* out, tensorSize n);
+    void select(const std::uint64_t* mask, const double* whereSet, const double* whereClear, double* out, tensorSize n);
+    void select(const std::uint64_t* mask, const std::uint8_t* whereSet, const std::uint8_t* whereClear, std::uint8_t* out, tensorSize n);
+    void select(const std::uint64_t* mask, const std::uint16_t* whereSet, const std::uint16_t* whereClear, std::uint16_t* out, tensorSize n);
+    void select(const std::uint64_t* mask, const std::int8_t* whereSet, const std::int8_t* whereClear, std::int8_t* out, tensorSize n);
+    void select(const std::uint64_t* mask, const std::int16_t* whereSet, const std::int16_t* whereClear, std::int16_t* out, tensorSize n);
+
+    // data[i] = value where the bit is set, others left as they are. AVX2 has no byte or word masked store, so
+    // for 8 and 16-bit integers it writes those back with their own values.
+    void fill(const std::uint64_t* mask, float value, float* data, tensorSize n);
+    void fill(const std::uint64_t* mask, double value, double* data, tensorSize n);
+    void fill(const std::uint64_t* mask, std::uint8_t value, std::uint8_t* data, tensorSize n);
+    void fill(const std::uint64_t* mask, std::uint16_t value, std::uint16_t* data, tensorSize n);
+    void fill(const std::uint64_t* mask, std::int8_t value, std::int8_t* data, tensorSize n);
+    void fill(const std::uint64_t* mask, std::int16_t value, std::int16_t* data, tensorSize n);
+
+    // Sum of the elements selected, those not selected are never added so may be NaN. Integers wrap in their
+    // own width.
+    float maskedSum(const std::uint64_t* mask, const float* in, tensorSize n);
+    double maskedSum(const std::uint64_t* mask, const double* in, tensorSize n);
+    std::uint8_t maskedSum(const std::uint64_t* mask, const std::uint8_t* in, tensorSize n);
+    std::uint16_t maskedSum(const std::uint64_t* mask, const std::uint16_t* in, tensorSize n);
+    std::int8_t maskedSum(const std::uint64_t* mask, const std::int8_t* in, tensorSize n);
+    std::int16_t maskedSum(const std::uint64_t* mask, const std::int16_t* in, tensorSize n);
+}
+
+#endif //TENSOR_MASKKERNELS_H
@@ -0,0 +1,63 @@
+#ifndef TENSOR_PARALLEL_H
+#define TENSOR_PARALLEL_H
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Private {
+
+    // Threads the caller may share work between: one per hardware thread, or, on a ThreadPool worker, its share
+    // of them, so async ops running side by side don't each start a thread per core. Defined with ThreadPool.
+    tensorSize threadBudget();
+
+    // Fewest elements worth a thread of their own, for passes doing a few operations per element. Drivers doing
+    // more per element, or per unit of a coarser split, scale it down by that.
+    inline constexpr tensorSize parallelGrain = 16384;
+
+    // How many chunks of at least 'grain' to split 'count' units of work into, at most one per thread of the budget
+    inline tensorSize parallelChunks(tensorSize count, tensorSize grain) {
+        return std::clamp<tensorSize>(count / std::max<tensorSize>(grain, 1), 1, threadBudget());
+    }
+
+    // Splits [0, count) into parallelChunks(count, grain) contiguous chunks and runs function(begin, end) on each.
+    // The calling thread takes the first chunk and returns once all are done. If any chunk throws, the rest still
+    // run to the end, and the exception of the first chunk to throw, by position, is rethrown on the caller.
+    template <typename Function>
+    void parallelFor(tensorSize count, tensorSize grain, Function&& function) {
+        const tensorSize chunks = parallelChunks(count, grain);
+        const auto boundary = [&](tensorSize chunk) { return count * chunk / chunks; };
+
+        std::vector<std::exception_ptr> failures (chunks);
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(chunks - 1);
+            for (tensorSize chunk = 1; chunk < chunks; chunk++) {
+                workers.emplace_back([&function, &failure = failures[chunk], begin = boundary(chunk), end = boundary(chunk + 1)] {
+                    try {
+                        function(begin, end);
+                    } catch (...) {
+                        failure = std::current_exception();
+                    }
+                });
+            }
+            if (count > 0) {
+                try {
+                    function(0, boundary(1));
+                } catch (...) {
+                    failures[0] = std::current_exception();
+                }
+            }
+        }
+        for (const std::exception_ptr& failure : failures) {
+            if (failure) {
+                std::rethrow_exception(failure);
+            }
+        }
+    }
+}
+
+#endif //TENSOR_PARALLEL_H
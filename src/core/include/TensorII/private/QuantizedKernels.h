@@ -0,0 +1,25 @@
+#ifndef TENSOR_QUANTIZEDKERNELS_H
+#define TENSOR_QUANTIZEDKERNELS_H
+
+#include <cstdint>
+
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Private {
+    // Exact integer kernels over quantized values, accumulated in 64 bits. 8-bit dot products use
+    // AVX-512 VNNI where the CPU has it, everything has an AVX2 path and a scalar fallback.
+
+    int64_t sum(const int8_t* in, tensorSize n);
+    int64_t sum(const uint8_t* in, tensorSize n);
+    int64_t sum(const int16_t* in, tensorSize n);
+    int64_t sum(const uint16_t* in, tensorSize n);
+    int64_t sum(const int32_t* in, tensorSize n);
+
+    int64_t dot(const int8_t* lhs, const int8_t* rhs, tensorSize n);
+    int64_t dot(const uint8_t* lhs, const uint8_t* rhs, tensorSize n);
+    int64_t dot(const int16_t* lhs, const int16_t* rhs, tensorSize n);
+    int64_t dot(const uint16_t* lhs, const uint16_t* rhs, tensorSize n);
+    int64_t dot(const int32_t* lhs, const int32_t* rhs, tensorSize n);
+}
+
+#endif //TENSOR_QUANTIZEDKERNELS_H
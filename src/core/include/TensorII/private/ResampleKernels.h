@@ -0,0 +1,46 @@
+#ifndef TENSOR_RESAMPLEKERNELS_H
+#define TENSOR_RESAMPLEKERNELS_H
+
+#include <algorithm>
+
+#include "TensorII/Boundary.h"
+#include "TensorII/Interpolation.h"
+#include "TensorII/Types.h"
+#include "TensorII/private/ConvolutionKernels.h"
+#include "TensorII/private/Parallel.h"
+
+namespace TensorII::Core::Private {
+
+    // Coordinates are clamped to this far out, so they always convert to an index
+    inline constexpr double farthestCoordinate = 1e15;
+
+    // Output rows per thread: parallelGrain output elements' worth
+    inline tensorSize resampleRowGrain(ImageExtents outExtents) {
+        return std::max<tensorSize>(1, parallelGrain / std::max<tensorSize>(outExtents.columns * outExtents.bands, 1));
+    }
+
+    // Bilinear and bicubic resampling of every band of a row-major rows x columns x bands image. Source
+    // positions are in pixels with the centres on whole numbers, and the boundary decides what taps beyond
+    // the image read. Output rows are shared out between threads.
+
+    // Onto a grid over the same area, outer edges aligned: first every needed source row blended into one
+    // row with the weights of the output row, a SIMD vector of columns and bands at a time, then that row's
+    // columns blended into each output pixel
+    void resize(const float* in, ImageExtents inExtents, float* out, ImageExtents outExtents,
+                Interpolation interpolation, Boundary boundary, float boundaryValue);
+    void resize(const double* in, ImageExtents inExtents, double* out, ImageExtents outExtents,
+                Interpolation interpolation, Boundary boundary, double boundaryValue);
+
+    // Output pixel i sampled at source (row, column) = (coordinates[2i], coordinates[2i + 1]). A NaN coordinate
+    // gives boundaryValue.
+    void warp(const float* in, ImageExtents inExtents, const float* coordinates, float* out, ImageExtents outExtents,
+              Interpolation interpolation, Boundary boundary, float boundaryValue);
+    void warp(const float* in, ImageExtents inExtents, const double* coordinates, float* out, ImageExtents outExtents,
+              Interpolation interpolation, Boundary boundary, float boundaryValue);
+    void warp(const double* in, ImageExtents inExtents, const float* coordinates, double* out, ImageExtents outExtents,
+              Interpolation interpolation, Boundary boundary, double boundaryValue);
+    void warp(const double* in, ImageExtents inExtents, const double* coordinates, double* out, ImageExtents outExtents,
+              Interpolation interpolation, Boundary boundary, double boundaryValue);
+}
+
+#endif //TENSOR_RESAMPLEKERNELS_H
@@ -0,0 +1,14 @@
+#ifndef TENSOR_SCANKERNELS_H
+#define TENSOR_SCANKERNELS_H
+
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Private {
+    // Running sums of one contiguous sequence, out[i] = in[0] + ... + in[i]. Each vector of the input is scanned
+    // in registers by log2(lanes) shifted adds, then offset by the total so far, which is all that's carried
+    // from one vector to the next. in and out may be the same array.
+    void inclusiveSum(const float* in, float* out, tensorSize n);
+    void inclusiveSum(const double* in, double* out, tensorSize n);
+}
+
+#endif //TENSOR_SCANKERNELS_H
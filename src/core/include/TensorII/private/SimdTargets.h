@@ -0,0 +1,32 @@
+#ifndef TENSOR_SIMDTARGETS_H
+#define TENSOR_SIMDTARGETS_H
+
+// Target attributes for the SIMD kernels, which are compiled for every instruction set they use and chosen between
+// at runtime on cpuFeatures(). Only included from the kernel translation units.
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define TENSORII_SIMD_KERNELS
+#define TENSORII_TARGET_AVX2 __attribute__((target("avx2")))
+#define TENSORII_TARGET_AVX2_FMA __attribute__((target("avx2,fma")))
+#define TENSORII_TARGET_AVX2_F16C __attribute__((target("avx2,fma,f16c")))
+#define TENSORII_TARGET_AVX512 __attribute__((target("avx512f")))
+#define TENSORII_TARGET_AVX512_BW __attribute__((target("avx512f,avx512bw")))
+#define TENSORII_TARGET_AVX512_VNNI __attribute__((target("avx512f,avx512bw,avx512vnni")))
+#endif
+
+// Around code inlining AVX-512 operations. GCC 12 flags the _mm512_undefined placeholders inside its own intrinsics
+// (GCC bug 105593), and notes an ABI change wherever a helper takes a vector without targeting AVX itself; those
+// helpers are only ever inlined into functions that do, so no vector crosses a call.
+#if defined(__GNUC__)
+#define TENSORII_SIMD_WARNINGS_PUSH \
+    _Pragma("GCC diagnostic push") \
+    _Pragma("GCC diagnostic ignored \"-Wmaybe-uninitialized\"") \
+    _Pragma("GCC diagnostic ignored \"-Wuninitialized\"") \
+    _Pragma("GCC diagnostic ignored \"-Wpsabi\"")
+#define TENSORII_SIMD_WARNINGS_POP _Pragma("GCC diagnostic pop")
+#else
+#define TENSORII_SIMD_WARNINGS_PUSH
+#define TENSORII_SIMD_WARNINGS_POP
+#endif
+
+#endif //TENSOR_SIMDTARGETS_H
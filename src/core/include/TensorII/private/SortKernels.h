@@ -0,0 +1,24 @@
+#ifndef TENSOR_SORTKERNELS_H
+#define TENSOR_SORTKERNELS_H
+
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Private {
+    // Sorting networks over blocks of sortLanes sequences laid side by side: element k of sequence l at
+    // block[k * sortLanes + l]. One fixed network of compare-exchanges (Batcher's odd-even merge sort) sorts
+    // every sequence of the block at once, each compare-exchange a min and max, or compare and blends, of whole
+    // vectors. No branch depends on the data.
+    inline constexpr tensorSize sortLanes = 16;
+    // Longest sequences sorted by network, beyond which comparison sorts win
+    inline constexpr tensorSize sortNetworkMost = 64;
+
+    // Each sequence of n <= sortNetworkMost keys ascending. NaNs are not allowed.
+    void sortBlock(float* keys, tensorSize n);
+    void sortBlock(double* keys, tensorSize n);
+
+    // Ascending by key, then by payload, each payload moving with its key. NaNs are not allowed in either.
+    void sortBlock(float* keys, float* payload, tensorSize n);
+    void sortBlock(double* keys, double* payload, tensorSize n);
+}
+
+#endif //TENSOR_SORTKERNELS_H
@@ -0,0 +1,27 @@
+#ifndef TENSOR_SPARSEKERNELS_H
+#define TENSOR_SPARSEKERNELS_H
+
+#include <cstdint>
+
+#include "TensorII/Types.h"
+
+namespace TensorII::Core::Private {
+
+    // The arrays of a compressed sparse row matrix
+    template <typename T, typename Column>
+    struct CsrArrays {
+        const tensorSize* rowOffsets;
+        const Column* columns;
+        const T* values;
+        tensorSize rows;
+    };
+
+    // out (rows x n) = sparse (rows x k) * dense (k x n), both dense matrices row-major. Threads take rows
+    // holding about equal numbers of nonzeros.
+    void multiplyCsr(CsrArrays<float, uint32_t> sparse, const float* dense, tensorSize n, float* out);
+    void multiplyCsr(CsrArrays<float, uint64_t> sparse, const float* dense, tensorSize n, float* out);
+    void multiplyCsr(CsrArrays<double, uint32_t> sparse, const double* dense, tensorSize n, double* out);
+    void multiplyCsr(CsrArrays<double, uint64_t> sparse, const double* dense, tensorSize n, double* out);
+}
+
+#endif //TENSOR_SPARSEKERNELS_H
@@ -8,6 +8,7 @@
 #include <type_traits>
 #include <exception>
 #include <optional>
+#include <cstring>
 #include "TensorII/private/Tensor_predecl.h"
 #include "TensorII/Shape.h"
 #include "TensorII/TensorDType.h"
@@ -28,6 +29,13 @@ namespace TensorII::Core::Private {
         const DType value;
         using Array = DType;
 
+        static constexpr DType* flatten(const Array& array, DType* out) {
+            *out = array;
+            return out + 1;
+        }
+
+        constexpr void copyTo(DType* out) const { flatten(value, out); }
+
         class Iterator{
         public:
             using iterator_category = std::forward_iterator_tag;
@@ -78,7 +86,7 @@ namespace TensorII::Core::Private {
     struct TensorInitializer<DType, shape, axis> {
     private:
         template <Scalar, Shape, tensorRank> friend class TensorInitializer;
-        friend class Tensor<DType, shape>;
+        template <Scalar, auto, TensorLayout> friend class Core::Tensor;
 
         using LowerArray = typename TensorInitializer<DType, shape, axis + 1>::Array;
         using Array = LowerArray const [shape[axis]];
@@ -95,6 +103,29 @@ namespace TensorII::Core::Private {
             // It's not technically recursion. Also, there's no runtime cost. ¯\_('_')_/¯
         }
 
+        // Copies the nested array into contiguous memory, returning one past the last element written.
+        // Each element is visited exactly once, so constant evaluation is linear in the number of elements,
+        // unlike stepping an Iterator which re-indexes from the outermost axis every time.
+        static constexpr DType* flatten(const Array& array, DType* out) {
+            for (const LowerArray& lower : array) {
+                if constexpr (axis + 1 == shape.rank()) {
+                    *out++ = lower;
+                } else {
+                    out = TensorInitializer<DType, shape, axis + 1>::flatten(lower, out);
+                }
+            }
+            return out;
+        }
+
+        constexpr void copyTo(DType* out) const {
+            if (std::is_constant_evaluated()) {
+                flatten(values, out);
+                return;
+            }
+            // Nested c-arrays are contiguous at runtime
+            std::memcpy(out, &values, shape.n_elems() * sizeof(DType));
+        }
+
         class Iterator{
         public:
             static_assert(axis == 0);
@@ -137,11 +168,9 @@ namespace TensorII::Core::Private {
                         } else {
                             keep_going = false;
                         }
-                        ptr = at(*underlying, indecies);
-                    }
-                    if (keep_going) {
-                        ptr = nullptr; // denotes end
                     }
+                    // Only re-index once the carry has settled
+                    ptr = keep_going ? nullptr : at(*underlying, indecies); // nullptr denotes end
                 } else {
                     ptr++;
                 }
@@ -5,11 +5,12 @@
 #ifndef TENSOR_TENSOR_PREDECL_H
 #define TENSOR_TENSOR_PREDECL_H
 
+#include "TensorII/Layout.h"
 #include "TensorII/TensorDType.h"
 #include "memory"
 
 namespace TensorII::Core {
-    template <Scalar DType, auto shape_>
+    template <Scalar DType, auto shape_, TensorLayout Layout_ = RowMajor>
     class Tensor;
 }
 
@@ -0,0 +1,63 @@
+#ifndef TENSOR_ASYNC_TPP
+#define TENSOR_ASYNC_TPP
+
+#include "TensorII/Async.h"
+
+#include <ios>
+
+#include "TensorII/Instrumentation.h"
+
+namespace TensorII::Core {
+
+    template <Scalar DType, auto shape, TensorLayout Layout, typename ... Dependencies>
+    Future<Accumulator<DType>> sumAsync(ThreadPool& pool, const Tensor<DType, shape, Layout>& tensor,
+                                        const Future<Dependencies>& ... after) {
+        return async(pool, [&tensor] { return sum(tensor); }, after...);
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout, typename ... Dependencies>
+    Future<Accumulator<DType>> dotAsync(ThreadPool& pool, const Tensor<DType, shape, Layout>& lhs,
+                                        const Tensor<DType, shape, Layout>& rhs, const Future<Dependencies>& ... after) {
+        return async(pool, [&lhs, &rhs] { return dot(lhs, rhs); }, after...);
+    }
+
+    template <Scalar DType, auto sparseShape, auto denseShape, auto outShape, typename ... Dependencies>
+    requires (Private::sparseContractable<sparseShape, denseShape, outShape>())
+    Future<void> contractAsync(ThreadPool& pool, const CsrTensor<DType, sparseShape>& sparse,
+                               const Tensor<DType, denseShape>& dense, Tensor<DType, outShape>& out,
+                               const Future<Dependencies>& ... after) {
+        return async(pool, [&sparse, &dense, &out] { contract(sparse, dense, out); }, after...);
+    }
+
+    template <Scalar DType, auto shape, TensorLayout From, TensorLayout To, typename ... Dependencies>
+    Future<void> copyAsync(ThreadPool& pool, const Tensor<DType, shape, From>& in, Tensor<DType, shape, To>& out,
+                           const Future<Dependencies>& ... after) {
+        return async(pool, [&in, &out] { relayout(in, out); }, after...);
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout, typename ... Dependencies>
+    Future<void> writeAsync(ThreadPool& pool, std::ostream& stream, const Tensor<DType, shape, Layout>& tensor,
+                            const Future<Dependencies>& ... after) {
+        return async(pool, [&stream, &tensor] {
+            TENSORII_INSTRUMENT_OP("write", IO, tensor.size(), tensor.size_in_bytes());
+            stream.write(reinterpret_cast<const char*>(tensor.data()), static_cast<std::streamsize>(tensor.size_in_bytes()));
+            if (!stream) {
+                throw std::ios_base::failure("Failed to write tensor");
+            }
+        }, after...);
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout, typename ... Dependencies>
+    Future<void> readAsync(ThreadPool& pool, std::istream& stream, Tensor<DType, shape, Layout>& tensor,
+                           const Future<Dependencies>& ... after) {
+        return async(pool, [&stream, &tensor] {
+            TENSORII_INSTRUMENT_OP("read", IO, tensor.size(), tensor.size_in_bytes());
+            stream.read(reinterpret_cast<char*>(tensor.data()), static_cast<std::streamsize>(tensor.size_in_bytes()));
+            if (!stream) {
+                throw std::ios_base::failure("Failed to read tensor");
+            }
+        }, after...);
+    }
+}
+
+#endif //TENSOR_ASYNC_TPP
@@ -0,0 +1,203 @@
+#ifndef TENSOR_COMPLEX_TPP
+#define TENSOR_COMPLEX_TPP
+
+#include "TensorII/Complex.h"
+
+#include <array>
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/Operations.h"
+#include "TensorII/private/ComplexKernels.h"
+#include "TensorII/private/ConvolutionKernels.h"
+
+namespace TensorII::Core {
+
+    //region SplitComplexTensor
+    template <std::floating_point Real, auto shape_, TensorLayout Layout_>
+    constexpr SplitComplexTensor<Real, shape_, Layout_>::SplitComplexTensor()
+    : real_{}
+    , imag_{}
+    {}
+
+    template <std::floating_point Real, auto shape_, TensorLayout Layout_>
+    template<std::convertible_to<tensorSize> ... Indices>
+    requires (sizeof...(Indices) == shape_.rank())
+    constexpr std::complex<Real> SplitComplexTensor<Real, shape_, Layout_>::at(const Indices& ... indices) const noexcept {
+        const tensorSize offset = Plane::offset(indices...);
+        return {real_.data()[offset], imag_.data()[offset]};
+    }
+
+    template <std::floating_point Real, auto shape_, TensorLayout Layout_>
+    template<std::convertible_to<tensorSize> ... Indices>
+    requires (sizeof...(Indices) == shape_.rank())
+    constexpr void SplitComplexTensor<Real, shape_, Layout_>::set(std::complex<Real> value, const Indices& ... indices) noexcept {
+        const tensorSize offset = Plane::offset(indices...);
+        real_.data()[offset] = value.real();
+        imag_.data()[offset] = value.imag();
+    }
+    //endregion
+
+    namespace Private {
+        template <std::floating_point Real>
+        inline constexpr bool hasSplitKernels = std::same_as<Real, float> || std::same_as<Real, double>;
+
+        template <std::floating_point Real, auto shape, TensorLayout Layout>
+        SplitPlanes<const Real> planesOf(const SplitComplexTensor<Real, shape, Layout>& tensor) {
+            return {tensor.real().data(), tensor.imag().data()};
+        }
+
+        template <std::floating_point Real, auto shape, TensorLayout Layout>
+        SplitPlanes<Real> planesOf(SplitComplexTensor<Real, shape, Layout>& tensor) {
+            return {tensor.real().data(), tensor.imag().data()};
+        }
+    }
+
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr void split(const Tensor<std::complex<Real>, shape, Layout>& in, SplitComplexTensor<Real, shape, Layout>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("split", Copy, n, 2 * n * sizeof(std::complex<Real>));
+        if constexpr (Private::hasSplitKernels<Real>) {
+            if (!std::is_constant_evaluated()) {
+                Private::split(in.data(), Private::planesOf(out), n);
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            out.real().data()[i] = in.data()[i].real();
+            out.imag().data()[i] = in.data()[i].imag();
+        }
+    }
+
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr void interleave(const SplitComplexTensor<Real, shape, Layout>& in, Tensor<std::complex<Real>, shape, Layout>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("interleave", Copy, n, 2 * n * sizeof(std::complex<Real>));
+        if constexpr (Private::hasSplitKernels<Real>) {
+            if (!std::is_constant_evaluated()) {
+                Private::interleave(Private::planesOf(in), out.data(), n);
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            out.data()[i] = {in.real().data()[i], in.imag().data()[i]};
+        }
+    }
+
+    // Sums and differences are of each plane on its own
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr void add(const SplitComplexTensor<Real, shape, Layout>& lhs, const SplitComplexTensor<Real, shape, Layout>& rhs,
+                       SplitComplexTensor<Real, shape, Layout>& out) {
+        add(lhs.real(), rhs.real(), out.real());
+        add(lhs.imag(), rhs.imag(), out.imag());
+    }
+
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr void subtract(const SplitComplexTensor<Real, shape, Layout>& lhs, const SplitComplexTensor<Real, shape, Layout>& rhs,
+                            SplitComplexTensor<Real, shape, Layout>& out) {
+        subtract(lhs.real(), rhs.real(), out.real());
+        subtract(lhs.imag(), rhs.imag(), out.imag());
+    }
+
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr void multiply(const SplitComplexTensor<Real, shape, Layout>& lhs, const SplitComplexTensor<Real, shape, Layout>& rhs,
+                            SplitComplexTensor<Real, shape, Layout>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("multiply", Elementwise, n, 3 * n * sizeof(std::complex<Real>));
+        if constexpr (Private::hasSplitKernels<Real>) {
+            if (!std::is_constant_evaluated()) {
+                Private::multiply(Private::planesOf(lhs), Private::planesOf(rhs), Private::planesOf(out), n);
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            const Real ar = lhs.real().data()[i], ai = lhs.imag().data()[i];
+            const Real br = rhs.real().data()[i], bi = rhs.imag().data()[i];
+            out.real().data()[i] = ar * br - ai * bi;
+            out.imag().data()[i] = ar * bi + ai * br;
+        }
+    }
+
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr std::complex<Real> sum(const SplitComplexTensor<Real, shape, Layout>& tensor) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("sum", Reduction, n, n * sizeof(std::complex<Real>));
+        if constexpr (Private::hasSplitKernels<Real>) {
+            if (!std::is_constant_evaluated()) {
+                return Private::sum(Private::planesOf(tensor), n);
+            }
+        }
+        Real real = 0, imag = 0;
+        for (tensorSize i = 0; i < n; i++) {
+            real += tensor.real().data()[i];
+            imag += tensor.imag().data()[i];
+        }
+        return {real, imag};
+    }
+
+    template <std::floating_point Real, auto shape, TensorLayout Layout>
+    constexpr std::complex<Real> dot(const SplitComplexTensor<Real, shape, Layout>& lhs, const SplitComplexTensor<Real, shape, Layout>& rhs) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("dot", Contraction, n, 2 * n * sizeof(std::complex<Real>));
+        if constexpr (Private::hasSplitKernels<Real>) {
+            if (!std::is_constant_evaluated()) {
+                return Private::dot(Private::planesOf(lhs), Private::planesOf(rhs), n);
+            }
+        }
+        Real real = 0, imag = 0;
+        for (tensorSize i = 0; i < n; i++) {
+            const Real ar = lhs.real().data()[i], ai = lhs.imag().data()[i];
+            const Real br = rhs.real().data()[i], bi = rhs.imag().data()[i];
+            real += ar * br - ai * bi;
+            imag += ar * bi + ai * br;
+        }
+        return {real, imag};
+    }
+
+    template <std::floating_point Real, auto lhsShape, auto rhsShape, auto outShape,
+              TensorLayout LhsLayout, TensorLayout RhsLayout, TensorLayout OutLayout>
+    requires (Private::multipliable<lhsShape, rhsShape, outShape>())
+    constexpr void matmul(const SplitComplexTensor<Real, lhsShape, LhsLayout>& lhs, const SplitComplexTensor<Real, rhsShape, RhsLayout>& rhs,
+                          SplitComplexTensor<Real, outShape, OutLayout>& out) {
+        constexpr auto rows = static_cast<tensorSize>(lhsShape[0]);
+        constexpr auto inner = static_cast<tensorSize>(lhsShape[1]);
+        constexpr auto columns = static_cast<tensorSize>(rhsShape[1]);
+        TENSORII_INSTRUMENT_OP("matmul", Contraction, rows * inner * columns,
+                               (rows * inner + inner * columns + rows * columns) * sizeof(std::complex<Real>));
+        if constexpr (Private::hasSplitKernels<Real> && std::same_as<LhsLayout, RowMajor> && std::same_as<RhsLayout, RowMajor>
+                      && std::same_as<OutLayout, RowMajor> && columns >= Private::matmulMinimumColumns) {
+            if (!std::is_constant_evaluated()) {
+                // re(out) = re(lhs) re(rhs) - im(lhs) im(rhs) and im(out) = re(lhs) im(rhs) + im(lhs) re(rhs), row by
+                // row: the real rows of rhs then the imaginary ones, and the other way round
+                std::array<const Real*, 2 * inner> realSources {}, imagSources {};
+                for (tensorSize k = 0; k < inner; k++) {
+                    realSources[k] = imagSources[inner + k] = rhs.real().data() + k * columns;
+                    imagSources[k] = realSources[inner + k] = rhs.imag().data() + k * columns;
+                }
+                std::array<Real, 2 * inner> realWeights {}, imagWeights {};
+                for (tensorSize i = 0; i < rows; i++) {
+                    for (tensorSize k = 0; k < inner; k++) {
+                        realWeights[k] = imagWeights[k] = lhs.real().data()[i * inner + k];
+                        imagWeights[inner + k] = lhs.imag().data()[i * inner + k];
+                        realWeights[inner + k] = -imagWeights[inner + k];
+                    }
+                    Private::weightedSum(realSources.data(), realWeights.data(), 2 * inner, out.real().data() + i * columns, columns);
+                    Private::weightedSum(imagSources.data(), imagWeights.data(), 2 * inner, out.imag().data() + i * columns, columns);
+                }
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < rows; i++) {
+            for (tensorSize j = 0; j < columns; j++) {
+                Real real = 0, imag = 0;
+                for (tensorSize k = 0; k < inner; k++) {
+                    const std::complex<Real> a = lhs.at(i, k), b = rhs.at(k, j);
+                    real += a.real() * b.real() - a.imag() * b.imag();
+                    imag += a.real() * b.imag() + a.imag() * b.real();
+                }
+                out.set({real, imag}, i, j);
+            }
+        }
+    }
+}
+
+#endif //TENSOR_COMPLEX_TPP
@@ -0,0 +1,60 @@
+#ifndef TENSOR_CONVOLUTION_TPP
+#define TENSOR_CONVOLUTION_TPP
+
+#include "TensorII/Convolution.h"
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/private/ConvolutionKernels.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        template <auto shape>
+        constexpr ImageExtents imageExtentsOf() noexcept {
+            return {static_cast<tensorSize>(shape[0]), static_cast<tensorSize>(shape[1]), static_cast<tensorSize>(shape[2])};
+        }
+
+        template <auto shape>
+        constexpr bool kernelFits(tensorDimension kernelRows, tensorDimension kernelColumns) noexcept {
+            return kernelRows > 0 && kernelColumns > 0 && kernelRows <= shape[0] && kernelColumns <= shape[1];
+        }
+    }
+
+    template <Boundary boundary, ConvolutionScalar DType, auto shape, auto kernelShape>
+    requires (shape.rank() == 3 && kernelShape.rank() == 2)
+    void convolve(const Tensor<DType, shape>& in, const Tensor<DType, kernelShape>& kernel, Tensor<DType, shape>& out,
+                  DType boundaryValue) {
+        static_assert(Private::kernelFits<shape>(kernelShape[0], kernelShape[1]), "Kernel is larger than the image");
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Convolution::direct", Contraction, n, 2 * n * sizeof(DType));
+        Private::convolveDirect(in.data(), out.data(), Private::imageExtentsOf<shape>(), kernel.data(),
+                                static_cast<tensorSize>(kernelShape[0]), static_cast<tensorSize>(kernelShape[1]),
+                                boundary, boundaryValue);
+    }
+
+    template <Boundary boundary, ConvolutionScalar DType, auto shape, auto columnShape, auto rowShape>
+    requires (shape.rank() == 3 && columnShape.rank() == 1 && rowShape.rank() == 1)
+    void convolveSeparable(const Tensor<DType, shape>& in, const Tensor<DType, columnShape>& columnKernel,
+                           const Tensor<DType, rowShape>& rowKernel, Tensor<DType, shape>& out, DType boundaryValue) {
+        static_assert(Private::kernelFits<shape>(columnShape[0], rowShape[0]), "Kernel is larger than the image");
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Convolution::separable", Contraction, n, 2 * n * sizeof(DType));
+        Private::convolveSeparable(in.data(), out.data(), Private::imageExtentsOf<shape>(),
+                                   columnKernel.data(), static_cast<tensorSize>(columnShape[0]),
+                                   rowKernel.data(), static_cast<tensorSize>(rowShape[0]), boundary, boundaryValue);
+    }
+
+    template <Boundary boundary, ConvolutionScalar DType, auto shape, auto kernelShape>
+    requires (shape.rank() == 3 && kernelShape.rank() == 2)
+    void convolveFFT(const Tensor<DType, shape>& in, const Tensor<DType, kernelShape>& kernel, Tensor<DType, shape>& out,
+                     DType boundaryValue) {
+        static_assert(Private::kernelFits<shape>(kernelShape[0], kernelShape[1]), "Kernel is larger than the image");
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Convolution::fft", Contraction, n, 2 * n * sizeof(DType));
+        Private::convolveFFT(in.data(), out.data(), Private::imageExtentsOf<shape>(), kernel.data(),
+                             static_cast<tensorSize>(kernelShape[0]), static_cast<tensorSize>(kernelShape[1]),
+                             boundary, boundaryValue);
+    }
+}
+
+#endif //TENSOR_CONVOLUTION_TPP
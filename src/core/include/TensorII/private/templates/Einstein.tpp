@@ -0,0 +1,412 @@
+#ifndef TENSOR_EINSTEIN_TPP
+#define TENSOR_EINSTEIN_TPP
+
+#include "TensorII/Einstein.h"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "TensorII/Instrumentation.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        //region Factors
+        enum class IndexFactorKind { Tensor, Delta, Epsilon, None };
+
+        // Every index in an expression, the tensor assigned to's first, then the rest in order of appearance
+        template <std::size_t capacity>
+        struct IndexAnalysis {
+            std::array<char, capacity> names {};
+            std::array<tensorSize, capacity> extents {};
+            // Times each appears in the product
+            std::array<std::size_t, capacity> uses {};
+            std::size_t size = 0;
+
+            bool repeatedOnLeft = false;
+            bool overused = false;
+            bool unmatched = false;
+            bool mismatched = false;
+            bool unsized = false;
+
+            [[nodiscard]] constexpr std::size_t find(char name) const {
+                std::size_t at = 0;
+                while (at < size && names[at] != name) {
+                    at++;
+                }
+                return at;
+            }
+
+            constexpr std::size_t add(char name) {
+                const std::size_t at = find(name);
+                if (at == size) {
+                    names[size++] = name;
+                }
+                return at;
+            }
+
+            // 0 for an index, like a delta's, that doesn't know its extent
+            constexpr void measure(std::size_t at, tensorSize extent) {
+                if (extent == 0) {
+                    return;
+                }
+                if (extents[at] == 0) {
+                    extents[at] = extent;
+                } else if (extents[at] != extent) {
+                    mismatched = true;
+                }
+            }
+        };
+
+        // For the assignment-free side of scalar()
+        template <typename Factor>
+        struct IndexFactorTraits {
+            static constexpr IndexFactorKind kind = IndexFactorKind::None;
+            static constexpr std::array<char, 0> names {};
+
+            static constexpr tensorSize extent(std::size_t) { return 0; }
+            static constexpr int sign(const auto&, const auto&) { return 1; }
+            static constexpr tensorSize offset(const auto&, const auto&) { return 0; }
+        };
+
+        template <Scalar DType_, auto shape, TensorLayout Layout, typename TensorType, char ... names_>
+        struct IndexedTensorTraits {
+            using DType = DType_;
+            static constexpr IndexFactorKind kind = IndexFactorKind::Tensor;
+            static constexpr std::array<char, sizeof...(names_)> names {names_...};
+
+            static constexpr tensorSize extent(std::size_t slot) { return static_cast<tensorSize>(shape[static_cast<tensorRank>(slot)]); }
+            static constexpr int sign(const auto&, const auto&) { return 1; }
+
+            static constexpr tensorSize offset(const auto& analysis, const auto& values) {
+                return [&]<std::size_t ... slot>(std::index_sequence<slot...>) {
+                    return Tensor<DType, shape, Layout>::offset(values[analysis.find(names[slot])]...);
+                }(std::make_index_sequence<sizeof...(names_)>());
+            }
+        };
+
+        template <Scalar DType, auto shape, TensorLayout Layout, char ... names>
+        struct IndexFactorTraits<Indexed<Tensor<DType, shape, Layout>, names...>>
+        : IndexedTensorTraits<DType, shape, Layout, Tensor<DType, shape, Layout>, names...> {};
+
+        template <Scalar DType, auto shape, TensorLayout Layout, char ... names>
+        struct IndexFactorTraits<Indexed<const Tensor<DType, shape, Layout>, names...>>
+        : IndexedTensorTraits<DType, shape, Layout, const Tensor<DType, shape, Layout>, names...> {};
+
+        template <char a, char b>
+        struct IndexFactorTraits<Delta<a, b>> {
+            static constexpr IndexFactorKind kind = IndexFactorKind::Delta;
+            static constexpr std::array<char, 2> names {a, b};
+
+            static constexpr tensorSize extent(std::size_t) { return 0; }
+            static constexpr tensorSize offset(const auto&, const auto&) { return 0; }
+
+            static constexpr int sign(const auto& analysis, const auto& values) {
+                return values[analysis.find(a)] == values[analysis.find(b)] ? 1 : 0;
+            }
+        };
+
+        template <char ... names_>
+        struct IndexFactorTraits<Epsilon<names_...>> {
+            static constexpr IndexFactorKind kind = IndexFactorKind::Epsilon;
+            static constexpr std::array<char, sizeof...(names_)> names {names_...};
+
+            static constexpr tensorSize extent(std::size_t) { return sizeof...(names_); }
+            static constexpr tensorSize offset(const auto&, const auto&) { return 0; }
+
+            // Parity of the number of pairs out of order
+            static constexpr int sign(const auto& analysis, const auto& values) {
+                std::array<tensorSize, sizeof...(names_)> permutation {};
+                for (std::size_t slot = 0; slot < names.size(); slot++) {
+                    permutation[slot] = values[analysis.find(names[slot])];
+                }
+                int result = 1;
+                for (std::size_t a = 0; a < names.size(); a++) {
+                    for (std::size_t b = a + 1; b < names.size(); b++) {
+                        if (permutation[a] == permutation[b]) {
+                            return 0;
+                        }
+                        result = permutation[b] < permutation[a] ? -result : result;
+                    }
+                }
+                return result;
+            }
+        };
+        //endregion
+
+        //region Terms
+        template <typename Out, typename ... Factors>
+        constexpr auto analyseIndices() {
+            using Left = IndexFactorTraits<Out>;
+            IndexAnalysis<Left::names.size() + (IndexFactorTraits<Factors>::names.size() + ... + 0)> analysis;
+            for (std::size_t slot = 0; slot < Left::names.size(); slot++) {
+                analysis.repeatedOnLeft |= analysis.find(Left::names[slot]) != analysis.size;
+                analysis.measure(analysis.add(Left::names[slot]), Left::extent(slot));
+            }
+            const auto visit = [&]<typename Factor>(std::type_identity<Factor>) {
+                using Traits = IndexFactorTraits<Factor>;
+                for (std::size_t slot = 0; slot < Traits::names.size(); slot++) {
+                    const std::size_t at = analysis.add(Traits::names[slot]);
+                    analysis.uses[at]++;
+                    analysis.measure(at, Traits::extent(slot));
+                }
+            };
+            (visit(std::type_identity<Factors> {}), ...);
+            for (std::size_t at = 0; at < analysis.size; at++) {
+                // Those on the left come first
+                const bool free = at < Left::names.size();
+                analysis.overused |= analysis.uses[at] > 2;
+                analysis.unmatched |= free != (analysis.uses[at] == 1);
+                analysis.unsized |= analysis.extents[at] == 0;
+            }
+            return analysis;
+        }
+
+        template <typename Out, typename ... Factors>
+        inline constexpr auto indexAnalysis = analyseIndices<Out, Factors...>();
+
+        template <typename Out, typename ... Factors>
+        constexpr bool validIndices() {
+            constexpr auto& analysis = indexAnalysis<Out, Factors...>;
+            static_assert(!analysis.repeatedOnLeft, "An index appears twice on the left");
+            static_assert(!analysis.overused, "An index appears more than twice in a product");
+            static_assert(!analysis.unmatched, "Indices appearing once in a product must be those on the left");
+            static_assert(!analysis.mismatched, "An index is on axes of different extents");
+            static_assert(!analysis.unsized, "An index is only on deltas, which have no extent of their own");
+            return true;
+        }
+
+        // Calls visit(values) for every value of every index, the first varying fastest
+        template <typename Out, typename ... Factors, typename Visit>
+        constexpr void forEachIndexValue(Visit visit) {
+            constexpr auto& analysis = indexAnalysis<Out, Factors...>;
+            std::array<tensorSize, analysis.names.size()> values {};
+            while (true) {
+                visit(values);
+                std::size_t at = 0;
+                for (; at < analysis.size; at++) {
+                    if (++values[at] < analysis.extents[at]) {
+                        break;
+                    }
+                    values[at] = 0;
+                }
+                if (at == analysis.size) {
+                    return;
+                }
+            }
+        }
+
+        // Stops counting once past maxIndexValues
+        template <typename Out, typename ... Factors>
+        constexpr std::size_t countIndexValues() {
+            constexpr auto& analysis = indexAnalysis<Out, Factors...>;
+            std::size_t count = 1;
+            for (std::size_t at = 0; at < analysis.size && count <= maxIndexValues; at++) {
+                count *= analysis.extents[at];
+            }
+            return count;
+        }
+
+        template <typename Out, typename ... Factors>
+        concept FewIndexValues = countIndexValues<Out, Factors...>() <= maxIndexValues;
+
+        template <typename ... Factors>
+        constexpr int indexSign(const auto& analysis, const auto& values) {
+            return (IndexFactorTraits<Factors>::sign(analysis, values) * ... * 1);
+        }
+
+        // Positions in the product of its tensors
+        template <typename ... Factors>
+        constexpr auto tensorFactors() {
+            constexpr std::size_t count = ((IndexFactorTraits<Factors>::kind == IndexFactorKind::Tensor ? 1 : 0) + ... + 0);
+            std::array<std::size_t, count> positions {};
+            std::size_t slot = 0;
+            std::size_t position = 0;
+            ((IndexFactorTraits<Factors>::kind == IndexFactorKind::Tensor ? positions[slot++] = position++ : position++), ...);
+            return positions;
+        }
+
+        // Where a nonzero term of the sum reads each tensor and writes the result
+        template <std::size_t tensors>
+        struct IndexTerm {
+            tensorSize out;
+            std::array<tensorSize, tensors> in;
+            bool negative;
+            // The first to write out, which can store rather than add; only known for unrolled terms
+            bool first;
+        };
+
+        template <typename Out, typename ... Factors>
+        constexpr std::size_t countIndexTerms() {
+            std::size_t count = 0;
+            forEachIndexValue<Out, Factors...>([&](const auto& values) {
+                count += indexSign<Factors...>(indexAnalysis<Out, Factors...>, values) != 0 ? 1 : 0;
+            });
+            return count;
+        }
+
+        template <typename Out, typename ... Factors>
+        constexpr auto buildIndexTerms() {
+            constexpr auto& analysis = indexAnalysis<Out, Factors...>;
+            constexpr std::size_t tensors = tensorFactors<Factors...>().size();
+            std::array<IndexTerm<tensors>, countIndexTerms<Out, Factors...>()> terms {};
+            std::size_t t = 0;
+            forEachIndexValue<Out, Factors...>([&](const auto& values) {
+                const int sign = indexSign<Factors...>(analysis, values);
+                if (sign == 0) {
+                    return;
+                }
+                terms[t].out = IndexFactorTraits<Out>::offset(analysis, values);
+                std::size_t slot = 0;
+                const auto read = [&]<typename Factor>(std::type_identity<Factor>) {
+                    if constexpr (IndexFactorTraits<Factor>::kind == IndexFactorKind::Tensor) {
+                        terms[t].in[slot++] = IndexFactorTraits<Factor>::offset(analysis, values);
+                    }
+                };
+                (read(std::type_identity<Factors> {}), ...);
+                terms[t].negative = sign < 0;
+                t++;
+            });
+            if (terms.size() <= unrolledIndexTerms) {
+                for (std::size_t a = 0; a < terms.size(); a++) {
+                    terms[a].first = true;
+                    for (std::size_t b = 0; b < a && terms[a].first; b++) {
+                        terms[a].first = terms[b].out != terms[a].out;
+                    }
+                }
+            }
+            return terms;
+        }
+
+        template <typename Out, typename ... Factors>
+        inline constexpr auto indexTerms = buildIndexTerms<Out, Factors...>();
+        //endregion
+
+        //region Evaluation
+        template <typename Value, typename ... Factors>
+        constexpr Value indexProduct(const std::tuple<Factors...>& factors, const auto& term) {
+            constexpr auto positions = tensorFactors<Factors...>();
+            return [&]<std::size_t ... f>(std::index_sequence<f...>) {
+                return (Value {1} * ... * static_cast<Value>(std::get<positions[f]>(factors).tensor.data()[term.in[f]]));
+            }(std::make_index_sequence<positions.size()>());
+        }
+
+        template <typename Value, std::size_t t, typename Out, typename ... Factors>
+        constexpr Value indexTermValue(const std::tuple<Factors...>& factors) {
+            constexpr auto& term = indexTerms<Out, Factors...>[t];
+            const Value product = indexProduct<Value>(factors, term);
+            if constexpr (term.negative) {
+                return -product;
+            } else {
+                return product;
+            }
+        }
+
+        template <bool accumulate, typename Value, std::size_t t, typename Out, typename ... Factors>
+        constexpr void addIndexTerm(Value* out, const std::tuple<Factors...>& factors) {
+            constexpr auto& term = indexTerms<Out, Factors...>[t];
+            if constexpr (!accumulate && term.first) {
+                out[term.out] = indexTermValue<Value, t, Out, Factors...>(factors);
+            } else {
+                out[term.out] += indexTermValue<Value, t, Out, Factors...>(factors);
+            }
+        }
+
+        // Adds each term to out[term.out], or stores the first of each unless accumulating into out, which is
+        // otherwise zero. out is in the storage order of the tensor assigned to.
+        template <bool accumulate, typename Value, typename Out, typename ... Factors>
+        requires FewIndexValues<Out, Factors...>
+        constexpr void accumulateIndexTerms(Value* out, const std::tuple<Factors...>& factors) {
+            static_assert(validIndices<Out, Factors...>());
+            constexpr auto& terms = indexTerms<Out, Factors...>;
+            if constexpr (terms.size() <= unrolledIndexTerms) {
+                [&]<std::size_t ... t>(std::index_sequence<t...>) {
+                    (addIndexTerm<accumulate, Value, t, Out, Factors...>(out, factors), ...);
+                }(std::make_index_sequence<terms.size()>());
+            } else {
+                for (const auto& term : terms) {
+                    const Value product = indexProduct<Value>(factors, term);
+                    out[term.out] += term.negative ? -product : product;
+                }
+            }
+        }
+
+        template <IndexExpression Expression>
+        constexpr auto indexFactors(const Expression& expression) {
+            if constexpr (IsIndexProduct<Expression>::value) {
+                return expression.factors;
+            } else {
+                return std::tuple<Expression> {expression};
+            }
+        }
+
+        template <IndexExpression Lhs, IndexExpression Rhs>
+        constexpr auto operator*(const Lhs& lhs, const Rhs& rhs) {
+            return std::apply([](const auto& ... factors) {
+                return Product<std::remove_cvref_t<decltype(factors)>...> {{factors...}};
+            }, std::tuple_cat(indexFactors(lhs), indexFactors(rhs)));
+        }
+
+        // Evaluated into a copy, so the tensor assigned to can be read on the right
+        template <bool accumulate, typename TensorType, char ... names, typename ... Factors>
+        requires FewIndexValues<Indexed<TensorType, names...>, Factors...>
+        constexpr void assignIndexed(TensorType& tensor, const std::tuple<Factors...>& factors) {
+            using Out = Indexed<TensorType, names...>;
+            using DType = typename IndexFactorTraits<Out>::DType;
+            using Value = Accumulator<DType>;
+            constexpr tensorSize terms = indexTerms<Out, Factors...>.size();
+            TENSORII_INSTRUMENT_OP("einstein", Contraction, terms, TensorType::size_in_bytes());
+            constexpr tensorSize size = TensorType::size();
+            std::array<Value, size> result {};
+            if constexpr (accumulate) {
+                for (tensorSize i = 0; i < size; i++) {
+                    result[i] = static_cast<Value>(tensor.data()[i]);
+                }
+            }
+            accumulateIndexTerms<accumulate, Value, Out>(result.data(), factors);
+            for (tensorSize i = 0; i < size; i++) {
+                tensor.data()[i] = static_cast<DType>(result[i]);
+            }
+        }
+        //endregion
+
+        template <typename TensorType, char ... names>
+        constexpr Indexed<TensorType, names...>& Indexed<TensorType, names...>::operator=(const Indexed& expression) {
+            assignIndexed<false, TensorType, names...>(tensor, indexFactors(expression));
+            return *this;
+        }
+
+        template <typename TensorType, char ... names>
+        template <typename Expression>
+        constexpr Indexed<TensorType, names...>& Indexed<TensorType, names...>::operator=(const Expression& expression) {
+            static_assert(IndexExpression<Expression>, "Only index notation can be assigned to indexed tensors");
+            assignIndexed<false, TensorType, names...>(tensor, indexFactors(expression));
+            return *this;
+        }
+
+        template <typename TensorType, char ... names>
+        template <typename Expression>
+        constexpr Indexed<TensorType, names...>& Indexed<TensorType, names...>::operator+=(const Expression& expression) {
+            static_assert(IndexExpression<Expression>, "Only index notation can be added to indexed tensors");
+            assignIndexed<true, TensorType, names...>(tensor, indexFactors(expression));
+            return *this;
+        }
+    }
+
+    template <Private::IndexExpression Expression>
+    constexpr auto scalar(const Expression& expression) {
+        const auto factors = Private::indexFactors(expression);
+        return [&]<typename ... Factors>(const std::tuple<Factors...>& tuple) {
+            constexpr auto positions = Private::tensorFactors<Factors...>();
+            static_assert(!positions.empty(), "A scalar needs a tensor in it");
+            using First = std::tuple_element_t<positions[0], std::tuple<Factors...>>;
+            using Value = Accumulator<typename Private::IndexFactorTraits<First>::DType>;
+            Value result {};
+            Private::accumulateIndexTerms<false, Value, void>(&result, tuple);
+            return result;
+        }(factors);
+    }
+}
+
+#endif //TENSOR_EINSTEIN_TPP
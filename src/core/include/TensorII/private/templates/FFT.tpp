@@ -0,0 +1,82 @@
+#ifndef TENSOR_FFT_TPP
+#define TENSOR_FFT_TPP
+
+#include "TensorII/FFT.h"
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/private/AxisExtents.h"
+#include "TensorII/private/FFTKernels.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        template <auto shape, tensorRank axis>
+        constexpr auto halfSpectrumOf() noexcept {
+            auto half = shape;
+            half.dimensions[axis] = shape[axis] / 2 + 1;
+            return half;
+        }
+
+        // One plan per length, whichever shapes and axes it is used along
+        template <tensorSize n>
+        const FFTPlan& fftPlan() {
+            static const FFTPlan plan (n);
+            return plan;
+        }
+
+        template <tensorRank axis, ComplexFFTScalar DType, auto shape>
+        void fftAlong(const DType* in, DType* out, bool inverse) {
+            static_assert(isFFTLength(shape[axis]), "FFT length must have no prime factors other than 2, 3 and 5");
+            constexpr AxisExtents extents = axisExtentsOf<shape, axis>();
+            constexpr tensorSize n = shape.n_elems();
+            TENSORII_INSTRUMENT_OP(inverse ? "FFT::inverse" : "FFT::forward", Contraction, n, 2 * n * sizeof(DType));
+            fftAxis(in, out, extents, fftPlan<extents.n>(), inverse);
+        }
+    }
+
+    template <tensorRank axis, ComplexFFTScalar DType, auto shape>
+    requires (axis < shape.rank())
+    void fft(Tensor<DType, shape>& data) {
+        Private::fftAlong<axis, DType, shape>(data.data(), data.data(), false);
+    }
+
+    template <tensorRank axis, ComplexFFTScalar DType, auto shape>
+    requires (axis < shape.rank())
+    void fft(const Tensor<DType, shape>& in, Tensor<DType, shape>& out) {
+        Private::fftAlong<axis, DType, shape>(in.data(), out.data(), false);
+    }
+
+    template <tensorRank axis, ComplexFFTScalar DType, auto shape>
+    requires (axis < shape.rank())
+    void ifft(Tensor<DType, shape>& data) {
+        Private::fftAlong<axis, DType, shape>(data.data(), data.data(), true);
+    }
+
+    template <tensorRank axis, ComplexFFTScalar DType, auto shape>
+    requires (axis < shape.rank())
+    void ifft(const Tensor<DType, shape>& in, Tensor<DType, shape>& out) {
+        Private::fftAlong<axis, DType, shape>(in.data(), out.data(), true);
+    }
+
+    template <tensorRank axis, RealFFTScalar DType, auto shape>
+    requires (axis < shape.rank())
+    void rfft(const Tensor<DType, shape>& in, Tensor<std::complex<DType>, halfSpectrum<shape, axis>>& out) {
+        static_assert(Private::isFFTLength(shape[axis]), "FFT length must have no prime factors other than 2, 3 and 5");
+        constexpr Private::AxisExtents extents = Private::axisExtentsOf<shape, axis>();
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("FFT::real", Contraction, n, n * sizeof(DType) + out.size_in_bytes());
+        Private::realFFTAxis(in.data(), out.data(), extents, Private::fftPlan<extents.n>());
+    }
+
+    template <tensorRank axis, RealFFTScalar DType, auto shape>
+    requires (axis < shape.rank())
+    void irfft(const Tensor<std::complex<DType>, halfSpectrum<shape, axis>>& in, Tensor<DType, shape>& out) {
+        static_assert(Private::isFFTLength(shape[axis]), "FFT length must have no prime factors other than 2, 3 and 5");
+        constexpr Private::AxisExtents extents = Private::axisExtentsOf<shape, axis>();
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("FFT::inverseReal", Contraction, n, n * sizeof(DType) + in.size_in_bytes());
+        Private::inverseRealFFTAxis(in.data(), out.data(), extents, Private::fftPlan<extents.n>());
+    }
+}
+
+#endif //TENSOR_FFT_TPP
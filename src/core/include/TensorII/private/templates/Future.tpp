@@ -0,0 +1,168 @@
+#ifndef TENSOR_FUTURE_TPP
+#define TENSOR_FUTURE_TPP
+
+#include "TensorII/Future.h"
+
+#include <atomic>
+#include <future>
+#include <optional>
+#include <stdexcept>
+
+namespace TensorII::Core {
+
+    //region AsyncState
+    namespace Private {
+        template <typename T>
+        template <typename Store>
+        void AsyncState<T>::complete(Store store) {
+            std::vector<std::function<void()>> continuations;
+            {
+                const std::scoped_lock lock (mutex_);
+                if (ready_) {
+                    throw std::logic_error("Async result is already complete");
+                }
+                store();
+                ready_ = true;
+                continuations.swap(continuations_);
+            }
+            completed_.notify_all();
+            // Outside the lock, as they read the result
+            for (auto& continuation : continuations) {
+                continuation();
+            }
+        }
+
+        template <typename T>
+        void AsyncState<T>::setValue(AsyncValue<T> value) {
+            complete([&] { value_.emplace(std::move(value)); });
+        }
+
+        template <typename T>
+        void AsyncState<T>::setException(std::exception_ptr error) {
+            complete([&] { error_ = std::move(error); });
+        }
+
+        template <typename T>
+        void AsyncState<T>::onReady(std::function<void()> continuation) {
+            {
+                const std::scoped_lock lock (mutex_);
+                if (!ready_) {
+                    continuations_.push_back(std::move(continuation));
+                    return;
+                }
+            }
+            continuation();
+        }
+
+        template <typename T>
+        bool AsyncState<T>::ready() const {
+            const std::scoped_lock lock (mutex_);
+            return ready_;
+        }
+
+        template <typename T>
+        void AsyncState<T>::wait() const {
+            std::unique_lock lock (mutex_);
+            completed_.wait(lock, [this] { return ready_; });
+        }
+
+        // Dependencies a task is still waiting on, and the first of them to fail
+        struct AsyncJoin {
+            explicit AsyncJoin(std::size_t count) : pending(count) {}
+
+            std::atomic<std::size_t> pending;
+            std::mutex mutex;
+            std::exception_ptr error;
+        };
+    }
+    //endregion
+
+    //region Future and Promise
+    template <typename T>
+    decltype(auto) Future<T>::get() const {
+        state_->wait();
+        if (state_->exception()) {
+            std::rethrow_exception(state_->exception());
+        }
+        if constexpr (!std::is_void_v<T>) {
+            return static_cast<const T&>(state_->value());
+        }
+    }
+
+    template <typename T>
+    template <typename Function>
+    auto Future<T>::then(ThreadPool& pool, Function function) const {
+        if constexpr (std::is_void_v<T>) {
+            return async(pool, std::move(function), *this);
+        }
+        else {
+            // Owning the state, as this Future may be a temporary gone long before the continuation runs
+            return async(pool, [state = state_, function]() mutable { return function(state->value()); }, *this);
+        }
+    }
+
+    template <typename T>
+    Promise<T>::~Promise() {
+        if (state_ && !state_->ready()) {
+            state_->setException(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+        }
+    }
+    //endregion
+
+    template <typename Function, typename ... Dependencies>
+    requires std::invocable<Function&> && std::copy_constructible<Function>
+    Future<std::invoke_result_t<Function&>> async(ThreadPool& pool, Function function, const Future<Dependencies>& ... after) {
+        using Result = std::invoke_result_t<Function&>;
+        auto state = std::make_shared<Private::AsyncState<Result>>();
+        auto run = [state, function]() mutable {
+            // Only the function's own failure is the op's. Completing the state runs its continuations, and
+            // one of those throwing mustn't be caught here and set on a state that's already complete.
+            std::optional<Private::AsyncValue<Result>> value;
+            try {
+                if constexpr (std::is_void_v<Result>) {
+                    function();
+                    value.emplace();
+                }
+                else {
+                    value.emplace(function());
+                }
+            }
+            catch (...) {
+                state->setException(std::current_exception());
+                return;
+            }
+            state->setValue(std::move(*value));
+        };
+
+        if constexpr (sizeof...(after) == 0) {
+            pool.submit(std::move(run));
+        }
+        else {
+            auto join = std::make_shared<Private::AsyncJoin>(sizeof...(after));
+            auto arrive = [join, state, run, pool = &pool](std::exception_ptr error) {
+                if (error) {
+                    const std::scoped_lock lock (join->mutex);
+                    if (!join->error) {
+                        join->error = std::move(error);
+                    }
+                }
+                if (join->pending.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    return;
+                }
+                // Last to arrive: every other arrival has recorded its error
+                if (join->error) {
+                    state->setException(join->error);
+                }
+                else {
+                    pool->submit(run);
+                }
+            };
+            // Continuations run from inside the dependency's state, so a plain pointer to it is enough, and
+            // doesn't keep it alive through its own continuation list
+            (after.state()->onReady([arrive, dependency = after.state().get()] { arrive(dependency->exception()); }), ...);
+        }
+        return Future<Result>(std::move(state));
+    }
+}
+
+#endif //TENSOR_FUTURE_TPP
@@ -0,0 +1,147 @@
+#ifndef TENSOR_GATHER_TPP
+#define TENSOR_GATHER_TPP
+
+#include "TensorII/Gather.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/private/GatherKernels.h"
+#include "TensorII/private/Parallel.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        template <typename DType, typename Index>
+        inline constexpr bool hasGatherKernel = (std::same_as<DType, float> || std::same_as<DType, double>)
+                                                && (std::same_as<Index, std::int32_t> || std::same_as<Index, std::int64_t>);
+
+        template <typename DType>
+        inline constexpr bool atomicallyAddable = (std::floating_point<DType> || std::integral<DType>) && !std::same_as<DType, bool>;
+
+        template <typename DType, typename Index>
+        constexpr void scatterAddRange(DType* field, const Index* indices, const DType* values, tensorSize begin, tensorSize end) {
+            for (tensorSize i = begin; i < end; i++) {
+                field[indices[i]] += values[i];
+            }
+        }
+
+        template <typename DType, typename Index>
+        void scatterAddPrivatised(DType* field, tensorSize fieldSize, const Index* indices, const DType* values, tensorSize n, tensorSize chunks) {
+            const auto boundary = [&](tensorSize chunk) { return n * chunk / chunks; };
+            // Not a vector, which packs bools into bits
+            const auto copies = std::make_unique<DType[]>(chunks * fieldSize);
+            parallelFor(chunks, 1, [&](tensorSize begin, tensorSize end) {
+                for (tensorSize chunk = begin; chunk < end; chunk++) {
+                    scatterAddRange(copies.get() + chunk * fieldSize, indices, values, boundary(chunk), boundary(chunk + 1));
+                }
+            });
+            parallelFor(fieldSize, parallelGrain, [&](tensorSize begin, tensorSize end) {
+                for (tensorSize chunk = 0; chunk < chunks; chunk++) {
+                    const DType* copy = copies.get() + chunk * fieldSize;
+                    for (tensorSize i = begin; i < end; i++) {
+                        field[i] += copy[i];
+                    }
+                }
+            });
+        }
+
+        template <typename DType, typename Index>
+        void scatterAddAtomic(DType* field, const Index* indices, const DType* values, tensorSize n) {
+            parallelFor(n, parallelGrain, [&](tensorSize begin, tensorSize end) {
+                for (tensorSize i = begin; i < end; i++) {
+                    std::atomic_ref<DType>(field[indices[i]]).fetch_add(values[i], std::memory_order_relaxed);
+                }
+            });
+        }
+    }
+
+    template <Scalar DType, auto fieldShape, TensorLayout FieldLayout, std::integral Index, auto indexShape, TensorLayout Layout>
+    constexpr void gather(const Tensor<DType, fieldShape, FieldLayout>& field, const Tensor<Index, indexShape, Layout>& indices,
+                          Tensor<DType, indexShape, Layout>& out) {
+        constexpr tensorSize n = indexShape.n_elems();
+        TENSORII_INSTRUMENT_OP("gather", Copy, n, n * (sizeof(Index) + 2 * sizeof(DType)));
+        if constexpr (Private::hasGatherKernel<DType, Index>) {
+            if (!std::is_constant_evaluated()) {
+                Private::gather(field.data(), indices.data(), out.data(), n);
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            out.data()[i] = field.data()[indices.data()[i]];
+        }
+    }
+
+    template <Scalar DType, auto fieldShape, TensorLayout FieldLayout, std::integral Index, auto indexShape, TensorLayout Layout>
+    constexpr void scatterAdd(Tensor<DType, fieldShape, FieldLayout>& field, const Tensor<Index, indexShape, Layout>& indices,
+                              const Tensor<DType, indexShape, Layout>& values, ScatterStrategy strategy) {
+        constexpr tensorSize n = indexShape.n_elems();
+        constexpr tensorSize fieldSize = fieldShape.n_elems();
+        TENSORII_INSTRUMENT_OP("scatterAdd", Elementwise, n, n * (sizeof(Index) + 3 * sizeof(DType)));
+        if (!std::is_constant_evaluated()) {
+            const tensorSize chunks = Private::parallelChunks(n, Private::parallelGrain);
+            if (strategy == ScatterStrategy::Automatic) {
+                if (chunks == 1) {
+                    strategy = ScatterStrategy::Serial;
+                } else if (fieldSize * chunks <= n || !Private::atomicallyAddable<DType>) {
+                    strategy = ScatterStrategy::Privatised;
+                } else {
+                    strategy = ScatterStrategy::Atomic;
+                }
+            }
+            if (strategy == ScatterStrategy::Privatised) {
+                Private::scatterAddPrivatised(field.data(), fieldSize, indices.data(), values.data(), n, chunks);
+                return;
+            }
+            if (strategy == ScatterStrategy::Atomic) {
+                if constexpr (Private::atomicallyAddable<DType>) {
+                    Private::scatterAddAtomic(field.data(), indices.data(), values.data(), n);
+                    return;
+                } else {
+                    throw std::invalid_argument("Atomic scatter needs an arithmetic DType");
+                }
+            }
+        }
+        Private::scatterAddRange(field.data(), indices.data(), values.data(), 0, n);
+    }
+
+    template <Scalar DType, auto fieldShape, TensorLayout FieldLayout, std::integral Index, auto indexShape>
+    requires ((std::same_as<Index, std::int32_t> || std::same_as<Index, std::int64_t>) && indexShape.rank() > 0)
+    ScatterColouring colourScatter(const Tensor<DType, fieldShape, FieldLayout>&, const Tensor<Index, indexShape>& indices) {
+        constexpr auto rowLength = static_cast<tensorSize>(indexShape[indexShape.rank() - 1]);
+        constexpr tensorSize rows = rowLength == 0 ? 0 : indexShape.n_elems() / rowLength;
+        return ScatterColouring(indices.data(), rows, rowLength, fieldShape.n_elems());
+    }
+
+    template <Scalar DType, auto fieldShape, TensorLayout FieldLayout, std::integral Index, auto indexShape>
+    requires (indexShape.rank() > 0)
+    void scatterAdd(Tensor<DType, fieldShape, FieldLayout>& field, const Tensor<Index, indexShape>& indices,
+                    const Tensor<DType, indexShape>& values, const ScatterColouring& colouring) {
+        constexpr tensorSize n = indexShape.n_elems();
+        constexpr auto rowLength = static_cast<tensorSize>(indexShape[indexShape.rank() - 1]);
+        TENSORII_INSTRUMENT_OP("scatterAdd", Elementwise, n, n * (sizeof(Index) + 3 * sizeof(DType)));
+        if (colouring.rowLength() != rowLength || colouring.rows() * rowLength != n) {
+            throw std::invalid_argument("Colouring is of other indices");
+        }
+        const auto addRow = [&](tensorSize row) {
+            Private::scatterAddRange(field.data(), indices.data(), values.data(), row * rowLength, (row + 1) * rowLength);
+        };
+        for (tensorSize colour = 0; colour < colouring.colours(); colour++) {
+            const auto rows = colouring.rowsOf(colour);
+            Private::parallelFor(rows.size(), std::max<tensorSize>(1, Private::parallelGrain / std::max<tensorSize>(rowLength, 1)),
+                                 [&](tensorSize begin, tensorSize end) {
+                for (tensorSize i = begin; i < end; i++) {
+                    addRow(rows[i]);
+                }
+            });
+        }
+        for (tensorSize row : colouring.uncoloured()) {
+            addRow(row);
+        }
+    }
+}
+
+#endif //TENSOR_GATHER_TPP
@@ -0,0 +1,362 @@
+#ifndef TENSOR_GRAPH_TPP
+#define TENSOR_GRAPH_TPP
+
+#include "TensorII/Graph.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/Operations.h"
+#include "TensorII/private/Parallel.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        // Elements a pass evaluates at a time, so a block of every node it fuses stays in L1
+        inline constexpr tensorSize graphBlock = 256;
+
+        // Unary operations ignore b. Reductions fold b into a.
+        template <GraphOp op, typename T>
+        constexpr T applyGraphOp(T a, T b) {
+            if constexpr (op == GraphOp::Negate) {
+                return static_cast<T>(-a);
+            } else if constexpr (op == GraphOp::Abs) {
+                return a < T {} ? static_cast<T>(-a) : a;
+            } else if constexpr (op == GraphOp::Sqrt) {
+                if constexpr (std::floating_point<T>) {
+                    return std::sqrt(a);
+                } else {
+                    return static_cast<T>(std::sqrt(static_cast<double>(a)));
+                }
+            } else if constexpr (op == GraphOp::Add || op == GraphOp::Sum) {
+                return static_cast<T>(a + b);
+            } else if constexpr (op == GraphOp::Subtract) {
+                return static_cast<T>(a - b);
+            } else if constexpr (op == GraphOp::Multiply) {
+                return static_cast<T>(a * b);
+            } else if constexpr (op == GraphOp::Divide) {
+                return static_cast<T>(a / b);
+            } else if constexpr (op == GraphOp::Minimum || op == GraphOp::Min) {
+                return b < a ? b : a;
+            } else if constexpr (op == GraphOp::Maximum || op == GraphOp::Max) {
+                return a < b ? b : a;
+            } else if constexpr (op == GraphOp::Greater) {
+                return static_cast<T>(a > b ? 1 : 0);
+            } else {
+                static_assert(op == GraphOp::Less);
+                return static_cast<T>(a < b ? 1 : 0);
+            }
+        }
+
+        // Calls function with the operation as a compile-time constant, so each gets a loop of its own
+        template <typename Function>
+        void withGraphOp(GraphOp op, Function&& function) {
+            switch (op) {
+                case GraphOp::Negate: return function(std::integral_constant<GraphOp, GraphOp::Negate>());
+                case GraphOp::Abs: return function(std::integral_constant<GraphOp, GraphOp::Abs>());
+                case GraphOp::Sqrt: return function(std::integral_constant<GraphOp, GraphOp::Sqrt>());
+                case GraphOp::Add: return function(std::integral_constant<GraphOp, GraphOp::Add>());
+                case GraphOp::Subtract: return function(std::integral_constant<GraphOp, GraphOp::Subtract>());
+                case GraphOp::Multiply: return function(std::integral_constant<GraphOp, GraphOp::Multiply>());
+                case GraphOp::Divide: return function(std::integral_constant<GraphOp, GraphOp::Divide>());
+                case GraphOp::Minimum: return function(std::integral_constant<GraphOp, GraphOp::Minimum>());
+                case GraphOp::Maximum: return function(std::integral_constant<GraphOp, GraphOp::Maximum>());
+                case GraphOp::Greater: return function(std::integral_constant<GraphOp, GraphOp::Greater>());
+                case GraphOp::Less: return function(std::integral_constant<GraphOp, GraphOp::Less>());
+                case GraphOp::Sum: return function(std::integral_constant<GraphOp, GraphOp::Sum>());
+                case GraphOp::Min: return function(std::integral_constant<GraphOp, GraphOp::Min>());
+                case GraphOp::Max: return function(std::integral_constant<GraphOp, GraphOp::Max>());
+                case GraphOp::Input:
+                case GraphOp::Constant:
+                default: throw std::logic_error("Graph inputs and constants aren't computed");
+            }
+        }
+
+        // A block of values, or one value for the whole block
+        template <typename DType>
+        struct GraphOperand {
+            const DType* values;
+            DType scalar;
+        };
+
+        template <GraphOp op, typename DType>
+        void applyGraphBlock(GraphOperand<DType> a, GraphOperand<DType> b, DType* out, tensorSize count) {
+            if (a.values != nullptr && b.values != nullptr) {
+                for (tensorSize i = 0; i < count; i++) {
+                    out[i] = applyGraphOp<op>(a.values[i], b.values[i]);
+                }
+            } else if (a.values != nullptr) {
+                for (tensorSize i = 0; i < count; i++) {
+                    out[i] = applyGraphOp<op>(a.values[i], b.scalar);
+                }
+            } else {
+                for (tensorSize i = 0; i < count; i++) {
+                    out[i] = applyGraphOp<op>(a.scalar, b.values[i]);
+                }
+            }
+        }
+
+        template <typename T>
+        constexpr T reductionIdentity(GraphOp op);
+
+        // Folded into independent lanes, so the compiler can vectorise without reordering any one lane's adds
+        inline constexpr tensorSize graphReductionLanes = 16;
+
+        template <GraphOp op, typename Acc, typename DType>
+        Acc foldGraphBlock(Acc partial, const DType* in, tensorSize count) {
+            std::array<Acc, graphReductionLanes> lanes;
+            lanes.fill(reductionIdentity<Acc>(op));
+            tensorSize i = 0;
+            for (; i + graphReductionLanes <= count; i += graphReductionLanes) {
+                for (tensorSize lane = 0; lane < graphReductionLanes; lane++) {
+                    lanes[lane] = applyGraphOp<op>(lanes[lane], static_cast<Acc>(in[i + lane]));
+                }
+            }
+            for (; i < count; i++) {
+                partial = applyGraphOp<op>(partial, static_cast<Acc>(in[i]));
+            }
+            for (Acc lane : lanes) {
+                partial = applyGraphOp<op>(partial, lane);
+            }
+            return partial;
+        }
+
+        template <typename T>
+        constexpr T reductionIdentity(GraphOp op) {
+            if (op == GraphOp::Sum) {
+                return T {};
+            }
+            using Limits = std::numeric_limits<T>;
+            if (op == GraphOp::Min) {
+                return Limits::has_infinity ? Limits::infinity() : Limits::max();
+            }
+            return Limits::has_infinity ? static_cast<T>(-Limits::infinity()) : Limits::lowest();
+        }
+
+        template <typename Lhs, typename Rhs>
+        requires LazyOperands<Lhs, Rhs>
+        auto lazyBinary(GraphOp op, const Lhs& lhs, const Rhs& rhs) {
+            if constexpr (!LazyTraits<Lhs>::isLazy) {
+                using DType = typename LazyTraits<Rhs>::Type;
+                return lazyBinary(op, rhs.graph().constant(static_cast<DType>(lhs)), rhs);
+            } else if constexpr (!LazyTraits<Rhs>::isLazy) {
+                using DType = typename LazyTraits<Lhs>::Type;
+                return lazyBinary(op, lhs, lhs.graph().constant(static_cast<DType>(rhs)));
+            } else {
+                auto& graph = lhs.graph();
+                if (&graph != &rhs.graph()) {
+                    throw std::invalid_argument("Operands belong to different graphs");
+                }
+                constexpr bool scalar = LazyTraits<Lhs>::scalar && LazyTraits<Rhs>::scalar;
+                const std::size_t node = graph.record(op, lhs.node(), rhs.node(), scalar);
+                if constexpr (scalar) {
+                    return graph.lazyScalar(node);
+                } else {
+                    return graph.lazy(node);
+                }
+            }
+        }
+
+        template <typename Operand>
+        requires (LazyTraits<Operand>::isLazy)
+        auto lazyUnary(GraphOp op, const Operand& operand) {
+            auto& graph = operand.graph();
+            const std::size_t node = graph.record(op, operand.node(), noInput, LazyTraits<Operand>::scalar);
+            if constexpr (LazyTraits<Operand>::scalar) {
+                return graph.lazyScalar(node);
+            } else {
+                return graph.lazy(node);
+            }
+        }
+    }
+
+    //region Graph
+    template <GraphScalar DType, auto shape>
+    std::size_t Graph<DType, shape>::record(GraphOp op, std::size_t lhs, std::size_t rhs, bool scalar) {
+        nodes_.push_back({op, {lhs, rhs}, scalar});
+        inputs_.push_back(nullptr);
+        values_.push_back(DType {});
+        plan_.reset();
+        return nodes_.size() - 1;
+    }
+
+    template <GraphScalar DType, auto shape>
+    Lazy<DType, shape> Graph<DType, shape>::input(const Tensor<DType, shape>& tensor) {
+        const std::size_t node = record(GraphOp::Input, noInput, noInput, false);
+        inputs_[node] = tensor.data();
+        return {*this, node};
+    }
+
+    template <GraphScalar DType, auto shape>
+    LazyScalar<DType, shape> Graph<DType, shape>::constant(DType value) {
+        const std::size_t node = record(GraphOp::Constant, noInput, noInput, true);
+        values_[node] = value;
+        return {*this, node};
+    }
+
+    template <GraphScalar DType, auto shape>
+    void Graph<DType, shape>::output(const Lazy<DType, shape>& value, Tensor<DType, shape>& out) {
+        stores_.emplace_back(value.node(), out.data());
+        plan_.reset();
+        hasRun_ = false;
+    }
+
+    template <GraphScalar DType, auto shape>
+    LazyScalar<DType, shape> Graph<DType, shape>::output(const LazyScalar<DType, shape>& value) {
+        scalarOutputs_.push_back(value.node());
+        plan_.reset();
+        hasRun_ = false;
+        return value;
+    }
+
+    template <GraphScalar DType, auto shape>
+    const GraphPlan& Graph<DType, shape>::plan() {
+        if (!plan_) {
+            std::vector<std::size_t> stored;
+            for (const auto& store : stores_) {
+                stored.push_back(store.first);
+            }
+            plan_ = schedule(nodes_, stored, scalarOutputs_);
+        }
+        return *plan_;
+    }
+
+    template <GraphScalar DType, auto shape>
+    void Graph<DType, shape>::writePlan(std::ostream& out) {
+        Core::writePlan(out, plan(), nodes_);
+    }
+
+    template <GraphScalar DType, auto shape>
+    void Graph<DType, shape>::run() {
+        const GraphPlan& scheduled = plan();
+        for (const GraphPlan::Pass& pass : scheduled.passes) {
+            computeScalars(pass.scalars);
+            runPass(pass);
+        }
+        computeScalars(scheduled.finalScalars);
+        hasRun_ = true;
+    }
+
+    template <GraphScalar DType, auto shape>
+    DType Graph<DType, shape>::value(const LazyScalar<DType, shape>& scalar) const {
+        if (!hasRun_ || std::find(scalarOutputs_.begin(), scalarOutputs_.end(), scalar.node()) == scalarOutputs_.end()) {
+            throw std::logic_error("Only outputs have values, once the graph has run");
+        }
+        return values_[scalar.node()];
+    }
+
+    template <GraphScalar DType, auto shape>
+    void Graph<DType, shape>::computeScalars(const std::vector<std::size_t>& scalars) {
+        for (std::size_t node : scalars) {
+            const GraphNode& scalar = nodes_[node];
+            const DType b = scalar.inputs[1] == noInput ? DType {} : values_[scalar.inputs[1]];
+            Private::withGraphOp(scalar.op, [&](auto op) {
+                values_[node] = Private::applyGraphOp<op.value>(values_[scalar.inputs[0]], b);
+            });
+        }
+    }
+
+    template <GraphScalar DType, auto shape>
+    void Graph<DType, shape>::runPass(const GraphPlan::Pass& pass) {
+        using Acc = Accumulator<DType>;
+        constexpr tensorSize n = shape.n_elems();
+        constexpr tensorSize block = Private::graphBlock;
+        constexpr tensorSize blocks = (n + block - 1) / block;
+
+        std::vector<std::pair<std::size_t, DType*>> stores;
+        tensorSize streams = 0;
+        for (const auto& store : stores_) {
+            if (std::find(pass.stores.begin(), pass.stores.end(), store.first) != pass.stores.end()) {
+                stores.push_back(store);
+                streams++;
+            }
+        }
+        for (std::size_t node : pass.elementwise) {
+            streams += nodes_[node].op == GraphOp::Input ? 1 : 0;
+        }
+        TENSORII_INSTRUMENT_OP("Graph::pass", Elementwise, n * pass.elementwise.size(), n * streams * sizeof(DType));
+
+        // Where each node's block sits in a thread's buffer
+        std::vector<std::size_t> slots (nodes_.size());
+        for (std::size_t i = 0; i < pass.elementwise.size(); i++) {
+            slots[pass.elementwise[i]] = i;
+        }
+        // Each block's partial reductions are kept apart and merged in block order after the threads are done,
+        // so the result doesn't depend on how the blocks were shared out or which thread finished first
+        const std::size_t reductions = pass.reductions.size();
+        std::vector<Acc> partials (blocks * reductions);
+
+        const tensorSize grain = std::max<tensorSize>(1, Private::parallelGrain / (block * std::max<tensorSize>(1, pass.elementwise.size())));
+        Private::parallelFor(blocks, grain, [&](tensorSize begin, tensorSize end) {
+            std::vector<DType> buffer (pass.elementwise.size() * block);
+            std::vector<const DType*> values (nodes_.size());
+            const auto operand = [&](std::size_t input) -> Private::GraphOperand<DType> {
+                if (input == noInput || nodes_[input].scalar) {
+                    return {nullptr, input == noInput ? DType {} : values_[input]};
+                }
+                return {values[input], DType {}};
+            };
+
+            for (tensorSize b = begin; b < end; b++) {
+                const tensorSize start = b * block;
+                const tensorSize count = std::min(block, n - start);
+                for (std::size_t node : pass.elementwise) {
+                    const GraphNode& elementwise = nodes_[node];
+                    if (elementwise.op == GraphOp::Input) {
+                        values[node] = inputs_[node] + start;
+                        continue;
+                    }
+                    DType* target = buffer.data() + slots[node] * block;
+                    Private::withGraphOp(elementwise.op, [&](auto op) {
+                        Private::applyGraphBlock<op.value>(operand(elementwise.inputs[0]), operand(elementwise.inputs[1]), target, count);
+                    });
+                    values[node] = target;
+                }
+                for (const auto& [node, out] : stores) {
+                    std::copy_n(values[node], count, out + start);
+                }
+                for (std::size_t r = 0; r < reductions; r++) {
+                    const GraphNode& reduction = nodes_[pass.reductions[r]];
+                    const DType* in = values[reduction.inputs[0]];
+                    Private::withGraphOp(reduction.op, [&](auto op) {
+                        partials[b * reductions + r] = Private::foldGraphBlock<op.value, Acc>(
+                                Private::reductionIdentity<Acc>(reduction.op), in, count);
+                    });
+                }
+            }
+        });
+
+        for (std::size_t r = 0; r < reductions; r++) {
+            Private::withGraphOp(nodes_[pass.reductions[r]].op, [&](auto op) {
+                Acc result = Private::reductionIdentity<Acc>(op.value);
+                for (tensorSize b = 0; b < blocks; b++) {
+                    result = Private::applyGraphOp<op.value>(result, partials[b * reductions + r]);
+                }
+                values_[pass.reductions[r]] = static_cast<DType>(result);
+            });
+        }
+    }
+    //endregion
+
+    template <GraphScalar DType, auto shape>
+    LazyScalar<DType, shape> sum(const Lazy<DType, shape>& operand) {
+        return operand.graph().lazyScalar(operand.graph().record(GraphOp::Sum, operand.node(), noInput, true));
+    }
+
+    template <GraphScalar DType, auto shape>
+    LazyScalar<DType, shape> min(const Lazy<DType, shape>& operand) {
+        return operand.graph().lazyScalar(operand.graph().record(GraphOp::Min, operand.node(), noInput, true));
+    }
+
+    template <GraphScalar DType, auto shape>
+    LazyScalar<DType, shape> max(const Lazy<DType, shape>& operand) {
+        return operand.graph().lazyScalar(operand.graph().record(GraphOp::Max, operand.node(), noInput, true));
+    }
+}
+
+#endif //TENSOR_GRAPH_TPP
@@ -0,0 +1,353 @@
+#ifndef TENSOR_HISTOGRAM_TPP
+#define TENSOR_HISTOGRAM_TPP
+
+#include "TensorII/Histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/private/AxisExtents.h"
+#include "TensorII/private/Parallel.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        // Threads a tile of n elements is shared out between. Each sums a histogram of 'counts' counts of its
+        // own into the total, so it needs at least as many elements again to be worth it.
+        inline tensorSize histogramChunks(tensorSize n, tensorSize counts) {
+            return parallelChunks(n, std::max(parallelGrain, counts));
+        }
+
+        // function(band, begin, end) on each run of consecutive elements of one band in [begin, end), of a
+        // row-major tensor with 'bands' along an axis and 'inner' elements after it
+        template <typename Function>
+        void forEachBandRun(tensorSize bands, tensorSize inner, tensorSize begin, tensorSize end, Function&& function) {
+            tensorSize band = begin / inner % bands;
+            tensorSize stop = begin - begin % inner + inner;
+            for (tensorSize i = begin; i < end; i = stop, stop += inner) {
+                function(band, i, std::min(stop, end));
+                band = band + 1 == bands ? 0 : band + 1;
+            }
+        }
+    }
+
+    //region Histogram
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    Histogram<DType, axis_, bands_>::Histogram(tensorSize bins, double low, double high)
+    : Histogram(bins, [&] { std::array<double, bands_> lows; lows.fill(low); return lows; }(),
+                [&] { std::array<double, bands_> highs; highs.fill(high); return highs; }())
+    {}
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    Histogram<DType, axis_, bands_>::Histogram(tensorSize bins, const std::array<double, bands_>& low, const std::array<double, bands_>& high)
+    : bins_ {bins}
+    , adaptive_ {false}
+    , ranged_ {}
+    , low_ {low}
+    , width_ {}
+    , counts_ (bands_ * slots())
+    {
+        if (bins == 0) {
+            throw std::invalid_argument("Histogram needs at least one bin");
+        }
+        for (tensorSize band = 0; band < bands_; band++) {
+            if (!std::isfinite(low[band]) || !std::isfinite(high[band]) || !(low[band] < high[band])) {
+                throw std::invalid_argument("Histogram range must be finite and not empty");
+            }
+            width_[band] = (high[band] - low[band]) / static_cast<double>(bins);
+        }
+        ranged_.fill(true);
+        min_.fill(std::numeric_limits<double>::infinity());
+        max_.fill(-std::numeric_limits<double>::infinity());
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    Histogram<DType, axis_, bands_>::Histogram(tensorSize bins)
+    : bins_ {bins}
+    , adaptive_ {true}
+    , ranged_ {}
+    , low_ {}
+    , width_ {}
+    , counts_ (bands_ * slots())
+    {
+        if (bins == 0 || bins % 2 != 0) {
+            throw std::invalid_argument("Adaptive histogram needs an even number of bins");
+        }
+        // Until a band has a range, only infinities can be counted, and they only need the sign
+        width_.fill(1);
+        min_.fill(std::numeric_limits<double>::infinity());
+        max_.fill(-std::numeric_limits<double>::infinity());
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    void Histogram<DType, axis_, bands_>::widen(tensorSize band, double lowest, double highest) {
+        const auto bins = static_cast<double>(bins_);
+        if (!ranged_[band]) {
+            low_[band] = lowest;
+            width_[band] = (highest > lowest ? highest - lowest : lowest != 0 ? std::abs(lowest) : 1) / bins;
+            ranged_[band] = true;
+            return;
+        }
+        Count* counts = counts_.data() + band * slots() + 1;
+        const tensorSize half = bins_ / 2;
+        while (lowest < low_[band]) {
+            // The old bins become the top half, from the highest pair down so none is overwritten unread
+            for (tensorSize j = half; j-- > 0;) {
+                const Count pair = counts[2 * j] + counts[2 * j + 1];
+                counts[half + j] = pair;
+            }
+            std::fill_n(counts, half, 0);
+            low_[band] -= bins * width_[band];
+            width_[band] *= 2;
+        }
+        while (highest > low_[band] + bins * width_[band]) {
+            for (tensorSize j = 0; j < half; j++) {
+                counts[j] = counts[2 * j] + counts[2 * j + 1];
+            }
+            std::fill_n(counts + half, half, 0);
+            width_[band] *= 2;
+        }
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    template <auto shape>
+    requires (axis_ < shape.rank() && static_cast<tensorSize>(shape[axis_]) == bands_)
+    void Histogram<DType, axis_, bands_>::add(const Tensor<DType, shape>& tile) {
+        constexpr Private::AxisExtents extents = Private::axisExtentsOf<shape, axis_>();
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("histogram", Reduction, n, n * sizeof(DType));
+        using Extremes = std::array<double, bands_>;
+        const DType* data = tile.data();
+        const tensorSize chunks = Private::histogramChunks(n, counts_.size());
+        const auto boundary = [&](tensorSize chunk) { return n * chunk / chunks; };
+
+        if (adaptive_) {
+            // Finite range of each band in the tile, widened to before counting, so no bins move under the threads
+            std::vector<Extremes> lowest (chunks), highest (chunks);
+            Private::parallelFor(chunks, 1, [&](tensorSize begin, tensorSize end) {
+                for (tensorSize chunk = begin; chunk < end; chunk++) {
+                    lowest[chunk].fill(std::numeric_limits<double>::infinity());
+                    highest[chunk].fill(-std::numeric_limits<double>::infinity());
+                    Private::forEachBandRun(bands_, extents.inner, boundary(chunk), boundary(chunk + 1),
+                                            [&](tensorSize band, tensorSize first, tensorSize last) {
+                        double low = lowest[chunk][band];
+                        double high = highest[chunk][band];
+                        for (tensorSize i = first; i < last; i++) {
+                            const auto value = static_cast<double>(data[i]);
+                            if (std::integral<DType> || std::isfinite(value)) {
+                                low = std::min(low, value);
+                                high = std::max(high, value);
+                            }
+                        }
+                        lowest[chunk][band] = low;
+                        highest[chunk][band] = high;
+                    });
+                }
+            });
+            for (tensorSize band = 0; band < bands_; band++) {
+                double low = lowest[0][band];
+                double high = highest[0][band];
+                for (tensorSize chunk = 1; chunk < chunks; chunk++) {
+                    low = std::min(low, lowest[chunk][band]);
+                    high = std::max(high, highest[chunk][band]);
+                }
+                if (low <= high) {
+                    widen(band, low, high);
+                }
+            }
+        }
+
+        const auto countRange = [&](Count* counts, Extremes& mins, Extremes& maxes, tensorSize begin, tensorSize end) {
+            const auto bins = static_cast<double>(bins_);
+            Private::forEachBandRun(bands_, extents.inner, begin, end, [&](tensorSize band, tensorSize first, tensorSize last) {
+                Count* bandCounts = counts + band * slots();
+                const double low = low_[band];
+                const double scale = 1 / width_[band];
+                double min = mins[band];
+                double max = maxes[band];
+                for (tensorSize i = first; i < last; i++) {
+                    const auto value = static_cast<double>(data[i]);
+                    const double position = (value - low) * scale;
+                    tensorSize slot;
+                    if (position >= 0 && position < bins) {
+                        slot = static_cast<tensorSize>(position) + 1;
+                    } else if (value != value) {
+                        slot = bins_ + 2;
+                    } else if (adaptive_ && std::isfinite(value)) {
+                        // Rounding at the ends of a range made to fit
+                        slot = position < 0 ? 1 : bins_;
+                    } else {
+                        slot = position < 0 ? 0 : bins_ + 1;
+                    }
+                    bandCounts[slot]++;
+                    // NaNs compare false, so leave both as they are
+                    min = std::min(min, value);
+                    max = std::max(max, value);
+                }
+                mins[band] = min;
+                maxes[band] = max;
+            });
+        };
+
+        if (chunks == 1) {
+            countRange(counts_.data(), min_, max_, 0, n);
+            return;
+        }
+        std::vector<Count> copies (chunks * counts_.size());
+        std::vector<Extremes> mins (chunks, min_), maxes (chunks, max_);
+        Private::parallelFor(chunks, 1, [&](tensorSize begin, tensorSize end) {
+            for (tensorSize chunk = begin; chunk < end; chunk++) {
+                countRange(copies.data() + chunk * counts_.size(), mins[chunk], maxes[chunk], boundary(chunk), boundary(chunk + 1));
+            }
+        });
+        for (tensorSize chunk = 0; chunk < chunks; chunk++) {
+            const Count* copy = copies.data() + chunk * counts_.size();
+            for (tensorSize i = 0; i < counts_.size(); i++) {
+                counts_[i] += copy[i];
+            }
+            for (tensorSize band = 0; band < bands_; band++) {
+                min_[band] = std::min(min_[band], mins[chunk][band]);
+                max_[band] = std::max(max_[band], maxes[chunk][band]);
+            }
+        }
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    void Histogram<DType, axis_, bands_>::merge(const Histogram& other) {
+        if (bins_ != other.bins_ || adaptive_ != other.adaptive_) {
+            throw std::invalid_argument("Histograms have different bins");
+        }
+        for (tensorSize band = 0; band < bands_; band++) {
+            if (ranged_[band] && other.ranged_[band] && (low_[band] != other.low_[band] || width_[band] != other.width_[band])) {
+                throw std::invalid_argument("Histograms have different bins");
+            }
+        }
+        for (tensorSize band = 0; band < bands_; band++) {
+            if (!ranged_[band] && other.ranged_[band]) {
+                low_[band] = other.low_[band];
+                width_[band] = other.width_[band];
+                ranged_[band] = true;
+            }
+            min_[band] = std::min(min_[band], other.min_[band]);
+            max_[band] = std::max(max_[band], other.max_[band]);
+        }
+        for (tensorSize i = 0; i < counts_.size(); i++) {
+            counts_[i] += other.counts_[i];
+        }
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    typename Histogram<DType, axis_, bands_>::Count Histogram<DType, axis_, bands_>::count(tensorSize band, tensorSize bin) const noexcept {
+        return counts_[band * slots() + bin + 1];
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    typename Histogram<DType, axis_, bands_>::Count Histogram<DType, axis_, bands_>::below(tensorSize band) const noexcept {
+        return counts_[band * slots()];
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    typename Histogram<DType, axis_, bands_>::Count Histogram<DType, axis_, bands_>::above(tensorSize band) const noexcept {
+        return counts_[band * slots() + bins_ + 1];
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    typename Histogram<DType, axis_, bands_>::Count Histogram<DType, axis_, bands_>::nans(tensorSize band) const noexcept {
+        return counts_[band * slots() + bins_ + 2];
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    typename Histogram<DType, axis_, bands_>::Count Histogram<DType, axis_, bands_>::total(tensorSize band) const noexcept {
+        const auto first = counts_.begin() + static_cast<std::ptrdiff_t>(band * slots());
+        return std::accumulate(first, first + static_cast<std::ptrdiff_t>(bins_ + 2), Count {0});
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    double Histogram<DType, axis_, bands_>::binLow(tensorSize band, tensorSize bin) const noexcept {
+        if (!ranged_[band]) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        return low_[band] + static_cast<double>(bin) * width_[band];
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    double Histogram<DType, axis_, bands_>::min(tensorSize band) const noexcept {
+        return total(band) == 0 ? std::numeric_limits<double>::quiet_NaN() : min_[band];
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    double Histogram<DType, axis_, bands_>::max(tensorSize band) const noexcept {
+        return total(band) == 0 ? std::numeric_limits<double>::quiet_NaN() : max_[band];
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    double Histogram<DType, axis_, bands_>::quantile(tensorSize band, double q) const {
+        if (!(q >= 0 && q <= 1)) {
+            throw std::invalid_argument("Quantile must be between 0 and 1");
+        }
+        const Count n = total(band);
+        if (n == 0) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (q == 0) {
+            return min_[band];
+        }
+        if (q == 1) {
+            return max_[band];
+        }
+        const double target = q * static_cast<double>(n);
+        const Count* counts = counts_.data() + band * slots();
+        double before = 0;
+        for (tensorSize slot = 0; slot < bins_ + 2; slot++) {
+            const auto count = static_cast<double>(counts[slot]);
+            if (count == 0 || before + count < target) {
+                before += count;
+                continue;
+            }
+            // Below and above the range reach out to the extremes, which may be infinite
+            if (slot == 0 && std::isinf(min_[band])) {
+                return min_[band];
+            }
+            if (slot == bins_ + 1 && std::isinf(max_[band])) {
+                return max_[band];
+            }
+            const double low = slot == 0 ? min_[band] : binLow(band, slot - 1);
+            const double high = slot == bins_ + 1 ? max_[band] : binLow(band, slot);
+            const double value = low + (target - before) / count * (high - low);
+            return std::clamp(value, min_[band], max_[band]);
+        }
+        return max_[band];
+    }
+
+    template <Scalar DType, tensorRank axis_, tensorSize bands_>
+    requires (bands_ > 0)
+    std::array<double, bands_> Histogram<DType, axis_, bands_>::quantiles(double q) const {
+        std::array<double, bands_> result;
+        for (tensorSize band = 0; band < bands_; band++) {
+            result[band] = quantile(band, q);
+        }
+        return result;
+    }
+    //endregion Histogram
+}
+
+#endif //TENSOR_HISTOGRAM_TPP
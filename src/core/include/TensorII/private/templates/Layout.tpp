@@ -0,0 +1,459 @@
+#ifndef TENSOR_LAYOUT_TPP
+#define TENSOR_LAYOUT_TPP
+
+#include "TensorII/Layout.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <utility>
+
+#if defined(__BMI2__) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace TensorII::Core {
+
+    namespace Private {
+        template <auto shape>
+        constexpr std::array<tensorSize, shape.rank()> extentsOf() noexcept {
+            std::array<tensorSize, shape.rank()> extents {};
+            for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+                extents[axis] = static_cast<tensorSize>(shape[axis]);
+            }
+            return extents;
+        }
+
+        // Strides with the last axis contiguous
+        template <tensorRank rank>
+        constexpr std::array<tensorSize, rank> rowMajorStrides(const std::array<tensorSize, rank>& extents) noexcept {
+            std::array<tensorSize, rank> strides {};
+            tensorSize stride = 1;
+            for (tensorRank axis = rank; axis-- > 0; ) {
+                strides[axis] = stride;
+                stride *= extents[axis];
+            }
+            return strides;
+        }
+
+        // Strides with the first axis contiguous
+        template <tensorRank rank>
+        constexpr std::array<tensorSize, rank> columnMajorStrides(const std::array<tensorSize, rank>& extents) noexcept {
+            std::array<tensorSize, rank> strides {};
+            tensorSize stride = 1;
+            for (tensorRank axis = 0; axis < rank; axis++) {
+                strides[axis] = stride;
+                stride *= extents[axis];
+            }
+            return strides;
+        }
+
+        template <tensorRank rank>
+        constexpr tensorSize applyStrides(const std::array<tensorSize, rank>& index,
+                                          const std::array<tensorSize, rank>& strides) noexcept {
+            tensorSize offset = 0;
+            for (tensorRank axis = 0; axis < rank; axis++) {
+                offset += index[axis] * strides[axis];
+            }
+            return offset;
+        }
+
+        // Variable templates, so the strides are computed once per shape at compile time
+        template <auto shape>
+        inline constexpr auto rowMajorStridesOf = rowMajorStrides(extentsOf<shape>());
+
+        template <auto shape>
+        inline constexpr auto columnMajorStridesOf = columnMajorStrides(extentsOf<shape>());
+
+        // Strides of the grid of tiles, in units of whole tiles
+        template <auto shape, typename Layout>
+        inline constexpr auto tileGridStridesOf = [] {
+            std::array<tensorSize, shape.rank()> grid = extentsOf<shape>();
+            for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+                grid[axis] /= Layout::tileShape[axis];
+            }
+            return rowMajorStrides(grid);
+        }();
+
+        template <typename Layout>
+        inline constexpr auto tileStridesOf = rowMajorStrides(Layout::tileShape);
+
+        // Odometer over the multi-index, the first axis fastest when 'firstFastest', the last otherwise
+        template <auto shape, bool firstFastest, typename Function>
+        constexpr void forEachIndexInOrder(Function&& function) {
+            std::array<tensorSize, shape.rank()> index {};
+            for (tensorSize offset = 0; offset < shape.n_elems(); offset++) {
+                function(offset, std::as_const(index));
+                for (tensorRank step = 0; step < shape.rank(); step++) {
+                    const tensorRank axis = firstFastest ? step : shape.rank() - 1 - step;
+                    if (++index[axis] < static_cast<tensorSize>(shape[axis])) {
+                        break;
+                    }
+                    index[axis] = 0;
+                }
+            }
+        }
+
+        template <auto shape, typename Layout, typename Function>
+        constexpr void forEachIndexByDecoding(Function&& function) {
+            for (tensorSize offset = 0; offset < shape.n_elems(); offset++) {
+                function(offset, Layout::template indexOf<shape>(offset));
+            }
+        }
+
+        // Scatters the low bits of 'value' to the set bits of 'mask', lowest first, as pdep does
+        constexpr uint64_t depositBits(uint64_t value, uint64_t mask) noexcept {
+            uint64_t result = 0;
+            for (; value != 0 && mask != 0; value >>= 1, mask &= mask - 1) {
+                if (value & 1) {
+                    result |= mask & (~mask + 1);
+                }
+            }
+            return result;
+        }
+
+        // Gathers the bits of 'value' under the set bits of 'mask' into the low bits, as pext does
+        constexpr uint64_t extractBits(uint64_t value, uint64_t mask) noexcept {
+            uint64_t result = 0;
+            for (uint64_t bit = 1; mask != 0; bit <<= 1, mask &= mask - 1) {
+                if (value & mask & (~mask + 1)) {
+                    result |= bit;
+                }
+            }
+            return result;
+        }
+
+        // Bits of a Morton offset belonging to each axis: one bit per axis per level, last axis lowest,
+        // skipping axes which have run out of bits
+        template <auto shape>
+        inline constexpr auto mortonMasksOf = [] {
+            std::array<uint64_t, shape.rank()> masks {};
+            uint64_t position = 0;
+            for (tensorRank level = 0; position < 64; level++) {
+                bool any = false;
+                for (tensorRank axis = shape.rank(); axis-- > 0; ) {
+                    if (level < static_cast<tensorRank>(std::countr_zero(static_cast<uint64_t>(shape[axis])))) {
+                        masks[axis] |= uint64_t(1) << position++;
+                        any = true;
+                    }
+                }
+                if (!any) {
+                    break;
+                }
+            }
+            return masks;
+        }();
+
+        // Without BMI2, depositing and extracting go a byte at a time through tables, like libmorton's. One
+        // table of 256 per byte of the widest index for encoding, and per byte of an offset for decoding.
+        template <auto shape>
+        inline constexpr tensorSize mortonIndexBytes = [] {
+            tensorSize widest = 0;
+            for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+                widest = std::max<tensorSize>(widest, static_cast<tensorSize>(std::countr_zero(static_cast<uint64_t>(shape[axis]))));
+            }
+            return std::max<tensorSize>((widest + 7) / 8, 1);
+        }();
+
+        template <auto shape>
+        inline constexpr tensorSize mortonOffsetBytes = std::max<tensorSize>((std::bit_width(static_cast<uint64_t>(shape.n_elems()) - 1) + 7) / 8, 1);
+
+        template <auto shape>
+        inline constexpr auto mortonEncodeTablesOf = [] {
+            std::array<std::array<std::array<uint64_t, 256>, mortonIndexBytes<shape>>, shape.rank()> tables {};
+            for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+                for (tensorSize byte = 0; byte < mortonIndexBytes<shape>; byte++) {
+                    for (uint64_t value = 0; value < 256; value++) {
+                        tables[axis][byte][value] = depositBits(value << (8 * byte), mortonMasksOf<shape>[axis]);
+                    }
+                }
+            }
+            return tables;
+        }();
+
+        template <auto shape>
+        inline constexpr auto mortonDecodeTablesOf = [] {
+            std::array<std::array<std::array<uint64_t, 256>, mortonOffsetBytes<shape>>, shape.rank()> tables {};
+            for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+                for (tensorSize byte = 0; byte < mortonOffsetBytes<shape>; byte++) {
+                    for (uint64_t value = 0; value < 256; value++) {
+                        tables[axis][byte][value] = extractBits(value << (8 * byte), mortonMasksOf<shape>[axis]);
+                    }
+                }
+            }
+            return tables;
+        }();
+
+        template <auto shape>
+        constexpr uint64_t mortonDeposit(tensorRank axis, uint64_t value) noexcept {
+#if defined(__BMI2__) && defined(__x86_64__)
+            if (!std::is_constant_evaluated()) {
+                return _pdep_u64(value, mortonMasksOf<shape>[axis]);
+            }
+#endif
+            uint64_t result = 0;
+            for (tensorSize byte = 0; byte < mortonEncodeTablesOf<shape>[axis].size(); byte++) {
+                result |= mortonEncodeTablesOf<shape>[axis][byte][(value >> (8 * byte)) & 0xFF];
+            }
+            return result;
+        }
+
+        template <auto shape>
+        constexpr uint64_t mortonExtract(tensorRank axis, uint64_t offset) noexcept {
+#if defined(__BMI2__) && defined(__x86_64__)
+            if (!std::is_constant_evaluated()) {
+                return _pext_u64(offset, mortonMasksOf<shape>[axis]);
+            }
+#endif
+            uint64_t result = 0;
+            for (tensorSize byte = 0; byte < mortonDecodeTablesOf<shape>[axis].size(); byte++) {
+                result |= mortonDecodeTablesOf<shape>[axis][byte][(offset >> (8 * byte)) & 0xFF];
+            }
+            return result;
+        }
+
+        // Indices within the first chunk of a Morton layout, in which every axis has the same number of bits,
+        // so that storage order iteration only decodes once per chunk. At most 64 elements.
+        template <auto shape>
+        inline constexpr tensorSize mortonChunkBits = [] {
+            tensorRank levels = 6 / shape.rank();
+            for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+                levels = std::min<tensorRank>(levels, static_cast<tensorRank>(std::countr_zero(static_cast<uint64_t>(shape[axis]))));
+            }
+            return levels * shape.rank();
+        }();
+
+        template <auto shape>
+        inline constexpr auto mortonChunkOf = [] {
+            std::array<std::array<tensorSize, shape.rank()>, tensorSize(1) << mortonChunkBits<shape>> chunk {};
+            for (tensorSize code = 0; code < chunk.size(); code++) {
+                for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+                    chunk[code][axis] = extractBits(code, mortonMasksOf<shape>[axis]);
+                }
+            }
+            return chunk;
+        }();
+    }
+
+    //region RowMajor
+    template <auto shape>
+    constexpr bool RowMajor::fits() noexcept {
+        return true;
+    }
+
+    template <auto shape>
+    constexpr tensorSize RowMajor::offset(const std::array<tensorSize, shape.rank()>& index) noexcept {
+        return Private::applyStrides(index, Private::rowMajorStridesOf<shape>);
+    }
+
+    template <auto shape>
+    constexpr tensorSize RowMajor::axisOffset(tensorRank axis, tensorSize i) noexcept {
+        return i * Private::rowMajorStridesOf<shape>[axis];
+    }
+
+    template <auto shape>
+    constexpr tensorSize RowMajor::contiguousRun() noexcept {
+        if constexpr (shape.rank() == 0) {
+            return 1;
+        } else {
+            return static_cast<tensorSize>(shape[shape.rank() - 1]);
+        }
+    }
+
+    template <auto shape>
+    constexpr std::array<tensorSize, shape.rank()> RowMajor::indexOf(tensorSize offset) noexcept {
+        std::array<tensorSize, shape.rank()> index {};
+        for (tensorRank axis = shape.rank(); axis-- > 0; ) {
+            index[axis] = offset % static_cast<tensorSize>(shape[axis]);
+            offset /= static_cast<tensorSize>(shape[axis]);
+        }
+        return index;
+    }
+
+    template <auto shape, typename Function>
+    constexpr void RowMajor::forEachIndex(Function&& function) {
+        Private::forEachIndexInOrder<shape, false>(function);
+    }
+    //endregion
+
+    //region ColumnMajor
+    template <auto shape>
+    constexpr bool ColumnMajor::fits() noexcept {
+        return true;
+    }
+
+    template <auto shape>
+    constexpr tensorSize ColumnMajor::offset(const std::array<tensorSize, shape.rank()>& index) noexcept {
+        return Private::applyStrides(index, Private::columnMajorStridesOf<shape>);
+    }
+
+    template <auto shape>
+    constexpr tensorSize ColumnMajor::axisOffset(tensorRank axis, tensorSize i) noexcept {
+        return i * Private::columnMajorStridesOf<shape>[axis];
+    }
+
+    template <auto shape>
+    constexpr tensorSize ColumnMajor::contiguousRun() noexcept {
+        if constexpr (shape.rank() <= 1) {
+            return shape.n_elems();
+        } else {
+            return 1;
+        }
+    }
+
+    template <auto shape>
+    constexpr std::array<tensorSize, shape.rank()> ColumnMajor::indexOf(tensorSize offset) noexcept {
+        std::array<tensorSize, shape.rank()> index {};
+        for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+            index[axis] = offset % static_cast<tensorSize>(shape[axis]);
+            offset /= static_cast<tensorSize>(shape[axis]);
+        }
+        return index;
+    }
+
+    template <auto shape, typename Function>
+    constexpr void ColumnMajor::forEachIndex(Function&& function) {
+        Private::forEachIndexInOrder<shape, true>(function);
+    }
+    //endregion
+
+    //region Tiled
+    template <tensorDimension... tile>
+    requires (sizeof...(tile) > 0 && ((tile > 0) && ...))
+    template <auto shape>
+    constexpr bool Tiled<tile...>::fits() noexcept {
+        if (shape.rank() != sizeof...(tile)) {
+            return false;
+        }
+        for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+            if (static_cast<tensorSize>(shape[axis]) % tileShape[axis] != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <tensorDimension... tile>
+    requires (sizeof...(tile) > 0 && ((tile > 0) && ...))
+    template <auto shape>
+    constexpr tensorSize Tiled<tile...>::offset(const std::array<tensorSize, shape.rank()>& index) noexcept {
+        tensorSize offset = 0;
+        for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+            offset += axisOffset<shape>(axis, index[axis]);
+        }
+        return offset;
+    }
+
+    template <tensorDimension... tile>
+    requires (sizeof...(tile) > 0 && ((tile > 0) && ...))
+    template <auto shape>
+    constexpr tensorSize Tiled<tile...>::axisOffset(tensorRank axis, tensorSize i) noexcept {
+        // Which tile, then where within it
+        return (i / tileShape[axis]) * Private::tileGridStridesOf<shape, Tiled>[axis] * tileSize
+               + (i % tileShape[axis]) * Private::tileStridesOf<Tiled>[axis];
+    }
+
+    template <tensorDimension... tile>
+    requires (sizeof...(tile) > 0 && ((tile > 0) && ...))
+    template <auto shape>
+    constexpr tensorSize Tiled<tile...>::contiguousRun() noexcept {
+        return tileShape[sizeof...(tile) - 1];
+    }
+
+    template <tensorDimension... tile>
+    requires (sizeof...(tile) > 0 && ((tile > 0) && ...))
+    template <auto shape>
+    constexpr std::array<tensorSize, shape.rank()> Tiled<tile...>::indexOf(tensorSize offset) noexcept {
+        std::array<tensorSize, shape.rank()> index {};
+        tensorSize tileNumber = offset / tileSize;
+        tensorSize withinTile = offset % tileSize;
+        for (tensorRank axis = shape.rank(); axis-- > 0; ) {
+            const tensorSize tilesAlong = static_cast<tensorSize>(shape[axis]) / tileShape[axis];
+            index[axis] = (tileNumber % tilesAlong) * tileShape[axis] + withinTile % tileShape[axis];
+            tileNumber /= tilesAlong;
+            withinTile /= tileShape[axis];
+        }
+        return index;
+    }
+
+    template <tensorDimension... tile>
+    requires (sizeof...(tile) > 0 && ((tile > 0) && ...))
+    template <auto shape, typename Function>
+    constexpr void Tiled<tile...>::forEachIndex(Function&& function) {
+        Private::forEachIndexByDecoding<shape, Tiled>(function);
+    }
+    //endregion
+
+    //region Morton
+    template <auto shape>
+    constexpr bool Morton::fits() noexcept {
+        if (shape.rank() != 2 && shape.rank() != 3) {
+            return false;
+        }
+        tensorSize bits = 0;
+        for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+            if (shape[axis] <= 0 || !std::has_single_bit(static_cast<uint64_t>(shape[axis]))) {
+                return false;
+            }
+            bits += static_cast<tensorSize>(std::countr_zero(static_cast<uint64_t>(shape[axis])));
+        }
+        return bits < 64;
+    }
+
+    template <auto shape>
+    constexpr tensorSize Morton::offset(const std::array<tensorSize, shape.rank()>& index) noexcept {
+        tensorSize offset = 0;
+        for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+            offset |= Private::mortonDeposit<shape>(axis, index[axis]);
+        }
+        return offset;
+    }
+
+    template <auto shape>
+    constexpr tensorSize Morton::axisOffset(tensorRank axis, tensorSize i) noexcept {
+        return Private::mortonDeposit<shape>(axis, i);
+    }
+
+    template <auto shape>
+    constexpr tensorSize Morton::contiguousRun() noexcept {
+        return tensorSize(1) << std::countr_one(Private::mortonMasksOf<shape>[shape.rank() - 1]);
+    }
+
+    template <auto shape>
+    constexpr std::array<tensorSize, shape.rank()> Morton::indexOf(tensorSize offset) noexcept {
+        std::array<tensorSize, shape.rank()> index {};
+        for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+            index[axis] = Private::mortonExtract<shape>(axis, offset);
+        }
+        return index;
+    }
+
+    template <auto shape, typename Function>
+    constexpr void Morton::forEachIndex(Function&& function) {
+        // Offsets of a chunk share their high bits, so each chunk is decoded once and the low bits looked up
+        constexpr auto& chunk = Private::mortonChunkOf<shape>;
+        for (tensorSize base = 0; base < shape.n_elems(); base += chunk.size()) {
+            const std::array<tensorSize, shape.rank()> baseIndex = indexOf<shape>(base);
+            for (tensorSize code = 0; code < chunk.size(); code++) {
+                std::array<tensorSize, shape.rank()> index {};
+                for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+                    index[axis] = baseIndex[axis] | chunk[code][axis];
+                }
+                function(base + code, std::as_const(index));
+            }
+        }
+    }
+
+    template <auto shape>
+    constexpr tensorSize Morton::neighbour(tensorSize offset, tensorRank axis, tensorIndex delta) noexcept {
+        const uint64_t mask = Private::mortonMasksOf<shape>[axis];
+        const tensorIndex extent = shape[axis];
+        const uint64_t step = Private::mortonDeposit<shape>(axis, static_cast<uint64_t>((delta % extent + extent) % extent));
+        // Setting the other axes' bits carries straight through them
+        const uint64_t moved = ((offset | ~mask) + step) & mask;
+        return (offset & ~mask) | moved;
+    }
+    //endregion
+}
+
+#endif //TENSOR_LAYOUT_TPP
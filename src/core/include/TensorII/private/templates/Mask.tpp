@@ -0,0 +1,255 @@
+#ifndef TENSOR_MASK_TPP
+#define TENSOR_MASK_TPP
+
+#include "TensorII/Mask.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/private/MaskKernels.h"
+
+namespace TensorII::Core {
+
+    //region Mask
+    template <auto shape_, TensorLayout Layout_>
+    constexpr tensorSize Mask<shape_, Layout_>::size() noexcept {
+        return shape_.n_elems();
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr tensorSize Mask<shape_, Layout_>::nWords() noexcept {
+        return (size() + wordBits - 1) / wordBits;
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr tensorSize Mask<shape_, Layout_>::size_in_bytes() noexcept {
+        return nWords() * sizeof(Word);
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr typename Mask<shape_, Layout_>::Word Mask<shape_, Layout_>::lastWordBits() noexcept {
+        constexpr tensorSize used = size() % wordBits;
+        return used == 0 ? ~Word {0} : (Word {1} << used) - 1;
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr Mask<shape_, Layout_>::Mask()
+    : words_ {}
+    {}
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr Mask<shape_, Layout_>::Mask(bool value)
+    : words_ {}
+    {
+        if (value) {
+            words_.fill(~Word {0});
+            if constexpr (nWords() > 0) {
+                words_.back() &= lastWordBits();
+            }
+        }
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr bool Mask<shape_, Layout_>::test(tensorSize offset) const noexcept {
+        return ((words_[offset / wordBits] >> (offset % wordBits)) & 1) != 0;
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr void Mask<shape_, Layout_>::set(tensorSize offset, bool value) noexcept {
+        const Word bit = Word {1} << (offset % wordBits);
+        Word& word = words_[offset / wordBits];
+        word = value ? word | bit : word & ~bit;
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr void Mask<shape_, Layout_>::setWord(tensorSize word, Word bits) noexcept {
+        words_[word] = word + 1 == nWords() ? bits & lastWordBits() : bits;
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    template <std::convertible_to<tensorSize> ... Indices>
+    requires (sizeof...(Indices) == shape_.rank())
+    constexpr bool Mask<shape_, Layout_>::at(const Indices& ... indices) const noexcept {
+        return test(Layout::template offset<shape_>({static_cast<tensorSize>(indices)...}));
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr const typename Mask<shape_, Layout_>::Word* Mask<shape_, Layout_>::words() const noexcept {
+        return words_.data();
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr tensorSize Mask<shape_, Layout_>::count() const noexcept {
+        tensorSize set = 0;
+        for (Word word : words_) {
+            set += static_cast<tensorSize>(std::popcount(word));
+        }
+        return set;
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr bool Mask<shape_, Layout_>::any() const noexcept {
+        for (Word word : words_) {
+            if (word != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr bool Mask<shape_, Layout_>::all() const noexcept {
+        return count() == size();
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr Mask<shape_, Layout_>& Mask<shape_, Layout_>::operator&=(const Mask& other) noexcept {
+        for (tensorSize i = 0; i < nWords(); i++) {
+            words_[i] &= other.words_[i];
+        }
+        return *this;
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr Mask<shape_, Layout_>& Mask<shape_, Layout_>::operator|=(const Mask& other) noexcept {
+        for (tensorSize i = 0; i < nWords(); i++) {
+            words_[i] |= other.words_[i];
+        }
+        return *this;
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr Mask<shape_, Layout_>& Mask<shape_, Layout_>::operator^=(const Mask& other) noexcept {
+        for (tensorSize i = 0; i < nWords(); i++) {
+            words_[i] ^= other.words_[i];
+        }
+        return *this;
+    }
+
+    template <auto shape_, TensorLayout Layout_>
+    constexpr Mask<shape_, Layout_> Mask<shape_, Layout_>::operator~() const noexcept {
+        Mask inverse;
+        for (tensorSize i = 0; i < nWords(); i++) {
+            inverse.setWord(i, ~words_[i]);
+        }
+        return inverse;
+    }
+
+    template <auto shape, TensorLayout Layout>
+    constexpr Mask<shape, Layout> operator&(const Mask<shape, Layout>& lhs, const Mask<shape, Layout>& rhs) noexcept {
+        Mask<shape, Layout> result;
+        for (tensorSize i = 0; i < result.nWords(); i++) {
+            result.setWord(i, lhs.words()[i] & rhs.words()[i]);
+        }
+        return result;
+    }
+
+    template <auto shape, TensorLayout Layout>
+    constexpr Mask<shape, Layout> operator|(const Mask<shape, Layout>& lhs, const Mask<shape, Layout>& rhs) noexcept {
+        Mask<shape, Layout> result;
+        for (tensorSize i = 0; i < result.nWords(); i++) {
+            result.setWord(i, lhs.words()[i] | rhs.words()[i]);
+        }
+        return result;
+    }
+
+    template <auto shape, TensorLayout Layout>
+    constexpr Mask<shape, Layout> operator^(const Mask<shape, Layout>& lhs, const Mask<shape, Layout>& rhs) noexcept {
+        Mask<shape, Layout> result;
+        for (tensorSize i = 0; i < result.nWords(); i++) {
+            result.setWord(i, lhs.words()[i] ^ rhs.words()[i]);
+        }
+        return result;
+    }
+    //endregion
+
+    template <Scalar DType, auto shape, TensorLayout Layout, std::predicate<DType> Predicate>
+    constexpr Mask<shape, Layout> makeMask(const Tensor<DType, shape, Layout>& tensor, Predicate predicate) {
+        using MaskType = Mask<shape, Layout>;
+        using Word = typename MaskType::Word;
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("makeMask", Elementwise, n, n * sizeof(DType) + MaskType::size_in_bytes());
+        MaskType mask;
+        // A word at a time, so each is written once
+        for (tensorSize word = 0; word < MaskType::nWords(); word++) {
+            const tensorSize first = word * MaskType::wordBits;
+            const tensorSize count = std::min(MaskType::wordBits, n - first);
+            Word bits = 0;
+            for (tensorSize bit = 0; bit < count; bit++) {
+                bits |= static_cast<Word>(static_cast<bool>(predicate(tensor.data()[first + bit]))) << bit;
+            }
+            mask.setWord(word, bits);
+        }
+        return mask;
+    }
+
+    namespace Private {
+        template <typename DType>
+        inline constexpr bool hasMaskKernels = std::same_as<DType, float> || std::same_as<DType, double>
+                                               || std::same_as<DType, std::uint8_t> || std::same_as<DType, std::uint16_t>
+                                               || std::same_as<DType, std::int8_t> || std::same_as<DType, std::int16_t>;
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void where(const Mask<shape, Layout>& mask, const Tensor<DType, shape, Layout>& whereSet,
+                         const Tensor<DType, shape, Layout>& whereClear, Tensor<DType, shape, Layout>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        constexpr tensorSize bytes = 3 * n * sizeof(DType) + Mask<shape, Layout>::size_in_bytes();
+        TENSORII_INSTRUMENT_OP("where", Elementwise, n, bytes);
+        if constexpr (Private::hasMaskKernels<DType>) {
+            if (!std::is_constant_evaluated()) {
+                Private::select(mask.words(), whereSet.data(), whereClear.data(), out.data(), n);
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            out.data()[i] = mask.test(i) ? whereSet.data()[i] : whereClear.data()[i];
+        }
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void maskedFill(Tensor<DType, shape, Layout>& tensor, const Mask<shape, Layout>& mask, DType value) {
+        constexpr tensorSize n = shape.n_elems();
+        constexpr tensorSize bytes = 2 * n * sizeof(DType) + Mask<shape, Layout>::size_in_bytes();
+        TENSORII_INSTRUMENT_OP("maskedFill", Elementwise, n, bytes);
+        if constexpr (Private::hasMaskKernels<DType>) {
+            if (!std::is_constant_evaluated()) {
+                Private::fill(mask.words(), value, tensor.data(), n);
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            tensor.data()[i] = mask.test(i) ? value : tensor.data()[i];
+        }
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr Accumulator<DType> sum(const Tensor<DType, shape, Layout>& tensor, const Mask<shape, Layout>& mask) {
+        constexpr tensorSize n = shape.n_elems();
+        constexpr tensorSize bytes = n * sizeof(DType) + Mask<shape, Layout>::size_in_bytes();
+        TENSORII_INSTRUMENT_OP("maskedSum", Reduction, n, bytes);
+        if constexpr (Private::hasMaskKernels<DType>) {
+            if (!std::is_constant_evaluated()) {
+                return Private::maskedSum(mask.words(), tensor.data(), n);
+            }
+        }
+        Accumulator<DType> result {};
+        for (tensorSize i = 0; i < n; i++) {
+            result += mask.test(i) ? static_cast<Accumulator<DType>>(tensor.data()[i]) : Accumulator<DType> {};
+        }
+        return result;
+    }
+
+    template <std::floating_point DType, auto shape, TensorLayout Layout>
+    constexpr DType mean(const Tensor<DType, shape, Layout>& tensor, const Mask<shape, Layout>& mask) {
+        const tensorSize count = mask.count();
+        if (count == 0) {
+            return std::numeric_limits<DType>::quiet_NaN();
+        }
+        return sum(tensor, mask) / static_cast<DType>(count);
+    }
+}
+
+#endif //TENSOR_MASK_TPP
@@ -0,0 +1,327 @@
+#ifndef TENSOR_OPERATIONS_TPP
+#define TENSOR_OPERATIONS_TPP
+
+#include "TensorII/Operations.h"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/private/ComplexKernels.h"
+#include "TensorII/private/ConvolutionKernels.h"
+#include "TensorII/private/ElementwiseKernels.h"
+#include "TensorII/private/HalfKernels.h"
+
+namespace TensorII::Core {
+
+    template <Scalar To, Scalar From, auto shape, TensorLayout Layout>
+    constexpr void convert(const Tensor<From, shape, Layout>& in, Tensor<To, shape, Layout>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("convert", Elementwise, n, n * (sizeof(From) + sizeof(To)));
+        if (!std::is_constant_evaluated()) {
+            if constexpr (ReducedFloat<From> && std::same_as<To, float>) {
+                Private::widen(in.data(), out.data(), n);
+                return;
+            } else if constexpr (std::same_as<From, float> && ReducedFloat<To>) {
+                Private::narrow(in.data(), out.data(), n);
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            out.data()[i] = static_cast<To>(in.data()[i]);
+        }
+    }
+
+    namespace Private {
+        // Side of the square blocks a transposing relayout works through. Kept small because with power of two
+        // extents every line of a block's strided side maps to the same cache set, and L1 has only 8-12 ways.
+        inline constexpr tensorSize relayoutBlock = 8;
+
+        // Shortest contiguous run along the last axis worth a copy of its own
+        inline constexpr tensorSize relayoutMinimumRun = 8;
+
+        // Narrowest matrix product worth a kernel call per row; below it the loop unrolls and wins
+        inline constexpr tensorSize matmulMinimumColumns = 16;
+    }
+
+    template <Scalar DType, auto shape, TensorLayout From, TensorLayout To>
+    constexpr void relayout(const Tensor<DType, shape, From>& in, Tensor<DType, shape, To>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        constexpr tensorRank rank = shape.rank();
+        TENSORII_INSTRUMENT_OP("relayout", Copy, n, 2 * n * sizeof(DType));
+
+        // Every layout of fewer than two axes is the same
+        if constexpr (std::same_as<From, To> || rank < 2) {
+            std::copy_n(in.data(), n, out.data());
+            return;
+        } else {
+            constexpr tensorSize run = std::gcd(From::template contiguousRun<shape>(), To::template contiguousRun<shape>());
+            constexpr auto extents = Private::extentsOf<shape>();
+            std::array<tensorSize, rank> index {};
+
+            if constexpr (run >= Private::relayoutMinimumRun) {
+                // Both keep the last axis contiguous for a while, e.g. row-major and tiled: copy run by run
+                for (tensorSize start = 0; start < n; start += run) {
+                    std::copy_n(in.data() + From::template offset<shape>(index), run,
+                                out.data() + To::template offset<shape>(index));
+                    index[rank - 1] += run;
+                    for (tensorRank axis = rank - 1; axis > 0 && index[axis] == extents[axis]; axis--) {
+                        index[axis] = 0;
+                        index[axis - 1]++;
+                    }
+                }
+            } else {
+                // Contiguous along different axes, e.g. row- to column-major: a transpose of the first and last
+                // axes for each index of the axes in between, in blocks. Offsets are sums of a term per axis, so
+                // the terms of a block's rows and columns are worked out once and added.
+                constexpr tensorSize first = extents[0];
+                constexpr tensorSize last = extents[rank - 1];
+                constexpr tensorSize block = Private::relayoutBlock;
+                std::array<tensorSize, block> rowsIn {}, rowsOut {}, columnsIn {}, columnsOut {};
+                for (tensorSize middle = 0; middle < n / (first * last); middle++) {
+                    tensorSize baseIn = 0;
+                    tensorSize baseOut = 0;
+                    for (tensorRank axis = 1; axis + 1 < rank; axis++) {
+                        baseIn += From::template axisOffset<shape>(axis, index[axis]);
+                        baseOut += To::template axisOffset<shape>(axis, index[axis]);
+                    }
+                    for (tensorSize i0 = 0; i0 < first; i0 += block) {
+                        const tensorSize rows = std::min(block, first - i0);
+                        for (tensorSize i = 0; i < rows; i++) {
+                            rowsIn[i] = baseIn + From::template axisOffset<shape>(0, i0 + i);
+                            rowsOut[i] = baseOut + To::template axisOffset<shape>(0, i0 + i);
+                        }
+                        for (tensorSize j0 = 0; j0 < last; j0 += block) {
+                            const tensorSize columns = std::min(block, last - j0);
+                            for (tensorSize j = 0; j < columns; j++) {
+                                columnsIn[j] = From::template axisOffset<shape>(rank - 1, j0 + j);
+                                columnsOut[j] = To::template axisOffset<shape>(rank - 1, j0 + j);
+                            }
+                            for (tensorSize i = 0; i < rows; i++) {
+                                for (tensorSize j = 0; j < columns; j++) {
+                                    out.data()[rowsOut[i] + columnsOut[j]] = in.data()[rowsIn[i] + columnsIn[j]];
+                                }
+                            }
+                        }
+                    }
+                    for (tensorRank axis = rank - 1; axis-- > 1; ) {
+                        if (++index[axis] < extents[axis]) {
+                            break;
+                        }
+                        index[axis] = 0;
+                    }
+                }
+            }
+        }
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void add(const Tensor<DType, shape, Layout>& lhs, const Tensor<DType, shape, Layout>& rhs,
+                       Tensor<DType, shape, Layout>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("add", Elementwise, n, 3 * n * sizeof(DType));
+        if constexpr (ReducedFloat<DType> || std::same_as<DType, float> || std::same_as<DType, double>) {
+            if (!std::is_constant_evaluated()) {
+                Private::add(lhs.data(), rhs.data(), out.data(), n);
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            out.data()[i] = lhs.data()[i] + rhs.data()[i];
+        }
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void subtract(const Tensor<DType, shape, Layout>& lhs, const Tensor<DType, shape, Layout>& rhs,
+                            Tensor<DType, shape, Layout>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("subtract", Elementwise, n, 3 * n * sizeof(DType));
+        if constexpr (ReducedFloat<DType> || std::same_as<DType, float> || std::same_as<DType, double>) {
+            if (!std::is_constant_evaluated()) {
+                Private::subtract(lhs.data(), rhs.data(), out.data(), n);
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            out.data()[i] = lhs.data()[i] - rhs.data()[i];
+        }
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void multiply(const Tensor<DType, shape, Layout>& lhs, const Tensor<DType, shape, Layout>& rhs,
+                            Tensor<DType, shape, Layout>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("multiply", Elementwise, n, 3 * n * sizeof(DType));
+        if constexpr (ReducedFloat<DType> || std::same_as<DType, float> || std::same_as<DType, double>
+                      || Private::ComplexKernelScalar<DType>) {
+            if (!std::is_constant_evaluated()) {
+                Private::multiply(lhs.data(), rhs.data(), out.data(), n);
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            out.data()[i] = lhs.data()[i] * rhs.data()[i];
+        }
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void divide(const Tensor<DType, shape, Layout>& lhs, const Tensor<DType, shape, Layout>& rhs,
+                          Tensor<DType, shape, Layout>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("divide", Elementwise, n, 3 * n * sizeof(DType));
+        if constexpr (std::same_as<DType, float> || std::same_as<DType, double>) {
+            if (!std::is_constant_evaluated()) {
+                Private::divide(lhs.data(), rhs.data(), out.data(), n);
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            out.data()[i] = lhs.data()[i] / rhs.data()[i];
+        }
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr void scale(const Tensor<DType, shape, Layout>& in, DType factor, Tensor<DType, shape, Layout>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("scale", Elementwise, n, 2 * n * sizeof(DType));
+        if constexpr (std::same_as<DType, float> || std::same_as<DType, double>) {
+            if (!std::is_constant_evaluated()) {
+                // A weighted sum of one source
+                const DType* source = in.data();
+                Private::weightedSum(&source, &factor, 1, out.data(), n);
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < n; i++) {
+            out.data()[i] = factor * in.data()[i];
+        }
+    }
+
+    template <Scalar In, Scalar Out, auto shape, TensorLayout Layout, std::invocable<In> Function>
+    constexpr void map(const Tensor<In, shape, Layout>& in, Tensor<Out, shape, Layout>& out, Function function) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("map", Elementwise, n, n * (sizeof(In) + sizeof(Out)));
+        for (tensorSize i = 0; i < n; i++) {
+            out.data()[i] = static_cast<Out>(function(in.data()[i]));
+        }
+    }
+
+    template <Scalar Lhs, Scalar Rhs, Scalar Out, auto shape, TensorLayout Layout, std::invocable<Lhs, Rhs> Function>
+    constexpr void map(const Tensor<Lhs, shape, Layout>& lhs, const Tensor<Rhs, shape, Layout>& rhs,
+                       Tensor<Out, shape, Layout>& out, Function function) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("map", Elementwise, n, n * (sizeof(Lhs) + sizeof(Rhs) + sizeof(Out)));
+        for (tensorSize i = 0; i < n; i++) {
+            out.data()[i] = static_cast<Out>(function(lhs.data()[i], rhs.data()[i]));
+        }
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr Accumulator<DType> sum(const Tensor<DType, shape, Layout>& tensor) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("sum", Reduction, n, n * sizeof(DType));
+        if constexpr (ReducedFloat<DType> || std::same_as<DType, float> || std::same_as<DType, double>
+                      || Private::ComplexKernelScalar<DType>) {
+            if (!std::is_constant_evaluated()) {
+                return Private::sum(tensor.data(), n);
+            }
+        }
+        Accumulator<DType> result {};
+        for (tensorSize i = 0; i < n; i++) {
+            result += tensor.data()[i];
+        }
+        return result;
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr Accumulator<DType> dot(const Tensor<DType, shape, Layout>& lhs, const Tensor<DType, shape, Layout>& rhs) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("dot", Contraction, n, 2 * n * sizeof(DType));
+        if constexpr (ReducedFloat<DType> || std::same_as<DType, float> || std::same_as<DType, double>
+                      || Private::ComplexKernelScalar<DType>) {
+            if (!std::is_constant_evaluated()) {
+                return Private::dot(lhs.data(), rhs.data(), n);
+            }
+        }
+        Accumulator<DType> result {};
+        for (tensorSize i = 0; i < n; i++) {
+            result += static_cast<Accumulator<DType>>(lhs.data()[i]) * static_cast<Accumulator<DType>>(rhs.data()[i]);
+        }
+        return result;
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    constexpr Accumulator<DType> product(const Tensor<DType, shape, Layout>& tensor) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("product", Reduction, n, n * sizeof(DType));
+        Accumulator<DType> result {1};
+        for (tensorSize i = 0; i < n; i++) {
+            result *= static_cast<Accumulator<DType>>(tensor.data()[i]);
+        }
+        return result;
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    requires std::totally_ordered<DType>
+    constexpr DType min(const Tensor<DType, shape, Layout>& tensor) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("min", Reduction, n, n * sizeof(DType));
+        DType result = tensor.data()[0];
+        for (tensorSize i = 1; i < n; i++) {
+            result = tensor.data()[i] < result ? tensor.data()[i] : result;
+        }
+        return result;
+    }
+
+    template <Scalar DType, auto shape, TensorLayout Layout>
+    requires std::totally_ordered<DType>
+    constexpr DType max(const Tensor<DType, shape, Layout>& tensor) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("max", Reduction, n, n * sizeof(DType));
+        DType result = tensor.data()[0];
+        for (tensorSize i = 1; i < n; i++) {
+            result = result < tensor.data()[i] ? tensor.data()[i] : result;
+        }
+        return result;
+    }
+
+    template <Scalar DType, auto lhsShape, auto rhsShape, auto outShape,
+              TensorLayout LhsLayout, TensorLayout RhsLayout, TensorLayout OutLayout>
+    requires (Private::multipliable<lhsShape, rhsShape, outShape>())
+    constexpr void matmul(const Tensor<DType, lhsShape, LhsLayout>& lhs, const Tensor<DType, rhsShape, RhsLayout>& rhs,
+                          Tensor<DType, outShape, OutLayout>& out) {
+        constexpr auto rows = static_cast<tensorSize>(lhsShape[0]);
+        constexpr auto inner = static_cast<tensorSize>(lhsShape[1]);
+        constexpr auto columns = static_cast<tensorSize>(rhsShape[1]);
+        TENSORII_INSTRUMENT_OP("matmul", Contraction, rows * inner * columns,
+                               (rows * inner + inner * columns + rows * columns) * sizeof(DType));
+        if constexpr ((std::same_as<DType, float> || std::same_as<DType, double> || Private::ComplexKernelScalar<DType>)
+                      && std::same_as<LhsLayout, RowMajor>
+                      && std::same_as<RhsLayout, RowMajor> && std::same_as<OutLayout, RowMajor>
+                      && columns >= Private::matmulMinimumColumns) {
+            if (!std::is_constant_evaluated()) {
+                // Each row of out is the rows of rhs weighted by that row of lhs
+                std::array<const DType*, inner> rhsRows {};
+                for (tensorSize k = 0; k < inner; k++) {
+                    rhsRows[k] = rhs.data() + k * columns;
+                }
+                for (tensorSize i = 0; i < rows; i++) {
+                    Private::weightedSum(rhsRows.data(), lhs.data() + i * inner, inner, out.data() + i * columns, columns);
+                }
+                return;
+            }
+        }
+        for (tensorSize i = 0; i < rows; i++) {
+            for (tensorSize j = 0; j < columns; j++) {
+                Accumulator<DType> total {};
+                for (tensorSize k = 0; k < inner; k++) {
+                    total += static_cast<Accumulator<DType>>(lhs.at(i, k)) * static_cast<Accumulator<DType>>(rhs.at(k, j));
+                }
+                out.at(i, j) = static_cast<DType>(total);
+            }
+        }
+    }
+}
+
+#endif //TENSOR_OPERATIONS_TPP
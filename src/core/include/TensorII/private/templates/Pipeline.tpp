@@ -0,0 +1,275 @@
+#ifndef TENSOR_PIPELINE_TPP
+#define TENSOR_PIPELINE_TPP
+
+#include "TensorII/Pipeline.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace TensorII::Core {
+
+    //region Channel
+    template <typename T>
+    struct Channel<T>::PushAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> suspended) {
+            PopAwaiter* popper = nullptr;
+            {
+                const std::scoped_lock lock (channel.mutex_);
+                if (channel.cancelled_ || channel.producers_ == 0) {
+                    return false;
+                }
+                accepted = true;
+                if (!channel.poppers_.empty()) {
+                    // The queue is empty if anyone's waiting on it: hand the item straight over
+                    popper = channel.poppers_.front();
+                    channel.poppers_.pop_front();
+                    popper->item.emplace(std::move(item));
+                }
+                else if (channel.items_.size() < channel.capacity_) {
+                    channel.items_.push_back(std::move(item));
+                    return false;
+                }
+                else {
+                    accepted = false;
+                    handle = suspended;
+                    channel.pushers_.push_back(this);
+                    return true;
+                }
+            }
+            channel.schedule(popper->handle);
+            return false;
+        }
+
+        bool await_resume() const noexcept { return accepted; }
+
+        Channel& channel;
+        T item;
+        bool accepted = false;
+        std::coroutine_handle<> handle;
+    };
+
+    template <typename T>
+    struct Channel<T>::PopAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> suspended) {
+            PushAwaiter* pusher = nullptr;
+            {
+                const std::scoped_lock lock (channel.mutex_);
+                if (channel.items_.empty()) {
+                    if (channel.cancelled_ || channel.producers_ == 0) {
+                        return false;
+                    }
+                    handle = suspended;
+                    channel.poppers_.push_back(this);
+                    return true;
+                }
+                item.emplace(std::move(channel.items_.front()));
+                channel.items_.pop_front();
+                if (channel.pushers_.empty()) {
+                    return false;
+                }
+                // Room for the first producer held back
+                pusher = channel.pushers_.front();
+                channel.pushers_.pop_front();
+                channel.items_.push_back(std::move(pusher->item));
+                pusher->accepted = true;
+            }
+            channel.schedule(pusher->handle);
+            return false;
+        }
+
+        std::optional<T> await_resume() noexcept { return std::move(item); }
+
+        Channel& channel;
+        std::optional<T> item;
+        std::coroutine_handle<> handle;
+    };
+
+    template <typename T>
+    Channel<T>::Channel(std::size_t capacity, std::size_t producers, ThreadPool& pool)
+    : capacity_(capacity), producers_(producers), pool_(pool) {
+        if (capacity == 0 || producers == 0) {
+            throw std::invalid_argument("A channel needs room for an item and at least one producer");
+        }
+    }
+
+    template <typename T>
+    auto Channel<T>::push(T item) {
+        return PushAwaiter {*this, std::move(item), false, {}};
+    }
+
+    template <typename T>
+    auto Channel<T>::pop() {
+        return PopAwaiter {*this, std::nullopt, {}};
+    }
+
+    template <typename T>
+    void Channel<T>::close() {
+        std::deque<PopAwaiter*> poppers;
+        {
+            const std::scoped_lock lock (mutex_);
+            if (producers_ == 0 || --producers_ > 0) {
+                return;
+            }
+            // Anyone waiting found the queue empty, and no more is coming
+            poppers.swap(poppers_);
+        }
+        for (PopAwaiter* popper : poppers) {
+            schedule(popper->handle);
+        }
+    }
+
+    template <typename T>
+    void Channel<T>::cancel() {
+        std::deque<T> dropped;
+        std::deque<PushAwaiter*> pushers;
+        std::deque<PopAwaiter*> poppers;
+        {
+            const std::scoped_lock lock (mutex_);
+            cancelled_ = true;
+            dropped.swap(items_);
+            pushers.swap(pushers_);
+            poppers.swap(poppers_);
+        }
+        for (PushAwaiter* pusher : pushers) {
+            schedule(pusher->handle);
+        }
+        for (PopAwaiter* popper : poppers) {
+            schedule(popper->handle);
+        }
+    }
+    //endregion
+
+    //region Frames
+    template <typename TensorType>
+    Frame<TensorType>& Frame<TensorType>::operator=(Frame&& other) noexcept {
+        if (this != &other) {
+            if (tensor_) {
+                pool_->release(std::move(tensor_));
+            }
+            pool_ = other.pool_;
+            tensor_ = std::move(other.tensor_);
+        }
+        return *this;
+    }
+
+    template <typename TensorType>
+    Frame<TensorType>::~Frame() {
+        if (tensor_) {
+            pool_->release(std::move(tensor_));
+        }
+    }
+
+    template <typename TensorType>
+    struct FramePool<TensorType>::AcquireAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> suspended) {
+            const std::scoped_lock lock (frames.mutex_);
+            if (!frames.free_.empty()) {
+                tensor = std::move(frames.free_.back());
+                frames.free_.pop_back();
+                return false;
+            }
+            handle = suspended;
+            frames.waiting_.push_back(this);
+            return true;
+        }
+
+        Frame<TensorType> await_resume() noexcept { return Frame<TensorType>(frames, std::move(tensor)); }
+
+        FramePool& frames;
+        std::unique_ptr<TensorType> tensor;
+        std::coroutine_handle<> handle;
+    };
+
+    template <typename TensorType>
+    FramePool<TensorType>::FramePool(std::size_t frames, ThreadPool& pool) : pool_(pool) {
+        if (frames == 0) {
+            throw std::invalid_argument("A frame pool needs at least one frame");
+        }
+        free_.reserve(frames);
+        for (std::size_t i = 0; i < frames; i++) {
+            free_.push_back(std::make_unique<TensorType>());
+        }
+    }
+
+    template <typename TensorType>
+    auto FramePool<TensorType>::acquire() {
+        return AcquireAwaiter {*this, nullptr, {}};
+    }
+
+    template <typename TensorType>
+    std::size_t FramePool<TensorType>::available() {
+        const std::scoped_lock lock (mutex_);
+        return free_.size();
+    }
+
+    template <typename TensorType>
+    void FramePool<TensorType>::release(std::unique_ptr<TensorType> tensor) {
+        AcquireAwaiter* waiter;
+        {
+            const std::scoped_lock lock (mutex_);
+            if (waiting_.empty()) {
+                free_.push_back(std::move(tensor));
+                return;
+            }
+            waiter = waiting_.front();
+            waiting_.pop_front();
+            waiter->tensor = std::move(tensor);
+        }
+        pool_.submit([handle = waiter->handle] { handle.resume(); });
+    }
+    //endregion
+
+    //region Stages
+    template <typename In, typename Out, typename Function>
+    StageTask transform(Channel<Frame<In>>& in, Channel<Frame<Out>>& out, FramePool<Out>& frames, Function function) {
+        try {
+            while (true) {
+                std::optional<Frame<In>> frame = co_await in.pop();
+                if (!frame) {
+                    break;
+                }
+                Frame<Out> result = co_await frames.acquire();
+                function(std::as_const(**frame), *result);
+                // Recycle the input before waiting on the next stage
+                frame.reset();
+                if (!co_await out.push(std::move(result))) {
+                    // Cancelled downstream: stop what's feeding this too
+                    in.cancel();
+                    break;
+                }
+            }
+        }
+        catch (...) {
+            in.cancel();
+            out.cancel();
+            throw;
+        }
+        out.close();
+    }
+
+    template <typename T, typename Function>
+    StageTask consume(Channel<T>& in, Function function) {
+        try {
+            while (true) {
+                std::optional<T> item = co_await in.pop();
+                if (!item) {
+                    break;
+                }
+                function(std::move(*item));
+            }
+        }
+        catch (...) {
+            in.cancel();
+            throw;
+        }
+    }
+    //endregion
+}
+
+#endif //TENSOR_PIPELINE_TPP
@@ -0,0 +1,366 @@
+#ifndef TENSOR_QUANTIZED_TPP
+#define TENSOR_QUANTIZED_TPP
+
+#include "TensorII/Quantized.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/private/QuantizedKernels.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        // Half away from zero, std::round isn't constexpr
+        constexpr int64_t roundToInteger(double value) {
+            return static_cast<int64_t>(value < 0 ? value - 0.5 : value + 0.5);
+        }
+
+        template <QuantizedStorage Stored>
+        constexpr int64_t sumRange(const Stored* in, tensorSize n) {
+            if constexpr (sizeof(Stored) <= 4) {
+                if (!std::is_constant_evaluated()) {
+                    return Private::sum(in, n);
+                }
+            }
+            int64_t result = 0;
+            for (tensorSize i = 0; i < n; i++) {
+                result += in[i];
+            }
+            return result;
+        }
+
+        template <QuantizedStorage Stored>
+        constexpr int64_t dotRange(const Stored* lhs, const Stored* rhs, tensorSize n) {
+            if constexpr (sizeof(Stored) <= 4) {
+                if (!std::is_constant_evaluated()) {
+                    return Private::dot(lhs, rhs, n);
+                }
+            }
+            int64_t result = 0;
+            for (tensorSize i = 0; i < n; i++) {
+                result += static_cast<int64_t>(lhs[i]) * static_cast<int64_t>(rhs[i]);
+            }
+            return result;
+        }
+
+        // Channels interleaved element by element have a stride the contiguous kernels can't take. Whole pixels
+        // are instead accumulated lane by lane into a fixed block of a cache line, a loop the compiler vectorises,
+        // and the lanes are folded into their channels at the end.
+        template <tensorSize nChannels, QuantizedStorage Stored>
+        constexpr tensorSize interleavedBlock() {
+            return nChannels * std::max<tensorSize>(1, 64 / (nChannels * sizeof(Stored)));
+        }
+
+        template <tensorSize nChannels, QuantizedStorage Stored>
+        constexpr void interleavedSums(const Stored* in, tensorSize n, std::array<int64_t, nChannels>& sums) {
+            constexpr tensorSize block = interleavedBlock<nChannels, Stored>();
+            std::array<int64_t, block> lanes {};
+            const tensorSize whole = n - n % block;
+            for (tensorSize i = 0; i < whole; i += block) {
+                for (tensorSize lane = 0; lane < block; lane++) {
+                    lanes[lane] += in[i + lane];
+                }
+            }
+            for (tensorSize lane = 0; lane < block; lane++) {
+                sums[lane % nChannels] += lanes[lane];
+            }
+            for (tensorSize i = whole; i < n; i++) {
+                sums[i % nChannels] += in[i];
+            }
+        }
+
+        template <tensorSize nChannels, QuantizedStorage Stored>
+        constexpr void interleavedDots(const Stored* lhs, const Stored* rhs, tensorSize n,
+                                       std::array<int64_t, nChannels>& products) {
+            constexpr tensorSize block = interleavedBlock<nChannels, Stored>();
+            std::array<int64_t, block> lanes {};
+            const tensorSize whole = n - n % block;
+            for (tensorSize i = 0; i < whole; i += block) {
+                for (tensorSize lane = 0; lane < block; lane++) {
+                    lanes[lane] += static_cast<int64_t>(lhs[i + lane]) * static_cast<int64_t>(rhs[i + lane]);
+                }
+            }
+            for (tensorSize lane = 0; lane < block; lane++) {
+                products[lane % nChannels] += lanes[lane];
+            }
+            for (tensorSize i = whole; i < n; i++) {
+                products[i % nChannels] += static_cast<int64_t>(lhs[i]) * static_cast<int64_t>(rhs[i]);
+            }
+        }
+    }
+
+    //region QuantizedTensor
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr tensorSize QuantizedTensor<Stored, shape_, axis_>::innerSize() {
+        tensorSize size = 1;
+        if constexpr (axis_ != perTensor) {
+            for (tensorRank i = axis_ + 1; i < shape_.rank(); i++) {
+                size *= static_cast<tensorSize>(shape_[i]);
+            }
+        } else {
+            size = shape_.n_elems();
+        }
+        return size;
+    }
+
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr tensorSize QuantizedTensor<Stored, shape_, axis_>::outerSize() {
+        return shape_.n_elems() / (innerSize() * nChannels);
+    }
+
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr QuantizedTensor<Stored, shape_, axis_>::QuantizedTensor()
+    : values_{}
+    , scales_{}
+    , zeroPoints_{}
+    {
+        scales_.fill(1.0f);
+    }
+
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr QuantizedTensor<Stored, shape_, axis_>::QuantizedTensor(float scale, int32_t zeroPoint)
+    requires (axis_ == perTensor)
+    : values_{}
+    , scales_{scale}
+    , zeroPoints_{zeroPoint}
+    {}
+
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr QuantizedTensor<Stored, shape_, axis_>::QuantizedTensor(const Scales& scales, const ZeroPoints& zeroPoints)
+    : values_{}
+    , scales_(scales)
+    , zeroPoints_(zeroPoints)
+    {}
+
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr QuantizedTensor<Stored, shape_, axis_>::QuantizedTensor(Tensor<Stored, shape_>&& values,
+                                                                       const Scales& scales, const ZeroPoints& zeroPoints)
+    : values_(std::move(values))
+    , scales_(scales)
+    , zeroPoints_(zeroPoints)
+    {}
+
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr Tensor<Stored, shape_>& QuantizedTensor<Stored, shape_, axis_>::values() noexcept {
+        return values_;
+    }
+
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr const Tensor<Stored, shape_>& QuantizedTensor<Stored, shape_, axis_>::values() const noexcept {
+        return values_;
+    }
+
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr const typename QuantizedTensor<Stored, shape_, axis_>::Scales&
+    QuantizedTensor<Stored, shape_, axis_>::scales() const noexcept {
+        return scales_;
+    }
+
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr const typename QuantizedTensor<Stored, shape_, axis_>::ZeroPoints&
+    QuantizedTensor<Stored, shape_, axis_>::zeroPoints() const noexcept {
+        return zeroPoints_;
+    }
+
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr void QuantizedTensor<Stored, shape_, axis_>::setParameters(const Scales& scales, const ZeroPoints& zeroPoints) {
+        scales_ = scales;
+        zeroPoints_ = zeroPoints;
+    }
+
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr tensorSize QuantizedTensor<Stored, shape_, axis_>::channelOf(tensorSize flatIndex) noexcept {
+        return (flatIndex / innerSize()) % nChannels;
+    }
+
+    template <QuantizedStorage Stored, auto shape_, tensorRank axis_>
+    requires (axis_ == perTensor || axis_ < shape_.rank())
+    constexpr float QuantizedTensor<Stored, shape_, axis_>::at(tensorSize flatIndex) const {
+        const tensorSize channel = channelOf(flatIndex);
+        const auto stored = static_cast<int64_t>(values_.data()[flatIndex]);
+        return scales_[channel] * static_cast<float>(stored - zeroPoints_[channel]);
+    }
+    //endregion
+
+    template <QuantizedStorage Stored, auto shape, tensorRank axis>
+    constexpr void quantize(const Tensor<float, shape>& in, QuantizedTensor<Stored, shape, axis>& out) {
+        using Quantized = QuantizedTensor<Stored, shape, axis>;
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Quantized::quantize", Elementwise, n, n * (sizeof(float) + sizeof(Stored)));
+        constexpr auto lowest = static_cast<int64_t>(std::numeric_limits<Stored>::lowest());
+        constexpr auto highest = static_cast<int64_t>(std::numeric_limits<Stored>::max());
+        const float* input = in.data();
+        Stored* output = out.values().data();
+        for (tensorSize i = 0; i < n; i++) {
+            const tensorSize channel = Quantized::channelOf(i);
+            const int64_t stored = Private::roundToInteger(static_cast<double>(input[i]) / out.scales()[channel])
+                                   + out.zeroPoints()[channel];
+            output[i] = static_cast<Stored>(std::clamp(stored, lowest, highest));
+        }
+    }
+
+    template <QuantizedStorage Stored, auto shape, tensorRank axis>
+    constexpr void dequantize(const QuantizedTensor<Stored, shape, axis>& in, Tensor<float, shape>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Quantized::dequantize", Elementwise, n, n * (sizeof(float) + sizeof(Stored)));
+        for (tensorSize i = 0; i < n; i++) {
+            out.data()[i] = in.at(i);
+        }
+    }
+
+    template <QuantizedStorage Out, QuantizedStorage Stored, auto shape, tensorRank axis>
+    requires (std::is_signed_v<Out> && sizeof(Out) > sizeof(Stored))
+    constexpr void add(const QuantizedTensor<Stored, shape, axis>& lhs, const QuantizedTensor<Stored, shape, axis>& rhs,
+                       QuantizedTensor<Out, shape, axis>& out) {
+        // s(a - za) + s(b - zb) = s((a + b) - (za + zb))
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Quantized::add", Elementwise, n, n * (2 * sizeof(Stored) + sizeof(Out)));
+        if (lhs.scales() != rhs.scales()) {
+            throw std::invalid_argument("Quantized add needs matching scales");
+        }
+        typename QuantizedTensor<Out, shape, axis>::ZeroPoints zeroPoints;
+        for (tensorSize channel = 0; channel < zeroPoints.size(); channel++) {
+            zeroPoints[channel] = lhs.zeroPoints()[channel] + rhs.zeroPoints()[channel];
+        }
+        out.setParameters(lhs.scales(), zeroPoints);
+        for (tensorSize i = 0; i < n; i++) {
+            out.values().data()[i] = static_cast<Out>(static_cast<Out>(lhs.values().data()[i]) + static_cast<Out>(rhs.values().data()[i]));
+        }
+    }
+
+    template <QuantizedStorage Out, QuantizedStorage Stored, auto shape, tensorRank axis>
+    requires (std::is_signed_v<Out> && sizeof(Out) > sizeof(Stored))
+    constexpr void subtract(const QuantizedTensor<Stored, shape, axis>& lhs, const QuantizedTensor<Stored, shape, axis>& rhs,
+                            QuantizedTensor<Out, shape, axis>& out) {
+        // s(a - za) - s(b - zb) = s((a - b) - (za - zb))
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Quantized::subtract", Elementwise, n, n * (2 * sizeof(Stored) + sizeof(Out)));
+        if (lhs.scales() != rhs.scales()) {
+            throw std::invalid_argument("Quantized subtract needs matching scales");
+        }
+        typename QuantizedTensor<Out, shape, axis>::ZeroPoints zeroPoints;
+        for (tensorSize channel = 0; channel < zeroPoints.size(); channel++) {
+            zeroPoints[channel] = lhs.zeroPoints()[channel] - rhs.zeroPoints()[channel];
+        }
+        out.setParameters(lhs.scales(), zeroPoints);
+        for (tensorSize i = 0; i < n; i++) {
+            out.values().data()[i] = static_cast<Out>(static_cast<Out>(lhs.values().data()[i]) - static_cast<Out>(rhs.values().data()[i]));
+        }
+    }
+
+    template <QuantizedStorage Out, QuantizedStorage Stored, auto shape, tensorRank axis>
+    requires (std::is_signed_v<Out> && sizeof(Out) > 2 * sizeof(Stored))
+    constexpr void multiply(const QuantizedTensor<Stored, shape, axis>& lhs, const QuantizedTensor<Stored, shape, axis>& rhs,
+                            QuantizedTensor<Out, shape, axis>& out) {
+        // sa(a - za) * sb(b - zb) = (sa * sb)((a - za)(b - zb) - 0)
+        using Quantized = QuantizedTensor<Stored, shape, axis>;
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Quantized::multiply", Elementwise, n, n * (2 * sizeof(Stored) + sizeof(Out)));
+        typename QuantizedTensor<Out, shape, axis>::Scales scales;
+        for (tensorSize channel = 0; channel < scales.size(); channel++) {
+            scales[channel] = lhs.scales()[channel] * rhs.scales()[channel];
+        }
+        out.setParameters(scales, {});
+
+        const Stored* a = lhs.values().data();
+        const Stored* b = rhs.values().data();
+        Out* result = out.values().data();
+        tensorSize i = 0;
+        for (tensorSize outer = 0; outer < Quantized::outerSize(); outer++) {
+            for (tensorSize channel = 0; channel < Quantized::nChannels; channel++) {
+                const auto za = static_cast<Out>(lhs.zeroPoints()[channel]);
+                const auto zb = static_cast<Out>(rhs.zeroPoints()[channel]);
+                for (tensorSize inner = 0; inner < Quantized::innerSize(); inner++, i++) {
+                    result[i] = static_cast<Out>((static_cast<Out>(a[i]) - za) * (static_cast<Out>(b[i]) - zb));
+                }
+            }
+        }
+    }
+
+    template <QuantizedStorage Stored, auto shape, tensorRank axis>
+    constexpr double sum(const QuantizedTensor<Stored, shape, axis>& tensor) {
+        using Quantized = QuantizedTensor<Stored, shape, axis>;
+        constexpr tensorSize n = shape.n_elems();
+        constexpr tensorSize inner = Quantized::innerSize();
+        TENSORII_INSTRUMENT_OP("Quantized::sum", Reduction, n, n * sizeof(Stored));
+
+        std::array<int64_t, Quantized::nChannels> sums {};
+        const Stored* data = tensor.values().data();
+        if constexpr (inner == 1) {
+            // Channels interleaved element by element, e.g. the bands of a pixel
+            Private::interleavedSums<Quantized::nChannels>(data, n, sums);
+        } else {
+            for (tensorSize outer = 0; outer < Quantized::outerSize(); outer++) {
+                const Stored* run = data + outer * Quantized::nChannels * inner;
+                for (tensorSize channel = 0; channel < Quantized::nChannels; channel++) {
+                    sums[channel] += Private::sumRange(run + channel * inner, inner);
+                }
+            }
+        }
+
+        constexpr auto perChannel = static_cast<int64_t>(n / Quantized::nChannels);
+        double result = 0;
+        for (tensorSize channel = 0; channel < Quantized::nChannels; channel++) {
+            const int64_t centered = sums[channel] - perChannel * tensor.zeroPoints()[channel];
+            result += static_cast<double>(tensor.scales()[channel]) * static_cast<double>(centered);
+        }
+        return result;
+    }
+
+    template <QuantizedStorage Stored, auto shape, tensorRank axis>
+    constexpr double dot(const QuantizedTensor<Stored, shape, axis>& lhs, const QuantizedTensor<Stored, shape, axis>& rhs) {
+        // sum (a - za)(b - zb) = sum ab - zb sum a - za sum b + n za zb, per channel
+        using Quantized = QuantizedTensor<Stored, shape, axis>;
+        constexpr tensorSize n = shape.n_elems();
+        constexpr tensorSize inner = Quantized::innerSize();
+        TENSORII_INSTRUMENT_OP("Quantized::dot", Contraction, n, 2 * n * sizeof(Stored));
+
+        std::array<int64_t, Quantized::nChannels> products {};
+        std::array<int64_t, Quantized::nChannels> lhsSums {};
+        std::array<int64_t, Quantized::nChannels> rhsSums {};
+        const Stored* a = lhs.values().data();
+        const Stored* b = rhs.values().data();
+        if constexpr (inner == 1) {
+            Private::interleavedDots<Quantized::nChannels>(a, b, n, products);
+            Private::interleavedSums<Quantized::nChannels>(a, n, lhsSums);
+            Private::interleavedSums<Quantized::nChannels>(b, n, rhsSums);
+        } else {
+            for (tensorSize outer = 0; outer < Quantized::outerSize(); outer++) {
+                const tensorSize offset = outer * Quantized::nChannels * inner;
+                for (tensorSize channel = 0; channel < Quantized::nChannels; channel++) {
+                    const tensorSize begin = offset + channel * inner;
+                    products[channel] += Private::dotRange(a + begin, b + begin, inner);
+                    lhsSums[channel] += Private::sumRange(a + begin, inner);
+                    rhsSums[channel] += Private::sumRange(b + begin, inner);
+                }
+            }
+        }
+
+        constexpr auto perChannel = static_cast<int64_t>(n / Quantized::nChannels);
+        double result = 0;
+        for (tensorSize channel = 0; channel < Quantized::nChannels; channel++) {
+            const int64_t za = lhs.zeroPoints()[channel];
+            const int64_t zb = rhs.zeroPoints()[channel];
+            const int64_t centered = products[channel] - zb * lhsSums[channel] - za * rhsSums[channel] + perChannel * za * zb;
+            result += static_cast<double>(lhs.scales()[channel]) * static_cast<double>(rhs.scales()[channel])
+                      * static_cast<double>(centered);
+        }
+        return result;
+    }
+}
+
+#endif //TENSOR_QUANTIZED_TPP
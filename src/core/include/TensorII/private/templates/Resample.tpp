@@ -0,0 +1,107 @@
+#ifndef TENSOR_RESAMPLE_TPP
+#define TENSOR_RESAMPLE_TPP
+
+#include "TensorII/Resample.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/private/Parallel.h"
+#include "TensorII/private/ResampleKernels.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        // Rank 2 images have one band
+        template <auto shape>
+        constexpr ImageExtents gridExtentsOf() noexcept {
+            return {static_cast<tensorSize>(shape[0]), static_cast<tensorSize>(shape[1]),
+                    shape.rank() == 3 ? static_cast<tensorSize>(shape[shape.rank() - 1]) : 1};
+        }
+
+        // Source pixel whose area holds the centre of output pixel i, in whole numbers so it's exact
+        constexpr tensorSize nearestSource(tensorSize i, tensorSize from, tensorSize to) noexcept {
+            return (2 * i + 1) * from / (2 * to);
+        }
+
+        template <typename DType>
+        void resizeNearest(const DType* in, ImageExtents inExtents, DType* out, ImageExtents outExtents) {
+            const tensorSize bands = inExtents.bands;
+            std::vector<tensorSize> sourceColumns (outExtents.columns);
+            for (tensorSize column = 0; column < outExtents.columns; column++) {
+                sourceColumns[column] = nearestSource(column, inExtents.columns, outExtents.columns);
+            }
+            parallelFor(outExtents.rows, resampleRowGrain(outExtents), [&](tensorSize begin, tensorSize end) {
+                for (tensorSize row = begin; row < end; row++) {
+                    const DType* sourceRow = in + nearestSource(row, inExtents.rows, outExtents.rows) * inExtents.columns * bands;
+                    DType* outRow = out + row * outExtents.columns * bands;
+                    for (tensorSize column = 0; column < outExtents.columns; column++) {
+                        std::copy_n(sourceRow + sourceColumns[column] * bands, bands, outRow + column * bands);
+                    }
+                }
+            });
+        }
+
+        template <typename DType, typename Coordinate>
+        void warpNearest(const DType* in, ImageExtents inExtents, const Coordinate* coordinates, DType* out,
+                         ImageExtents outExtents, Boundary boundary, DType boundaryValue) {
+            const tensorSize bands = inExtents.bands;
+            const auto nearest = [&](Coordinate position, tensorSize extent) {
+                const double rounded = std::floor(std::clamp(static_cast<double>(position), -farthestCoordinate, farthestCoordinate) + 0.5);
+                return wrapIndex(boundary, static_cast<tensorIndex>(rounded), static_cast<tensorIndex>(extent));
+            };
+            parallelFor(outExtents.rows, resampleRowGrain(outExtents), [&](tensorSize begin, tensorSize end) {
+                for (tensorSize pixel = begin * outExtents.columns; pixel < end * outExtents.columns; pixel++) {
+                    const Coordinate row = coordinates[2 * pixel];
+                    const Coordinate column = coordinates[2 * pixel + 1];
+                    DType* target = out + pixel * bands;
+                    const tensorIndex sourceRow = std::isnan(row) ? -1 : nearest(row, inExtents.rows);
+                    const tensorIndex sourceColumn = std::isnan(column) ? -1 : nearest(column, inExtents.columns);
+                    if (sourceRow < 0 || sourceColumn < 0) {
+                        std::fill_n(target, bands, boundaryValue);
+                    } else {
+                        const tensorSize source = static_cast<tensorSize>(sourceRow) * inExtents.columns + static_cast<tensorSize>(sourceColumn);
+                        std::copy_n(in + source * bands, bands, target);
+                    }
+                }
+            });
+        }
+    }
+
+    template <Interpolation interpolation, Boundary boundary, Scalar DType, auto inShape, auto outShape>
+    requires (Private::resamplable<inShape, outShape>() && Private::interpolates<interpolation, DType>)
+    void resize(const Tensor<DType, inShape>& in, Tensor<DType, outShape>& out, DType boundaryValue) {
+        constexpr tensorSize n = outShape.n_elems();
+        TENSORII_INSTRUMENT_OP("resize", Copy, n, (inShape.n_elems() + n) * sizeof(DType));
+        constexpr Private::ImageExtents inExtents = Private::gridExtentsOf<inShape>();
+        constexpr Private::ImageExtents outExtents = Private::gridExtentsOf<outShape>();
+        if constexpr (interpolation == Interpolation::Nearest) {
+            Private::resizeNearest(in.data(), inExtents, out.data(), outExtents);
+        } else {
+            Private::resize(in.data(), inExtents, out.data(), outExtents, interpolation, boundary, boundaryValue);
+        }
+    }
+
+    template <Interpolation interpolation, Boundary boundary, Scalar DType, auto inShape,
+              typename Coordinate, auto mapShape, auto outShape>
+    requires (Private::resamplable<inShape, outShape>() && Private::interpolates<interpolation, DType>
+              && Private::mapsCoordinates<Coordinate>
+              && mapShape.rank() == 3 && mapShape[0] == outShape[0] && mapShape[1] == outShape[1] && mapShape[2] == 2)
+    void warp(const Tensor<DType, inShape>& in, const Tensor<Coordinate, mapShape>& coordinates, Tensor<DType, outShape>& out,
+              DType boundaryValue) {
+        constexpr tensorSize n = outShape.n_elems();
+        constexpr tensorSize bytes = (inShape.n_elems() + n) * sizeof(DType) + mapShape.n_elems() * sizeof(Coordinate);
+        TENSORII_INSTRUMENT_OP("warp", Copy, n, bytes);
+        constexpr Private::ImageExtents inExtents = Private::gridExtentsOf<inShape>();
+        constexpr Private::ImageExtents outExtents = Private::gridExtentsOf<outShape>();
+        if constexpr (interpolation == Interpolation::Nearest) {
+            Private::warpNearest(in.data(), inExtents, coordinates.data(), out.data(), outExtents, boundary, boundaryValue);
+        } else {
+            Private::warp(in.data(), inExtents, coordinates.data(), out.data(), outExtents, interpolation, boundary, boundaryValue);
+        }
+    }
+}
+
+#endif //TENSOR_RESAMPLE_TPP
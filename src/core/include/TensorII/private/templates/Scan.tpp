@@ -0,0 +1,220 @@
+#ifndef TENSOR_SCAN_TPP
+#define TENSOR_SCAN_TPP
+
+#include "TensorII/Scan.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/private/AxisExtents.h"
+#include "TensorII/private/Parallel.h"
+#include "TensorII/private/ScanKernels.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        // Sequences along an axis other than the last are scanned up to scanLanesMost side by side, so each
+        // thread streams through long contiguous runs. Totals carried in a wider type are kept scanBlock at a
+        // time in an array the compiler vectorises over.
+        inline constexpr tensorSize scanLanesMost = 4096;
+        inline constexpr tensorSize scanBlock = 64;
+
+        template <typename Acc, typename DType, typename Op>
+        inline constexpr bool hasSumKernel = std::same_as<Acc, DType> && (std::same_as<DType, float> || std::same_as<DType, double>)
+                                             && (std::same_as<Op, std::plus<>> || std::same_as<Op, std::plus<DType>>);
+
+        // One contiguous sequence of n > 0 elements
+        template <typename Acc, typename DType, typename Op>
+        constexpr void scanRun(const DType* in, DType* out, tensorSize n, Op op) {
+            if constexpr (hasSumKernel<Acc, DType, Op>) {
+                if (!std::is_constant_evaluated()) {
+                    inclusiveSum(in, out, n);
+                    return;
+                }
+            }
+            Acc running = static_cast<Acc>(in[0]);
+            out[0] = static_cast<DType>(running);
+            for (tensorSize i = 1; i < n; i++) {
+                running = op(running, static_cast<Acc>(in[i]));
+                out[i] = static_cast<DType>(running);
+            }
+        }
+
+        // 'lanes' neighbouring sequences of n > 0 elements, each 'stride' on from the one before. Each step reads
+        // the running totals back from the step before, unless they're carried in a wider type.
+        template <typename Acc, typename DType, typename Op>
+        constexpr void scanLanes(const DType* in, DType* out, tensorSize n, tensorSize stride, tensorSize lanes, Op op) {
+            if constexpr (std::same_as<Acc, DType>) {
+                if (in != out) {
+                    std::copy_n(in, lanes, out);
+                }
+                for (tensorSize step = 1; step < n; step++) {
+                    const DType* source = in + step * stride;
+                    const DType* previous = out + (step - 1) * stride;
+                    DType* target = out + step * stride;
+                    for (tensorSize lane = 0; lane < lanes; lane++) {
+                        target[lane] = op(previous[lane], source[lane]);
+                    }
+                }
+            } else {
+                for (tensorSize first = 0; first < lanes; first += scanBlock) {
+                    const tensorSize count = std::min(scanBlock, lanes - first);
+                    std::array<Acc, scanBlock> running {};
+                    for (tensorSize step = 0; step < n; step++) {
+                        const DType* source = in + step * stride + first;
+                        DType* target = out + step * stride + first;
+                        for (tensorSize lane = 0; lane < count; lane++) {
+                            running[lane] = step == 0 ? static_cast<Acc>(source[lane]) : op(running[lane], static_cast<Acc>(source[lane]));
+                            target[lane] = static_cast<DType>(running[lane]);
+                        }
+                    }
+                }
+            }
+        }
+
+        // One long sequence split between threads. Where the totals are carried in the element type, each scans a
+        // chunk, then all but the first add on the totals of the chunks before theirs. Where they're carried in a
+        // wider type, the partial scans would be rounded to DType before the offsets went on, so each only totals
+        // its chunk at first, and then scans it again on from the totals before it, rounding every element once.
+        template <typename Acc, typename DType, typename Op>
+        void scanSplit(const DType* in, DType* out, tensorSize n, tensorSize chunks, Op op) {
+            const auto boundary = [&](tensorSize chunk) { return n * chunk / chunks; };
+            std::vector<Acc> offsets (chunks);
+            if constexpr (std::same_as<Acc, DType>) {
+                parallelFor(chunks, 1, [&](tensorSize begin, tensorSize end) {
+                    for (tensorSize chunk = begin; chunk < end; chunk++) {
+                        scanRun<Acc>(in + boundary(chunk), out + boundary(chunk), boundary(chunk + 1) - boundary(chunk), op);
+                    }
+                });
+
+                offsets[1] = out[boundary(1) - 1];
+                for (tensorSize chunk = 2; chunk < chunks; chunk++) {
+                    offsets[chunk] = op(offsets[chunk - 1], out[boundary(chunk) - 1]);
+                }
+
+                parallelFor(chunks - 1, 1, [&](tensorSize begin, tensorSize end) {
+                    for (tensorSize chunk = begin + 1; chunk < end + 1; chunk++) {
+                        const Acc offset = offsets[chunk];
+                        for (tensorSize i = boundary(chunk); i < boundary(chunk + 1); i++) {
+                            out[i] = op(offset, out[i]);
+                        }
+                    }
+                });
+            } else {
+                // The last chunk's total is never needed
+                std::vector<Acc> totals (chunks - 1);
+                parallelFor(chunks - 1, 1, [&](tensorSize begin, tensorSize end) {
+                    for (tensorSize chunk = begin; chunk < end; chunk++) {
+                        Acc total = static_cast<Acc>(in[boundary(chunk)]);
+                        for (tensorSize i = boundary(chunk) + 1; i < boundary(chunk + 1); i++) {
+                            total = op(total, static_cast<Acc>(in[i]));
+                        }
+                        totals[chunk] = total;
+                    }
+                });
+
+                offsets[1] = totals[0];
+                for (tensorSize chunk = 2; chunk < chunks; chunk++) {
+                    offsets[chunk] = op(offsets[chunk - 1], totals[chunk - 1]);
+                }
+
+                parallelFor(chunks, 1, [&](tensorSize begin, tensorSize end) {
+                    for (tensorSize chunk = begin; chunk < end; chunk++) {
+                        if (chunk == 0) {
+                            scanRun<Acc>(in, out, boundary(1), op);
+                            continue;
+                        }
+                        Acc running = offsets[chunk];
+                        for (tensorSize i = boundary(chunk); i < boundary(chunk + 1); i++) {
+                            running = op(running, static_cast<Acc>(in[i]));
+                            out[i] = static_cast<DType>(running);
+                        }
+                    }
+                });
+            }
+        }
+
+        template <tensorRank axis, typename Acc, Scalar DType, auto shape, typename Op>
+        constexpr void scanAlong(const char* name, const DType* in, DType* out, Op op) {
+            constexpr AxisExtents extents = axisExtentsOf<shape, axis>();
+            constexpr tensorSize n = shape.n_elems();
+            TENSORII_INSTRUMENT_OP(name, Reduction, n, 2 * n * sizeof(DType));
+            if constexpr (n == 0) {
+                return;
+            } else if constexpr (extents.inner == 1) {
+                const auto rows = [&](tensorSize begin, tensorSize end) {
+                    for (tensorSize row = begin; row < end; row++) {
+                        scanRun<Acc>(in + row * extents.n, out + row * extents.n, extents.n, op);
+                    }
+                };
+                if (std::is_constant_evaluated()) {
+                    rows(0, extents.outer);
+                    return;
+                }
+                const tensorSize chunks = parallelChunks(extents.n, parallelGrain);
+                if (extents.outer >= threadBudget() || chunks < 2) {
+                    parallelFor(extents.outer, std::max<tensorSize>(1, parallelGrain / extents.n), rows);
+                } else {
+                    for (tensorSize row = 0; row < extents.outer; row++) {
+                        scanSplit<Acc>(in + row * extents.n, out + row * extents.n, extents.n, chunks, op);
+                    }
+                }
+            } else {
+                constexpr tensorSize blocks = (extents.inner + scanLanesMost - 1) / scanLanesMost;
+                const auto units = [&](tensorSize begin, tensorSize end) {
+                    for (tensorSize unit = begin; unit < end; unit++) {
+                        const tensorSize first = unit % blocks * scanLanesMost;
+                        const tensorSize offset = unit / blocks * extents.n * extents.inner + first;
+                        scanLanes<Acc>(in + offset, out + offset, extents.n, extents.inner,
+                                       std::min(scanLanesMost, extents.inner - first), op);
+                    }
+                };
+                if (std::is_constant_evaluated()) {
+                    units(0, extents.outer * blocks);
+                    return;
+                }
+                parallelFor(extents.outer * blocks, std::max<tensorSize>(1, parallelGrain / (extents.n * std::min(scanLanesMost, extents.inner))), units);
+            }
+        }
+    }
+
+    template <tensorRank axis, Scalar DType, auto shape, ScanOperation<DType> Op>
+    requires (axis < shape.rank())
+    constexpr void scan(const Tensor<DType, shape>& in, Tensor<DType, shape>& out, Op op) {
+        Private::scanAlong<axis, DType, DType, shape>("scan", in.data(), out.data(), op);
+    }
+
+    template <tensorRank axis, Scalar DType, auto shape, ScanOperation<DType> Op>
+    requires (axis < shape.rank())
+    constexpr void scan(Tensor<DType, shape>& data, Op op) {
+        Private::scanAlong<axis, DType, DType, shape>("scan", data.data(), data.data(), op);
+    }
+
+    template <tensorRank axis, Scalar DType, auto shape>
+    requires (axis < shape.rank())
+    constexpr void cumsum(const Tensor<DType, shape>& in, Tensor<DType, shape>& out) {
+        Private::scanAlong<axis, Accumulator<DType>, DType, shape>("cumsum", in.data(), out.data(), std::plus<>());
+    }
+
+    template <tensorRank axis, Scalar DType, auto shape>
+    requires (axis < shape.rank())
+    constexpr void cumsum(Tensor<DType, shape>& data) {
+        Private::scanAlong<axis, Accumulator<DType>, DType, shape>("cumsum", data.data(), data.data(), std::plus<>());
+    }
+
+    template <tensorRank axis, Scalar DType, auto shape>
+    requires (axis < shape.rank())
+    constexpr void cumprod(const Tensor<DType, shape>& in, Tensor<DType, shape>& out) {
+        Private::scanAlong<axis, Accumulator<DType>, DType, shape>("cumprod", in.data(), out.data(), std::multiplies<>());
+    }
+
+    template <tensorRank axis, Scalar DType, auto shape>
+    requires (axis < shape.rank())
+    constexpr void cumprod(Tensor<DType, shape>& data) {
+        Private::scanAlong<axis, Accumulator<DType>, DType, shape>("cumprod", data.data(), data.data(), std::multiplies<>());
+    }
+}
+
+#endif //TENSOR_SCAN_TPP
@@ -0,0 +1,291 @@
+#ifndef TENSOR_SORT_TPP
+#define TENSOR_SORT_TPP
+
+#include "TensorII/Sort.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/private/AxisExtents.h"
+#include "TensorII/private/Parallel.h"
+#include "TensorII/private/SortKernels.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        template <typename DType>
+        inline constexpr bool hasSortNetwork = std::same_as<DType, float> || std::same_as<DType, double>;
+
+        enum class SortMode { Sort, Argsort, Topk };
+
+        template <typename DType>
+        constexpr bool isNaN(const DType& x) {
+            if constexpr (std::floating_point<DType> || ReducedFloat<DType>) {
+                return x != x;
+            } else {
+                return false;
+            }
+        }
+
+        // Ascending, and descending, with NaNs last either way
+        template <typename DType>
+        constexpr bool sortsBefore(const DType& a, const DType& b) {
+            return a < b || (isNaN(b) && !isNaN(a));
+        }
+
+        template <typename DType>
+        constexpr bool ranksAbove(const DType& a, const DType& b) {
+            return b < a || (isNaN(b) && !isNaN(a));
+        }
+
+        template <typename DType>
+        struct Ranked {
+            DType value;
+            tensorSize position;
+        };
+
+        // By 'before' on values, then by position, which makes any sort stable
+        template <typename DType, typename Before>
+        constexpr auto byPosition(Before before) {
+            return [before](const Ranked<DType>& a, const Ranked<DType>& b) {
+                return before(a.value, b.value) || (!before(b.value, a.value) && a.position < b.position);
+            };
+        }
+
+        constexpr tensorSize sequenceStart(const AxisExtents& extents, tensorSize sequence) noexcept {
+            return sequence / extents.inner * extents.n * extents.inner + sequence % extents.inner;
+        }
+
+        // Chunks of a single long sequence, one per thread
+        template <typename T>
+        tensorSize sortChunks(const std::vector<T>& items) {
+            return parallelChunks(items.size(), parallelGrain);
+        }
+
+        // Each chunk sorted on a thread of its own, then neighbouring runs merged pairwise, in parallel, until
+        // one is left
+        template <typename T, typename Compare>
+        void parallelSort(std::vector<T>& items, Compare compare) {
+            const tensorSize chunks = sortChunks(items);
+            const auto boundary = [&](tensorSize chunk) {
+                return items.begin() + static_cast<std::ptrdiff_t>(items.size() * std::min(chunk, chunks) / chunks);
+            };
+            parallelFor(chunks, 1, [&](tensorSize begin, tensorSize end) {
+                for (tensorSize chunk = begin; chunk < end; chunk++) {
+                    std::sort(boundary(chunk), boundary(chunk + 1), compare);
+                }
+            });
+            for (tensorSize width = 1; width < chunks; width *= 2) {
+                parallelFor((chunks + 2 * width - 1) / (2 * width), 1, [&](tensorSize begin, tensorSize end) {
+                    for (tensorSize pair = begin; pair < end; pair++) {
+                        const tensorSize chunk = pair * 2 * width;
+                        std::inplace_merge(boundary(chunk), boundary(chunk + width), boundary(chunk + 2 * width), compare);
+                    }
+                });
+            }
+        }
+
+        // The first 'kept' of items in order, the rest in none: each chunk's own first 'kept' on a thread each,
+        // then the first of those
+        template <typename T, typename Compare>
+        void parallelTop(std::vector<T>& items, tensorSize kept, Compare compare) {
+            const tensorSize chunks = sortChunks(items);
+            const auto boundary = [&](tensorSize chunk) {
+                return items.begin() + static_cast<std::ptrdiff_t>(items.size() * chunk / chunks);
+            };
+            const auto keptOf = [&](tensorSize chunk) {
+                return std::min(kept, static_cast<tensorSize>(boundary(chunk + 1) - boundary(chunk)));
+            };
+            parallelFor(chunks, 1, [&](tensorSize begin, tensorSize end) {
+                for (tensorSize chunk = begin; chunk < end; chunk++) {
+                    std::partial_sort(boundary(chunk), boundary(chunk) + static_cast<std::ptrdiff_t>(keptOf(chunk)), boundary(chunk + 1), compare);
+                }
+            });
+            std::vector<T> candidates;
+            candidates.reserve(chunks * kept);
+            for (tensorSize chunk = 0; chunk < chunks; chunk++) {
+                candidates.insert(candidates.end(), boundary(chunk), boundary(chunk) + static_cast<std::ptrdiff_t>(keptOf(chunk)));
+            }
+            std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(kept), candidates.end(), compare);
+            std::copy_n(candidates.begin(), kept, items.begin());
+        }
+
+        // Up to sortLanes sequences from 'first' on, through a sorting network. Sequences are copied into a
+        // block side by side and back. The network can't order NaNs, so they go in as +infinity: sorting values,
+        // the right number of NaNs are written back over the end; otherwise the payload of positions marks
+        // them past sortNetworkMost, so they follow any real +infinity. topk sorts the negated values.
+        template <SortMode mode, typename DType, typename Index>
+        void networkSortGroup(const DType* in, DType* values, Index* indices, AxisExtents extents, tensorSize kept,
+                              tensorSize first, tensorSize count) {
+            const tensorSize n = extents.n;
+            const AxisExtents outExtents {extents.outer, kept, extents.inner};
+            std::array<DType, sortLanes * sortNetworkMost> keys;
+            std::array<DType, sortLanes * sortNetworkMost> payload;
+            std::array<tensorSize, sortLanes> nans {};
+            for (tensorSize lane = 0; lane < sortLanes; lane++) {
+                const DType* sequence = in + sequenceStart(extents, first + std::min(lane, count - 1));
+                for (tensorSize k = 0; k < n; k++) {
+                    const DType x = mode == SortMode::Topk ? -sequence[k * extents.inner] : sequence[k * extents.inner];
+                    const bool nan = x != x;
+                    keys[k * sortLanes + lane] = nan ? std::numeric_limits<DType>::infinity() : x;
+                    if constexpr (mode == SortMode::Sort) {
+                        nans[lane] += nan ? 1 : 0;
+                    } else {
+                        payload[k * sortLanes + lane] = static_cast<DType>(nan ? k + sortNetworkMost : k);
+                    }
+                }
+            }
+
+            if constexpr (mode == SortMode::Sort) {
+                sortBlock(keys.data(), n);
+            } else {
+                sortBlock(keys.data(), payload.data(), n);
+            }
+
+            for (tensorSize lane = 0; lane < count; lane++) {
+                const tensorSize start = sequenceStart(extents, first + lane);
+                const tensorSize outStart = sequenceStart(outExtents, first + lane);
+                for (tensorSize k = 0; k < kept; k++) {
+                    const tensorSize out = outStart + k * extents.inner;
+                    if constexpr (mode == SortMode::Sort) {
+                        values[out] = k < n - nans[lane] ? keys[k * sortLanes + lane] : std::numeric_limits<DType>::quiet_NaN();
+                    } else {
+                        const auto marked = static_cast<tensorSize>(payload[k * sortLanes + lane]);
+                        const tensorSize position = marked < sortNetworkMost ? marked : marked - sortNetworkMost;
+                        indices[out] = static_cast<Index>(position);
+                        if constexpr (mode == SortMode::Topk) {
+                            values[out] = in[start + position * extents.inner];
+                        }
+                    }
+                }
+            }
+        }
+
+        template <SortMode mode, typename DType, typename Index>
+        constexpr void compareSortSequence(const DType* in, DType* values, Index* indices, AxisExtents extents, tensorSize kept,
+                                           tensorSize sequence, bool parallel) {
+            const tensorSize start = sequenceStart(extents, sequence);
+            const tensorSize outStart = sequenceStart({extents.outer, kept, extents.inner}, sequence);
+            const tensorSize stride = extents.inner;
+            if constexpr (mode == SortMode::Sort) {
+                std::vector<DType> items (extents.n);
+                for (tensorSize k = 0; k < extents.n; k++) {
+                    items[k] = in[start + k * stride];
+                }
+                const auto before = [](const DType& a, const DType& b) { return sortsBefore(a, b); };
+                if (parallel) {
+                    parallelSort(items, before);
+                } else {
+                    std::sort(items.begin(), items.end(), before);
+                }
+                for (tensorSize k = 0; k < extents.n; k++) {
+                    values[outStart + k * stride] = items[k];
+                }
+            } else {
+                std::vector<Ranked<DType>> items (extents.n);
+                for (tensorSize k = 0; k < extents.n; k++) {
+                    items[k] = {in[start + k * stride], k};
+                }
+                if constexpr (mode == SortMode::Argsort) {
+                    const auto compare = byPosition<DType>([](const DType& a, const DType& b) { return sortsBefore(a, b); });
+                    if (parallel) {
+                        parallelSort(items, compare);
+                    } else {
+                        std::sort(items.begin(), items.end(), compare);
+                    }
+                } else {
+                    const auto compare = byPosition<DType>([](const DType& a, const DType& b) { return ranksAbove(a, b); });
+                    if (parallel) {
+                        parallelTop(items, kept, compare);
+                    } else {
+                        std::partial_sort(items.begin(), items.begin() + static_cast<std::ptrdiff_t>(kept), items.end(), compare);
+                    }
+                }
+                for (tensorSize k = 0; k < kept; k++) {
+                    indices[outStart + k * stride] = static_cast<Index>(items[k].position);
+                    if constexpr (mode == SortMode::Topk) {
+                        values[outStart + k * stride] = items[k].value;
+                    }
+                }
+            }
+        }
+
+        // 'kept' of each sequence written out, all of it but for topk
+        template <SortMode mode, tensorRank axis, typename DType, auto shape, tensorSize kept, typename Index>
+        constexpr void sortAlong(const DType* in, DType* values, Index* indices) {
+            constexpr AxisExtents extents = axisExtentsOf<shape, axis>();
+            constexpr tensorSize sequences = extents.outer * extents.inner;
+            if constexpr (shape.n_elems() > 0) {
+                const auto compareSorts = [&](tensorSize begin, tensorSize end, bool parallel) {
+                    for (tensorSize sequence = begin; sequence < end; sequence++) {
+                        compareSortSequence<mode>(in, values, indices, extents, kept, sequence, parallel);
+                    }
+                };
+                if (std::is_constant_evaluated()) {
+                    compareSorts(0, sequences, false);
+                    return;
+                }
+                if constexpr (hasSortNetwork<DType> && extents.n <= sortNetworkMost) {
+                    constexpr tensorSize groups = (sequences + sortLanes - 1) / sortLanes;
+                    parallelFor(groups, std::max<tensorSize>(1, parallelGrain / (sortLanes * extents.n)), [&](tensorSize begin, tensorSize end) {
+                        for (tensorSize group = begin; group < end; group++) {
+                            const tensorSize first = group * sortLanes;
+                            networkSortGroup<mode>(in, values, indices, extents, kept, first, std::min(sortLanes, sequences - first));
+                        }
+                    });
+                } else {
+                    if (sequences >= threadBudget() || extents.n < 2 * parallelGrain) {
+                        parallelFor(sequences, std::max<tensorSize>(1, parallelGrain / extents.n), [&](tensorSize begin, tensorSize end) {
+                            compareSorts(begin, end, false);
+                        });
+                    } else {
+                        compareSorts(0, sequences, true);
+                    }
+                }
+            }
+        }
+    }
+
+    template <tensorRank axis, Scalar DType, auto shape>
+    requires (axis < shape.rank())
+    constexpr void sort(const Tensor<DType, shape>& in, Tensor<DType, shape>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("sort", Copy, n, 2 * n * sizeof(DType));
+        Private::sortAlong<Private::SortMode::Sort, axis, DType, shape, static_cast<tensorSize>(shape[axis])>(
+                in.data(), out.data(), static_cast<tensorSize*>(nullptr));
+    }
+
+    template <tensorRank axis, Scalar DType, auto shape>
+    requires (axis < shape.rank())
+    constexpr void sort(Tensor<DType, shape>& data) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("sort", Copy, n, 2 * n * sizeof(DType));
+        Private::sortAlong<Private::SortMode::Sort, axis, DType, shape, static_cast<tensorSize>(shape[axis])>(
+                data.data(), data.data(), static_cast<tensorSize*>(nullptr));
+    }
+
+    template <tensorRank axis, Scalar DType, auto shape, std::integral Index>
+    requires (axis < shape.rank())
+    constexpr void argsort(const Tensor<DType, shape>& in, Tensor<Index, shape>& indices) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("argsort", Copy, n, n * (sizeof(DType) + sizeof(Index)));
+        Private::sortAlong<Private::SortMode::Argsort, axis, DType, shape, static_cast<tensorSize>(shape[axis])>(
+                in.data(), static_cast<DType*>(nullptr), indices.data());
+    }
+
+    template <tensorSize k, tensorRank axis, Scalar DType, auto shape, std::integral Index>
+    requires (axis < shape.rank() && k <= static_cast<tensorSize>(shape[axis]))
+    constexpr void topk(const Tensor<DType, shape>& in, Tensor<DType, Private::withExtent<shape, axis, k>()>& values,
+                        Tensor<Index, Private::withExtent<shape, axis, k>()>& indices) {
+        constexpr tensorSize n = shape.n_elems();
+        constexpr tensorSize kept = Private::withExtent<shape, axis, k>().n_elems();
+        constexpr tensorSize bytes = n * sizeof(DType) + kept * (sizeof(DType) + sizeof(Index));
+        TENSORII_INSTRUMENT_OP("topk", Reduction, n, bytes);
+        Private::sortAlong<Private::SortMode::Topk, axis, DType, shape, k>(in.data(), values.data(), indices.data());
+    }
+}
+
+#endif //TENSOR_SORT_TPP
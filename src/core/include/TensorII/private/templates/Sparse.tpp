@@ -0,0 +1,277 @@
+#ifndef TENSOR_SPARSE_TPP
+#define TENSOR_SPARSE_TPP
+
+#include "TensorII/Sparse.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "TensorII/Instrumentation.h"
+#include "TensorII/private/SparseKernels.h"
+
+namespace TensorII::Core {
+
+    namespace Private {
+        // Row-major strides of every axis
+        template <auto shape>
+        constexpr std::array<tensorSize, shape.rank()> stridesOf() noexcept {
+            std::array<tensorSize, shape.rank()> strides {};
+            tensorSize stride = 1;
+            for (tensorRank axis = shape.rank(); axis-- > 0; ) {
+                strides[axis] = stride;
+                stride *= static_cast<tensorSize>(shape[axis]);
+            }
+            return strides;
+        }
+
+        // Column of an index in the CSR matrix, the row-major offset of all but its first axis
+        template <auto shape>
+        constexpr tensorSize columnOf(const std::array<tensorSize, shape.rank()>& index) noexcept {
+            constexpr auto strides = stridesOf<shape>();
+            tensorSize column = 0;
+            for (tensorRank axis = 1; axis < shape.rank(); axis++) {
+                column += index[axis] * strides[axis];
+            }
+            return column;
+        }
+
+        template <auto sparseShape, auto denseShape, auto outShape>
+        constexpr bool sparseContractable() noexcept {
+            constexpr tensorRank contracted = sparseShape.rank() - 1;
+            if (sparseShape.rank() < 2 || denseShape.rank() < contracted
+                || outShape.rank() != 1 + denseShape.rank() - contracted || outShape[0] != sparseShape[0]) {
+                return false;
+            }
+            for (tensorRank axis = 0; axis < contracted; axis++) {
+                if (sparseShape[1 + axis] != denseShape[axis]) {
+                    return false;
+                }
+            }
+            for (tensorRank axis = contracted; axis < denseShape.rank(); axis++) {
+                if (outShape[1 + axis - contracted] != denseShape[axis]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <typename DType>
+        inline constexpr bool hasSparseKernels = std::same_as<DType, float> || std::same_as<DType, double>;
+    }
+
+    //region CooTensor
+    template <Scalar DType, auto shape_>
+    void CooTensor<DType, shape_>::reserve(tensorSize count) {
+        indices_.reserve(count);
+        values_.reserve(count);
+    }
+
+    template <Scalar DType, auto shape_>
+    void CooTensor<DType, shape_>::clear() noexcept {
+        indices_.clear();
+        values_.clear();
+    }
+
+    template <Scalar DType, auto shape_>
+    template<std::convertible_to<tensorSize> ... Indices>
+    requires (sizeof...(Indices) == shape_.rank())
+    void CooTensor<DType, shape_>::insert(DType value, const Indices& ... indices) {
+        const Index index {static_cast<tensorSize>(indices)...};
+        for (tensorRank axis = 0; axis < shape_.rank(); axis++) {
+            if (index[axis] >= static_cast<tensorSize>(shape_[axis])) {
+                throw std::out_of_range("COO index lies outside the tensor");
+            }
+        }
+        indices_.push_back(index);
+        values_.push_back(value);
+    }
+    //endregion
+
+    //region CsrTensor
+    template <Scalar DType, auto shape_>
+    requires (shape_.rank() >= 2)
+    CsrTensor<DType, shape_>::CsrTensor()
+    : rowOffsets_(rows + 1)
+    {}
+
+    template <Scalar DType, auto shape_>
+    requires (shape_.rank() >= 2)
+    CsrTensor<DType, shape_>::CsrTensor(std::vector<tensorSize> rowOffsets, std::vector<Column> columnIndices,
+                                        std::vector<DType> values)
+    : rowOffsets_(std::move(rowOffsets))
+    , columns_(std::move(columnIndices))
+    , values_(std::move(values))
+    {
+        if (rowOffsets_.size() != rows + 1 || rowOffsets_.front() != 0 || rowOffsets_.back() != values_.size()
+            || columns_.size() != values_.size() || !std::is_sorted(rowOffsets_.begin(), rowOffsets_.end())) {
+            throw std::invalid_argument("CSR row offsets don't match the rows and nonzeros");
+        }
+        for (tensorSize row = 0; row < rows; row++) {
+            const auto first = columns_.begin() + static_cast<std::ptrdiff_t>(rowOffsets_[row]);
+            const auto last = columns_.begin() + static_cast<std::ptrdiff_t>(rowOffsets_[row + 1]);
+            if (std::adjacent_find(first, last, std::greater_equal<>()) != last || (first != last && *(last - 1) >= columns)) {
+                throw std::invalid_argument("CSR columns must ascend within each row and lie inside the tensor");
+            }
+        }
+    }
+
+    template <Scalar DType, auto shape_>
+    requires (shape_.rank() >= 2)
+    tensorSize CsrTensor<DType, shape_>::size_in_bytes() const noexcept {
+        return rowOffsets_.size() * sizeof(tensorSize) + nonzeros() * (sizeof(Column) + sizeof(DType));
+    }
+
+    template <Scalar DType, auto shape_>
+    requires (shape_.rank() >= 2)
+    template<std::convertible_to<tensorSize> ... Indices>
+    requires (sizeof...(Indices) == shape_.rank())
+    DType CsrTensor<DType, shape_>::at(const Indices& ... indices) const {
+        const std::array<tensorSize, shape_.rank()> index {static_cast<tensorSize>(indices)...};
+        const auto column = static_cast<Column>(Private::columnOf<shape_>(index));
+        const auto first = columns_.begin() + static_cast<std::ptrdiff_t>(rowOffsets_[index[0]]);
+        const auto last = columns_.begin() + static_cast<std::ptrdiff_t>(rowOffsets_[index[0] + 1]);
+        const auto found = std::lower_bound(first, last, column);
+        return found != last && *found == column ? values_[static_cast<tensorSize>(found - columns_.begin())] : DType {};
+    }
+    //endregion
+
+    template <Scalar DType, auto shape>
+    void sparsify(const Tensor<DType, shape>& dense, CooTensor<DType, shape>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Sparse::sparsify", Copy, n, n * sizeof(DType));
+        out.clear();
+        std::array<tensorSize, shape.rank()> index {};
+        for (tensorSize i = 0; i < n; i++) {
+            if (dense.data()[i] != DType {}) {
+                std::apply([&](auto... indices) { out.insert(dense.data()[i], indices...); }, index);
+            }
+            for (tensorRank axis = shape.rank(); axis-- > 0; ) {
+                if (++index[axis] < static_cast<tensorSize>(shape[axis])) {
+                    break;
+                }
+                index[axis] = 0;
+            }
+        }
+    }
+
+    // Row-major storage is already in row and column order, so the arrays fill in one pass
+    template <Scalar DType, auto shape>
+    void sparsify(const Tensor<DType, shape>& dense, CsrTensor<DType, shape>& out) {
+        using Csr = CsrTensor<DType, shape>;
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Sparse::sparsify", Copy, n, n * sizeof(DType));
+        std::vector<tensorSize> rowOffsets (Csr::rows + 1);
+        std::vector<typename Csr::Column> columns;
+        std::vector<DType> values;
+        for (tensorSize row = 0; row < Csr::rows; row++) {
+            const DType* elements = dense.data() + row * Csr::columns;
+            for (tensorSize column = 0; column < Csr::columns; column++) {
+                if (elements[column] != DType {}) {
+                    columns.push_back(static_cast<typename Csr::Column>(column));
+                    values.push_back(elements[column]);
+                }
+            }
+            rowOffsets[row + 1] = values.size();
+        }
+        out = Csr(std::move(rowOffsets), std::move(columns), std::move(values));
+    }
+
+    template <Scalar DType, auto shape>
+    void compress(const CooTensor<DType, shape>& in, CsrTensor<DType, shape>& out) {
+        using Csr = CsrTensor<DType, shape>;
+        using Column = typename Csr::Column;
+        const tensorSize entries = in.nonzeros();
+        TENSORII_INSTRUMENT_OP("Sparse::compress", Copy, entries, entries * (sizeof(typename CooTensor<DType, shape>::Index) + sizeof(DType)));
+
+        // Counting sort into rows, then each row sorted by column and its repeats summed
+        std::vector<tensorSize> rowOffsets (Csr::rows + 1);
+        for (const auto& index : in.indices()) {
+            rowOffsets[index[0] + 1]++;
+        }
+        std::partial_sum(rowOffsets.begin(), rowOffsets.end(), rowOffsets.begin());
+        std::vector<std::pair<Column, DType>> entriesByRow (entries);
+        std::vector<tensorSize> next (rowOffsets.begin(), rowOffsets.end() - 1);
+        for (tensorSize i = 0; i < entries; i++) {
+            const auto& index = in.indices()[i];
+            entriesByRow[next[index[0]]++] = {static_cast<Column>(Private::columnOf<shape>(index)), in.values()[i]};
+        }
+
+        std::vector<tensorSize> offsets (Csr::rows + 1);
+        std::vector<Column> columns;
+        std::vector<DType> values;
+        columns.reserve(entries);
+        values.reserve(entries);
+        for (tensorSize row = 0; row < Csr::rows; row++) {
+            const auto first = entriesByRow.begin() + static_cast<std::ptrdiff_t>(rowOffsets[row]);
+            const auto last = entriesByRow.begin() + static_cast<std::ptrdiff_t>(rowOffsets[row + 1]);
+            std::stable_sort(first, last, [](const auto& a, const auto& b) { return a.first < b.first; });
+            for (auto entry = first; entry != last; ++entry) {
+                if (values.size() > offsets[row] && columns.back() == entry->first) {
+                    values.back() += entry->second;
+                } else {
+                    columns.push_back(entry->first);
+                    values.push_back(entry->second);
+                }
+            }
+            offsets[row + 1] = values.size();
+        }
+        out = Csr(std::move(offsets), std::move(columns), std::move(values));
+    }
+
+    template <Scalar DType, auto shape>
+    void densify(const CooTensor<DType, shape>& in, Tensor<DType, shape>& out) {
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Sparse::densify", Copy, n, n * sizeof(DType));
+        constexpr auto strides = Private::stridesOf<shape>();
+        std::fill_n(out.data(), n, DType {});
+        for (tensorSize i = 0; i < in.nonzeros(); i++) {
+            tensorSize offset = 0;
+            for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+                offset += in.indices()[i][axis] * strides[axis];
+            }
+            out.data()[offset] += in.values()[i];
+        }
+    }
+
+    template <Scalar DType, auto shape>
+    void densify(const CsrTensor<DType, shape>& in, Tensor<DType, shape>& out) {
+        using Csr = CsrTensor<DType, shape>;
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Sparse::densify", Copy, n, n * sizeof(DType));
+        std::fill_n(out.data(), n, DType {});
+        for (tensorSize row = 0; row < Csr::rows; row++) {
+            for (tensorSize i = in.rowOffsets()[row]; i < in.rowOffsets()[row + 1]; i++) {
+                out.data()[row * Csr::columns + in.columnIndices()[i]] = in.values()[i];
+            }
+        }
+    }
+
+    template <Scalar DType, auto sparseShape, auto denseShape, auto outShape>
+    requires (Private::sparseContractable<sparseShape, denseShape, outShape>())
+    void contract(const CsrTensor<DType, sparseShape>& sparse, const Tensor<DType, denseShape>& dense, Tensor<DType, outShape>& out) {
+        using Csr = CsrTensor<DType, sparseShape>;
+        constexpr tensorSize n = denseShape.n_elems() / Csr::columns;
+        const tensorSize nonzeros = sparse.nonzeros();
+        TENSORII_INSTRUMENT_OP("Sparse::contract", Contraction, nonzeros * n,
+                               sparse.size_in_bytes() + nonzeros * n * sizeof(DType) + out.size_in_bytes());
+        if constexpr (Private::hasSparseKernels<DType>) {
+            const Private::CsrArrays<DType, typename Csr::Column> arrays {
+                    sparse.rowOffsets().data(), sparse.columnIndices().data(), sparse.values().data(), Csr::rows};
+            Private::multiplyCsr(arrays, dense.data(), n, out.data());
+        } else {
+            std::fill_n(out.data(), out.size(), DType {});
+            for (tensorSize row = 0; row < Csr::rows; row++) {
+                for (tensorSize i = sparse.rowOffsets()[row]; i < sparse.rowOffsets()[row + 1]; i++) {
+                    const DType value = sparse.values()[i];
+                    const DType* source = dense.data() + sparse.columnIndices()[i] * n;
+                    for (tensorSize j = 0; j < n; j++) {
+                        out.data()[row * n + j] += value * source[j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif //TENSOR_SPARSE_TPP
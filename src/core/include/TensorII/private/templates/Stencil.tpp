@@ -0,0 +1,238 @@
+#ifndef TENSOR_STENCIL_TPP
+#define TENSOR_STENCIL_TPP
+
+#include "TensorII/Stencil.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "TensorII/Instrumentation.h"
+
+namespace TensorII::Core {
+
+    template <tensorRank rank_, tensorSize points_>
+    constexpr tensorIndex Stencil<rank_, points_>::radius() const noexcept {
+        tensorIndex radius = 0;
+        for (const auto& offset : offsets) {
+            for (tensorIndex step : offset) {
+                radius = std::max(radius, step < 0 ? -step : step);
+            }
+        }
+        return radius;
+    }
+
+    namespace Private {
+        constexpr tensorSize densePoints(tensorRank rank, tensorIndex radius) noexcept {
+            tensorSize count = 1;
+            for (tensorRank axis = 0; axis < rank; axis++) {
+                count *= static_cast<tensorSize>(2 * radius + 1);
+            }
+            return count;
+        }
+    }
+
+    namespace Stencils {
+        template <tensorRank rank>
+        constexpr Stencil<rank, 2 * rank + 1> laplacian(double spacing) {
+            const double weight = 1.0 / (spacing * spacing);
+            Stencil<rank, 2 * rank + 1> stencil {};
+            stencil.coefficients[0] = -2.0 * static_cast<double>(rank) * weight;
+            for (tensorRank axis = 0; axis < rank; axis++) {
+                stencil.offsets[1 + 2 * axis][axis] = -1;
+                stencil.offsets[2 + 2 * axis][axis] = 1;
+                stencil.coefficients[1 + 2 * axis] = weight;
+                stencil.coefficients[2 + 2 * axis] = weight;
+            }
+            return stencil;
+        }
+
+        template <tensorRank rank, tensorIndex radius, tensorSize points>
+        constexpr Stencil<rank, points> dense(const std::array<double, points>& weights) {
+            Stencil<rank, points> stencil {};
+            stencil.coefficients = weights;
+            for (tensorSize point = 0; point < points; point++) {
+                tensorSize remaining = point;
+                for (tensorRank axis = rank; axis-- > 0; ) {
+                    const auto side = static_cast<tensorSize>(2 * radius + 1);
+                    stencil.offsets[point][axis] = static_cast<tensorIndex>(remaining % side) - radius;
+                    remaining /= side;
+                }
+            }
+            return stencil;
+        }
+    }
+
+    namespace Private {
+        // Farthest any point reaches along the innermost axis
+        template <auto stencil>
+        constexpr tensorIndex innerRadius() noexcept {
+            tensorIndex radius = 0;
+            for (const auto& offset : stencil.offsets) {
+                const tensorIndex step = offset[stencil.rank() - 1];
+                radius = std::max(radius, step < 0 ? -step : step);
+            }
+            return radius;
+        }
+
+        // Elements [begin, end) of a row whose points all lie inside it: one fused multiply-add per point,
+        // unrolled over the points and vectorised over the row
+        template <auto stencil, Scalar DType, tensorSize... point>
+        constexpr void stencilInterior(const std::array<const DType*, stencil.points()>& rows, DType* __restrict out,
+                                       tensorIndex begin, tensorIndex end, std::index_sequence<point...>) {
+            constexpr tensorRank last = stencil.rank() - 1;
+            for (tensorIndex i = begin; i < end; i++) {
+                out[i] = ((static_cast<DType>(stencil.coefficients[point]) * rows[point][i + stencil.offsets[point][last]]) + ...);
+            }
+        }
+
+        // One row along the innermost axis. rows[p] is the row point p reads from, already resolved against the
+        // boundary on the outer axes.
+        template <auto stencil, Boundary boundary, Scalar DType, tensorIndex extent>
+        constexpr void stencilRow(const std::array<const DType*, stencil.points()>& rows, DType* out, DType boundaryValue) {
+            constexpr tensorRank last = stencil.rank() - 1;
+            constexpr tensorIndex radius = std::min(innerRadius<stencil>(), extent);
+            const auto edge = [&](tensorIndex i) {
+                DType total {};
+                for (tensorSize point = 0; point < stencil.points(); point++) {
+                    const tensorIndex j = resolveIndex<boundary>(i + stencil.offsets[point][last], extent);
+                    total += static_cast<DType>(stencil.coefficients[point]) * (j < 0 ? boundaryValue : rows[point][j]);
+                }
+                out[i] = total;
+            };
+            for (tensorIndex i = 0; i < radius; i++) {
+                edge(i);
+            }
+            stencilInterior<stencil>(rows, out, radius, extent - radius, std::make_index_sequence<stencil.points()>{});
+            for (tensorIndex i = std::max(radius, extent - radius); i < extent; i++) {
+                edge(i);
+            }
+        }
+
+        // Every row of planes [firstPlane, lastPlane) along the first axis. 'ghost' is a row of boundary values
+        // read in place of rows beyond a Dirichlet edge.
+        template <auto stencil, Boundary boundary, Scalar DType, auto shape>
+        constexpr void stencilPlanes(const DType* in, DType* out, const DType* ghost,
+                                     tensorIndex firstPlane, tensorIndex lastPlane, DType boundaryValue) {
+            constexpr tensorRank rank = shape.rank();
+            constexpr tensorIndex extent = shape[rank - 1];
+            std::array<const DType*, stencil.points()> rows {};
+            if constexpr (rank == 1) {
+                rows.fill(in);
+                stencilRow<stencil, boundary, DType, extent>(rows, out, boundaryValue);
+            } else {
+                // Rows are numbered row-major over the outer axes
+                constexpr auto rowStrides = [] {
+                    std::array<tensorSize, rank - 1> strides {};
+                    tensorSize stride = 1;
+                    for (tensorRank axis = rank - 1; axis-- > 0; ) {
+                        strides[axis] = stride;
+                        stride *= static_cast<tensorSize>(shape[axis]);
+                    }
+                    return strides;
+                }();
+                constexpr tensorSize rowsPerPlane = shape.n_elems() / static_cast<tensorSize>(shape[0] * extent);
+
+                for (tensorIndex plane = firstPlane; plane < lastPlane; plane++) {
+                    std::array<tensorIndex, rank - 1> index {};
+                    index[0] = plane;
+                    for (tensorSize row = 0; row < rowsPerPlane; row++) {
+                        tensorSize rowNumber = 0;
+                        for (tensorRank axis = 0; axis + 1 < rank; axis++) {
+                            rowNumber += static_cast<tensorSize>(index[axis]) * rowStrides[axis];
+                        }
+                        for (tensorSize point = 0; point < stencil.points(); point++) {
+                            tensorSize source = 0;
+                            bool outside = false;
+                            for (tensorRank axis = 0; axis + 1 < rank; axis++) {
+                                const tensorIndex j = resolveIndex<boundary>(index[axis] + stencil.offsets[point][axis], shape[axis]);
+                                outside = outside || j < 0;
+                                source += static_cast<tensorSize>(j) * rowStrides[axis];
+                            }
+                            rows[point] = outside ? ghost : in + source * static_cast<tensorSize>(extent);
+                        }
+                        stencilRow<stencil, boundary, DType, extent>(rows, out + rowNumber * static_cast<tensorSize>(extent), boundaryValue);
+
+                        for (tensorRank axis = rank - 1; axis-- > 1; ) {
+                            if (++index[axis] < shape[axis]) {
+                                break;
+                            }
+                            index[axis] = 0;
+                        }
+                    }
+                }
+            }
+        }
+
+        template <Scalar DType, auto shape, Boundary boundary>
+        constexpr std::vector<DType> ghostRow(DType boundaryValue) {
+            if constexpr (boundary == Boundary::Dirichlet) {
+                return std::vector<DType>(static_cast<tensorSize>(shape[shape.rank() - 1]), boundaryValue);
+            } else {
+                return {};
+            }
+        }
+
+        template <auto stencil, auto shape>
+        constexpr bool stencilFits() noexcept {
+            for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+                if (stencil.radius() > shape[axis]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    template <auto stencil, Boundary boundary, Scalar DType, auto shape>
+    requires (stencil.rank() == shape.rank())
+    constexpr void applyStencil(const Tensor<DType, shape>& in, Tensor<DType, shape>& out, DType boundaryValue) {
+        static_assert(Private::stencilFits<stencil, shape>(), "Stencil reaches further than the grid is wide");
+        constexpr tensorSize n = shape.n_elems();
+        TENSORII_INSTRUMENT_OP("Stencil::apply", Elementwise, n, 2 * n * sizeof(DType));
+        const std::vector<DType> ghost = Private::ghostRow<DType, shape, boundary>(boundaryValue);
+        Private::stencilPlanes<stencil, boundary, DType, shape>(in.data(), out.data(), ghost.data(), 0, shape[0], boundaryValue);
+    }
+
+    template <auto stencil, Boundary boundary, tensorSize timeBlock, Scalar DType, auto shape>
+    requires (stencil.rank() == shape.rank() && timeBlock > 0)
+    constexpr void iterateStencil(Tensor<DType, shape>& field, Tensor<DType, shape>& scratch, tensorSize steps,
+                                  DType boundaryValue) {
+        static_assert(Private::stencilFits<stencil, shape>(), "Stencil reaches further than the grid is wide");
+        constexpr tensorSize n = shape.n_elems();
+        constexpr bool wavefront = shape.rank() > 1 && boundary != Boundary::Periodic && timeBlock > 1;
+        constexpr tensorSize fused = wavefront ? timeBlock : 1;
+        TENSORII_INSTRUMENT_OP("Stencil::iterate", Elementwise, steps * n, (steps + fused - 1) / fused * 2 * n * sizeof(DType));
+
+        const std::vector<DType> ghost = Private::ghostRow<DType, shape, boundary>(boundaryValue);
+        const std::array<DType*, 2> buffers {field.data(), scratch.data()};
+        constexpr tensorIndex planes = shape[0];
+        // A step may run one radius behind the one before it, and no further, as both write over the planes the
+        // other is reading
+        constexpr tensorIndex lag = stencil.radius();
+
+        for (tensorSize done = 0; done < steps; done += fused) {
+            const auto depth = static_cast<tensorIndex>(std::min(fused, steps - done));
+            for (tensorIndex front = 0; front < planes + (depth - 1) * lag; front++) {
+                for (tensorIndex step = 0; step < depth; step++) {
+                    const tensorIndex plane = wavefront ? front - step * lag : 0;
+                    if (plane < 0 || plane >= planes) {
+                        continue;
+                    }
+                    const tensorSize parity = (done + static_cast<tensorSize>(step)) % 2;
+                    Private::stencilPlanes<stencil, boundary, DType, shape>(
+                            buffers[parity], buffers[1 - parity], ghost.data(),
+                            plane, wavefront ? plane + 1 : planes, boundaryValue);
+                }
+                if (!wavefront) {
+                    break;
+                }
+            }
+        }
+        if (steps % 2 == 1) {
+            std::copy_n(scratch.data(), n, field.data());
+        }
+    }
+}
+
+#endif //TENSOR_STENCIL_TPP
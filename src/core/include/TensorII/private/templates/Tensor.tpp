@@ -7,83 +7,174 @@
 
 #include "TensorII/Tensor.h"
 
+#include <cstring>
+
+#include "TensorII/Instrumentation.h"
+
 namespace TensorII::Core {
 
-    template<Scalar DType, auto shape_>
-    constexpr Tensor<DType, shape_>::Tensor()
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    constexpr Tensor<DType, shape_, Layout_>::Tensor()
     : data_ {}
     {}
 
-    template<Scalar DType, auto shape_>
-    constexpr Tensor<DType, shape_>::Tensor(typename Private::TensorInitializer<DType, shape_>::Array &array) {
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    constexpr Tensor<DType, shape_, Layout_>::Tensor(typename Private::TensorInitializer<DType, shape_>::Array &array) {
+        TENSORII_INSTRUMENT_OP("Tensor::fromArray", Copy, size(), 2 * size_in_bytes());
         static_assert(sizeof(Array) == sizeof(decltype(array))); // assert c-array same size as std::array
+        if constexpr (!std::is_same_v<Layout, RowMajor>) {
+            scatter(Private::TensorInitializer<DType, shape_>(array).begin());
+            return;
+        }
         if (!std::is_constant_evaluated()){
-            memmove_s(data_.data(), size_in_bytes(), array, size_in_bytes());
+            std::memmove(data_.data(), array, size_in_bytes());
             return;
         }
+        Private::TensorInitializer<DType, shape_>::flatten(array, data_.data());
     }
 
-    template<Scalar DType, auto shape_>
-    constexpr Tensor<DType, shape_>::Tensor(Private::TensorInitializer<DType, shape_> &&initializer)
-            : Tensor<DType, shape_>::Tensor(from_range, initializer)
-    {}
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    constexpr Tensor<DType, shape_, Layout_>::Tensor(Private::TensorInitializer<DType, shape_> &&initializer) {
+        TENSORII_INSTRUMENT_OP("Tensor::fromInitializer", Copy, size(), 2 * size_in_bytes());
+        if constexpr (!std::is_same_v<Layout, RowMajor>) {
+            scatter(initializer.begin());
+        } else {
+            initializer.copyTo(data_.data());
+        }
+    }
 
-    template<Scalar DType, auto shape_>
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
     template<Util::SizedContainerCompatibleRange<DType> Range>
-    constexpr Tensor<DType, shape_>::Tensor(from_range_t, Range && range) {
-        std::ranges::copy_n(range.begin(), size(), data_.begin());
+    constexpr Tensor<DType, shape_, Layout_>::Tensor(from_range_t, Range && range) {
+        TENSORII_INSTRUMENT_OP("Tensor::fromRange", Copy, size(), 2 * size_in_bytes());
+        if constexpr (!std::is_same_v<Layout, RowMajor>) {
+            scatter(range.begin());
+        } else {
+            std::ranges::copy_n(range.begin(), size(), data_.begin());
+        }
     }
 
-    template<Scalar DType, auto shape_>
-    constexpr Tensor<DType, shape_>::Tensor(Tensor && other) noexcept
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    constexpr Tensor<DType, shape_, Layout_>::Tensor(Tensor && other) noexcept
     : data_{}
     {
+        TENSORII_INSTRUMENT_OP("Tensor::moveConstruct", Copy, size(), 2 * size_in_bytes());
         if (!std::is_constant_evaluated()){
-            memmove_s(data_.data(), size_in_bytes(), other.data(), other.size_in_bytes());
+            std::memmove(data_.data(), other.data(), size_in_bytes());
             return;
         }
-        for(size_t i = 0; i < Array::size(); i++){
+        for(size_t i = 0; i < size(); i++){
             data_[i] = other.data_[i];
         }
     }
 
-    template<Scalar DType, auto shape_>
-    constexpr Tensor<DType, shape_>& Tensor<DType, shape_>::operator=(Tensor && other) noexcept {
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    constexpr Tensor<DType, shape_, Layout_>& Tensor<DType, shape_, Layout_>::operator=(Tensor && other) noexcept {
+        TENSORII_INSTRUMENT_OP("Tensor::moveAssign", Copy, size(), 2 * size_in_bytes());
         if (!std::is_constant_evaluated()){
-            memmove_s(data_.data(), size_in_bytes(), other.data(), other.size_in_bytes());
+            std::memmove(data_.data(), other.data(), size_in_bytes());
             return *this;
         }
-        for(size_t i = 0; i < Array::size(); i++){
+        for(size_t i = 0; i < size(); i++){
             data_[i] = other.data_[i];
         }
         return *this;
     }
 
-    template<Scalar DType, auto shape_>
-    constexpr Shape<shape_.rank()> Tensor<DType, shape_>::shape() {
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    constexpr Shape<shape_.rank()> Tensor<DType, shape_, Layout_>::shape() {
         return shape_;
     }
 
-    template<Scalar DType, auto shape_>
-    constexpr tensorSize Tensor<DType, shape_>::size() noexcept {
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    constexpr tensorSize Tensor<DType, shape_, Layout_>::size() noexcept {
         return shape_.n_elems();
     }
 
-    template<Scalar DType, auto shape_>
-    constexpr tensorSize Tensor<DType, shape_>::size_in_bytes() noexcept {
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    constexpr tensorSize Tensor<DType, shape_, Layout_>::size_in_bytes() noexcept {
         return size() * sizeof(DType);
     }
 
-    template<Scalar DType, auto shape_>
-    constexpr DType *Tensor<DType, shape_>::data() noexcept {
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    constexpr DType *Tensor<DType, shape_, Layout_>::data() noexcept {
         return data_.data();
     }
 
-    template<Scalar DType, auto shape_>
-    constexpr const DType *Tensor<DType, shape_>::data() const noexcept {
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    constexpr const DType *Tensor<DType, shape_, Layout_>::data() const noexcept {
         return data_.data();
     }
 
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    template<std::convertible_to<tensorSize> ... Indices>
+    requires (sizeof...(Indices) == shape_.rank())
+    constexpr tensorSize Tensor<DType, shape_, Layout_>::offset(const Indices& ... indices) noexcept {
+        return Layout::template offset<shape_>({static_cast<tensorSize>(indices)...});
+    }
+
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    template<std::convertible_to<tensorSize> ... Indices>
+    requires (sizeof...(Indices) == shape_.rank())
+    constexpr DType& Tensor<DType, shape_, Layout_>::at(const Indices& ... indices) noexcept {
+        return data_[offset(indices...)];
+    }
+
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    template<std::convertible_to<tensorSize> ... Indices>
+    requires (sizeof...(Indices) == shape_.rank())
+    constexpr const DType& Tensor<DType, shape_, Layout_>::at(const Indices& ... indices) const noexcept {
+        return data_[offset(indices...)];
+    }
+
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    template<char ... names>
+    requires (sizeof...(names) == shape_.rank())
+    constexpr Private::Indexed<Tensor<DType, shape_, Layout_>, names...>
+    Tensor<DType, shape_, Layout_>::operator()(Index<names> ...) noexcept {
+        return Private::Indexed<Tensor, names...>(*this);
+    }
+
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    template<char ... names>
+    requires (sizeof...(names) == shape_.rank())
+    constexpr Private::Indexed<const Tensor<DType, shape_, Layout_>, names...>
+    Tensor<DType, shape_, Layout_>::operator()(Index<names> ...) const noexcept {
+        return Private::Indexed<const Tensor, names...>(*this);
+    }
+
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    template<typename Function>
+    constexpr void Tensor<DType, shape_, Layout_>::forEachStored(Function&& function) {
+        Layout::template forEachIndex<shape_>([&](tensorSize offset, const auto& index) {
+            function(data_[offset], index);
+        });
+    }
+
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    template<typename Function>
+    constexpr void Tensor<DType, shape_, Layout_>::forEachStored(Function&& function) const {
+        Layout::template forEachIndex<shape_>([&](tensorSize offset, const auto& index) {
+            function(data_[offset], index);
+        });
+    }
+
+    template<Scalar DType, auto shape_, TensorLayout Layout_>
+    template<typename Iterator>
+    constexpr void Tensor<DType, shape_, Layout_>::scatter(Iterator values) {
+        // Odometer over the multi-index, rather than unflattening every element
+        std::array<tensorSize, shape_.rank()> index {};
+        for (tensorSize i = 0; i < size(); i++, ++values) {
+            data_[Layout::template offset<shape_>(index)] = *values;
+            for (tensorRank axis = shape_.rank(); axis-- > 0; ) {
+                if (++index[axis] < static_cast<tensorSize>(shape_[axis])) {
+                    break;
+                }
+                index[axis] = 0;
+            }
+        }
+    }
+
     template<auto newShape, auto oldShape, Scalar DType>
     requires (oldShape.n_elems() == newShape.n_elems()
               && oldShape.isValidExplicit()
@@ -1,3 +1,22 @@
 SET(SOURCES
         foo.cpp
+        Instrumentation.cpp
+        PerfCounters.cpp
+        CpuFeatures.cpp
+        HalfKernels.cpp
+        ElementwiseKernels.cpp
+        QuantizedKernels.cpp
+        ComplexKernels.cpp
+        SparseKernels.cpp
+        ScanKernels.cpp
+        GraphPlan.cpp
+        ThreadPool.cpp
+        Pipeline.cpp
+        FFTKernels.cpp
+        ConvolutionKernels.cpp
+        MaskKernels.cpp
+        GatherKernels.cpp
+        ScatterColouring.cpp
+        SortKernels.cpp
+        ResampleKernels.cpp
 )
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Async.h"
+#include "TensorII/private/Parallel.h"
+
+using namespace TensorII::Core;
+
+TEST_CASE("Async, a chain runs once its input is ready, without waiting between ops", "[Async]") {
+    ThreadPool pool (2);
+    Tensor<int, Shape{2, 3}> in ({{1, 2, 3}, {4, 5, 6}});
+    Tensor<int, Shape{2, 3}, ColumnMajor> copied;
+
+    Promise<void> loaded;
+    auto copy = copyAsync(pool, in, copied, loaded.future());
+    auto total = sumAsync(pool, copied, copy);
+    auto doubled = total.then(pool, [](long value) { return 2 * value; });
+    auto squares = dotAsync(pool, copied, copied, copy);
+
+    // Nothing can have run: the copy waits on the promise, and everything else on the copy
+    CHECK_FALSE(copy.ready());
+    CHECK_FALSE(doubled.ready());
+    loaded.set();
+
+    CHECK(doubled.get() == 42);
+    CHECK(squares.get() == 91);
+    CHECK(copied.at(1, 0) == 4);
+    CHECK(total.get() == sum(in));
+}
+
+TEST_CASE("Async, continuations of temporaries keep their input alive", "[Async]") {
+    ThreadPool pool (2);
+    Promise<void> started;
+    // Neither intermediate Future outlives its statement, and nothing runs until after they're gone
+    auto result = async(pool, [] { return 20; }, started.future())
+            .then(pool, [](int value) { return value + 1; })
+            .then(pool, [](int value) { return 2 * value; });
+    started.set();
+    CHECK(result.get() == 42);
+    CHECK(async(pool, [] { return 3; }).then(pool, [](int value) { return value * value; }).get() == 9);
+}
+
+TEST_CASE("Async, failures skip dependent ops and reach every future after them", "[Async]") {
+    ThreadPool pool (2);
+    std::atomic<int> ran = 0;
+
+    auto fails = async(pool, []() -> int { throw std::runtime_error("failed"); });
+    auto fine = async(pool, [] { return 1; });
+    auto joined = async(pool, [&ran] { ran++; }, fine, fails);
+    auto after = joined.then(pool, [&ran] { ran++; });
+
+    CHECK_THROWS_AS(after.get(), std::runtime_error);
+    CHECK_THROWS_AS(joined.get(), std::runtime_error);
+    CHECK(fine.get() == 1);
+    CHECK(ran == 0);
+
+    Future<double> abandoned;
+    {
+        Promise<double> promise;
+        abandoned = promise.future();
+    }
+    CHECK_THROWS_AS(abandoned.get(), std::future_error);
+}
+
+TEST_CASE("Async, writes and reads back a tensor through a stream", "[Async]") {
+    ThreadPool pool (1);
+    Tensor<float, Shape{4}> out ({1.5f, -2.0f, 3.25f, 8.0f}), in;
+    std::stringstream stream;
+
+    auto written = writeAsync(pool, stream, out);
+    readAsync(pool, stream, in, written).get();
+    CHECK(in.at(2) == 3.25f);
+    CHECK(in.at(3) == 8.0f);
+
+    CHECK_THROWS_AS(readAsync(pool, stream, in).get(), std::ios_base::failure);
+}
+
+TEST_CASE("Async, many independent ops on the shared pool", "[Async]") {
+    std::atomic<int> count = 0;
+    std::vector<Future<void>> futures;
+    for (int i = 0; i < 200; i++) {
+        futures.push_back(async([&count] { count++; }));
+    }
+    for (const auto& future : futures) {
+        future.wait();
+    }
+    CHECK(count == 200);
+}
+
+TEST_CASE("Async, ops on pool workers share the hardware threads between them", "[Async]") {
+    const tensorSize hardware = Private::threadBudget();
+    CHECK(hardware == std::max(1u, std::thread::hardware_concurrency()));
+    // A worker of a pool as large as the machine splits nothing further; one of a single thread pool may
+    CHECK(async([] { return Private::threadBudget(); }).get() == 1);
+    ThreadPool single (1);
+    CHECK(async(single, [] { return Private::threadBudget(); }).get() == hardware);
+    CHECK(async(single, [] { return Private::parallelChunks(1 << 20, 1); }).get() == hardware);
+}
@@ -0,0 +1,131 @@
+#include <cmath>
+#include <complex>
+#include <random>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Complex.h"
+#include "TensorII/Operations.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    // Long enough for the unrolled vector loops, with a tail
+    constexpr Shape<2> shape {5, 15};
+
+    template <typename Real, auto shape_>
+    void fill(Tensor<std::complex<Real>, shape_>& tensor, unsigned seed) {
+        std::mt19937 generator (seed);
+        std::uniform_real_distribution<Real> distribution (-1, 1);
+        for (tensorSize i = 0; i < tensor.size(); i++) {
+            const Real real = distribution(generator);
+            tensor.data()[i] = {real, distribution(generator)};
+        }
+    }
+
+    template <typename Real>
+    constexpr Real tolerance = std::is_same_v<Real, float> ? 1e-4f : 1e-12;
+
+    template <typename Real>
+    void checkInterleavedAndSplit() {
+        Tensor<std::complex<Real>, shape> a, b, out;
+        fill(a, 1);
+        fill(b, 2);
+        std::complex<Real> expectedSum, expectedDot;
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            expectedSum += a.data()[i];
+            expectedDot += a.data()[i] * b.data()[i];
+        }
+
+        multiply(a, b, out);
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            CHECK(std::abs(out.data()[i] - a.data()[i] * b.data()[i]) < tolerance<Real>);
+        }
+        CHECK(std::abs(sum(a) - expectedSum) < tolerance<Real>);
+        CHECK(std::abs(dot(a, b) - expectedDot) < tolerance<Real>);
+
+        SplitComplexTensor<Real, shape> splitA, splitB, splitOut;
+        split(a, splitA);
+        split(b, splitB);
+        CHECK(splitA.at(2, 3) == a.at(2, 3));
+        multiply(splitA, splitB, splitOut);
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            const std::complex<Real> product (splitOut.real().data()[i], splitOut.imag().data()[i]);
+            CHECK(std::abs(product - a.data()[i] * b.data()[i]) < tolerance<Real>);
+        }
+        CHECK(std::abs(sum(splitA) - expectedSum) < tolerance<Real>);
+        CHECK(std::abs(dot(splitA, splitB) - expectedDot) < tolerance<Real>);
+
+        add(splitA, splitB, splitOut);
+        subtract(splitOut, splitB, splitOut);
+        interleave(splitOut, out);
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            CHECK(std::abs(out.data()[i] - a.data()[i]) < tolerance<Real>);
+        }
+    }
+
+    // Rows of out long enough for the kernels, with a tail
+    template <typename Real>
+    void checkMatmul() {
+        Tensor<std::complex<Real>, Shape{3, 5}> a;
+        Tensor<std::complex<Real>, Shape{5, 19}> b;
+        fill(a, 3);
+        fill(b, 4);
+        Tensor<std::complex<Real>, Shape{3, 19}> out;
+        Tensor<std::complex<Real>, Shape{3, 19}, ColumnMajor> generic;
+        matmul(a, b, out);
+        matmul(a, b, generic);
+
+        SplitComplexTensor<Real, Shape{3, 5}> splitA;
+        SplitComplexTensor<Real, Shape{5, 19}> splitB;
+        SplitComplexTensor<Real, Shape{3, 19}> splitOut;
+        split(a, splitA);
+        split(b, splitB);
+        matmul(splitA, splitB, splitOut);
+
+        for (tensorSize i = 0; i < 3; i++) {
+            for (tensorSize j = 0; j < 19; j++) {
+                std::complex<Real> expected;
+                for (tensorSize k = 0; k < 5; k++) {
+                    expected += a.at(i, k) * b.at(k, j);
+                }
+                CHECK(std::abs(out.at(i, j) - expected) < tolerance<Real>);
+                CHECK(std::abs(generic.at(i, j) - expected) < tolerance<Real>);
+                CHECK(std::abs(splitOut.at(i, j) - expected) < tolerance<Real>);
+            }
+        }
+    }
+}
+
+TEST_CASE("Complex, matrix products interleaved and split", "[Complex]") {
+    checkMatmul<float>();
+    checkMatmul<double>();
+}
+
+TEST_CASE("Complex, constexpr", "[Complex]") {
+    using C = std::complex<double>;
+    constexpr auto interleavedDot = [] {
+        Tensor<C, Shape{2}> a ({C(1, 2), C(3, -1)});
+        Tensor<C, Shape{2}> b ({C(0, 1), C(2, 2)});
+        return dot(a, b);
+    };
+    STATIC_CHECK(interleavedDot() == C(6, 5));
+
+    constexpr auto splitProduct = [] {
+        SplitComplexTensor<double, Shape{2}> a, b, out;
+        a.set(C(1, 2), 0);
+        a.set(C(3, -1), 1);
+        b.set(C(0, 1), 0);
+        b.set(C(2, 2), 1);
+        multiply(a, b, out);
+        return sum(out);
+    };
+    STATIC_CHECK(splitProduct() == C(6, 5));
+
+    STATIC_CHECK(std::same_as<ComplexTensor<float, shape>, Tensor<std::complex<float>, shape>>);
+    STATIC_CHECK(std::same_as<ComplexTensor<float, shape, ComplexStorage::Split>, SplitComplexTensor<float, shape>>);
+}
+
+TEST_CASE("Complex kernels match std::complex, interleaved and split", "[Complex]") {
+    checkInterleavedAndSplit<float>();
+    checkInterleavedAndSplit<double>();
+}
@@ -0,0 +1,175 @@
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <new>
+#include <numbers>
+#include <random>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Convolution.h"
+#include "TensorII/private/FFTKernels.h"
+#include "TensorII/private/Parallel.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    // Textbook definition, every output element summing kernel(i, j) * in(y + rows / 2 - i, x + columns / 2 - j)
+    template <Boundary boundary, typename DType, auto shape, auto kernelShape>
+    void naiveConvolve(const Tensor<DType, shape>& in, const Tensor<DType, kernelShape>& kernel,
+                       Tensor<DType, shape>& out, DType boundaryValue) {
+        const auto resolve = [](tensorIndex i, tensorIndex extent) -> tensorIndex {
+            if (i >= 0 && i < extent) { return i; }
+            if (boundary == Boundary::Periodic) { return (i + extent) % extent; }
+            if (boundary == Boundary::Neumann) { return i < 0 ? -1 - i : 2 * extent - 1 - i; }
+            return -1;
+        };
+        for (tensorIndex y = 0; y < shape[0]; y++) {
+            for (tensorIndex x = 0; x < shape[1]; x++) {
+                for (tensorIndex b = 0; b < shape[2]; b++) {
+                    double total = 0;
+                    for (tensorIndex i = 0; i < kernelShape[0]; i++) {
+                        for (tensorIndex j = 0; j < kernelShape[1]; j++) {
+                            const tensorIndex row = resolve(y + kernelShape[0] / 2 - i, shape[0]);
+                            const tensorIndex column = resolve(x + kernelShape[1] / 2 - j, shape[1]);
+                            const double value = row < 0 || column < 0 ? boundaryValue : in.at(row, column, b);
+                            total += kernel.at(i, j) * value;
+                        }
+                    }
+                    out.at(y, x, b) = static_cast<DType>(total);
+                }
+            }
+        }
+    }
+
+    template <typename DType, auto shape>
+    std::unique_ptr<Tensor<DType, shape>> randomTensor(unsigned seed) {
+        std::mt19937 generator (seed);
+        std::uniform_real_distribution<double> distribution (-1.0, 1.0);
+        auto tensor = std::make_unique<Tensor<DType, shape>>();
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            tensor->data()[i] = static_cast<DType>(distribution(generator));
+        }
+        return tensor;
+    }
+
+    template <typename DType, auto shape>
+    double maxDifference(const Tensor<DType, shape>& a, const Tensor<DType, shape>& b) {
+        double difference = 0;
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            difference = std::max(difference, std::abs(static_cast<double>(a.data()[i]) - static_cast<double>(b.data()[i])));
+        }
+        return difference;
+    }
+
+    template <typename DType>
+    constexpr double tolerance = std::is_same_v<DType, float> ? 1e-4 : 1e-10;
+
+    template <Boundary boundary, typename DType, auto shape, auto kernelShape>
+    void checkConvolutions(DType boundaryValue = DType {}) {
+        constexpr Shape<1> columnShape {kernelShape[0]}, rowShape {kernelShape[1]};
+        auto in = randomTensor<DType, shape>(1);
+        auto columnKernel = randomTensor<DType, columnShape>(2);
+        auto rowKernel = randomTensor<DType, rowShape>(3);
+        auto kernel = std::make_unique<Tensor<DType, kernelShape>>();
+        for (tensorSize i = 0; i < static_cast<tensorSize>(kernelShape[0]); i++) {
+            for (tensorSize j = 0; j < static_cast<tensorSize>(kernelShape[1]); j++) {
+                kernel->at(i, j) = columnKernel->at(i) * rowKernel->at(j);
+            }
+        }
+
+        auto expected = std::make_unique<Tensor<DType, shape>>();
+        auto actual = std::make_unique<Tensor<DType, shape>>();
+        naiveConvolve<boundary>(*in, *kernel, *expected, boundaryValue);
+
+        convolve<boundary>(*in, *kernel, *actual, boundaryValue);
+        CHECK(maxDifference(*expected, *actual) < tolerance<DType>);
+        convolveSeparable<boundary>(*in, *columnKernel, *rowKernel, *actual, boundaryValue);
+        CHECK(maxDifference(*expected, *actual) < tolerance<DType>);
+        convolveFFT<boundary>(*in, *kernel, *actual, boundaryValue);
+        CHECK(maxDifference(*expected, *actual) < tolerance<DType>);
+    }
+}
+
+TEST_CASE("FFT matches the discrete Fourier transform", "[Convolution][FFT]") {
+    constexpr tensorSize n = 16, lanes = 3;
+    std::vector<std::complex<double>> data (n * lanes), expected (n * lanes);
+    std::mt19937 generator (5);
+    std::uniform_real_distribution<double> distribution (-1.0, 1.0);
+    for (auto& value : data) {
+        value = {distribution(generator), distribution(generator)};
+    }
+    for (tensorSize lane = 0; lane < lanes; lane++) {
+        for (tensorSize k = 0; k < n; k++) {
+            for (tensorSize t = 0; t < n; t++) {
+                const double angle = -2 * std::numbers::pi * static_cast<double>(k * t) / n;
+                expected[k * lanes + lane] += data[t * lanes + lane] * std::polar(1.0, angle);
+            }
+        }
+    }
+
+    const Private::FFTPlan plan (n);
+    auto transformed = data;
+    plan.transform(transformed.data(), lanes, false);
+    for (tensorSize i = 0; i < data.size(); i++) {
+        CHECK(std::abs(transformed[i] - expected[i]) < 1e-12);
+    }
+    plan.transform(transformed.data(), lanes, true);
+    for (tensorSize i = 0; i < data.size(); i++) {
+        CHECK(std::abs(transformed[i] / static_cast<double>(n) - data[i]) < 1e-12);
+    }
+    CHECK_THROWS_AS(Private::FFTPlan(14), std::invalid_argument);
+    CHECK_THROWS_AS(Private::FFTPlan(0), std::invalid_argument);
+}
+
+TEST_CASE("parallelFor covers every index once", "[Convolution]") {
+    std::vector<int> visits (1000);
+    Private::parallelFor(visits.size(), 10, [&](tensorSize begin, tensorSize end) {
+        for (tensorSize i = begin; i < end; i++) {
+            visits[i]++;
+        }
+    });
+    CHECK(std::ranges::all_of(visits, [](int count) { return count == 1; }));
+}
+
+TEST_CASE("parallelFor rethrows a chunk's exception on the caller", "[Convolution]") {
+    // The last chunk runs on a worker whenever there is more than one
+    std::vector<int> visits (1000);
+    CHECK_THROWS_AS(Private::parallelFor(visits.size(), 10, [&](tensorSize begin, tensorSize end) {
+        for (tensorSize i = begin; i < end; i++) {
+            visits[i]++;
+        }
+        if (end == visits.size()) {
+            throw std::bad_alloc();
+        }
+    }), std::bad_alloc);
+    CHECK(std::ranges::all_of(visits, [](int count) { return count == 1; }));
+}
+
+TEST_CASE("Convolutions match the definition", "[Convolution]") {
+    SECTION("Dirichlet") {
+        checkConvolutions<Boundary::Dirichlet, float, Shape<3>{23, 37, 5}, Shape<2>{3, 3}>(0.5f);
+        checkConvolutions<Boundary::Dirichlet, double, Shape<3>{19, 21, 4}, Shape<2>{5, 2}>(-1.0);
+        checkConvolutions<Boundary::Dirichlet, float, Shape<3>{40, 50, 16}, Shape<2>{7, 9}>();
+    }
+    SECTION("Periodic") {
+        checkConvolutions<Boundary::Periodic, float, Shape<3>{23, 37, 5}, Shape<2>{3, 3}>();
+        checkConvolutions<Boundary::Periodic, double, Shape<3>{19, 21, 1}, Shape<2>{4, 6}>();
+        checkConvolutions<Boundary::Periodic, double, Shape<3>{6, 7, 2}, Shape<2>{6, 7}>();
+    }
+    SECTION("Neumann") {
+        checkConvolutions<Boundary::Neumann, float, Shape<3>{23, 37, 5}, Shape<2>{3, 3}>();
+        checkConvolutions<Boundary::Neumann, double, Shape<3>{70, 9, 3}, Shape<2>{15, 1}>();
+        checkConvolutions<Boundary::Neumann, double, Shape<3>{5, 5, 2}, Shape<2>{5, 4}>();
+    }
+}
+
+TEST_CASE("Convolving with the identity copies", "[Convolution]") {
+    constexpr Shape<3> shape {130, 70, 8};
+    auto in = randomTensor<float, shape>(9);
+    auto out = std::make_unique<Tensor<float, shape>>();
+    Tensor<float, Shape<2>{3, 3}> identity {{{0, 0, 0}, {0, 1, 0}, {0, 0, 0}}};
+    convolve(*in, identity, *out);
+    CHECK(maxDifference(*in, *out) == 0);
+    convolveFFT(*in, identity, *out);
+    CHECK(maxDifference(*in, *out) < 1e-6);
+}
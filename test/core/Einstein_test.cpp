@@ -0,0 +1,73 @@
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Einstein.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Core::Indices;
+
+namespace {
+    constexpr auto cross = [] {
+        Tensor<int, Shape{3}> a ({1, 2, 3});
+        Tensor<int, Shape{3}> b ({4, 5, 6});
+        Tensor<int, Shape{3}> c;
+        c(i) = epsilon(i, j, k) * a(j) * b(k);
+        return c;
+    };
+}
+
+TEST_CASE("Einstein, vector identities at compile time", "[Einstein]") {
+    constexpr auto c = cross();
+    STATIC_CHECK(c.at(0) == -3);
+    STATIC_CHECK(c.at(1) == 6);
+    STATIC_CHECK(c.at(2) == -3);
+
+    constexpr auto traces = [] {
+        Tensor<double, Shape{3, 3}> m ({{1, 2, 3}, {4, 5, 6}, {7, 8, 10}});
+        Tensor<double, Shape{3, 3}> copy;
+        copy(i, k) = delta(i, j) * m(j, k);
+        // Frobenius product with the copy, and the trace
+        return scalar(m(i, j) * copy(i, j)) + 1000 * scalar(m(i, i));
+    }();
+    STATIC_CHECK(traces == 1 + 4 + 9 + 16 + 25 + 36 + 49 + 64 + 100 + 1000 * 16);
+
+    // e_ijk e_imn = d_jm d_kn - d_jn d_km, summed over all of j k m n
+    constexpr auto contracted = [] {
+        Tensor<int, Shape{3, 3, 3, 3}> lhs;
+        lhs(j, k, m, n) = epsilon(i, j, k) * epsilon(i, m, n);
+        Tensor<int, Shape{3, 3, 3, 3}> ones;
+        ones(j, k, m, n) = delta(j, m) * delta(k, n);
+        return std::array<int, 3> {lhs.at(0, 1, 0, 1), lhs.at(0, 1, 1, 0), scalar(lhs(j, k, j, k)) - scalar(ones(j, k, j, k))};
+    }();
+    STATIC_CHECK(contracted == std::array<int, 3> {1, -1, 6 - 9});
+}
+
+TEST_CASE("Einstein, in place and across layouts at run time", "[Einstein]") {
+    Tensor<float, Shape{2, 3}> a ({{1, 2, 3}, {4, 5, 6}});
+    Tensor<float, Shape{3, 2}, ColumnMajor> b;
+    b(j, i) = a(i, j);
+    CHECK(b.at(2, 1) == 6);
+    CHECK(b.data()[1] == 2);
+
+    Tensor<float, Shape{2, 2}> product;
+    product(i, k) = a(i, j) * b(j, k);
+    CHECK(product.at(0, 0) == 14);
+    CHECK(product.at(1, 0) == 32);
+    CHECK(product.at(1, 1) == 77);
+
+    // Transposed in place, read and written at once
+    product(i, k) = product(k, i);
+    CHECK(product.at(0, 1) == 32);
+
+    product(i, k) += delta(i, j) * product(j, k);
+    CHECK(product.at(0, 0) == 28);
+    CHECK(product.at(0, 1) == 64);
+}
+
+TEST_CASE("Einstein, only small shapes take index notation", "[Einstein]") {
+    using Small = Tensor<float, Shape{16, 16}>;
+    using Large = Tensor<float, Shape{32, 32}>;
+    using Private::FewIndexValues;
+    using Private::Indexed;
+    STATIC_CHECK(FewIndexValues<Indexed<Small, 'i', 'k'>, Indexed<Small, 'i', 'j'>, Indexed<Small, 'j', 'k'>>);
+    STATIC_CHECK_FALSE(FewIndexValues<Indexed<Large, 'i', 'k'>, Indexed<Large, 'i', 'j'>, Indexed<Large, 'j', 'k'>>);
+    STATIC_CHECK(FewIndexValues<void, Indexed<Large, 'i', 'i'>>);
+}
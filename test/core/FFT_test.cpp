@@ -0,0 +1,184 @@
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/FFT.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    template <typename DType, auto shape>
+    std::unique_ptr<Tensor<DType, shape>> randomTensor(unsigned seed) {
+        std::mt19937 generator (seed);
+        std::uniform_real_distribution<double> distribution (-1.0, 1.0);
+        auto tensor = std::make_unique<Tensor<DType, shape>>();
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            if constexpr (Complex<DType>) {
+                const double real = distribution(generator);
+                tensor->data()[i] = DType(static_cast<typename DType::value_type>(real),
+                                          static_cast<typename DType::value_type>(distribution(generator)));
+            } else {
+                tensor->data()[i] = static_cast<DType>(distribution(generator));
+            }
+        }
+        return tensor;
+    }
+
+    // Textbook definition along 'axis', every sequence of the tensor viewed as outer x n x inner
+    template <tensorRank axis, auto shape, typename In>
+    std::vector<std::complex<double>> naiveDFT(const In* in, bool inverse) {
+        tensorSize outer = 1, inner = 1;
+        for (tensorRank i = 0; i < shape.rank(); i++) {
+            (i < axis ? outer : inner) *= i == axis ? 1 : static_cast<tensorSize>(shape[i]);
+        }
+        const auto n = static_cast<tensorSize>(shape[axis]);
+        std::vector<std::complex<double>> out (shape.n_elems());
+        for (tensorSize o = 0; o < outer; o++) {
+            for (tensorSize i = 0; i < inner; i++) {
+                for (tensorSize k = 0; k < n; k++) {
+                    std::complex<double> total;
+                    for (tensorSize t = 0; t < n; t++) {
+                        const double angle = (inverse ? 2 : -2) * std::numbers::pi * static_cast<double>(k * t % n) / static_cast<double>(n);
+                        total += std::complex<double>(in[(o * n + t) * inner + i]) * std::polar(1.0, angle);
+                    }
+                    out[(o * n + k) * inner + i] = inverse ? total / static_cast<double>(n) : total;
+                }
+            }
+        }
+        return out;
+    }
+
+    template <typename DType>
+    constexpr double tolerance = std::is_same_v<DType, std::complex<float>> || std::is_same_v<DType, float> ? 1e-4 : 1e-10;
+
+    template <tensorRank axis, typename DType, auto shape>
+    void checkComplex() {
+        auto in = randomTensor<DType, shape>(1);
+        auto out = std::make_unique<Tensor<DType, shape>>();
+        const auto expected = naiveDFT<axis, shape>(in->data(), false);
+        fft<axis>(*in, *out);
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            CHECK(std::abs(std::complex<double>(out->data()[i]) - expected[i]) < tolerance<DType> * static_cast<double>(shape[axis]));
+        }
+
+        const auto inverted = naiveDFT<axis, shape>(out->data(), true);
+        ifft<axis>(*out);
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            CHECK(std::abs(std::complex<double>(out->data()[i]) - inverted[i]) < tolerance<DType>);
+            CHECK(std::abs(std::complex<double>(out->data()[i] - in->data()[i])) < tolerance<DType>);
+        }
+    }
+
+    template <tensorRank axis, typename DType, auto shape>
+    void checkReal() {
+        constexpr auto spectrumShape = halfSpectrum<shape, axis>;
+        auto in = randomTensor<DType, shape>(2);
+        auto spectrum = std::make_unique<Tensor<std::complex<DType>, spectrumShape>>();
+        auto out = std::make_unique<Tensor<DType, shape>>();
+        const auto expected = naiveDFT<axis, shape>(in->data(), false);
+        rfft<axis>(*in, *spectrum);
+
+        // The non-negative frequencies of the full spectrum
+        tensorSize outer = 1;
+        for (tensorRank i = 0; i < axis; i++) {
+            outer *= static_cast<tensorSize>(shape[i]);
+        }
+        const auto n = static_cast<tensorSize>(shape[axis]), half = static_cast<tensorSize>(spectrumShape[axis]);
+        const tensorSize inner = shape.n_elems() / (outer * n);
+        for (tensorSize o = 0; o < outer; o++) {
+            for (tensorSize k = 0; k < half; k++) {
+                for (tensorSize i = 0; i < inner; i++) {
+                    const std::complex<double> actual (spectrum->data()[(o * half + k) * inner + i]);
+                    CHECK(std::abs(actual - expected[(o * n + k) * inner + i]) < tolerance<DType> * static_cast<double>(n));
+                }
+            }
+        }
+
+        irfft<axis>(*spectrum, *out);
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            CHECK(std::abs(static_cast<double>(out->data()[i] - in->data()[i])) < tolerance<DType>);
+        }
+    }
+}
+
+TEST_CASE("Complex is only std::complex of floating point", "[FFT]") {
+    STATIC_REQUIRE(Complex<std::complex<float>>);
+    STATIC_REQUIRE(Complex<std::complex<double>>);
+    STATIC_REQUIRE_FALSE(Complex<std::complex<int>>);
+    STATIC_REQUIRE_FALSE(Complex<double>);
+    STATIC_REQUIRE(Scalar<std::complex<double>>);
+
+    constexpr Tensor<std::complex<double>, Shape {2}> tensor ({std::complex<double>(1, 2), std::complex<double>(3, 4)});
+    STATIC_REQUIRE(tensor.at(1) == std::complex<double>(3, 4));
+}
+
+TEST_CASE("Mixed radix plans match the discrete Fourier transform", "[FFT]") {
+    for (tensorSize n : {1, 2, 3, 4, 5, 6, 8, 9, 12, 15, 16, 25, 30, 60, 64, 81, 120, 125, 240}) {
+        constexpr tensorSize lanes = 7;
+        std::vector<std::complex<double>> data (n * lanes), expected (n * lanes);
+        std::mt19937 generator (static_cast<unsigned>(n));
+        std::uniform_real_distribution<double> distribution (-1.0, 1.0);
+        for (auto& value : data) {
+            value = {distribution(generator), distribution(generator)};
+        }
+        for (tensorSize lane = 0; lane < lanes; lane++) {
+            for (tensorSize k = 0; k < n; k++) {
+                for (tensorSize t = 0; t < n; t++) {
+                    const double angle = -2 * std::numbers::pi * static_cast<double>(k * t % n) / static_cast<double>(n);
+                    expected[k * lanes + lane] += data[t * lanes + lane] * std::polar(1.0, angle);
+                }
+            }
+        }
+
+        const Private::FFTPlan plan (n);
+        for (tensorSize used : {tensorSize {1}, lanes}) {
+            auto transformed = data;
+            plan.transform(transformed.data(), used, lanes, false);
+            for (tensorSize k = 0; k < n; k++) {
+                for (tensorSize lane = 0; lane < used; lane++) {
+                    CHECK(std::abs(transformed[k * lanes + lane] - expected[k * lanes + lane]) < 1e-11);
+                }
+            }
+            plan.transform(transformed.data(), used, lanes, true);
+            for (tensorSize i = 0; i < n * used; i++) {
+                CHECK(std::abs(transformed[i / used * lanes + i % used] / static_cast<double>(n) - data[i / used * lanes + i % used]) < 1e-12);
+            }
+        }
+    }
+    CHECK_THROWS_AS(Private::FFTPlan(7), std::invalid_argument);
+    STATIC_REQUIRE(Private::isFFTLength(720));
+    STATIC_REQUIRE_FALSE(Private::isFFTLength(22));
+}
+
+TEST_CASE("fft along every axis", "[FFT]") {
+    constexpr Shape<3> shape {12, 5, 16};
+    checkComplex<0, std::complex<double>, shape>();
+    checkComplex<1, std::complex<double>, shape>();
+    checkComplex<2, std::complex<double>, shape>();
+    checkComplex<0, std::complex<float>, shape>();
+    checkComplex<2, std::complex<float>, shape>();
+
+    constexpr Shape<4> wide {3, 60, 2, 9};
+    checkComplex<1, std::complex<double>, wide>();
+    checkComplex<3, std::complex<double>, wide>();
+    checkComplex<0, std::complex<double>, Shape<1> {240}>();
+}
+
+TEST_CASE("rfft along every axis, of odd and even lengths", "[FFT]") {
+    constexpr Shape<3> shape {15, 8, 6};
+    checkReal<0, double, shape>();
+    checkReal<1, double, shape>();
+    checkReal<2, double, shape>();
+    checkReal<0, float, shape>();
+    checkReal<2, float, shape>();
+
+    // An odd number of sequences leaves the last lane of the last pair empty
+    constexpr Shape<3> odd {3, 25, 3};
+    checkReal<1, double, odd>();
+    checkReal<0, double, Shape<1> {1}>();
+    checkReal<0, double, Shape<2> {2, 1}>();
+}
@@ -0,0 +1,160 @@
+#include <cstdint>
+#include <random>
+#include <set>
+#include <stdexcept>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Gather.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    template <typename Index, auto shape>
+    void randomIndices(Tensor<Index, shape>& indices, tensorSize fieldSize, unsigned seed) {
+        std::mt19937 generator (seed);
+        std::uniform_int_distribution<tensorSize> distribution (0, fieldSize - 1);
+        for (tensorSize i = 0; i < indices.size(); i++) {
+            indices.data()[i] = static_cast<Index>(distribution(generator));
+        }
+    }
+
+    template <typename DType, typename Index>
+    void checkGather() {
+        // A vector and a tail of each width
+        constexpr Shape<2> shape {3, 13};
+        Tensor<DType, Shape{50}> field;
+        for (tensorSize i = 0; i < field.size(); i++) {
+            field.data()[i] = static_cast<DType>(i) + DType {0.5};
+        }
+        Tensor<Index, shape> indices;
+        randomIndices(indices, field.size(), 1);
+        Tensor<DType, shape> out;
+        gather(field, indices, out);
+        for (tensorSize i = 0; i < out.size(); i++) {
+            CHECK(out.data()[i] == field.data()[indices.data()[i]]);
+        }
+    }
+
+    // A line of n + 1 nodes, each element the two at its ends
+    template <tensorDimension n>
+    Tensor<std::int32_t, Shape{n, 2}> line() {
+        Tensor<std::int32_t, Shape{n, 2}> elements;
+        for (tensorSize e = 0; e < static_cast<tensorSize>(n); e++) {
+            elements.at(e, 0) = static_cast<std::int32_t>(e);
+            elements.at(e, 1) = static_cast<std::int32_t>(e + 1);
+        }
+        return elements;
+    }
+}
+
+TEST_CASE("Gather, gather and scatter-add at compile time", "[Gather]") {
+    constexpr auto results = [] {
+        Tensor<int, Shape{4}> field ({10, 20, 30, 40});
+        Tensor<std::int64_t, Shape{2, 3}> indices ({{3, 0, 3}, {1, 1, 2}});
+        Tensor<int, Shape{2, 3}> gathered;
+        gather(field, indices, gathered);
+        Tensor<int, Shape{2, 3}> ones ({{1, 1, 1}, {1, 1, 1}});
+        scatterAdd(field, indices, ones);
+        return std::array<int, 6> {gathered.at(0, 0), gathered.at(1, 2), field.at(0), field.at(1), field.at(2), field.at(3)};
+    }();
+    STATIC_CHECK(results == std::array<int, 6> {40, 30, 11, 22, 31, 42});
+}
+
+TEST_CASE("Gather, hardware gathers of every index width", "[Gather]") {
+    checkGather<float, std::int32_t>();
+    checkGather<float, std::int64_t>();
+    checkGather<double, std::int32_t>();
+    checkGather<double, std::int64_t>();
+}
+
+TEST_CASE("Gather, scatter-add with every strategy", "[Gather]") {
+    // Many more values than elements, so every element is added to many times
+    constexpr Shape<1> shape {40000};
+    Tensor<std::int64_t, shape> indices;
+    randomIndices(indices, 100, 2);
+    Tensor<double, shape> values;
+    for (tensorSize i = 0; i < values.size(); i++) {
+        values.data()[i] = static_cast<double>(i % 7);
+    }
+
+    Tensor<double, Shape{100}> expected;
+    scatterAdd(expected, indices, values, ScatterStrategy::Serial);
+    double total = 0;
+    for (tensorSize i = 0; i < expected.size(); i++) {
+        total += expected.data()[i];
+    }
+    // 5714 runs of 0 to 6, then 0 and 1
+    CHECK(total == 5714 * 21 + 1);
+
+    for (ScatterStrategy strategy : {ScatterStrategy::Automatic, ScatterStrategy::Privatised, ScatterStrategy::Atomic}) {
+        Tensor<double, Shape{100}> field;
+        scatterAdd(field, indices, values, strategy);
+        for (tensorSize i = 0; i < field.size(); i++) {
+            CHECK(field.data()[i] == expected.data()[i]);
+        }
+    }
+}
+
+TEST_CASE("Gather, scatter-add into bool fields has no atomic strategy", "[Gather]") {
+    Tensor<std::int32_t, Shape{4}> indices ({0, 2, 0, 2});
+    Tensor<bool, Shape{4}> values ({true, false, false, false});
+    Tensor<bool, Shape{3}> field;
+    scatterAdd(field, indices, values);
+    CHECK(field.at(0));
+    CHECK_FALSE(field.at(1));
+    CHECK_FALSE(field.at(2));
+    CHECK_THROWS_AS(scatterAdd(field, indices, values, ScatterStrategy::Atomic), std::invalid_argument);
+}
+
+TEST_CASE("Gather, scatter-add by coloured rows", "[Gather]") {
+    const auto elements = line<9>();
+    Tensor<double, Shape{10}> nodes;
+    const ScatterColouring colouring = colourScatter(nodes, elements);
+    // Alternate elements share no node
+    REQUIRE(colouring.colours() == 2);
+    CHECK(colouring.rowsOf(0).size() == 5);
+    CHECK(colouring.uncoloured().empty());
+    for (tensorSize colour = 0; colour < colouring.colours(); colour++) {
+        std::set<std::int32_t> touched;
+        for (tensorSize row : colouring.rowsOf(colour)) {
+            CHECK(touched.insert(elements.at(row, 0)).second);
+            CHECK(touched.insert(elements.at(row, 1)).second);
+        }
+    }
+
+    // Each element adds 1 to both its nodes, so inner nodes get 2
+    Tensor<double, Shape{9, 2}> ones;
+    for (tensorSize i = 0; i < ones.size(); i++) {
+        ones.data()[i] = 1;
+    }
+    scatterAdd(nodes, elements, ones, colouring);
+    CHECK(nodes.at(0) == 1);
+    CHECK(nodes.at(5) == 2);
+    CHECK(nodes.at(9) == 1);
+
+    Tensor<std::int32_t, Shape{4, 2}> other;
+    CHECK_THROWS_AS(scatterAdd(nodes, other, Tensor<double, Shape{4, 2}>(), colouring), std::invalid_argument);
+    Tensor<std::int32_t, Shape{1, 2}> outside ({{0, 10}});
+    CHECK_THROWS_AS(colourScatter(nodes, outside), std::out_of_range);
+}
+
+TEST_CASE("Gather, rows beyond the last colour are left uncoloured", "[Gather]") {
+    // Every row shares node 0, so no two can have a colour in common
+    Tensor<std::int64_t, Shape{70, 2}> star;
+    for (tensorSize row = 0; row < 70; row++) {
+        star.at(row, 0) = 0;
+        star.at(row, 1) = static_cast<std::int64_t>(row + 1);
+    }
+    Tensor<float, Shape{71}> field;
+    const ScatterColouring colouring = colourScatter(field, star);
+    CHECK(colouring.colours() == ScatterColouring::maxColours);
+    CHECK(colouring.uncoloured().size() == 70 - ScatterColouring::maxColours);
+
+    Tensor<float, Shape{70, 2}> ones;
+    for (tensorSize i = 0; i < ones.size(); i++) {
+        ones.data()[i] = 1;
+    }
+    scatterAdd(field, star, ones, colouring);
+    CHECK(field.at(0) == 70);
+    CHECK(field.at(70) == 1);
+}
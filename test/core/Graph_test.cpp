@@ -0,0 +1,119 @@
+#include <cmath>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Graph.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    // More than one block, with a partial one at the end
+    constexpr Shape<2> shape {7, 100};
+    constexpr tensorSize n = shape.n_elems();
+
+    std::unique_ptr<Tensor<double, shape>> randomTensor() {
+        std::mt19937 generator (3);
+        std::uniform_real_distribution<double> distribution (-2.0, 5.0);
+        auto tensor = std::make_unique<Tensor<double, shape>>();
+        for (tensorSize i = 0; i < n; i++) {
+            tensor->data()[i] = distribution(generator);
+        }
+        return tensor;
+    }
+}
+
+TEST_CASE("Graph, normalise, mask and reduce in two passes", "[Graph]") {
+    auto data = randomTensor();
+    Tensor<double, shape> centred;
+    Graph<double, shape> graph;
+
+    auto x = graph.input(*data);
+    auto mean = sum(x) / static_cast<double>(n);
+    auto deviation = x - mean;
+    graph.output(deviation, centred);
+    auto variance = graph.output(sum(deviation * deviation) / static_cast<double>(n));
+    auto positive = graph.output(sum(deviation * greater(deviation, 0.0)));
+    auto spread = graph.output(max(x) - min(x));
+    auto unused = sqrt(abs(x)) * 3.0;
+
+    const GraphPlan& plan = graph.plan();
+    REQUIRE(plan.passes.size() == 2);
+    CHECK(plan.passes[0].reductions.size() == 3);
+    CHECK(plan.passes[1].reductions.size() == 2);
+    CHECK(plan.passes[1].stores == std::vector<std::size_t> {deviation.node()});
+    CHECK(plan.recomputed.empty());
+    CHECK(std::ranges::find(plan.eliminated, unused.node()) != plan.eliminated.end());
+    std::ostringstream text;
+    graph.writePlan(text);
+    INFO(text.str());
+    CHECK(text.str().starts_with("pass 0: fuses input#0 into sum#1, "));
+    CHECK(text.str().find("pass 1: computes divide#3, subtract#15; fuses input#0, subtract#4, multiply#5, greater#10, multiply#11 "
+                              "into sum#6, sum#12; stores subtract#4\nthen computes divide#8\neliminated: ") != std::string::npos);
+
+    CHECK_THROWS_AS(graph.value(variance), std::logic_error);
+    graph.run();
+
+    double expectedMean = 0, expectedVariance = 0, expectedPositive = 0, low = data->data()[0], high = low;
+    for (tensorSize i = 0; i < n; i++) {
+        expectedMean += data->data()[i] / static_cast<double>(n);
+        low = std::min(low, data->data()[i]);
+        high = std::max(high, data->data()[i]);
+    }
+    for (tensorSize i = 0; i < n; i++) {
+        const double d = data->data()[i] - expectedMean;
+        CHECK(std::abs(centred.data()[i] - d) < 1e-12);
+        expectedVariance += d * d / static_cast<double>(n);
+        expectedPositive += d > 0 ? d : 0;
+    }
+    CHECK(std::abs(graph.value(variance) - expectedVariance) < 1e-9);
+    CHECK(std::abs(graph.value(positive) - expectedPositive) < 1e-9);
+    CHECK(graph.value(spread) == high - low);
+    CHECK_THROWS_AS(graph.value(mean), std::logic_error);
+}
+
+TEST_CASE("Graph, recomputes rather than stores what later passes need", "[Graph]") {
+    Tensor<int, Shape{3, 4}> in ({{1, -2, 3, 4}, {5, 6, -7, 8}, {9, 10, 11, -12}}), out;
+    Graph<int, Shape{3, 4}> graph;
+    auto scaled = minimum(graph.input(in) * 2, 10);
+    auto shifted = scaled - sum(scaled);
+    graph.output(-shifted, out);
+    graph.run();
+
+    CHECK(graph.plan().recomputed == std::vector<std::size_t> {scaled.node() - 2, scaled.node()});
+    const int total = 2 - 4 + 6 + 8 + 10 + 10 - 14 + 10 + 10 + 10 + 10 - 24;
+    CHECK(out.at(0, 1) == total + 4);
+    CHECK(out.at(2, 3) == total + 24);
+
+    // Rerunning rereads the inputs
+    in.at(0, 0) = 2;
+    graph.run();
+    CHECK(out.at(0, 1) == total + 2 + 4);
+
+    CHECK_THROWS_AS(schedule(graph.nodes(), {sum(scaled).node()}, {}), std::invalid_argument);
+}
+
+TEST_CASE("Graph, reductions don't depend on thread timing", "[Graph]") {
+    // Enough blocks to be shared between threads, with magnitudes far enough apart that the order of the
+    // additions shows in the result
+    constexpr Shape<2> large {64, 4096};
+    auto data = std::make_unique<Tensor<float, large>>();
+    std::mt19937 generator (5);
+    std::uniform_real_distribution<float> mantissa (1.0f, 2.0f);
+    std::uniform_int_distribution<int> exponent (-20, 20);
+    for (tensorSize i = 0; i < large.n_elems(); i++) {
+        data->data()[i] = std::ldexp(mantissa(generator), exponent(generator)) * (i % 3 == 0 ? -1.0f : 1.0f);
+    }
+    Graph<float, large> graph;
+    auto x = graph.input(*data);
+    auto total = graph.output(sum(x * x - x));
+
+    graph.run();
+    const float first = graph.value(total);
+    for (int repeat = 0; repeat < 8; repeat++) {
+        graph.run();
+        REQUIRE(graph.value(total) == first);
+    }
+}
@@ -0,0 +1,79 @@
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Half.h"
+#include "TensorII/TensorDType.h"
+
+using namespace TensorII::Core;
+
+TEST_CASE("Half, float16 rounding", "[Half]"){
+    STATIC_CHECK(float16(1.0f).bits() == 0x3C00);
+    STATIC_CHECK(float16(-2.0f).bits() == 0xC000);
+    STATIC_CHECK(float16(0.1f).bits() == 0x2E66);
+    STATIC_CHECK(float16(65504.0f).bits() == 0x7BFF);
+    // Halfway between the largest half and 2^16 rounds to even, which overflows
+    STATIC_CHECK(float16(65519.0f).bits() == 0x7BFF);
+    STATIC_CHECK(float16(65520.0f).bits() == 0x7C00);
+    STATIC_CHECK(float16(-1e10f).bits() == 0xFC00);
+    // Subnormals, including ties on either side
+    STATIC_CHECK(float16(0x1p-24f).bits() == 0x0001);
+    STATIC_CHECK(float16(0x1p-25f).bits() == 0x0000);
+    STATIC_CHECK(float16(0x1.8p-24f).bits() == 0x0002);
+    STATIC_CHECK(float16(0x1.8p-25f).bits() == 0x0001);
+    STATIC_CHECK(float16(0x1.ff8p-15f).bits() == 0x03FF);
+    STATIC_CHECK(float16(0x1.ffcp-15f).bits() == 0x0400);
+    STATIC_CHECK(float16(-0.0f).bits() == 0x8000);
+    STATIC_CHECK(float16(std::numeric_limits<float>::quiet_NaN()).bits() == 0x7E00);
+}
+
+TEST_CASE("Half, float16 round trips every value", "[Half]"){
+    for (uint32_t bits = 0; bits <= 0xFFFF; bits++) {
+        const float16 half = float16::fromBits(static_cast<uint16_t>(bits));
+        const float widened = half;
+        if (std::isnan(widened)) {
+            CHECK((bits & 0x7C00) == 0x7C00);
+            CHECK(std::isnan(static_cast<float>(float16(widened))));
+            continue;
+        }
+        REQUIRE(float16(widened).bits() == bits);
+    }
+}
+
+TEST_CASE("Half, bfloat16 rounding", "[Half]"){
+    STATIC_CHECK(bfloat16(1.0f).bits() == 0x3F80);
+    STATIC_CHECK(bfloat16(std::bit_cast<float>(0x3F808000U)).bits() == 0x3F80);
+    STATIC_CHECK(bfloat16(std::bit_cast<float>(0x3F818000U)).bits() == 0x3F82);
+    STATIC_CHECK(bfloat16(std::bit_cast<float>(0x3F808001U)).bits() == 0x3F81);
+    STATIC_CHECK(bfloat16(std::numeric_limits<float>::infinity()).bits() == 0x7F80);
+    // A NaN whose payload is all below bit 16 must not round to Inf
+    STATIC_CHECK(bfloat16(std::bit_cast<float>(0x7F800001U)).bits() == 0x7FC0);
+    STATIC_CHECK(static_cast<float>(bfloat16::fromBits(0xC040)) == -3.0f);
+}
+
+TEST_CASE("Half, arithmetic promotes to float", "[Half]"){
+    constexpr float16 a = 1.5f;
+    constexpr bfloat16 b = 2.0f;
+    STATIC_CHECK(std::same_as<decltype(a + a), float>);
+    STATIC_CHECK(a * b == 3.0f);
+    STATIC_CHECK(-a == -1.5f);
+
+    float16 c = 0.0f;
+    c += 2.5f;
+    c++;
+    CHECK(c == 3.5f);
+    CHECK(float16(bfloat16(c)) == 3.5f);
+}
+
+TEST_CASE("Half, limits and concepts", "[Half]"){
+    STATIC_CHECK(std::numeric_limits<float16>::max() == 65504.0f);
+    STATIC_CHECK(std::numeric_limits<float16>::epsilon() == 0x1p-10f);
+    STATIC_CHECK(std::numeric_limits<float16>::denorm_min() == 0x1p-24f);
+    STATIC_CHECK(std::numeric_limits<bfloat16>::epsilon() == 0x1p-7f);
+    STATIC_CHECK(std::numeric_limits<bfloat16>::max() == std::bit_cast<float>(0x7F7F0000U));
+
+    STATIC_CHECK(Scalar<float16>);
+    STATIC_CHECK(Scalar<bfloat16>);
+    STATIC_CHECK_FALSE(ReducedFloat<float>);
+}
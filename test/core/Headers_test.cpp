@@ -0,0 +1,47 @@
+// Every public header in one translation unit, so helpers two of them define can't collide
+
+#include "TensorII/AnyShape.h"
+#include "TensorII/Async.h"
+#include "TensorII/Boundary.h"
+#include "TensorII/Complex.h"
+#include "TensorII/Convolution.h"
+#include "TensorII/Einstein.h"
+#include "TensorII/FFT.h"
+#include "TensorII/Future.h"
+#include "TensorII/Gather.h"
+#include "TensorII/Graph.h"
+#include "TensorII/GraphPlan.h"
+#include "TensorII/Half.h"
+#include "TensorII/Histogram.h"
+#include "TensorII/Instrumentation.h"
+#include "TensorII/Interpolation.h"
+#include "TensorII/Layout.h"
+#include "TensorII/Mask.h"
+#include "TensorII/Operations.h"
+#include "TensorII/PerfCounters.h"
+#include "TensorII/Pipeline.h"
+#include "TensorII/Quantized.h"
+#include "TensorII/Resample.h"
+#include "TensorII/Scan.h"
+#include "TensorII/ScatterColouring.h"
+#include "TensorII/Shape.h"
+#include "TensorII/Sort.h"
+#include "TensorII/Sparse.h"
+#include "TensorII/Stencil.h"
+#include "TensorII/Tensor.h"
+#include "TensorII/TensorDType.h"
+#include "TensorII/TensorIterator.h"
+#include "TensorII/TensorView.h"
+#include "TensorII/ThreadPool.h"
+#include "TensorII/Types.h"
+
+#include "Catch2/catch_test_macros.hpp"
+
+using namespace TensorII::Core;
+
+TEST_CASE("Headers, the FFT and the axis ops share their extents", "[Headers]") {
+    constexpr Private::AxisExtents extents = Private::axisExtentsOf<Shape{2, 3, 4}, 1>();
+    STATIC_CHECK(extents.outer == 2);
+    STATIC_CHECK(extents.n == 3);
+    STATIC_CHECK(extents.inner == 4);
+}
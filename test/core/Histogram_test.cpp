@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/FFT.h"
+#include "TensorII/Histogram.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    // Smallest of sorted values with at least a fraction q of them at or below it
+    double exactQuantile(const std::vector<double>& sorted, double q) {
+        const auto rank = static_cast<tensorSize>(std::ceil(q * static_cast<double>(sorted.size())));
+        return sorted[std::max<tensorSize>(rank, 1) - 1];
+    }
+}
+
+TEST_CASE("Histogram, fixed bins per band along the last axis", "[Histogram]") {
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    // Band 0 has one of each bin, band 1 values outside the range, band 2 NaNs
+    Tensor<double, Shape{4, 3}> tile ({{0.5, -1, nan}, {1.5, 4, 2}, {2.5, 1, nan}, {3.5, 3.999, 0}});
+    Histogram<double, 1, 3> histogram (4, 0, 4);
+    histogram.add(tile);
+
+    for (tensorSize bin = 0; bin < 4; bin++) {
+        CHECK(histogram.count(0, bin) == 1);
+    }
+    CHECK(histogram.below(1) == 1);
+    CHECK(histogram.above(1) == 1);
+    CHECK(histogram.count(1, 1) == 1);
+    CHECK(histogram.count(1, 3) == 1);
+    CHECK(histogram.nans(2) == 2);
+    CHECK(histogram.total(2) == 2);
+    CHECK(histogram.min(1) == -1);
+    CHECK(histogram.max(1) == 4);
+    CHECK(histogram.binLow(0, 4) == 4);
+
+    CHECK(histogram.quantile(0, 0) == 0.5);
+    CHECK(histogram.quantile(0, 1) == 3.5);
+    // Halfway through the second of four bins
+    CHECK(histogram.quantile(0, 0.375) == 1.5);
+    // Values below the range reach down to the minimum
+    CHECK(histogram.quantile(1, 0.125) == -0.5);
+    CHECK(std::isnan(Histogram<double, 1, 3>(4, 0, 4).quantile(0, 0.5)));
+}
+
+TEST_CASE("Histogram, streaming tiles adds up to the whole", "[Histogram]") {
+    // Bands along the first axis, with a range each
+    constexpr Shape<3> tileShape {2, 16, 16};
+    std::mt19937 generator (1);
+    std::uniform_int_distribution<int> distribution (0, 255);
+    Histogram<std::uint16_t, 0, 2> streamed (16, {0, 0}, {256, 128});
+    Histogram<std::uint16_t, 0, 2> first (16, {0, 0}, {256, 128});
+    Histogram<std::uint16_t, 0, 2> second (16, {0, 0}, {256, 128});
+    std::array<std::vector<double>, 2> values;
+    for (int t = 0; t < 4; t++) {
+        Tensor<std::uint16_t, tileShape> tile;
+        for (tensorSize i = 0; i < tile.size(); i++) {
+            tile.data()[i] = static_cast<std::uint16_t>(distribution(generator));
+            values[i / 256].push_back(tile.data()[i]);
+        }
+        streamed.add(tile);
+        (t % 2 == 0 ? first : second).add(tile);
+    }
+    first.merge(second);
+
+    for (tensorSize band = 0; band < 2; band++) {
+        CHECK(streamed.total(band) == 4 * 256);
+        for (tensorSize bin = 0; bin < 16; bin++) {
+            const auto inBin = std::count_if(values[band].begin(), values[band].end(), [&](double value) {
+                return value >= streamed.binLow(band, bin) && value < streamed.binLow(band, bin + 1);
+            });
+            CHECK(streamed.count(band, bin) == static_cast<std::uint64_t>(inBin));
+            CHECK(first.count(band, bin) == streamed.count(band, bin));
+        }
+        CHECK(first.above(band) == streamed.above(band));
+    }
+    CHECK(streamed.above(0) == 0);
+    CHECK(streamed.above(1) > 0);
+}
+
+TEST_CASE("Histogram, adaptive bins widen to fit every tile", "[Histogram]") {
+    constexpr Shape<2> tileShape {64, 2};
+    std::mt19937 generator (2);
+    Histogram<float, 1, 2> histogram (32);
+    CHECK(std::isnan(histogram.binLow(0, 0)));
+    std::array<std::vector<double>, 2> values;
+    // Each tile spreads further, both up and down
+    for (int t = 0; t < 6; t++) {
+        std::uniform_real_distribution<float> distribution (-std::ldexp(1.0f, t), std::ldexp(10.0f, 2 * t));
+        Tensor<float, tileShape> tile;
+        for (tensorSize i = 0; i < tile.size(); i++) {
+            tile.data()[i] = distribution(generator) * (i % 2 == 0 ? 1.0f : 0.001f);
+            values[i % 2].push_back(tile.data()[i]);
+        }
+        histogram.add(tile);
+    }
+
+    for (tensorSize band = 0; band < 2; band++) {
+        std::sort(values[band].begin(), values[band].end());
+        CHECK(histogram.total(band) == values[band].size());
+        CHECK(histogram.below(band) == 0);
+        CHECK(histogram.above(band) == 0);
+        CHECK(histogram.binLow(band, 0) <= values[band].front());
+        CHECK(histogram.binLow(band, 32) >= values[band].back());
+        const double width = histogram.binLow(band, 1) - histogram.binLow(band, 0);
+        for (double q : {0.02, 0.25, 0.5, 0.75, 0.98}) {
+            CHECK(std::abs(histogram.quantile(band, q) - exactQuantile(values[band], q)) <= width);
+        }
+        CHECK(histogram.quantile(band, 0) == values[band].front());
+        CHECK(histogram.quantile(band, 1) == values[band].back());
+    }
+}
+
+TEST_CASE("Histogram, adaptive bins count infinities outside the range", "[Histogram]") {
+    constexpr float infinity = std::numeric_limits<float>::infinity();
+    Histogram<float, 1, 1> histogram (4);
+    histogram.add(Tensor<float, Shape{3, 1}>({{infinity}, {-infinity}, {std::numeric_limits<float>::quiet_NaN()}}));
+    histogram.add(Tensor<float, Shape{4, 1}>({{1}, {2}, {3}, {5}}));
+    CHECK(histogram.below(0) == 1);
+    CHECK(histogram.above(0) == 1);
+    CHECK(histogram.nans(0) == 1);
+    CHECK(histogram.total(0) == 6);
+    CHECK(histogram.quantile(0, 0.1) == -infinity);
+    CHECK(histogram.quantile(0, 0.9) == infinity);
+    CHECK(histogram.count(0, 0) + histogram.count(0, 1) + histogram.count(0, 2) + histogram.count(0, 3) == 4);
+}
+
+TEST_CASE("Histogram, large tiles split between threads", "[Histogram]") {
+    constexpr Shape<3> tileShape {256, 256, 4};
+    auto tile = std::make_unique<Tensor<float, tileShape>>();
+    for (tensorSize i = 0; i < tile->size(); i++) {
+        tile->data()[i] = static_cast<float>(i / 4 % 100) + static_cast<float>(i % 4) * 1000;
+    }
+    Histogram<float, 2, 4> fixed (100, {0, 1000, 2000, 3000}, {100, 1100, 2100, 3100});
+    Histogram<float, 2, 4> adaptive (64);
+    fixed.add(*tile);
+    adaptive.add(*tile);
+    for (tensorSize band = 0; band < 4; band++) {
+        CHECK(fixed.total(band) == 256 * 256);
+        CHECK(fixed.below(band) + fixed.above(band) == 0);
+        // 65536 pixels through 100 values leaves the first 36 one over
+        CHECK(fixed.count(band, 0) == 656);
+        CHECK(fixed.count(band, 99) == 655);
+        CHECK(adaptive.total(band) == 256 * 256);
+        CHECK(adaptive.min(band) == static_cast<double>(band * 1000));
+        CHECK(adaptive.max(band) == static_cast<double>(band * 1000 + 99));
+    }
+}
+
+TEST_CASE("Histogram, of the magnitudes of a spectrum", "[Histogram]") {
+    // A constant in band 0 and one cycle of a cosine in band 1
+    Tensor<double, Shape{8, 2}> signal;
+    for (tensorSize i = 0; i < 8; i++) {
+        signal.at(i, 0) = 1;
+        signal.at(i, 1) = std::cos(2 * std::numbers::pi * static_cast<double>(i) / 8);
+    }
+    Tensor<std::complex<double>, halfSpectrum<Shape{8, 2}, 0>> spectrum;
+    rfft<0>(signal, spectrum);
+    Tensor<double, Shape{5, 2}> magnitudes;
+    std::transform(spectrum.data(), spectrum.data() + spectrum.size(), magnitudes.data(),
+                   [](std::complex<double> value) { return std::abs(value); });
+
+    // Bins 2 wide, centred on 0, 2, 4, 6 and 8
+    Histogram<double, 1, 2> histogram (5, -1, 9);
+    histogram.add(magnitudes);
+    CHECK(histogram.count(0, 0) == 4);
+    CHECK(histogram.count(0, 4) == 1);
+    CHECK(histogram.count(1, 0) == 4);
+    CHECK(histogram.count(1, 2) == 1);
+}
+
+TEST_CASE("Histogram, bad bins and quantiles", "[Histogram]") {
+    using BandHistogram = Histogram<float, 0, 2>;
+    CHECK_THROWS_AS(BandHistogram(0, 0, 1), std::invalid_argument);
+    CHECK_THROWS_AS(BandHistogram(4, 1, 1), std::invalid_argument);
+    CHECK_THROWS_AS(BandHistogram(4, 0, std::numeric_limits<double>::infinity()), std::invalid_argument);
+    CHECK_THROWS_AS(BandHistogram(5), std::invalid_argument);
+    BandHistogram histogram (4, 0, 1);
+    CHECK_THROWS_AS(histogram.quantile(0, 1.5), std::invalid_argument);
+    CHECK_THROWS_AS(histogram.merge(BandHistogram(4, 0, 2)), std::invalid_argument);
+    CHECK_THROWS_AS(histogram.merge(BandHistogram(4)), std::invalid_argument);
+}
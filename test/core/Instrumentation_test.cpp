@@ -0,0 +1,62 @@
+#include <sstream>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Instrumentation.h"
+
+using namespace TensorII::Core;
+using namespace TensorII::Core::Instrumentation;
+
+namespace {
+    constexpr int instrumentedSquare(int x) {
+        ScopedOp op {"instrumentedSquare", OpKind::Elementwise, 1, 2 * sizeof(int)};
+        return x * x;
+    }
+}
+
+TEST_CASE("Instrumentation, scoped op in constant evaluation", "[Instrumentation]"){
+    STATIC_CHECK(instrumentedSquare(3) == 9);
+}
+
+TEST_CASE("Instrumentation, aggregate stats", "[Instrumentation]"){
+    reset();
+    for (int i = 0; i < 3; i++) {
+        CHECK(instrumentedSquare(i) == i * i);
+    }
+    record("manualCopy", OpKind::Copy, 100, 150, 10, 80);
+
+    auto recorded = stats();
+    REQUIRE(recorded.size() == 2);
+    auto square = std::ranges::find(recorded, std::string("instrumentedSquare"), &OpStats::name);
+    REQUIRE(square != recorded.end());
+    CHECK(square->calls == 3);
+    CHECK(square->elements == 3);
+    CHECK(square->bytes == 3 * 2 * sizeof(int));
+    CHECK(square->kind == OpKind::Elementwise);
+
+    auto copy = std::ranges::find(recorded, std::string("manualCopy"), &OpStats::name);
+    REQUIRE(copy != recorded.end());
+    CHECK(copy->nanoseconds == 50);
+    CHECK(events().size() == 4);
+
+    reset();
+    CHECK(stats().empty());
+    CHECK(events().empty());
+}
+
+TEST_CASE("Instrumentation, JSON and trace output", "[Instrumentation]"){
+    reset();
+    record("manualCopy", OpKind::Copy, 1000, 3000, 10, 80);
+
+    std::ostringstream json;
+    writeJson(json);
+    CHECK(json.str().find("\"name\": \"manualCopy\"") != std::string::npos);
+    CHECK(json.str().find("\"kind\": \"Copy\"") != std::string::npos);
+    CHECK(json.str().find("\"bytes\": 80") != std::string::npos);
+
+    std::ostringstream trace;
+    writeChromeTrace(trace);
+    CHECK(trace.str().find("\"traceEvents\"") != std::string::npos);
+    CHECK(trace.str().find("\"ph\": \"X\"") != std::string::npos);
+    CHECK(trace.str().find("\"dur\": 2") != std::string::npos);
+    reset();
+}
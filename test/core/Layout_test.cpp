@@ -0,0 +1,269 @@
+#include <memory>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Operations.h"
+#include "TensorII/Tensor.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    // Element value encoding its own multi-index, so a misplaced element can't go unnoticed
+    template <auto shape>
+    constexpr int encode(const std::array<tensorSize, shape.rank()>& index) {
+        int value = 0;
+        for (tensorRank axis = 0; axis < shape.rank(); axis++) {
+            value = value * 100 + static_cast<int>(index[axis]);
+        }
+        return value;
+    }
+
+    template <auto shape, TensorLayout Layout>
+    void fill(Tensor<int, shape, Layout>& tensor) {
+        std::array<tensorSize, shape.rank()> index {};
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            tensorSize flat = i;
+            for (tensorRank axis = shape.rank(); axis-- > 0; ) {
+                index[axis] = flat % static_cast<tensorSize>(shape[axis]);
+                flat /= static_cast<tensorSize>(shape[axis]);
+            }
+            tensor.data()[Layout::template offset<shape>(index)] = encode<shape>(index);
+        }
+    }
+
+    template <auto shape, TensorLayout Layout>
+    bool matchesEncoding(const Tensor<int, shape, Layout>& tensor) {
+        std::array<tensorSize, shape.rank()> index {};
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            tensorSize flat = i;
+            for (tensorRank axis = shape.rank(); axis-- > 0; ) {
+                index[axis] = flat % static_cast<tensorSize>(shape[axis]);
+                flat /= static_cast<tensorSize>(shape[axis]);
+            }
+            if (tensor.data()[Layout::template offset<shape>(index)] != encode<shape>(index)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <auto shape, TensorLayout From, TensorLayout To>
+    void checkRelayout() {
+        auto in = std::make_unique<Tensor<int, shape, From>>();
+        auto out = std::make_unique<Tensor<int, shape, To>>();
+        auto back = std::make_unique<Tensor<int, shape, From>>();
+        fill(*in);
+        relayout(*in, *out);
+        CHECK(matchesEncoding(*out));
+        relayout(*out, *back);
+        CHECK(std::equal(in->data(), in->data() + in->size(), back->data()));
+    }
+}
+
+TEST_CASE("Layout, offsets", "[Layout]"){
+    constexpr Shape<2> shape {4, 6};
+    STATIC_CHECK(RowMajor::offset<shape>({1, 2}) == 8);
+    STATIC_CHECK(ColumnMajor::offset<shape>({1, 2}) == 9);
+    // Tiles of 2 x 3, two tiles per row of tiles
+    STATIC_CHECK(Tiled<2, 3>::offset<shape>({1, 2}) == 5);
+    STATIC_CHECK(Tiled<2, 3>::offset<shape>({0, 3}) == 6);
+    STATIC_CHECK(Tiled<2, 3>::offset<shape>({2, 0}) == 12);
+    STATIC_CHECK(Tiled<2, 3>::offset<shape>({3, 5}) == 23);
+
+    STATIC_CHECK(Tiled<2, 3>::fits<shape>());
+    STATIC_CHECK(!Tiled<3, 3>::fits<shape>());
+    STATIC_CHECK(!Tiled<2, 3, 1>::fits<shape>());
+
+    constexpr Shape<3> cube {2, 3, 4};
+    STATIC_CHECK(ColumnMajor::offset<cube>({1, 2, 3}) == 1 + 2 * 2 + 3 * 6);
+    STATIC_CHECK(Tensor<float, cube>::offset(1, 2, 3) == 23);
+    STATIC_CHECK(Tensor<float, cube, ColumnMajor>::offset(1, 2, 3) == 23);
+    STATIC_CHECK(Tensor<float, cube, ColumnMajor>::offset(1, 0, 0) == 1);
+}
+
+TEST_CASE("Layout, every element has its own offset", "[Layout]"){
+    constexpr Shape<3> shape {4, 6, 8};
+    std::array<bool, shape.n_elems()> seen {};
+    for (tensorSize i = 0; i < 4; i++) {
+        for (tensorSize j = 0; j < 6; j++) {
+            for (tensorSize k = 0; k < 8; k++) {
+                const tensorSize offset = Tiled<2, 3, 4>::offset<shape>({i, j, k});
+                REQUIRE(offset < shape.n_elems());
+                REQUIRE(offset == Tiled<2, 3, 4>::axisOffset<shape>(0, i) + Tiled<2, 3, 4>::axisOffset<shape>(1, j)
+                                  + Tiled<2, 3, 4>::axisOffset<shape>(2, k));
+                REQUIRE(!seen[offset]);
+                seen[offset] = true;
+            }
+        }
+    }
+}
+
+TEST_CASE("Layout, initializers are row-major whatever the storage", "[Layout]"){
+    constexpr auto make = [] {
+        return Tensor<int, Shape{2, 3}, ColumnMajor>({{1, 2, 3}, {4, 5, 6}});
+    };
+    constexpr auto columnMajor = make();
+    STATIC_CHECK(columnMajor.at(0, 2) == 3);
+    STATIC_CHECK(columnMajor.at(1, 0) == 4);
+    STATIC_CHECK(columnMajor.data()[1] == 4);
+    STATIC_CHECK(columnMajor.data()[2] == 2);
+
+    int values[2][4] {{1, 2, 3, 4}, {5, 6, 7, 8}};
+    Tensor<int, Shape{2, 4}, Tiled<2, 2>> tiled (values);
+    CHECK(tiled.data()[0] == 1);
+    CHECK(tiled.data()[1] == 2);
+    CHECK(tiled.data()[2] == 5);
+    CHECK(tiled.data()[3] == 6);
+    CHECK(tiled.data()[4] == 3);
+    CHECK(tiled.at(1, 3) == 8);
+
+    std::array<int, 8> range {1, 2, 3, 4, 5, 6, 7, 8};
+    Tensor<int, Shape{2, 4}, ColumnMajor> fromRange (from_range, range);
+    CHECK(fromRange.at(0, 3) == 4);
+    CHECK(fromRange.data()[1] == 5);
+
+    tiled.at(0, 3) = 40;
+    CHECK(tiled.data()[5] == 40);
+}
+
+TEST_CASE("Layout, relayout", "[Layout]"){
+    constexpr Shape<2> matrix {64, 96};
+    checkRelayout<matrix, RowMajor, ColumnMajor>();
+    checkRelayout<matrix, RowMajor, Tiled<8, 16>>();
+    checkRelayout<matrix, ColumnMajor, Tiled<8, 16>>();
+    checkRelayout<matrix, Tiled<16, 8>, Tiled<8, 16>>();
+    checkRelayout<matrix, Tiled<4, 4>, RowMajor>();
+
+    // Not a multiple of the transpose block
+    constexpr Shape<2> odd {37, 45};
+    checkRelayout<odd, RowMajor, ColumnMajor>();
+    checkRelayout<odd, ColumnMajor, Tiled<37, 5>>();
+
+    constexpr Shape<3> cube {6, 5, 40};
+    checkRelayout<cube, RowMajor, ColumnMajor>();
+    checkRelayout<cube, RowMajor, Tiled<2, 5, 8>>();
+    checkRelayout<cube, Tiled<3, 1, 20>, ColumnMajor>();
+
+    constexpr Shape<1> vector {40};
+    checkRelayout<vector, Tiled<8>, ColumnMajor>();
+}
+
+TEST_CASE("Layout, constexpr relayout and elementwise", "[Layout]"){
+    constexpr auto transposed = [] {
+        Tensor<int, Shape{2, 3}> rowMajor ({{1, 2, 3}, {4, 5, 6}});
+        Tensor<int, Shape{2, 3}, ColumnMajor> columnMajor;
+        relayout(rowMajor, columnMajor);
+        add(columnMajor, columnMajor, columnMajor);
+        return columnMajor;
+    }();
+    STATIC_CHECK(transposed.data()[0] == 2);
+    STATIC_CHECK(transposed.data()[1] == 8);
+    STATIC_CHECK(transposed.at(1, 2) == 12);
+    STATIC_CHECK(sum(transposed) == 42);
+}
+
+TEST_CASE("Layout, Morton offsets", "[Layout][Morton]"){
+    constexpr Shape<2> square {4, 4};
+    // Z pattern within each 2 x 2 block, and of the blocks
+    STATIC_CHECK(Morton::offset<square>({0, 1}) == 1);
+    STATIC_CHECK(Morton::offset<square>({1, 0}) == 2);
+    STATIC_CHECK(Morton::offset<square>({1, 1}) == 3);
+    STATIC_CHECK(Morton::offset<square>({0, 2}) == 4);
+    STATIC_CHECK(Morton::offset<square>({2, 0}) == 8);
+    STATIC_CHECK(Morton::offset<square>({3, 3}) == 15);
+    STATIC_CHECK(Morton::contiguousRun<square>() == 2);
+
+    constexpr Shape<3> cube {2, 2, 2};
+    STATIC_CHECK(Morton::offset<cube>({0, 0, 1}) == 1);
+    STATIC_CHECK(Morton::offset<cube>({0, 1, 0}) == 2);
+    STATIC_CHECK(Morton::offset<cube>({1, 0, 0}) == 4);
+
+    // Once the first axis runs out of bits the second carries on alone
+    constexpr Shape<2> wide {2, 8};
+    STATIC_CHECK(Morton::offset<wide>({1, 1}) == 3);
+    STATIC_CHECK(Morton::offset<wide>({0, 2}) == 4);
+    STATIC_CHECK(Morton::offset<wide>({0, 4}) == 8);
+    STATIC_CHECK(Morton::offset<wide>({1, 7}) == 15);
+
+    STATIC_CHECK(Morton::fits<Shape{16, 4, 8}>());
+    STATIC_CHECK(!Morton::fits<Shape{6, 8}>());
+    STATIC_CHECK(!Morton::fits<Shape{8}>());
+    STATIC_CHECK(!Morton::fits<Shape{2, 2, 2, 2}>());
+}
+
+TEST_CASE("Layout, Morton encodes and decodes every element", "[Layout][Morton]"){
+    constexpr Shape<3> shape {8, 32, 4};
+    std::array<bool, shape.n_elems()> seen {};
+    for (tensorSize i = 0; i < 8; i++) {
+        for (tensorSize j = 0; j < 32; j++) {
+            for (tensorSize k = 0; k < 4; k++) {
+                const tensorSize offset = Morton::offset<shape>({i, j, k});
+                REQUIRE(offset < shape.n_elems());
+                REQUIRE(!seen[offset]);
+                seen[offset] = true;
+                const auto index = Morton::indexOf<shape>(offset);
+                REQUIRE(index == std::array<tensorSize, 3>{i, j, k});
+            }
+        }
+    }
+}
+
+TEST_CASE("Layout, Morton neighbours", "[Layout][Morton]"){
+    constexpr Shape<2> shape {16, 32};
+    for (tensorSize i = 0; i < 16; i++) {
+        for (tensorSize j = 0; j < 32; j++) {
+            const tensorSize offset = Morton::offset<shape>({i, j});
+            for (tensorIndex delta : {-17, -1, 1, 3, 16, 40}) {
+                const auto wrappedI = static_cast<tensorSize>((static_cast<tensorIndex>(i) + delta + 64) % 16);
+                const auto wrappedJ = static_cast<tensorSize>((static_cast<tensorIndex>(j) + delta + 64) % 32);
+                REQUIRE(Morton::neighbour<shape>(offset, 0, delta) == Morton::offset<shape>({wrappedI, j}));
+                REQUIRE(Morton::neighbour<shape>(offset, 1, delta) == Morton::offset<shape>({i, wrappedJ}));
+            }
+        }
+    }
+}
+
+TEST_CASE("Layout, iteration in storage order", "[Layout]"){
+    const auto checkOrder = []<auto shape, TensorLayout Layout>(const Tensor<int, shape, Layout>& tensor) {
+        tensorSize expectedOffset = 0;
+        bool inOrder = true;
+        tensor.forEachStored([&](const int& element, const std::array<tensorSize, shape.rank()>& index) {
+            inOrder = inOrder && &element == tensor.data() + expectedOffset++
+                      && element == encode<shape>(index);
+        });
+        CHECK(inOrder);
+        CHECK(expectedOffset == shape.n_elems());
+    };
+    auto rowMajor = std::make_unique<Tensor<int, Shape{6, 5, 4}>>();
+    auto columnMajor = std::make_unique<Tensor<int, Shape{6, 5, 4}, ColumnMajor>>();
+    auto tiled = std::make_unique<Tensor<int, Shape{6, 5, 4}, Tiled<3, 5, 2>>>();
+    auto morton2 = std::make_unique<Tensor<int, Shape{16, 64}, Morton>>();
+    auto morton3 = std::make_unique<Tensor<int, Shape{2, 8, 16}, Morton>>();
+    fill(*rowMajor);
+    fill(*columnMajor);
+    fill(*tiled);
+    fill(*morton2);
+    fill(*morton3);
+    checkOrder(*rowMajor);
+    checkOrder(*columnMajor);
+    checkOrder(*tiled);
+    checkOrder(*morton2);
+    checkOrder(*morton3);
+
+    for (tensorSize offset = 0; offset < 120; offset++) {
+        REQUIRE(Tiled<3, 5, 2>::offset<Shape{6, 5, 4}>(Tiled<3, 5, 2>::indexOf<Shape{6, 5, 4}>(offset)) == offset);
+        REQUIRE(ColumnMajor::offset<Shape{6, 5, 4}>(ColumnMajor::indexOf<Shape{6, 5, 4}>(offset)) == offset);
+    }
+}
+
+TEST_CASE("Layout, Morton relayout", "[Layout][Morton]"){
+    checkRelayout<Shape{64, 128}, RowMajor, Morton>();
+    checkRelayout<Shape{64, 128}, Morton, ColumnMajor>();
+    checkRelayout<Shape{16, 8, 32}, RowMajor, Morton>();
+    checkRelayout<Shape{16, 8, 32}, Morton, Tiled<4, 4, 4>>();
+
+    constexpr auto morton = [] {
+        Tensor<int, Shape{2, 2}, Morton> tensor ({{1, 2}, {3, 4}});
+        return tensor;
+    }();
+    STATIC_CHECK(morton.at(1, 0) == 3);
+}
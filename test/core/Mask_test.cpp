@@ -0,0 +1,142 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Mask.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    // Small integers, so float sums are exact in any order, and NaN wherever the pixel is invalid
+    template <typename DType, auto shape>
+    void fillScene(Tensor<DType, shape>& scene, unsigned seed) {
+        std::mt19937 generator (seed);
+        std::uniform_int_distribution<int> distribution (-9, 9);
+        std::bernoulli_distribution invalid (0.3);
+        for (tensorSize i = 0; i < scene.size(); i++) {
+            scene.data()[i] = invalid(generator) ? std::numeric_limits<DType>::quiet_NaN() : static_cast<DType>(distribution(generator));
+        }
+    }
+
+    template <typename DType>
+    void checkMasked() {
+        // Rows of a vector and a word with tails of each, and several words in all
+        constexpr Shape<2> shape {3, 70};
+        Tensor<DType, shape> scene, fallback, out;
+        fillScene(scene, 1);
+        for (tensorSize i = 0; i < fallback.size(); i++) {
+            fallback.data()[i] = static_cast<DType>(i);
+        }
+        const auto valid = makeMask(scene, [](DType x) { return !std::isnan(x); });
+
+        DType expected = 0;
+        tensorSize count = 0;
+        for (tensorSize i = 0; i < scene.size(); i++) {
+            CHECK(valid.test(i) == !std::isnan(scene.data()[i]));
+            if (valid.test(i)) {
+                expected += scene.data()[i];
+                count++;
+            }
+        }
+        CHECK(valid.count() == count);
+        CHECK(sum(scene, valid) == expected);
+        CHECK(mean(scene, valid) == expected / static_cast<DType>(count));
+
+        where(valid, scene, fallback, out);
+        for (tensorSize i = 0; i < out.size(); i++) {
+            CHECK(out.data()[i] == (valid.test(i) ? scene.data()[i] : static_cast<DType>(i)));
+        }
+
+        // Written over one of its own inputs
+        where(~valid, fallback, scene, scene);
+        for (tensorSize i = 0; i < scene.size(); i++) {
+            CHECK(scene.data()[i] == out.data()[i]);
+        }
+
+        maskedFill(out, ~valid, DType {-1});
+        for (tensorSize i = 0; i < out.size(); i++) {
+            CHECK(out.data()[i] == (valid.test(i) ? scene.data()[i] : DType {-1}));
+        }
+    }
+
+    template <typename DType>
+    void checkMaskedIntegers() {
+        // Long enough for the unrolled sums at 64 bytes a vector, with single vectors and a tail after. Values
+        // over the whole range, so the sums wrap.
+        constexpr Shape<2> shape {5, 70};
+        Tensor<DType, shape> counts, fallback, out;
+        std::mt19937 generator (2);
+        std::uniform_int_distribution<int> distribution (std::numeric_limits<DType>::min(), std::numeric_limits<DType>::max());
+        for (tensorSize i = 0; i < counts.size(); i++) {
+            counts.data()[i] = static_cast<DType>(distribution(generator));
+            fallback.data()[i] = static_cast<DType>(i);
+        }
+        const auto valid = makeMask(counts, [](DType x) { return x % 3 != 0; });
+
+        DType expected = 0;
+        for (tensorSize i = 0; i < counts.size(); i++) {
+            expected = static_cast<DType>(expected + (valid.test(i) ? counts.data()[i] : DType {0}));
+        }
+        CHECK(sum(counts, valid) == expected);
+
+        where(valid, counts, fallback, out);
+        for (tensorSize i = 0; i < out.size(); i++) {
+            CHECK(out.data()[i] == (valid.test(i) ? counts.data()[i] : static_cast<DType>(i)));
+        }
+
+        maskedFill(out, ~valid, std::numeric_limits<DType>::max());
+        for (tensorSize i = 0; i < out.size(); i++) {
+            CHECK(out.data()[i] == (valid.test(i) ? counts.data()[i] : std::numeric_limits<DType>::max()));
+        }
+    }
+}
+
+TEST_CASE("Mask, packed bits and logic", "[Mask]") {
+    constexpr auto check = [] {
+        Tensor<int, Shape{2, 3}, ColumnMajor> values ({{1, -2, 3}, {-4, 5, -6}});
+        const auto positive = makeMask(values, [](int x) { return x > 0; });
+        const auto all = Mask<Shape{2, 3}, ColumnMajor>(true);
+        const auto negative = all ^ positive;
+        return positive.at(0, 0) && !positive.at(1, 0) && positive.at(1, 1) && positive.count() == 3
+               && negative == ~positive && !(positive & negative).any() && (positive | negative).all()
+               && all.words()[0] == 0b111111;
+    };
+    STATIC_CHECK(check());
+
+    STATIC_CHECK(Mask<Shape{512, 512}>::size_in_bytes() == 512 * 512 / 8);
+    STATIC_CHECK(Mask<Shape{65}>::nWords() == 2);
+    STATIC_CHECK(Mask<Shape{65}>(true).count() == 65);
+}
+
+TEST_CASE("Mask, where, fill and reductions at compile time", "[Mask]") {
+    constexpr auto results = [] {
+        Tensor<int, Shape{5}> a ({1, 2, 3, 4, 5});
+        Tensor<int, Shape{5}> b ({10, 20, 30, 40, 50});
+        Mask<Shape{5}> odd;
+        odd.set(0);
+        odd.set(2);
+        odd.set(4);
+        Tensor<int, Shape{5}> out;
+        where(odd, a, b, out);
+        maskedFill(b, odd, 0);
+        return std::array<int, 4> {out.at(1), out.at(2), sum(a, odd), sum(b, ~odd)};
+    }();
+    STATIC_CHECK(results == std::array<int, 4> {20, 3, 9, 60});
+}
+
+TEST_CASE("Mask, float and double kernels skip invalid pixels", "[Mask]") {
+    checkMasked<float>();
+    checkMasked<double>();
+
+    Tensor<double, Shape{4}> nothing ({1, 2, 3, 4});
+    CHECK(std::isnan(mean(nothing, Mask<Shape{4}>())));
+}
+
+TEST_CASE("Mask, 8 and 16-bit integer kernels", "[Mask]") {
+    checkMaskedIntegers<std::uint8_t>();
+    checkMaskedIntegers<std::int8_t>();
+    checkMaskedIntegers<std::uint16_t>();
+    checkMaskedIntegers<std::int16_t>();
+}
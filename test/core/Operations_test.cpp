@@ -0,0 +1,264 @@
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Operations.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    // Long enough for the unrolled vector loops, with a tail
+    constexpr Shape<2> shape {5, 15};
+
+    template <Scalar DType>
+    void fill(Tensor<DType, shape>& tensor, float start, float step) {
+        for (tensorSize i = 0; i < tensor.size(); i++) {
+            tensor.data()[i] = start + step * static_cast<float>(i);
+        }
+    }
+}
+
+TEST_CASE("Operations, constexpr", "[Operations]"){
+    constexpr auto sumOfSums = [] {
+        Tensor<int, Shape{2, 3}> a ({{1, 2, 3}, {4, 5, 6}});
+        Tensor<int, Shape{2, 3}> b ({{6, 5, 4}, {3, 2, 1}});
+        Tensor<int, Shape{2, 3}> out;
+        add(a, b, out);
+        return sum(out);
+    };
+    STATIC_CHECK(sumOfSums() == 42);
+
+    constexpr auto halfDot = [] {
+        Tensor<float16, Shape{3}> a ({1.0f, 2.0f, 3.0f});
+        Tensor<float16, Shape{3}> b ({0.5f, 0.25f, 2.0f});
+        return dot(a, b);
+    };
+    STATIC_CHECK(halfDot() == 7.0f);
+}
+
+TEST_CASE("Operations, float16 conversions match the scalar rounding", "[Operations][Half]"){
+    Tensor<float, shape> floats;
+    fill(floats, -70000.0f, 1234.567f);
+    floats.data()[1] = std::numeric_limits<float>::quiet_NaN();
+    floats.data()[2] = 0x1.8p-24f;
+    floats.data()[3] = 65520.0f;
+    floats.data()[40] = -0.0f;
+
+    Tensor<float16, shape> halves;
+    convert(floats, halves);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        REQUIRE(halves.data()[i].bits() == float16(floats.data()[i]).bits());
+    }
+
+    Tensor<float, shape> widened;
+    convert(halves, widened);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        const float expected = halves.data()[i];
+        REQUIRE(std::bit_cast<uint32_t>(widened.data()[i]) == std::bit_cast<uint32_t>(expected));
+    }
+}
+
+TEST_CASE("Operations, bfloat16 conversions match the scalar rounding", "[Operations][Half]"){
+    Tensor<float, shape> floats;
+    fill(floats, -3.0f, 0.0078125f + 0x1p-16f);
+    floats.data()[0] = std::bit_cast<float>(0x3F808000U);
+    floats.data()[1] = std::bit_cast<float>(0x3F818000U);
+    floats.data()[2] = std::bit_cast<float>(0x7F800001U);
+    floats.data()[3] = -std::numeric_limits<float>::infinity();
+
+    Tensor<bfloat16, shape> bfloats;
+    convert(floats, bfloats);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        REQUIRE(bfloats.data()[i].bits() == bfloat16(floats.data()[i]).bits());
+    }
+
+    Tensor<float, shape> widened;
+    convert(bfloats, widened);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        REQUIRE(std::bit_cast<uint32_t>(widened.data()[i]) == static_cast<uint32_t>(bfloats.data()[i].bits()) << 16);
+    }
+}
+
+TEST_CASE("Operations, half elementwise and reductions widen to fp32", "[Operations][Half]"){
+    Tensor<float16, shape> a;
+    Tensor<float16, shape> b;
+    fill(a, -2.0f, 0.0625f);
+    fill(b, 1.0f, -0.03125f);
+
+    Tensor<float16, shape> out;
+    add(a, b, out);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        REQUIRE(out.data()[i].bits() == float16(a.data()[i] + b.data()[i]).bits());
+    }
+    subtract(a, b, out);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        REQUIRE(out.data()[i].bits() == float16(a.data()[i] - b.data()[i]).bits());
+    }
+    multiply(a, b, out);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        REQUIRE(out.data()[i].bits() == float16(a.data()[i] * b.data()[i]).bits());
+    }
+
+    double expectedSum = 0;
+    double expectedDot = 0;
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        expectedSum += a.data()[i];
+        expectedDot += static_cast<double>(a.data()[i]) * b.data()[i];
+    }
+    STATIC_CHECK(std::same_as<decltype(sum(a)), float>);
+    CHECK(std::abs(sum(a) - expectedSum) < 1e-4);
+    CHECK(std::abs(dot(a, b) - expectedDot) < 1e-4);
+
+    Tensor<bfloat16, shape> c;
+    fill(c, 0.5f, 0.25f);
+    Tensor<bfloat16, shape> d;
+    multiply(c, c, d);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        REQUIRE(d.data()[i].bits() == bfloat16(c.data()[i] * c.data()[i]).bits());
+    }
+    double expectedSquares = 0;
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        expectedSquares += static_cast<double>(c.data()[i]) * c.data()[i];
+    }
+    CHECK(std::abs(dot(c, c) - expectedSquares) < 1e-2);
+}
+
+TEST_CASE("Operations, compile-time tables", "[Operations]"){
+    // 3x3 Gauss-Legendre weights on [-1, 1]^2, the outer product of the 1D rule with itself
+    constexpr auto weights = [] {
+        Tensor<double, Shape{3, 1}> column ({{5.0 / 9}, {8.0 / 9}, {5.0 / 9}});
+        Tensor<double, Shape{1, 3}> row ({{5.0 / 9, 8.0 / 9, 5.0 / 9}});
+        Tensor<double, Shape{3, 3}> out;
+        matmul(column, row, out);
+        return out;
+    }();
+    STATIC_CHECK(weights.at(1, 1) == 8.0 / 9 * (8.0 / 9));
+    STATIC_CHECK(sum(weights) > 4 - 1e-15);
+    STATIC_CHECK(sum(weights) < 4 + 1e-15);
+    STATIC_CHECK(max(weights) == weights.at(1, 1));
+
+    // Bilinear shape functions at the 2x2 Gauss points, which sum to one at every point
+    constexpr auto shapeFunctions = [] {
+        constexpr double g = 0.57735026918962576451;
+        constexpr double points[4][2] {{-g, -g}, {g, -g}, {g, g}, {-g, g}};
+        constexpr double corners[4][2] {{-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
+        Tensor<double, Shape{4, 4}> n;
+        for (tensorSize p = 0; p < 4; p++) {
+            for (tensorSize c = 0; c < 4; c++) {
+                n.at(p, c) = (1 + corners[c][0] * points[p][0]) * (1 + corners[c][1] * points[p][1]) / 4;
+            }
+        }
+        return n;
+    }();
+    constexpr auto partition = [&] {
+        Tensor<double, Shape{4, 1}> ones ({{1.0}, {1.0}, {1.0}, {1.0}});
+        Tensor<double, Shape{4, 1}> out;
+        matmul(shapeFunctions, ones, out);
+        Tensor<double, Shape{4, 1}> error;
+        map(out, error, [](double x) { return x < 1 ? 1 - x : x - 1; });
+        return max(error);
+    }();
+    STATIC_CHECK(partition < 1e-15);
+
+    // A quarter turn about z, four times over, and the set of turns it generates
+    constexpr auto turns = [] {
+        Tensor<int, Shape{3, 3}> turn ({{0, -1, 0}, {1, 0, 0}, {0, 0, 1}});
+        Tensor<int, Shape{3, 3}> power ({{1, 0, 0}, {0, 1, 0}, {0, 0, 1}});
+        Tensor<int, Shape{4, 9}> set;
+        for (tensorSize k = 0; k < 4; k++) {
+            for (tensorSize i = 0; i < 9; i++) {
+                set.data()[9 * k + i] = power.data()[i];
+            }
+            Tensor<int, Shape{3, 3}> next;
+            matmul(power, turn, next);
+            power = std::move(next);
+        }
+        return set;
+    }();
+    STATIC_CHECK(turns.at(1, 1) == -1);
+    STATIC_CHECK(turns.at(2, 0) == -1);
+    STATIC_CHECK(product(turns) == 0);
+    STATIC_CHECK(min(turns) == -1);
+
+    constexpr auto scaled = [] {
+        Tensor<float, Shape{3}> a ({1.0f, 2.0f, 4.0f});
+        Tensor<float, Shape{3}> b ({2.0f, 8.0f, 8.0f});
+        scale(a, 3.0f, a);
+        divide(a, b, b);
+        return product(b);
+    }();
+    STATIC_CHECK(scaled == 1.5f * 0.75f * 1.5f);
+}
+
+TEST_CASE("Operations, runtime matmul and scale match the constexpr loops", "[Operations]"){
+    Tensor<float, Shape{5, 7}> lhs;
+    Tensor<float, Shape{7, 19}> rhs;
+    for (tensorSize i = 0; i < lhs.size(); i++) {
+        lhs.data()[i] = 0.25f * static_cast<float>(i % 11) - 1.0f;
+    }
+    for (tensorSize i = 0; i < rhs.size(); i++) {
+        rhs.data()[i] = 0.125f * static_cast<float>(i % 13) - 0.5f;
+    }
+
+    // Row-major takes the SIMD kernel, column-major the loop
+    Tensor<float, Shape{5, 19}> fast;
+    Tensor<float, Shape{5, 19}, ColumnMajor> plain;
+    matmul(lhs, rhs, fast);
+    matmul(lhs, rhs, plain);
+    for (tensorSize i = 0; i < 5; i++) {
+        for (tensorSize j = 0; j < 19; j++) {
+            REQUIRE(std::abs(fast.at(i, j) - plain.at(i, j)) < 1e-5f);
+        }
+    }
+
+    Tensor<double, shape> values;
+    fill(values, -3.0f, 0.5f);
+    scale(values, -2.0, values);
+    CHECK(values.at(0, 0) == 6.0);
+    CHECK(values.at(4, 14) == -2.0 * (-3.0 + 0.5 * 74));
+    CHECK(max(values) == 6.0);
+}
+
+TEST_CASE("Operations, runtime float and double arithmetic covers the vector tails", "[Operations]"){
+    // 75 elements: whole blocks of four vectors, single vectors and a tail shorter than one, at either width
+    Tensor<float, shape> lhs;
+    Tensor<float, shape> rhs;
+    Tensor<float, shape> out;
+    fill(lhs, -3.0f, 0.5f);
+    fill(rhs, 2.0f, -0.25f);
+    add(lhs, rhs, out);
+    for (tensorSize i = 0; i < out.size(); i++) {
+        REQUIRE(out.data()[i] == lhs.data()[i] + rhs.data()[i]);
+    }
+    multiply(lhs, rhs, out);
+    for (tensorSize i = 0; i < out.size(); i++) {
+        REQUIRE(out.data()[i] == lhs.data()[i] * rhs.data()[i]);
+    }
+    divide(lhs, rhs, out);
+    for (tensorSize i = 0; i < out.size(); i++) {
+        REQUIRE(out.data()[i] == lhs.data()[i] / rhs.data()[i]);
+    }
+
+    // Multiples of 1/8 well inside the mantissa, so the sums are exact in any order
+    float total = 0.0f;
+    float products = 0.0f;
+    for (tensorSize i = 0; i < lhs.size(); i++) {
+        total += lhs.data()[i];
+        products += lhs.data()[i] * rhs.data()[i];
+    }
+    CHECK(sum(lhs) == total);
+    CHECK(dot(lhs, rhs) == products);
+
+    // In place, out being the left input
+    Tensor<double, shape> values;
+    Tensor<double, shape> step;
+    fill(values, 1.0f, 1.0f);
+    fill(step, 0.5f, 0.0f);
+    subtract(values, step, values);
+    for (tensorSize i = 0; i < values.size(); i++) {
+        REQUIRE(values.data()[i] == static_cast<double>(i) + 0.5);
+    }
+    CHECK(sum(values) == 75.0 * 37.0 + 75.0 * 0.5);
+    CHECK(dot(values, step) == 0.5 * sum(values));
+}
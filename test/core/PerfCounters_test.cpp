@@ -0,0 +1,97 @@
+#include <memory>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#endif
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Instrumentation.h"
+#include "TensorII/PerfCounters.h"
+
+using namespace TensorII::Core::Instrumentation;
+
+namespace {
+    // Touch one byte per page of fresh memory, so there is at least one page fault per page. Mapped rather than
+    // allocated, since the heap may hand back pages an earlier test already faulted in.
+    void touchPages(size_t nPages) {
+        constexpr size_t pageSize = 4096;
+        const size_t bytes = nPages * pageSize;
+#if defined(__unix__) || defined(__APPLE__)
+        void* mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        REQUIRE(mapping != MAP_FAILED);
+        auto* memory = static_cast<char*>(mapping);
+#else
+        auto allocation = std::make_unique<char[]>(bytes);
+        char* memory = allocation.get();
+#endif
+        for (size_t i = 0; i < nPages; i++) {
+            reinterpret_cast<volatile char&>(memory[i * pageSize]) = 1;
+        }
+#if defined(__unix__) || defined(__APPLE__)
+        munmap(mapping, bytes);
+#endif
+    }
+}
+
+TEST_CASE("PerfCounters, counters never decrease", "[PerfCounters]"){
+    PerfCounters counters;
+    CounterSample before = counters.read();
+    touchPages(64);
+    CounterSample after = counters.read();
+    for (size_t i = 0; i < nCounters; i++) {
+        CHECK(after.values[i] >= before.values[i]);
+    }
+}
+
+TEST_CASE("PerfCounters, unavailable counters read as 0", "[PerfCounters]"){
+    PerfCounters counters;
+    touchPages(16);
+    CounterSample sample = counters.read();
+    for (size_t i = 0; i < nCounters; i++) {
+        auto counter = static_cast<Counter>(i);
+        if (!counters.available(counter)) {
+            CHECK(sample[counter] == 0);
+        }
+    }
+    CHECK(counters.available() == (counters.available(Counter::Cycles)
+                                   || counters.available(Counter::Instructions)
+                                   || counters.available(Counter::CacheMisses)
+                                   || counters.available(Counter::BranchMisses)
+                                   || counters.available(Counter::PageFaults)));
+}
+
+TEST_CASE("PerfCounters, sample arithmetic", "[PerfCounters]"){
+    CounterSample a;
+    a[Counter::Cycles] = 10;
+    a[Counter::Instructions] = 25;
+    CounterSample b;
+    b[Counter::Cycles] = 4;
+    b[Counter::Instructions] = 5;
+
+    CounterSample difference = a - b;
+    CHECK(difference[Counter::Cycles] == 6);
+    CHECK(difference[Counter::Instructions] == 20);
+
+    difference += b;
+    CHECK(difference[Counter::Cycles] == 10);
+    CHECK(difference[Counter::Instructions] == 25);
+}
+
+TEST_CASE("PerfCounters, per-op counters in instrumentation", "[PerfCounters][Instrumentation]"){
+    reset();
+    setHardwareCounters(true);
+    {
+        ScopedOp op {"touchPages", OpKind::Copy, 64, 64 * 4096};
+        touchPages(64);
+    }
+    setHardwareCounters(false);
+
+    auto recorded = stats();
+    REQUIRE(recorded.size() == 1);
+    if (PerfCounters::thisThread().available(Counter::PageFaults)) {
+        CHECK(recorded[0].counters[Counter::PageFaults] >= 1);
+    } else {
+        CHECK(recorded[0].counters[Counter::PageFaults] == 0);
+    }
+    reset();
+}
@@ -0,0 +1,88 @@
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Pipeline.h"
+#include "TensorII/Tensor.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    using Raw = Tensor<std::uint16_t, Shape{4, 6, 3}>;
+    using Scaled = Tensor<float, Shape{4, 6, 3}>;
+
+    StageTask produce(FramePool<Raw>& frames, Channel<Frame<Raw>>& out, int count, std::atomic<int>& produced) {
+        for (int i = 0; i < count; i++) {
+            Frame<Raw> frame = co_await frames.acquire();
+            for (tensorSize j = 0; j < Raw::size(); j++) {
+                frame->data()[j] = static_cast<std::uint16_t>(i);
+            }
+            produced++;
+            if (!co_await out.push(std::move(frame))) {
+                break;
+            }
+        }
+        out.close();
+    }
+}
+
+TEST_CASE("Pipeline, frames flow through parallel stages on recycled buffers", "[Pipeline]") {
+    ThreadPool pool (3);
+    FramePool<Raw> rawFrames (2, pool);
+    FramePool<Scaled> scaledFrames (3, pool);
+    constexpr int copies = 3;
+    Channel<Frame<Raw>> raw (1, 1, pool);
+    Channel<Frame<Scaled>> scaled (2, copies, pool);
+
+    std::atomic<int> produced = 0;
+    int consumed = 0, mostAhead = 0;
+    double total = 0;
+    Pipeline pipeline (pool);
+    pipeline.add(produce(rawFrames, raw, 100, produced));
+    for (int i = 0; i < copies; i++) {
+        pipeline.add(transform(raw, scaled, scaledFrames, [](const Raw& in, Scaled& out) {
+            for (tensorSize j = 0; j < Raw::size(); j++) {
+                out.data()[j] = 0.5f * in.data()[j];
+            }
+        }));
+    }
+    pipeline.add(consume(scaled, [&](Frame<Scaled> frame) {
+        total += frame->at(3, 5, 2);
+        consumed++;
+        mostAhead = std::max(mostAhead, produced - consumed);
+    }));
+    pipeline.wait();
+
+    CHECK(consumed == 100);
+    CHECK(total == 0.5 * 99 * 100 / 2);
+    // Back-pressure: the producer can't get further ahead than there are frames to hold what's in flight
+    CHECK(mostAhead <= 2 + 3);
+    CHECK(rawFrames.available() == 2);
+    CHECK(scaledFrames.available() == 3);
+}
+
+TEST_CASE("Pipeline, a failing stage cancels the rest rather than stalling them", "[Pipeline]") {
+    ThreadPool pool (2);
+    FramePool<Raw> rawFrames (2, pool);
+    FramePool<Scaled> scaledFrames (1, pool);
+    Channel<Frame<Raw>> raw (1, 1, pool);
+    Channel<Frame<Scaled>> scaled (1, 1, pool);
+
+    std::atomic<int> produced = 0;
+    int consumed = 0;
+    Pipeline pipeline (pool);
+    pipeline.add(produce(rawFrames, raw, 1000, produced));
+    pipeline.add(transform(raw, scaled, scaledFrames, [](const Raw& in, Scaled&) {
+        if (in.at(0, 0, 0) == 5) {
+            throw std::domain_error("bad frame");
+        }
+    }));
+    pipeline.add(consume(scaled, [&](const Frame<Scaled>&) { consumed++; }));
+
+    CHECK_THROWS_AS(pipeline.wait(), std::domain_error);
+    CHECK(consumed <= 5);
+    CHECK(produced < 1000);
+    CHECK(rawFrames.available() == 2);
+    CHECK_THROWS_AS(Channel<int>(0), std::invalid_argument);
+}
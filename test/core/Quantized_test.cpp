@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Quantized.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    // Exact reference for the integer kernels, 64-bit accumulation of the raw stored values
+    template <QuantizedStorage Stored, auto shape>
+    void checkKernels(const QuantizedTensor<Stored, shape>& lhs, const QuantizedTensor<Stored, shape>& rhs) {
+        int64_t expectedSum = 0;
+        int64_t expectedDot = 0;
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            expectedSum += lhs.values().data()[i];
+            expectedDot += static_cast<int64_t>(lhs.values().data()[i]) * rhs.values().data()[i];
+        }
+        CHECK(sum(lhs) == static_cast<double>(expectedSum));
+        CHECK(dot(lhs, rhs) == static_cast<double>(expectedDot));
+    }
+
+    template <QuantizedStorage Stored, auto shape, tensorRank axis>
+    void fillPattern(QuantizedTensor<Stored, shape, axis>& tensor, uint32_t seed) {
+        // Mostly extremes, which is where the widening and bias tricks could go wrong
+        uint32_t state = seed;
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            state = state * 1664525 + 1013904223;
+            const uint32_t pick = state >> 28;
+            Stored value;
+            if (pick < 5) {
+                value = std::numeric_limits<Stored>::lowest();
+            } else if (pick < 10) {
+                value = std::numeric_limits<Stored>::max();
+            } else {
+                value = static_cast<Stored>(state >> 8);
+            }
+            tensor.values().data()[i] = value;
+        }
+    }
+}
+
+TEST_CASE("Quantized, constexpr round trip", "[Quantized]"){
+    constexpr auto roundTrip = [] {
+        Tensor<float, Shape{4}> reals ({-1.0f, 0.0f, 0.26f, 100.0f});
+        QuantizedTensor<int8_t, Shape{4}> quantized (0.5f, 10);
+        quantize(reals, quantized);
+        return quantized;
+    };
+    constexpr auto quantized = roundTrip();
+    STATIC_CHECK(quantized.values().data()[0] == 8);
+    STATIC_CHECK(quantized.values().data()[2] == 11);
+    // Saturates
+    STATIC_CHECK(quantized.values().data()[3] == 127);
+    STATIC_CHECK(quantized.at(0) == -1.0f);
+    STATIC_CHECK(quantized.at(2) == 0.5f);
+    STATIC_CHECK(sum(quantized) == -1.0 + 0.0 + 0.5 + 58.5);
+}
+
+TEST_CASE("Quantized, per band gain and offset", "[Quantized]"){
+    // Raw counts of 3 bands, interleaved per pixel
+    constexpr Shape<3> shape {4, 5, 3};
+    using Counts = QuantizedTensor<uint16_t, shape, 2>;
+    STATIC_CHECK(Counts::nChannels == 3);
+    STATIC_CHECK(Counts::innerSize() == 1);
+    STATIC_CHECK(Counts::outerSize() == 20);
+
+    Counts counts ({0.5f, 2.0f, 0.125f}, {100, 0, 4000});
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        counts.values().data()[i] = static_cast<uint16_t>(4000 + 37 * i);
+    }
+
+    Tensor<float, shape> calibrated;
+    dequantize(counts, calibrated);
+    double expectedSum = 0;
+    double expectedDot = 0;
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        const tensorSize band = i % 3;
+        const double expected = counts.scales()[band] * (static_cast<double>(counts.values().data()[i]) - counts.zeroPoints()[band]);
+        REQUIRE(calibrated.data()[i] == static_cast<float>(expected));
+        expectedSum += expected;
+        expectedDot += expected * expected;
+    }
+    CHECK(sum(counts) == expectedSum);
+    CHECK(std::abs(dot(counts, counts) - expectedDot) < 1e-6 * expectedDot);
+
+    // Quantizing the calibrated values gets the counts back
+    Counts requantized (counts.scales(), counts.zeroPoints());
+    quantize(calibrated, requantized);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        REQUIRE(requantized.values().data()[i] == counts.values().data()[i]);
+    }
+}
+
+TEST_CASE("Quantized, per channel on an outer axis", "[Quantized]"){
+    constexpr Shape<2> shape {3, 203};
+    using Quantized = QuantizedTensor<int8_t, shape, 0>;
+    STATIC_CHECK(Quantized::innerSize() == 203);
+    Quantized a ({0.25f, 1.0f, 4.0f}, {-3, 0, 7});
+    Quantized b ({2.0f, 0.5f, 1.0f}, {1, -128, 0});
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        a.values().data()[i] = static_cast<int8_t>(i * 7);
+        b.values().data()[i] = static_cast<int8_t>(i * 13 + 5);
+    }
+    double expectedSum = 0;
+    double expectedDot = 0;
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        expectedSum += a.at(i);
+        expectedDot += static_cast<double>(a.at(i)) * b.at(i);
+    }
+    CHECK(sum(a) == expectedSum);
+    CHECK(dot(a, b) == expectedDot);
+
+    QuantizedTensor<int32_t, shape, 0> product;
+    multiply(a, b, product);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        REQUIRE(product.at(i) == a.at(i) * b.at(i));
+    }
+}
+
+TEST_CASE("Quantized, elementwise stays in the integer domain", "[Quantized]"){
+    constexpr Shape<1> shape {40};
+    QuantizedTensor<uint16_t, shape> frame (0.5f, 1000);
+    QuantizedTensor<uint16_t, shape> dark (0.5f, 10);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        frame.values().data()[i] = static_cast<uint16_t>(65535 - i);
+        dark.values().data()[i] = static_cast<uint16_t>(i * 3);
+    }
+
+    QuantizedTensor<int32_t, shape> difference;
+    subtract(frame, dark, difference);
+    CHECK(difference.zeroPoints()[0] == 990);
+    QuantizedTensor<int32_t, shape> total;
+    add(frame, dark, total);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        REQUIRE(difference.at(i) == frame.at(i) - dark.at(i));
+        REQUIRE(total.at(i) == frame.at(i) + dark.at(i));
+    }
+
+    QuantizedTensor<uint16_t, shape> otherScale (0.25f, 10);
+    CHECK_THROWS_AS(subtract(frame, otherScale, difference), std::invalid_argument);
+}
+
+TEST_CASE("Quantized, elementwise results below zero", "[Quantized]"){
+    constexpr Shape<1> shape {6};
+    QuantizedTensor<uint8_t, shape> lhs (0.5f, 0);
+    QuantizedTensor<uint8_t, shape> rhs (0.5f, 200);
+    QuantizedTensor<int8_t, shape> small (1.0f, 0);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        lhs.values().data()[i] = static_cast<uint8_t>(i);
+        rhs.values().data()[i] = static_cast<uint8_t>(255 - i * 50);
+        small.values().data()[i] = static_cast<int8_t>(-128 + static_cast<int>(i) * 40);
+    }
+
+    // Stored differences, not just the reals they stand for, go negative
+    QuantizedTensor<int16_t, shape> difference;
+    subtract(lhs, rhs, difference);
+    QuantizedTensor<int16_t, shape> total;
+    add(small, small, total);
+    QuantizedTensor<int32_t, shape> product;
+    multiply(lhs, rhs, product);
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        REQUIRE(difference.values().data()[i] == static_cast<int>(i) - (255 - static_cast<int>(i) * 50));
+        REQUIRE(difference.at(i) == lhs.at(i) - rhs.at(i));
+        REQUIRE(total.values().data()[i] == 2 * (-128 + static_cast<int>(i) * 40));
+        REQUIRE(total.at(i) == small.at(i) + small.at(i));
+        REQUIRE(product.at(i) == lhs.at(i) * rhs.at(i));
+    }
+    CHECK(difference.values().data()[0] == -255);
+    CHECK(total.values().data()[0] == -256);
+}
+
+TEST_CASE("Quantized, interleaved bands with a partial block", "[Quantized]"){
+    // Bands last, and a pixel count that leaves a tail after the whole blocks
+    constexpr Shape<2> shape {1001, 3};
+    using Bands = QuantizedTensor<int8_t, shape, 1>;
+    STATIC_CHECK(Bands::innerSize() == 1);
+    Bands a ({0.5f, 2.0f, 1.0f}, {3, -7, 0});
+    Bands b ({1.0f, 0.25f, 4.0f}, {0, 1, -2});
+    fillPattern(a, 9);
+    fillPattern(b, 10);
+
+    std::array<int64_t, 3> sums {};
+    std::array<int64_t, 3> products {};
+    std::array<int64_t, 3> bSums {};
+    for (tensorSize i = 0; i < shape.n_elems(); i++) {
+        sums[i % 3] += a.values().data()[i];
+        bSums[i % 3] += b.values().data()[i];
+        products[i % 3] += static_cast<int64_t>(a.values().data()[i]) * b.values().data()[i];
+    }
+    double expectedSum = 0;
+    double expectedDot = 0;
+    for (tensorSize band = 0; band < 3; band++) {
+        const int64_t za = a.zeroPoints()[band];
+        const int64_t zb = b.zeroPoints()[band];
+        expectedSum += a.scales()[band] * static_cast<double>(sums[band] - 1001 * za);
+        expectedDot += static_cast<double>(a.scales()[band]) * b.scales()[band]
+                       * static_cast<double>(products[band] - zb * sums[band] - za * bSums[band] + 1001 * za * zb);
+    }
+    CHECK(sum(a) == expectedSum);
+    CHECK(dot(a, b) == expectedDot);
+}
+
+TEST_CASE("Quantized, integer kernels are exact", "[Quantized]"){
+    // Long enough that 32-bit partial sums must be flushed to 64 bits, with a tail
+    constexpr Shape<1> shape {(1 << 19) + 77};
+    auto int8s = std::make_unique<std::array<QuantizedTensor<int8_t, shape>, 2>>();
+    auto uint8s = std::make_unique<std::array<QuantizedTensor<uint8_t, shape>, 2>>();
+    auto int16s = std::make_unique<std::array<QuantizedTensor<int16_t, shape>, 2>>();
+    auto uint16s = std::make_unique<std::array<QuantizedTensor<uint16_t, shape>, 2>>();
+    fillPattern((*int8s)[0], 1);
+    fillPattern((*int8s)[1], 2);
+    fillPattern((*uint8s)[0], 3);
+    fillPattern((*uint8s)[1], 4);
+    fillPattern((*int16s)[0], 5);
+    fillPattern((*int16s)[1], 6);
+    fillPattern((*uint16s)[0], 7);
+    fillPattern((*uint16s)[1], 8);
+    checkKernels((*int8s)[0], (*int8s)[1]);
+    checkKernels((*uint8s)[0], (*uint8s)[1]);
+    checkKernels((*int16s)[0], (*int16s)[1]);
+    checkKernels((*uint16s)[0], (*uint16s)[1]);
+    // Every value at the extreme
+    for (auto& tensor : *int8s) { std::fill_n(tensor.values().data(), shape.n_elems(), int8_t(-128)); }
+    checkKernels((*int8s)[0], (*int8s)[1]);
+    for (auto& tensor : *uint16s) { std::fill_n(tensor.values().data(), shape.n_elems(), uint16_t(65535)); }
+    checkKernels((*uint16s)[0], (*uint16s)[1]);
+}
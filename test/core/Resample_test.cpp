@@ -0,0 +1,161 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Resample.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    // A plane in every band, which bilinear and bicubic both reproduce exactly away from the edges
+    double plane(double row, double column, tensorSize band) {
+        return 3 * row + 2 * column + 10 * static_cast<double>(band);
+    }
+
+    template <typename DType, auto shape>
+    void fillPlane(Tensor<DType, shape>& image) {
+        for (tensorSize row = 0; row < static_cast<tensorSize>(shape[0]); row++) {
+            for (tensorSize column = 0; column < static_cast<tensorSize>(shape[1]); column++) {
+                for (tensorSize band = 0; band < static_cast<tensorSize>(shape[2]); band++) {
+                    image.at(row, column, band) = static_cast<DType>(plane(static_cast<double>(row), static_cast<double>(column), band));
+                }
+            }
+        }
+    }
+
+    // Upsampling by 2, checked wherever every tap lies inside the image
+    template <Interpolation interpolation, typename DType, tensorDimension size, tensorDimension bands>
+    void checkPlane() {
+        constexpr Shape<3> inShape {size, size, bands};
+        constexpr Shape<3> outShape {2 * size, 2 * size, bands};
+        auto in = std::make_unique<Tensor<DType, inShape>>();
+        fillPlane(*in);
+        auto out = std::make_unique<Tensor<DType, outShape>>();
+        resize<interpolation>(*in, *out);
+
+        const double reach = interpolation == Interpolation::Bicubic ? 1 : 0;
+        const auto inside = [&](double position) { return position >= reach && position <= static_cast<double>(size) - 2 - reach; };
+        tensorSize checked = 0;
+        for (tensorSize row = 0; row < static_cast<tensorSize>(outShape[0]); row++) {
+            const double sourceRow = (static_cast<double>(row) + 0.5) / 2 - 0.5;
+            for (tensorSize column = 0; column < static_cast<tensorSize>(outShape[1]); column++) {
+                const double sourceColumn = (static_cast<double>(column) + 0.5) / 2 - 0.5;
+                if (!inside(sourceRow) || !inside(sourceColumn)) {
+                    continue;
+                }
+                for (tensorSize band = 0; band < static_cast<tensorSize>(bands); band++) {
+                    CHECK(std::abs(out->at(row, column, band) - plane(sourceRow, sourceColumn, band)) < 1e-3);
+                    checked++;
+                }
+            }
+        }
+        CHECK(checked > 0);
+    }
+
+    template <typename Coordinate>
+    constexpr bool warpsWith = requires (const Tensor<float, Shape{4, 4}>& in, const Tensor<Coordinate, Shape{2, 2, 2}>& coordinates,
+                                         Tensor<float, Shape{2, 2}>& out) {
+        warp<Interpolation::Bilinear>(in, coordinates, out);
+    };
+}
+
+TEST_CASE("Resample, wrapping any distance beyond the edge", "[Resample]") {
+    STATIC_CHECK(Private::wrapIndex(Boundary::Periodic, -7, 3) == 2);
+    STATIC_CHECK(Private::wrapIndex(Boundary::Periodic, 7, 3) == 1);
+    STATIC_CHECK(Private::wrapIndex(Boundary::Neumann, -1, 3) == 0);
+    STATIC_CHECK(Private::wrapIndex(Boundary::Neumann, 4, 3) == 1);
+    STATIC_CHECK(Private::wrapIndex(Boundary::Neumann, 7, 3) == 1);
+    STATIC_CHECK(Private::wrapIndex(Boundary::Dirichlet, 3, 3) == -1);
+}
+
+TEST_CASE("Resample, nearest resize of any type", "[Resample]") {
+    Tensor<std::int16_t, Shape{2, 3}> labels ({{1, 2, 3}, {4, 5, 6}});
+    Tensor<std::int16_t, Shape{4, 6}> up;
+    resize<Interpolation::Nearest>(labels, up);
+    for (tensorSize row = 0; row < 4; row++) {
+        for (tensorSize column = 0; column < 6; column++) {
+            CHECK(up.at(row, column) == labels.at(row / 2, column / 2));
+        }
+    }
+
+    // The pixel under each output centre
+    Tensor<std::int16_t, Shape{2, 3}> down;
+    resize<Interpolation::Nearest>(up, down);
+    for (tensorSize i = 0; i < down.size(); i++) {
+        CHECK(down.data()[i] == labels.data()[i]);
+    }
+}
+
+TEST_CASE("Resample, the same grid is a copy", "[Resample]") {
+    Tensor<float, Shape{5, 4, 3}> in;
+    fillPlane(in);
+    Tensor<float, Shape{5, 4, 3}> bilinear;
+    Tensor<float, Shape{5, 4, 3}> bicubic;
+    resize<Interpolation::Bilinear>(in, bilinear);
+    resize<Interpolation::Bicubic>(in, bicubic);
+    for (tensorSize i = 0; i < in.size(); i++) {
+        CHECK(bilinear.data()[i] == in.data()[i]);
+        CHECK(bicubic.data()[i] == in.data()[i]);
+    }
+}
+
+TEST_CASE("Resample, bilinear halving averages each 2 x 2 block", "[Resample]") {
+    Tensor<double, Shape{4, 6}> in ({{1, 2, 3, 4, 5, 6}, {7, 8, 9, 10, 11, 12}, {0, 0, 4, 4, 8, 8}, {2, 2, 0, 0, 0, 8}});
+    Tensor<double, Shape{2, 3}> out;
+    resize<Interpolation::Bilinear>(in, out);
+    CHECK(out.at(0, 0) == 4.5);
+    CHECK(out.at(0, 2) == 8.5);
+    CHECK(out.at(1, 1) == 2);
+    CHECK(out.at(1, 2) == 6);
+}
+
+TEST_CASE("Resample, upsampling reproduces a plane", "[Resample]") {
+    // A few bands blended one at a time, and enough for SIMD blending and several threads
+    checkPlane<Interpolation::Bilinear, float, 8, 3>();
+    checkPlane<Interpolation::Bicubic, float, 8, 3>();
+    checkPlane<Interpolation::Bilinear, double, 32, 20>();
+    checkPlane<Interpolation::Bicubic, float, 32, 20>();
+}
+
+TEST_CASE("Resample, warping by a coordinate map", "[Resample]") {
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    Tensor<float, Shape{4, 4, 2}> in;
+    fillPlane(in);
+    // Identity, half a pixel to the right, beyond the right edge, and not mapped
+    Tensor<double, Shape{2, 2, 2}> coordinates ({{{1, 2}, {1, 1.5}}, {{2, 5}, {nan, 1}}});
+    Tensor<float, Shape{2, 2, 2}> bilinear;
+    Tensor<float, Shape{2, 2, 2}> bicubic;
+    warp<Interpolation::Bilinear>(in, coordinates, bilinear, -1.0f);
+    warp<Interpolation::Bicubic>(in, coordinates, bicubic, -1.0f);
+    for (tensorSize band = 0; band < 2; band++) {
+        CHECK(bilinear.at(0, 0, band) == in.at(1, 2, band));
+        CHECK(bicubic.at(0, 0, band) == in.at(1, 2, band));
+        CHECK(bilinear.at(0, 1, band) == static_cast<float>(plane(1, 1.5, band)));
+        CHECK(std::abs(bicubic.at(0, 1, band) - plane(1, 1.5, band)) < 1e-4);
+        CHECK(bilinear.at(1, 0, band) == -1);
+        CHECK(bilinear.at(1, 1, band) == -1);
+        CHECK(bicubic.at(1, 1, band) == -1);
+    }
+
+    // Wrapped round, and a nearest warp of labels
+    Tensor<float, Shape{1, 1, 2}> wrapped;
+    Tensor<float, Shape{1, 1, 2}> beyond ({{{1, 6}}});
+    warp<Interpolation::Bilinear, Boundary::Periodic>(in, beyond, wrapped);
+    CHECK(wrapped.at(0, 0, 1) == in.at(1, 2, 1));
+
+    Tensor<std::uint8_t, Shape{2, 2}> labels ({{1, 2}, {3, 4}});
+    Tensor<float, Shape{2, 2, 2}> nearest ({{{0.4f, 0.6f}, {-3, 0}}, {{1.2f, -0.2f}, {0, 0}}});
+    Tensor<std::uint8_t, Shape{2, 2}> picked;
+    warp<Interpolation::Nearest>(labels, nearest, picked, std::uint8_t {255});
+    CHECK(picked.at(0, 0) == 2);
+    CHECK(picked.at(0, 1) == 255);
+    CHECK(picked.at(1, 0) == 3);
+    CHECK(picked.at(1, 1) == 1);
+
+    // Only the coordinate types the kernels take
+    STATIC_CHECK(warpsWith<float>);
+    STATIC_CHECK(warpsWith<double>);
+    STATIC_CHECK_FALSE(warpsWith<long double>);
+}
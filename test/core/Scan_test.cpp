@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Half.h"
+#include "TensorII/Scan.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    // Small integers, so float sums are exact in any order
+    template <typename DType, auto shape>
+    void fill(Tensor<DType, shape>& tensor, unsigned seed) {
+        std::mt19937 generator (seed);
+        std::uniform_int_distribution<int> distribution (-9, 9);
+        for (tensorSize i = 0; i < tensor.size(); i++) {
+            tensor.data()[i] = static_cast<DType>(distribution(generator));
+        }
+    }
+
+    template <tensorRank axis, typename DType, auto shape>
+    void checkCumsum() {
+        Tensor<DType, shape> in, out;
+        fill(in, 1);
+        cumsum<axis>(in, out);
+
+        tensorSize outer = 1, inner = 1;
+        for (tensorRank i = 0; i < shape.rank(); i++) {
+            (i < axis ? outer : inner) *= i == axis ? 1 : static_cast<tensorSize>(shape[i]);
+        }
+        const auto n = static_cast<tensorSize>(shape[axis]);
+        for (tensorSize o = 0; o < outer; o++) {
+            for (tensorSize l = 0; l < inner; l++) {
+                DType running {};
+                for (tensorSize k = 0; k < n; k++) {
+                    const tensorSize i = (o * n + k) * inner + l;
+                    running += in.data()[i];
+                    CHECK(out.data()[i] == running);
+                }
+            }
+        }
+
+        cumsum<axis>(in);
+        for (tensorSize i = 0; i < in.size(); i++) {
+            CHECK(in.data()[i] == out.data()[i]);
+        }
+    }
+}
+
+TEST_CASE("Scan, cumulative sums along every axis", "[Scan]") {
+    // Rows longer than a vector with a tail, and more neighbouring sequences than one block
+    constexpr Shape<3> shape {3, 70, 37};
+    checkCumsum<0, float, shape>();
+    checkCumsum<1, float, shape>();
+    checkCumsum<2, float, shape>();
+    checkCumsum<2, double, shape>();
+    checkCumsum<1, int, shape>();
+    checkCumsum<0, double, Shape{1000}>();
+}
+
+TEST_CASE("Scan, products and other associative operations", "[Scan]") {
+    Tensor<int, Shape{2, 4}> in ({{1, 2, 3, 4}, {-1, 5, 2, 0}}), out;
+    cumprod<1>(in, out);
+    CHECK(std::ranges::equal(std::vector<int>(out.data(), out.data() + 8), std::vector {1, 2, 6, 24, -1, -5, -10, 0}));
+    scan<1>(in, out, [](int a, int b) { return std::max(a, b); });
+    CHECK(std::ranges::equal(std::vector<int>(out.data(), out.data() + 8), std::vector {1, 2, 3, 4, -1, 5, 5, 5}));
+    scan<0>(in, std::multiplies<>());
+    CHECK(std::ranges::equal(std::vector<int>(in.data(), in.data() + 8), std::vector {1, 2, 3, 4, -1, 10, 6, 0}));
+
+    // Carried in float, so the running sum isn't stuck where adding 1 no longer changes a half
+    Tensor<float16, Shape{3000}> ones, sums;
+    std::fill_n(ones.data(), ones.size(), float16(1.0f));
+    cumsum<0>(ones, sums);
+    CHECK(static_cast<float>(sums.data()[2999]) == 3000.0f);
+
+    constexpr auto compileTime = [] {
+        Tensor<int, Shape{2, 3}> tensor ({{1, 2, 3}, {4, 5, 6}});
+        cumsum<0>(tensor);
+        cumprod<1>(tensor);
+        return tensor.at(1, 2);
+    };
+    STATIC_CHECK(compileTime() == 5 * 7 * 9);
+}
+
+TEST_CASE("Scan, a long sequence split into chunks", "[Scan]") {
+    std::vector<double> in (10007), out (in.size());
+    std::mt19937 generator (2);
+    std::uniform_int_distribution<int> distribution (-9, 9);
+    std::ranges::generate(in, [&] { return distribution(generator); });
+    Private::scanSplit<double>(in.data(), out.data(), in.size(), 5, std::plus<>());
+    double running = 0;
+    for (tensorSize i = 0; i < in.size(); i++) {
+        running += in[i];
+        CHECK(out[i] == running);
+    }
+}
+
+TEST_CASE("Scan, a long reduced float sequence split into chunks", "[Scan]") {
+    // Past where a half or bfloat16 holds every integer, so any partial sum rounded before the chunk offsets are
+    // added on shows up against the exact reference
+    std::vector<int> values (10007);
+    std::mt19937 generator (3);
+    std::uniform_int_distribution<int> distribution (0, 9);
+    std::ranges::generate(values, [&] { return distribution(generator); });
+    std::vector<float16> halves (values.size()), halfSums (values.size());
+    std::vector<bfloat16> bfloats (values.size()), bfloatSums (values.size());
+    std::ranges::transform(values, halves.begin(), [](int value) { return float16(static_cast<float>(value)); });
+    std::ranges::transform(values, bfloats.begin(), [](int value) { return bfloat16(static_cast<float>(value)); });
+    Private::scanSplit<float>(halves.data(), halfSums.data(), values.size(), 5, std::plus<>());
+    Private::scanSplit<float>(bfloats.data(), bfloatSums.data(), values.size(), 5, std::plus<>());
+    double running = 0;
+    for (tensorSize i = 0; i < values.size(); i++) {
+        running += values[i];
+        CHECK(static_cast<float>(halfSums[i]) == static_cast<float>(float16(static_cast<float>(running))));
+        CHECK(static_cast<float>(bfloatSums[i]) == static_cast<float>(bfloat16(static_cast<float>(running))));
+    }
+}
@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Sort.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    template <typename DType, auto shape>
+    void randomFill(Tensor<DType, shape>& tensor, unsigned seed) {
+        std::mt19937 generator (seed);
+        // Few distinct values, so there are ties to keep in order
+        std::uniform_int_distribution<int> distribution (-20, 20);
+        for (tensorSize i = 0; i < tensor.size(); i++) {
+            tensor.data()[i] = static_cast<DType>(distribution(generator)) / 4;
+        }
+    }
+
+    // Every sequence along the axis against std::stable_sort of its own copy
+    template <typename DType, tensorRank axis, auto shape>
+    void checkAlong() {
+        auto in = std::make_unique<Tensor<DType, shape>>();
+        randomFill(*in, static_cast<unsigned>(shape[axis]));
+        auto sorted = std::make_unique<Tensor<DType, shape>>();
+        auto indices = std::make_unique<Tensor<std::int32_t, shape>>();
+        sort<axis>(*in, *sorted);
+        argsort<axis>(*in, *indices);
+        constexpr tensorSize top = 3;
+        auto values = std::make_unique<Tensor<DType, Private::withExtent<shape, axis, top>()>>();
+        auto positions = std::make_unique<Tensor<std::int64_t, Private::withExtent<shape, axis, top>()>>();
+        topk<top, axis>(*in, *values, *positions);
+
+        constexpr auto n = static_cast<tensorSize>(shape[axis]);
+        for (tensorSize sequence = 0; sequence < static_cast<tensorSize>(shape[1 - axis]); sequence++) {
+            const auto at = [&](tensorSize k) -> std::array<tensorSize, 2> {
+                return axis == 0 ? std::array<tensorSize, 2> {k, sequence} : std::array<tensorSize, 2> {sequence, k};
+            };
+            std::vector<std::pair<DType, tensorSize>> expected;
+            for (tensorSize k = 0; k < n; k++) {
+                expected.emplace_back(in->at(at(k)[0], at(k)[1]), k);
+            }
+            std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+            for (tensorSize k = 0; k < n; k++) {
+                CHECK(sorted->at(at(k)[0], at(k)[1]) == expected[k].first);
+                CHECK(static_cast<tensorSize>(indices->at(at(k)[0], at(k)[1])) == expected[k].second);
+            }
+            std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+            for (tensorSize k = 0; k < top; k++) {
+                CHECK(values->at(at(k)[0], at(k)[1]) == expected[k].first);
+                CHECK(static_cast<tensorSize>(positions->at(at(k)[0], at(k)[1])) == expected[k].second);
+            }
+        }
+    }
+
+    template <typename DType>
+    void checkNaNs() {
+        constexpr DType nan = std::numeric_limits<DType>::quiet_NaN();
+        constexpr DType infinity = std::numeric_limits<DType>::infinity();
+        Tensor<DType, Shape{2, 5}> in ({{nan, 1, infinity, nan, -infinity}, {2, nan, 2, 1, infinity}});
+        Tensor<DType, Shape{2, 5}> sorted;
+        sort<1>(in, sorted);
+        CHECK(sorted.at(0, 0) == -infinity);
+        CHECK(sorted.at(0, 1) == 1);
+        CHECK(sorted.at(0, 2) == infinity);
+        CHECK(std::isnan(sorted.at(0, 3)));
+        CHECK(std::isnan(sorted.at(0, 4)));
+        CHECK(sorted.at(1, 3) == infinity);
+        CHECK(std::isnan(sorted.at(1, 4)));
+
+        Tensor<int, Shape{2, 5}> indices;
+        argsort<1>(in, indices);
+        const std::array<int, 10> expectedIndices {4, 1, 2, 0, 3, 3, 0, 2, 4, 1};
+        CHECK(std::equal(expectedIndices.begin(), expectedIndices.end(), indices.data()));
+
+        Tensor<DType, Shape{2, 4}> values;
+        Tensor<int, Shape{2, 4}> positions;
+        topk<4, 1>(in, values, positions);
+        const std::array<int, 8> expectedPositions {2, 1, 4, 0, 4, 0, 2, 3};
+        CHECK(std::equal(expectedPositions.begin(), expectedPositions.end(), positions.data()));
+        CHECK(values.at(0, 2) == -infinity);
+        CHECK(std::isnan(values.at(0, 3)));
+    }
+}
+
+TEST_CASE("Sort, sort, argsort and topk at compile time", "[Sort]") {
+    constexpr auto results = [] {
+        Tensor<int, Shape{2, 4}> in ({{3, 1, 3, 0}, {7, 9, 8, 9}});
+        Tensor<int, Shape{2, 4}> sorted;
+        sort<1>(in, sorted);
+        Tensor<int, Shape{2, 4}> indices;
+        argsort<1>(in, indices);
+        Tensor<int, Shape{2, 2}> values;
+        Tensor<long, Shape{2, 2}> positions;
+        topk<2, 1>(in, values, positions);
+        sort<0>(in);
+        return std::array<long, 10> {sorted.at(0, 0), sorted.at(1, 3), indices.at(0, 2), indices.at(0, 3),
+                                     values.at(1, 0), positions.at(1, 0), positions.at(1, 1), positions.at(0, 1),
+                                     in.at(0, 3), in.at(1, 0)};
+    }();
+    STATIC_CHECK(results == std::array<long, 10> {0, 9, 0, 2, 9, 1, 3, 2, 0, 7});
+}
+
+TEST_CASE("Sort, topk's shape is the input's with k along the axis", "[Sort]") {
+    STATIC_CHECK(Private::withExtent<Shape{8, 6, 5}, 1, 2>() == Shape{8, 2, 5});
+}
+
+TEST_CASE("Sort, networks of every length along either axis", "[Sort]") {
+    // Under a vector, exactly one, a partial group of sequences, and the longest a network sorts
+    checkAlong<float, 1, Shape{21, 5}>();
+    checkAlong<float, 0, Shape{16, 19}>();
+    checkAlong<double, 1, Shape{33, 37}>();
+    checkAlong<double, 0, Shape{64, 3}>();
+    checkAlong<float, 1, Shape{7, 64}>();
+}
+
+TEST_CASE("Sort, comparison sorts of longer sequences and other types", "[Sort]") {
+    checkAlong<float, 1, Shape{3, 65}>();
+    checkAlong<double, 0, Shape{200, 4}>();
+    checkAlong<int, 1, Shape{5, 30}>();
+    checkAlong<std::int16_t, 0, Shape{9, 2}>();
+}
+
+TEST_CASE("Sort, NaNs go last", "[Sort]") {
+    checkNaNs<float>();
+    checkNaNs<double>();
+    checkNaNs<float16>();
+    checkNaNs<bfloat16>();
+}
+
+TEST_CASE("Sort, a single long sequence", "[Sort]") {
+    constexpr Shape<1> shape {40000};
+    auto data = std::make_unique<Tensor<float, shape>>();
+    randomFill(*data, 3);
+    std::vector<float> expected (data->data(), data->data() + shape.n_elems());
+    auto indices = std::make_unique<Tensor<std::int32_t, shape>>();
+    argsort<0>(*data, *indices);
+    Tensor<float, Shape{4}> values;
+    Tensor<std::int32_t, Shape{4}> positions;
+    topk<4, 0>(*data, values, positions);
+    sort<0>(*data);
+
+    std::stable_sort(expected.begin(), expected.end());
+    CHECK(std::equal(expected.begin(), expected.end(), data->data()));
+    bool stable = true;
+    for (tensorSize i = 1; i < shape.n_elems(); i++) {
+        const auto previous = indices->data()[i - 1];
+        const auto current = indices->data()[i];
+        stable = stable && data->data()[i - 1] <= data->data()[i] && (data->data()[i - 1] < data->data()[i] || previous < current);
+    }
+    CHECK(stable);
+    CHECK(values.at(0) == 5);
+    CHECK(values.at(3) == 5);
+    CHECK(positions.at(0) < positions.at(1));
+}
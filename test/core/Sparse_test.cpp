@@ -0,0 +1,142 @@
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Sparse.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    // About a fifth nonzero, with every third row left empty
+    template <typename DType, auto shape>
+    void fillSparse(Tensor<DType, shape>& tensor, unsigned seed) {
+        std::mt19937 generator (seed);
+        std::uniform_int_distribution<int> distribution (-20, 20);
+        const tensorSize rowLength = shape.n_elems() / static_cast<tensorSize>(shape[0]);
+        for (tensorSize i = 0; i < tensor.size(); i++) {
+            const int value = distribution(generator);
+            tensor.data()[i] = (i / rowLength) % 3 == 1 || value % 5 != 0 ? DType {} : static_cast<DType>(value);
+        }
+    }
+
+    template <typename DType, auto shape>
+    void fillDense(Tensor<DType, shape>& tensor, unsigned seed) {
+        std::mt19937 generator (seed);
+        std::uniform_int_distribution<int> distribution (-8, 8);
+        for (tensorSize i = 0; i < tensor.size(); i++) {
+            tensor.data()[i] = static_cast<DType>(distribution(generator));
+        }
+    }
+
+    // Integer-valued inputs keep every product exact, so float sums in any order agree
+    template <typename DType, auto sparseShape, auto denseShape, auto outShape>
+    void checkContraction() {
+        Tensor<DType, sparseShape> matrix;
+        Tensor<DType, denseShape> dense;
+        Tensor<DType, outShape> out, expected;
+        fillSparse(matrix, 1);
+        fillDense(dense, 2);
+
+        const tensorSize rows = static_cast<tensorSize>(sparseShape[0]);
+        const tensorSize inner = sparseShape.n_elems() / rows;
+        const tensorSize n = denseShape.n_elems() / inner;
+        for (tensorSize row = 0; row < rows; row++) {
+            for (tensorSize j = 0; j < n; j++) {
+                DType total {};
+                for (tensorSize k = 0; k < inner; k++) {
+                    total += matrix.data()[row * inner + k] * dense.data()[k * n + j];
+                }
+                expected.data()[row * n + j] = total;
+            }
+        }
+
+        CsrTensor<DType, sparseShape> sparse;
+        sparsify(matrix, sparse);
+        contract(sparse, dense, out);
+        for (tensorSize i = 0; i < out.size(); i++) {
+            CHECK(out.data()[i] == expected.data()[i]);
+        }
+    }
+}
+
+TEST_CASE("Sparse, dense round trips", "[Sparse]") {
+    constexpr Shape<3> shape {6, 4, 5};
+    Tensor<float, shape> dense, back;
+    fillSparse(dense, 3);
+
+    CooTensor<float, shape> coo;
+    sparsify(dense, coo);
+    CsrTensor<float, shape> fromDense, fromCoo;
+    sparsify(dense, fromDense);
+    compress(coo, fromCoo);
+    CHECK(coo.nonzeros() == fromDense.nonzeros());
+    CHECK(fromCoo.rowOffsets() == fromDense.rowOffsets());
+    CHECK(fromCoo.columnIndices() == fromDense.columnIndices());
+    CHECK(fromCoo.values() == fromDense.values());
+    CHECK(fromDense.at(0, 2, 3) == dense.at(0, 2, 3));
+    CHECK(fromDense.at(1, 2, 3) == 0);
+
+    densify(coo, back);
+    for (tensorSize i = 0; i < dense.size(); i++) {
+        CHECK(back.data()[i] == dense.data()[i]);
+    }
+    densify(fromCoo, back);
+    for (tensorSize i = 0; i < dense.size(); i++) {
+        CHECK(back.data()[i] == dense.data()[i]);
+    }
+}
+
+TEST_CASE("Sparse, compressing sorts entries and sums repeats", "[Sparse]") {
+    CooTensor<double, Shape{3, 4}> coo;
+    coo.insert(1.0, 2, 3);
+    coo.insert(2.0, 0, 1);
+    coo.insert(4.0, 2, 0);
+    coo.insert(8.0, 0, 1);
+
+    CsrTensor<double, Shape{3, 4}> csr;
+    compress(coo, csr);
+    CHECK(csr.nonzeros() == 3);
+    CHECK(csr.rowOffsets() == std::vector<tensorSize> {0, 1, 1, 3});
+    CHECK(csr.columnIndices() == std::vector<uint32_t> {1, 0, 3});
+    CHECK(csr.at(0, 1) == 10.0);
+    CHECK(csr.at(2, 0) == 4.0);
+    CHECK(csr.at(1, 1) == 0.0);
+
+    CHECK_THROWS_AS((CsrTensor<double, Shape{3, 4}>({0, 1, 1}, {1}, {1.0})), std::invalid_argument);
+    CHECK_THROWS_AS((CsrTensor<double, Shape{3, 4}>({0, 2, 2, 2}, {3, 1}, {1.0, 2.0})), std::invalid_argument);
+    CHECK_THROWS_AS((CsrTensor<double, Shape{3, 4}>({0, 1, 1, 1}, {4}, {1.0})), std::invalid_argument);
+}
+
+TEST_CASE("Sparse, coordinates outside the tensor are refused", "[Sparse]") {
+    CooTensor<double, Shape{3, 4}> coo;
+    coo.insert(1.0, 2, 3);
+    // A column past the end would otherwise land in the next row once compressed
+    CHECK_THROWS_AS(coo.insert(2.0, 0, 4), std::out_of_range);
+    CHECK_THROWS_AS(coo.insert(2.0, 3, 0), std::out_of_range);
+    CHECK_THROWS_AS(coo.insert(2.0, -1, 0), std::out_of_range);
+    CHECK(coo.nonzeros() == 1);
+
+    CsrTensor<double, Shape{3, 4}> csr;
+    compress(coo, csr);
+    CHECK(csr.at(2, 3) == 1.0);
+    CHECK(csr.at(1, 0) == 0.0);
+}
+
+TEST_CASE("Sparse, contraction matches a dense product", "[Sparse]") {
+    checkContraction<float, Shape{37, 29}, Shape{29}, Shape{37}>();
+    checkContraction<double, Shape{37, 29}, Shape{29}, Shape{37}>();
+    checkContraction<float, Shape{37, 29}, Shape{29, 21}, Shape{37, 21}>();
+    checkContraction<double, Shape{9, 4, 5}, Shape{4, 5, 3, 2}, Shape{9, 3, 2}>();
+    checkContraction<int, Shape{37, 29}, Shape{29, 6}, Shape{37, 6}>();
+
+    CsrTensor<float, Shape{4, 3}> empty;
+    Tensor<float, Shape{3, 2}> dense;
+    Tensor<float, Shape{4, 2}> out;
+    fillDense(dense, 4);
+    std::fill_n(out.data(), out.size(), 1.0f);
+    contract(empty, dense, out);
+    for (tensorSize i = 0; i < out.size(); i++) {
+        CHECK(out.data()[i] == 0.0f);
+    }
+}
@@ -0,0 +1,186 @@
+#include <cmath>
+#include <memory>
+#include <random>
+
+#include "Catch2/catch_test_macros.hpp"
+#include "TensorII/Stencil.h"
+
+using namespace TensorII::Core;
+
+namespace {
+    // Direct evaluation of every point of every element, resolving each index against the boundary
+    template <auto stencil, Boundary boundary, auto shape>
+    void naiveStencil(const Tensor<double, shape>& in, Tensor<double, shape>& out, double boundaryValue) {
+        constexpr tensorRank rank = shape.rank();
+        std::array<tensorIndex, rank> index {};
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            double total = 0;
+            for (tensorSize point = 0; point < stencil.points(); point++) {
+                tensorSize flat = 0;
+                bool outside = false;
+                for (tensorRank axis = 0; axis < rank; axis++) {
+                    const tensorIndex extent = shape[axis];
+                    tensorIndex j = index[axis] + stencil.offsets[point][axis];
+                    if (j < 0 || j >= extent) {
+                        if (boundary == Boundary::Periodic) {
+                            j = (j + extent) % extent;
+                        } else if (boundary == Boundary::Neumann) {
+                            j = j < 0 ? -1 - j : 2 * extent - 1 - j;
+                        } else {
+                            outside = true;
+                        }
+                    }
+                    flat = flat * static_cast<tensorSize>(extent) + static_cast<tensorSize>(outside ? 0 : j);
+                }
+                total += stencil.coefficients[point] * (outside ? boundaryValue : in.data()[flat]);
+            }
+            out.data()[i] = total;
+            for (tensorRank axis = rank; axis-- > 0; ) {
+                if (++index[axis] < shape[axis]) {
+                    break;
+                }
+                index[axis] = 0;
+            }
+        }
+    }
+
+    template <auto shape>
+    std::unique_ptr<Tensor<double, shape>> randomGrid() {
+        std::mt19937_64 generator (7);
+        std::uniform_real_distribution<double> distribution (-1.0, 1.0);
+        auto grid = std::make_unique<Tensor<double, shape>>();
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            grid->data()[i] = distribution(generator);
+        }
+        return grid;
+    }
+
+    template <auto shape>
+    bool near(const Tensor<double, shape>& a, const Tensor<double, shape>& b) {
+        for (tensorSize i = 0; i < shape.n_elems(); i++) {
+            const double difference = a.data()[i] - b.data()[i];
+            if (difference > 1e-12 || difference < -1e-12) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <auto stencil, Boundary boundary, auto shape>
+    void checkAgainstNaive(double boundaryValue) {
+        auto in = randomGrid<shape>();
+        auto expected = std::make_unique<Tensor<double, shape>>();
+        auto actual = std::make_unique<Tensor<double, shape>>();
+        naiveStencil<stencil, boundary>(*in, *expected, boundaryValue);
+        applyStencil<stencil, boundary>(*in, *actual, boundaryValue);
+        CHECK(near(*expected, *actual));
+    }
+
+    template <auto stencil, Boundary boundary, tensorSize timeBlock, auto shape>
+    void checkIterate(tensorSize steps, double boundaryValue) {
+        auto expected = randomGrid<shape>();
+        auto field = randomGrid<shape>();
+        auto scratch = std::make_unique<Tensor<double, shape>>();
+        for (tensorSize step = 0; step < steps; step++) {
+            applyStencil<stencil, boundary>(*expected, *scratch, boundaryValue);
+            std::swap(*expected, *scratch);
+        }
+        iterateStencil<stencil, boundary, timeBlock>(*field, *scratch, steps, boundaryValue);
+        CHECK(near(*expected, *field));
+    }
+
+    constexpr auto laplacian1 = Stencils::laplacian<1>();
+    constexpr auto laplacian2 = Stencils::laplacian<2>(0.5);
+    constexpr auto laplacian3 = Stencils::laplacian<3>();
+    constexpr auto box3 = Stencils::dense<3, 1>([] {
+        std::array<double, 27> weights {};
+        for (tensorSize i = 0; i < weights.size(); i++) {
+            weights[i] = static_cast<double>(i) / 27.0 - 0.5;
+        }
+        return weights;
+    }());
+    // Radius 2 along the innermost axis only, to exercise rows narrower than the stencil's interior
+    constexpr Stencil<2, 3> wide {{{{0, 0}, {0, -2}, {1, 2}}}, {1.0, 0.25, -0.5}};
+}
+
+TEST_CASE("Stencil factories", "[Stencil]") {
+    STATIC_CHECK(laplacian3.points() == 7);
+    STATIC_CHECK(laplacian3.radius() == 1);
+    STATIC_CHECK(laplacian2.coefficients[0] == -16.0);
+    STATIC_CHECK(laplacian2.coefficients[4] == 4.0);
+    STATIC_CHECK(box3.points() == 27);
+    STATIC_CHECK(box3.offsets[0] == std::array<tensorIndex, 3> {-1, -1, -1});
+    STATIC_CHECK(box3.offsets[5] == std::array<tensorIndex, 3> {-1, 0, 1});
+    STATIC_CHECK(box3.offsets[13] == std::array<tensorIndex, 3> {0, 0, 0});
+    STATIC_CHECK(wide.radius() == 2);
+}
+
+TEST_CASE("Laplacian of a quadratic is constant in the interior", "[Stencil]") {
+    constexpr Shape<2> shape {12, 17};
+    Tensor<double, shape> in, out;
+    for (tensorSize i = 0; i < 12; i++) {
+        for (tensorSize j = 0; j < 17; j++) {
+            const auto x = static_cast<double>(i) * 0.5, y = static_cast<double>(j) * 0.5;
+            in.at(i, j) = x * x + 3 * y * y;
+        }
+    }
+    applyStencil<laplacian2>(in, out);
+    for (tensorSize i = 1; i < 11; i++) {
+        for (tensorSize j = 1; j < 16; j++) {
+            REQUIRE(std::abs(out.at(i, j) - 8.0) < 1e-9);
+        }
+    }
+}
+
+TEST_CASE("applyStencil matches direct evaluation", "[Stencil]") {
+    SECTION("Dirichlet") {
+        checkAgainstNaive<laplacian1, Boundary::Dirichlet, Shape<1>{37}>(2.0);
+        checkAgainstNaive<laplacian2, Boundary::Dirichlet, Shape<2>{9, 41}>(-1.5);
+        checkAgainstNaive<laplacian3, Boundary::Dirichlet, Shape<3>{6, 7, 35}>(3.0);
+        checkAgainstNaive<box3, Boundary::Dirichlet, Shape<3>{5, 8, 19}>(0.5);
+        checkAgainstNaive<wide, Boundary::Dirichlet, Shape<2>{4, 3}>(1.0);
+    }
+    SECTION("Periodic") {
+        checkAgainstNaive<laplacian1, Boundary::Periodic, Shape<1>{37}>(0);
+        checkAgainstNaive<laplacian2, Boundary::Periodic, Shape<2>{9, 41}>(0);
+        checkAgainstNaive<laplacian3, Boundary::Periodic, Shape<3>{6, 7, 35}>(0);
+        checkAgainstNaive<box3, Boundary::Periodic, Shape<3>{1, 8, 19}>(0);
+        checkAgainstNaive<wide, Boundary::Periodic, Shape<2>{4, 3}>(0);
+    }
+    SECTION("Neumann") {
+        checkAgainstNaive<laplacian1, Boundary::Neumann, Shape<1>{37}>(0);
+        checkAgainstNaive<laplacian2, Boundary::Neumann, Shape<2>{9, 41}>(0);
+        checkAgainstNaive<laplacian3, Boundary::Neumann, Shape<3>{6, 7, 35}>(0);
+        checkAgainstNaive<box3, Boundary::Neumann, Shape<3>{5, 1, 19}>(0);
+        checkAgainstNaive<wide, Boundary::Neumann, Shape<2>{4, 2}>(0);
+    }
+}
+
+TEST_CASE("iterateStencil matches repeated application", "[Stencil]") {
+    SECTION("Temporally blocked") {
+        checkIterate<laplacian2, Boundary::Dirichlet, 4, Shape<2>{23, 30}>(9, 1.0);
+        checkIterate<laplacian3, Boundary::Neumann, 3, Shape<3>{11, 6, 20}>(7, 0);
+        checkIterate<box3, Boundary::Dirichlet, 4, Shape<3>{9, 5, 17}>(8, 0.25);
+        checkIterate<wide, Boundary::Neumann, 5, Shape<2>{13, 8}>(12, 0);
+        // More steps in a block than there are planes
+        checkIterate<laplacian2, Boundary::Dirichlet, 8, Shape<2>{3, 10}>(11, 0);
+    }
+    SECTION("Stepwise") {
+        checkIterate<laplacian1, Boundary::Dirichlet, 4, Shape<1>{50}>(6, 1.0);
+        checkIterate<laplacian3, Boundary::Periodic, 4, Shape<3>{7, 6, 20}>(5, 0);
+        checkIterate<laplacian2, Boundary::Neumann, 1, Shape<2>{10, 12}>(3, 0);
+    }
+    SECTION("No steps") {
+        checkIterate<laplacian2, Boundary::Dirichlet, 4, Shape<2>{10, 12}>(0, 0);
+    }
+}
+
+TEST_CASE("applyStencil at compile time", "[Stencil]") {
+    constexpr auto result = [] {
+        Tensor<int, Shape<2>{3, 4}> in {{{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}}};
+        Tensor<int, Shape<2>{3, 4}> out;
+        applyStencil<Stencils::laplacian<2>(), Boundary::Periodic>(in, out);
+        return std::array {out.at(0, 0), out.at(1, 1), out.at(2, 3)};
+    }();
+    STATIC_CHECK(result == std::array {16, 0, -16});
+}
@@ -40,6 +40,26 @@ TEST_CASE("Tensor Initialization", "[Tensor][Init]"){
     CHECK(memcmp(t5.data(), expected, 5) == 0);
 }
 
+TEST_CASE("Tensor Constexpr Initialization", "[Tensor][Init]"){
+    constexpr Tensor<int, Shape{}> t0 (1);
+    STATIC_CHECK(*t0.data() == 1);
+
+    constexpr Tensor<int, Shape{2, 3}> t2 ({{1, 2, 3},
+                                            {4, 5, 6}});
+    STATIC_CHECK(t2.data()[0] == 1);
+    STATIC_CHECK(t2.data()[5] == 6);
+
+    constexpr Tensor t3 = toTensor<int>({
+                                        {{1 , 2 , 3 }, {4 , 5 , 6 }},
+                                        {{7 , 8 , 9 }, {10, 11, 12}}
+                                        });
+    STATIC_CHECK(t3.data()[3] == 4);
+    STATIC_CHECK(t3.data()[11] == 12);
+
+    constexpr Tensor t5 = toTensor<int> ({{{{1, 2, 3, 4, 5}}}});
+    STATIC_CHECK(t5.data()[4] == 5);
+}
+
 TEST_CASE("Tensor ToTensor", "[Tensor][Init]"){
     Tensor u0 = Tensor<int, Shape{}> (1); // NOLINT(modernize-use-auto)
     Tensor t0 = toTensor<int>(1);
@@ -5,4 +5,26 @@ set(SOURCES
         AnyShape_test.cpp
         TensorView_test.cpp
         TensorIndex_test.cpp
+        Instrumentation_test.cpp
+        PerfCounters_test.cpp
+        Half_test.cpp
+        Operations_test.cpp
+        Quantized_test.cpp
+        Layout_test.cpp
+        Stencil_test.cpp
+        Convolution_test.cpp
+        FFT_test.cpp
+        Complex_test.cpp
+        Sparse_test.cpp
+        Scan_test.cpp
+        Graph_test.cpp
+        Async_test.cpp
+        Pipeline_test.cpp
+        Einstein_test.cpp
+        Mask_test.cpp
+        Gather_test.cpp
+        Sort_test.cpp
+        Headers_test.cpp
+        Histogram_test.cpp
+        Resample_test.cpp
         )
\ No newline at end of file